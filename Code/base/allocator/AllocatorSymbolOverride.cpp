@@ -1,21 +1,82 @@
 // Purposefully in no namespace.
 
 #include <TiltedCore/Allocator.hpp>
+#include <base/allocator/TrackingAllocator.h>
+
+// The backend is picked with the "allocator" build option
+#if defined(TP_ALLOCATOR_MIMALLOC)
+#include <mimalloc.h>
+#elif defined(TP_ALLOCATOR_SLAB)
+#include <base/allocator/SlabAllocator.h>
+#endif
+
+namespace
+{
+// Subsystem charged for what operator new hands out on this thread, see Base::AllocationScope
+thread_local Base::TrackingAllocator* s_pAllocationTag = nullptr;
+} // namespace
 
 // not private cause thse can be referenced as external symbols
 void* TiltedAlloc(const size_t acSize)
 {
+#if defined(TP_ALLOCATOR_MIMALLOC)
+    return mi_malloc(acSize);
+#elif defined(TP_ALLOCATOR_SLAB)
+    return Base::SlabAllocator::Get().Allocate(acSize);
+#else
     return TiltedPhoques::Allocator::GetDefault()->Allocate(acSize);
+#endif
 }
 
 void TiltedFree(void* apBlock)
 {
+#if defined(TP_ALLOCATOR_MIMALLOC)
+    mi_free(apBlock);
+#elif defined(TP_ALLOCATOR_SLAB)
+    Base::SlabAllocator::Get().Free(apBlock);
+#else
     TiltedPhoques::Allocator::GetDefault()->Free(apBlock);
+#endif
+}
+
+namespace Base
+{
+const char* GetAllocatorBackendName() noexcept
+{
+#if defined(TP_ALLOCATOR_MIMALLOC)
+    return "mimalloc";
+#elif defined(TP_ALLOCATOR_SLAB)
+    return "slab";
+#else
+    return "default";
+#endif
+}
+
+TrackingAllocator* GetAllocationTag() noexcept
+{
+    return s_pAllocationTag;
+}
+
+void SetAllocationTag(TrackingAllocator* apAllocator) noexcept
+{
+    s_pAllocationTag = apAllocator;
+}
+} // namespace Base
+
+namespace
+{
+void* TrackedAlloc(const size_t acSize)
+{
+    if (auto* pTag = s_pAllocationTag)
+        pTag->Charge(acSize);
+
+    return TiltedAlloc(acSize);
 }
+} // namespace
 
 void* operator new(size_t size)
 {
-    return TiltedAlloc(size);
+    return TrackedAlloc(size);
 }
 
 void operator delete(void* p) noexcept
@@ -25,7 +86,7 @@ void operator delete(void* p) noexcept
 
 void* operator new[](size_t size)
 {
-    return TiltedAlloc(size);
+    return TrackedAlloc(size);
 }
 
 void operator delete[](void* p) noexcept
@@ -35,12 +96,12 @@ void operator delete[](void* p) noexcept
 
 void* operator new(size_t size, const std::nothrow_t&) noexcept
 {
-    return TiltedAlloc(size);
+    return TrackedAlloc(size);
 }
 
 void* operator new[](size_t size, const std::nothrow_t&) noexcept
 {
-    return TiltedAlloc(size);
+    return TrackedAlloc(size);
 }
 
 void operator delete(void* p, const std::nothrow_t&) noexcept
@@ -0,0 +1,245 @@
+#include <base/allocator/SlabAllocator.h>
+
+#include <cstdlib>
+#include <new>
+
+namespace Base
+{
+namespace
+{
+constexpr std::array<size_t, SlabAllocator::kClassCount> kClassSizes{16, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+constexpr uint32_t kLargeClass = SlabAllocator::kClassCount;
+
+constexpr size_t kChunkSize = 64 * 1024;
+// Blocks moved between a thread cache and the shared list at once
+constexpr uint32_t kBatchSize = 32;
+constexpr uint32_t kMaxCachedBlocks = 4 * kBatchSize;
+
+// In front of every block, keeps the blocks 16 bytes aligned
+struct alignas(16) Header
+{
+    uint64_t Size;
+    uint32_t Class;
+};
+static_assert(sizeof(Header) == 16);
+
+constexpr auto kClassLookup = []
+{
+    // Indexed by the size in 16 byte steps, rounded up
+    std::array<uint8_t, SlabAllocator::kMaxBlockSize / 16 + 1> lookup{};
+    uint32_t sizeClass = 0;
+    for (size_t i = 0; i < lookup.size(); ++i)
+    {
+        while (kClassSizes[sizeClass] < i * 16)
+            ++sizeClass;
+        lookup[i] = static_cast<uint8_t>(sizeClass);
+    }
+    return lookup;
+}();
+
+struct ThreadCache
+{
+    std::array<void*, SlabAllocator::kClassCount> Heads{};
+    std::array<uint32_t, SlabAllocator::kClassCount> Counts{};
+    // Set once the thread started tearing down, blocks go straight to the shared lists after that
+    bool Released{false};
+};
+
+thread_local ThreadCache t_cache;
+
+struct ThreadCacheReleaser
+{
+    ~ThreadCacheReleaser() { SlabAllocator::Get().ReleaseThreadCache(); }
+};
+
+thread_local ThreadCacheReleaser t_releaser;
+
+Header* GetHeader(void* apData) noexcept
+{
+    return static_cast<Header*>(apData) - 1;
+}
+} // namespace
+
+SlabAllocator& SlabAllocator::Get() noexcept
+{
+    // Never destroyed, blocks are still freed by static destructors running after ours would
+    alignas(SlabAllocator) static uint8_t s_storage[sizeof(SlabAllocator)];
+    static auto* s_pAllocator = new (s_storage) SlabAllocator;
+    return *s_pAllocator;
+}
+
+void* SlabAllocator::Allocate(size_t aSize) noexcept
+{
+    if (aSize > kMaxBlockSize)
+    {
+        auto* pHeader = static_cast<Header*>(std::malloc(sizeof(Header) + aSize));
+        if (!pHeader)
+            return nullptr;
+
+        m_largeAllocations.fetch_add(1, std::memory_order_relaxed);
+        pHeader->Size = aSize;
+        pHeader->Class = kLargeClass;
+        return pHeader + 1;
+    }
+
+    const uint32_t cClass = kClassLookup[(aSize + 15) / 16];
+
+    auto& cache = t_cache;
+    auto* pBlock = static_cast<Block*>(cache.Heads[cClass]);
+    if (pBlock)
+    {
+        cache.Heads[cClass] = pBlock->pNext;
+        cache.Counts[cClass]--;
+    }
+    else
+    {
+        pBlock = Refill(cClass);
+        if (!pBlock)
+            return nullptr;
+    }
+
+    auto* pHeader = reinterpret_cast<Header*>(pBlock);
+    pHeader->Size = kClassSizes[cClass];
+    pHeader->Class = cClass;
+    return pHeader + 1;
+}
+
+void SlabAllocator::Free(void* apData) noexcept
+{
+    if (!apData)
+        return;
+
+    auto* pHeader = GetHeader(apData);
+    const auto cClass = pHeader->Class;
+
+    if (cClass == kLargeClass)
+    {
+        std::free(pHeader);
+        return;
+    }
+
+    auto* pBlock = reinterpret_cast<Block*>(pHeader);
+
+    auto& cache = t_cache;
+    if (cache.Released)
+    {
+        Release(cClass, pBlock, pBlock);
+        return;
+    }
+
+    // A thread that only frees never refills, its cache has to go back when it exits as well
+    (void)&t_releaser;
+
+    pBlock->pNext = static_cast<Block*>(cache.Heads[cClass]);
+    cache.Heads[cClass] = pBlock;
+
+    // Blocks freed by another thread than the one that allocated them pile up here, give some back
+    if (++cache.Counts[cClass] > kMaxCachedBlocks)
+    {
+        auto* pFirst = pBlock;
+        auto* pLast = pBlock;
+        for (uint32_t i = 1; i < kBatchSize; ++i)
+            pLast = pLast->pNext;
+
+        cache.Heads[cClass] = pLast->pNext;
+        cache.Counts[cClass] -= kBatchSize;
+        Release(cClass, pFirst, pLast);
+    }
+}
+
+size_t SlabAllocator::Size(void* apData) noexcept
+{
+    return apData ? GetHeader(apData)->Size : 0;
+}
+
+SlabAllocator::Stats SlabAllocator::GetStats() const noexcept
+{
+    Stats stats;
+    stats.ReservedBytes = m_reservedBytes.load(std::memory_order_relaxed);
+    stats.LargeAllocations = m_largeAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SlabAllocator::ReleaseThreadCache() noexcept
+{
+    auto& cache = t_cache;
+    cache.Released = true;
+
+    for (uint32_t i = 0; i < kClassCount; ++i)
+    {
+        auto* pFirst = static_cast<Block*>(cache.Heads[i]);
+        if (!pFirst)
+            continue;
+
+        auto* pLast = pFirst;
+        while (pLast->pNext)
+            pLast = pLast->pNext;
+
+        Release(i, pFirst, pLast);
+        cache.Heads[i] = nullptr;
+        cache.Counts[i] = 0;
+    }
+}
+
+SlabAllocator::Block* SlabAllocator::Refill(uint32_t aClass) noexcept
+{
+    auto& cache = t_cache;
+    auto& sizeClass = m_classes[aClass];
+
+    // Makes sure the cache goes back to the shared lists when the thread exits
+    if (!cache.Released)
+        (void)&t_releaser;
+
+    std::scoped_lock _(sizeClass.Lock);
+
+    if (!sizeClass.pFree)
+    {
+        const auto cBlockSize = sizeof(Header) + kClassSizes[aClass];
+        auto* pChunk = static_cast<uint8_t*>(std::malloc(kChunkSize));
+        if (!pChunk)
+            return nullptr;
+
+        m_reservedBytes.fetch_add(kChunkSize, std::memory_order_relaxed);
+
+        Block* pHead = nullptr;
+        for (size_t offset = (kChunkSize / cBlockSize - 1) * cBlockSize;; offset -= cBlockSize)
+        {
+            auto* pBlock = reinterpret_cast<Block*>(pChunk + offset);
+            pBlock->pNext = pHead;
+            pHead = pBlock;
+
+            if (offset == 0)
+                break;
+        }
+        sizeClass.pFree = pHead;
+    }
+
+    auto* pBlock = sizeClass.pFree;
+    sizeClass.pFree = pBlock->pNext;
+
+    // A thread that is tearing down doesn't cache anything anymore
+    if (cache.Released)
+        return pBlock;
+
+    for (uint32_t i = 0; i < kBatchSize && sizeClass.pFree; ++i)
+    {
+        auto* pCached = sizeClass.pFree;
+        sizeClass.pFree = pCached->pNext;
+
+        pCached->pNext = static_cast<Block*>(cache.Heads[aClass]);
+        cache.Heads[aClass] = pCached;
+        cache.Counts[aClass]++;
+    }
+
+    return pBlock;
+}
+
+void SlabAllocator::Release(uint32_t aClass, Block* apFirst, Block* apLast) noexcept
+{
+    auto& sizeClass = m_classes[aClass];
+
+    std::scoped_lock _(sizeClass.Lock);
+    apLast->pNext = sizeClass.pFree;
+    sizeClass.pFree = apFirst;
+}
+} // namespace Base
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <TiltedCore/Allocator.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace Base
+{
+// Size class allocator for the small blocks that make up most of the server's allocations. Blocks come from
+// 64KiB chunks that are never given back, each thread keeps a cache of free blocks per class so most calls
+// take no lock. Anything larger than kMaxBlockSize goes to malloc.
+// It only relies on malloc so it can sit behind operator new, see AllocatorSymbolOverride.cpp.
+class SlabAllocator final : public TiltedPhoques::Allocator
+{
+public:
+    static constexpr size_t kMaxBlockSize = 512;
+    static constexpr uint32_t kClassCount = 10;
+
+    struct Stats
+    {
+        // Memory taken from malloc for the chunks
+        uint64_t ReservedBytes{0};
+        uint64_t LargeAllocations{0};
+    };
+
+    [[nodiscard]] static SlabAllocator& Get() noexcept;
+
+    [[nodiscard]] void* Allocate(size_t aSize) noexcept override;
+    void Free(void* apData) noexcept override;
+    [[nodiscard]] size_t Size(void* apData) noexcept override;
+
+    [[nodiscard]] Stats GetStats() const noexcept;
+
+    // Hands the blocks cached by the calling thread back to the shared lists, done on thread exit
+    void ReleaseThreadCache() noexcept;
+
+private:
+    SlabAllocator() noexcept = default;
+
+    struct Block
+    {
+        Block* pNext;
+    };
+
+    struct SizeClass
+    {
+        std::mutex Lock;
+        Block* pFree{nullptr};
+    };
+
+    // Fills the cache of the calling thread, returns nullptr if malloc failed
+    Block* Refill(uint32_t aClass) noexcept;
+    void Release(uint32_t aClass, Block* apFirst, Block* apLast) noexcept;
+
+    std::array<SizeClass, kClassCount> m_classes;
+    std::atomic<uint64_t> m_reservedBytes{0};
+    std::atomic<uint64_t> m_largeAllocations{0};
+};
+} // namespace Base
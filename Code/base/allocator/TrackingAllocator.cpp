@@ -0,0 +1,97 @@
+#include <base/allocator/TrackingAllocator.h>
+
+#include <mutex>
+
+namespace Base
+{
+namespace
+{
+// Function statics, allocators are globals constructed in any order
+std::mutex& GetListLock() noexcept
+{
+    static std::mutex s_lock;
+    return s_lock;
+}
+
+TrackingAllocator*& GetListHead() noexcept
+{
+    static TrackingAllocator* s_pHead = nullptr;
+    return s_pHead;
+}
+} // namespace
+
+TrackingAllocator::TrackingAllocator(const char* apName) noexcept
+    : m_pName(apName)
+{
+    std::scoped_lock _(GetListLock());
+
+    auto& pHead = GetListHead();
+    m_pNext = pHead;
+    if (pHead)
+        pHead->m_pPrevious = this;
+    pHead = this;
+}
+
+TrackingAllocator::~TrackingAllocator() noexcept
+{
+    std::scoped_lock _(GetListLock());
+
+    if (m_pPrevious)
+        m_pPrevious->m_pNext = m_pNext;
+    else
+        GetListHead() = m_pNext;
+
+    if (m_pNext)
+        m_pNext->m_pPrevious = m_pPrevious;
+}
+
+void* TrackingAllocator::Allocate(size_t aSize) noexcept
+{
+    Charge(aSize);
+    return TiltedPhoques::Allocator::GetDefault()->Allocate(aSize);
+}
+
+void TrackingAllocator::Free(void* apData) noexcept
+{
+    TiltedPhoques::Allocator::GetDefault()->Free(apData);
+}
+
+size_t TrackingAllocator::Size(void* apData) noexcept
+{
+    return TiltedPhoques::Allocator::GetDefault()->Size(apData);
+}
+
+TrackingAllocator::Stats TrackingAllocator::GetStats() const noexcept
+{
+    Stats stats;
+    stats.Allocations = m_allocations.load(std::memory_order_relaxed);
+    stats.Bytes = m_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void TrackingAllocator::ResetStats() noexcept
+{
+    m_allocations.store(0, std::memory_order_relaxed);
+    m_bytes.store(0, std::memory_order_relaxed);
+}
+
+void TrackingAllocator::ForEach(const std::function<void(TrackingAllocator&)>& acFunc)
+{
+    std::scoped_lock _(GetListLock());
+
+    for (auto* pAllocator = GetListHead(); pAllocator; pAllocator = pAllocator->m_pNext)
+        acFunc(*pAllocator);
+}
+
+AllocationScope::AllocationScope(TrackingAllocator& aAllocator) noexcept
+    : m_scope(aAllocator)
+    , m_pPrevious(GetAllocationTag())
+{
+    SetAllocationTag(&aAllocator);
+}
+
+AllocationScope::~AllocationScope() noexcept
+{
+    SetAllocationTag(m_pPrevious);
+}
+} // namespace Base
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <TiltedCore/Allocator.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace Base
+{
+// Allocator charging what goes through it to a subsystem, the memory itself comes from the default allocator.
+// Instances register themselves so they can all be listed, they are meant to be globals.
+class TrackingAllocator final : public TiltedPhoques::Allocator
+{
+public:
+    struct Stats
+    {
+        uint64_t Allocations{0};
+        uint64_t Bytes{0};
+    };
+
+    // The name must outlive the allocator
+    explicit TrackingAllocator(const char* apName) noexcept;
+    ~TrackingAllocator() noexcept;
+
+    TrackingAllocator(const TrackingAllocator&) = delete;
+    TrackingAllocator& operator=(const TrackingAllocator&) = delete;
+
+    [[nodiscard]] void* Allocate(size_t aSize) noexcept override;
+    void Free(void* apData) noexcept override;
+    [[nodiscard]] size_t Size(void* apData) noexcept override;
+
+    // Counts an allocation that was served elsewhere, operator new does this for the allocation tag
+    void Charge(size_t aSize) noexcept
+    {
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+        m_bytes.fetch_add(aSize, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const char* GetName() const noexcept { return m_pName; }
+    [[nodiscard]] Stats GetStats() const noexcept;
+    void ResetStats() noexcept;
+
+    static void ForEach(const std::function<void(TrackingAllocator&)>& acFunc);
+
+private:
+    const char* m_pName;
+    std::atomic<uint64_t> m_allocations{0};
+    std::atomic<uint64_t> m_bytes{0};
+
+    TrackingAllocator* m_pPrevious{nullptr};
+    TrackingAllocator* m_pNext{nullptr};
+};
+
+// Charges the allocations made by this thread to a subsystem while in scope. Containers pick the allocator up
+// through TiltedPhoques' allocator stack, plain operator new through the allocation tag.
+class AllocationScope
+{
+public:
+    explicit AllocationScope(TrackingAllocator& aAllocator) noexcept;
+    ~AllocationScope() noexcept;
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    TiltedPhoques::ScopedAllocator m_scope;
+    TrackingAllocator* m_pPrevious;
+};
+
+// Implemented next to operator new, see AllocatorSymbolOverride.cpp
+const char* GetAllocatorBackendName() noexcept;
+TrackingAllocator* GetAllocationTag() noexcept;
+void SetAllocationTag(TrackingAllocator* apAllocator) noexcept;
+} // namespace Base
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+// Bounded multiple producer, single consumer queue.
+// Producers claim a slot with a compare exchange and never block each other, the consumer can sleep
+// until something is pushed instead of polling like fast_queue's reader does. The lock is only taken
+// to wake a consumer that is actually waiting.
+template<class T, size_t Exponent = 12>
+struct mpsc_queue
+{
+    mpsc_queue();
+
+    // Returns false when the queue is full, the value is left untouched
+    bool try_push(T& value);
+    // Consumer side only
+    std::optional<T> try_pop();
+
+    // Consumer side only, returns true as soon as the queue isn't empty, false on timeout or interrupt()
+    template<class Rep, class Period>
+    bool wait_for(std::chrono::duration<Rep, Period> timeout);
+    // Wakes the consumer up even though nothing was pushed
+    void interrupt();
+
+    bool empty() const;
+    size_t size() const;
+
+private:
+
+    enum
+    {
+        kSize = 1 << Exponent,
+        kMask = kSize - 1,
+        // Keeps the producer and consumer indices on their own cache line
+        kCacheLine = 64
+    };
+
+    void wake();
+
+    // A cell is free for the producer of position p when its sequence is p, readable when it is p + 1
+    struct cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    alignas(kCacheLine) std::atomic<size_t> m_tail{ 0 };
+    alignas(kCacheLine) std::atomic<size_t> m_head{ 0 };
+    alignas(kCacheLine) std::atomic<bool> m_waiting{ false };
+    bool m_interrupted{ false };
+    std::mutex m_lock;
+    std::condition_variable m_wakeUp;
+    std::unique_ptr<cell[]> m_buffer;
+};
+
+template<class T, size_t Exponent>
+mpsc_queue<T, Exponent>::mpsc_queue()
+    : m_buffer(std::make_unique<cell[]>(kSize))
+{
+    for (size_t i = 0; i < kSize; ++i)
+        m_buffer[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<class T, size_t Exponent>
+bool mpsc_queue<T, Exponent>::try_push(T& value)
+{
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto& entry = m_buffer[tail & kMask];
+        const auto sequence = entry.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(tail);
+
+        if (diff == 0)
+        {
+            if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+            {
+                entry.data = std::move(value);
+                entry.sequence.store(tail + 1, std::memory_order_release);
+                break;
+            }
+        }
+        // The consumer hasn't freed this cell from the previous round yet
+        else if (diff < 0)
+            return false;
+        else
+            tail = m_tail.load(std::memory_order_relaxed);
+    }
+
+    // Pairs with the fence in wait_for, either the consumer sees the new item or we see it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiting.load(std::memory_order_relaxed))
+        wake();
+
+    return true;
+}
+
+template<class T, size_t Exponent>
+std::optional<T> mpsc_queue<T, Exponent>::try_pop()
+{
+    const auto head = m_head.load(std::memory_order_relaxed);
+    auto& entry = m_buffer[head & kMask];
+    if (entry.sequence.load(std::memory_order_acquire) != head + 1)
+        return std::nullopt;
+
+    std::optional<T> value{ std::move(entry.data) };
+    entry.sequence.store(head + kSize, std::memory_order_release);
+    m_head.store(head + 1, std::memory_order_relaxed);
+
+    return value;
+}
+
+template<class T, size_t Exponent>
+template<class Rep, class Period>
+bool mpsc_queue<T, Exponent>::wait_for(std::chrono::duration<Rep, Period> timeout)
+{
+    const auto ready = [this]
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        return m_buffer[head & kMask].sequence.load(std::memory_order_acquire) == head + 1;
+    };
+
+    if (ready())
+        return true;
+
+    std::unique_lock lock(m_lock);
+
+    m_waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const auto result = m_wakeUp.wait_for(lock, timeout, [&] { return m_interrupted || ready(); });
+
+    m_waiting.store(false, std::memory_order_relaxed);
+    m_interrupted = false;
+
+    return result && ready();
+}
+
+template<class T, size_t Exponent>
+void mpsc_queue<T, Exponent>::interrupt()
+{
+    {
+        std::scoped_lock _(m_lock);
+        m_interrupted = true;
+    }
+    m_wakeUp.notify_one();
+}
+
+template<class T, size_t Exponent>
+void mpsc_queue<T, Exponent>::wake()
+{
+    // Taking the lock makes sure the consumer is either before its last check or already asleep
+    {
+        std::scoped_lock _(m_lock);
+    }
+    m_wakeUp.notify_one();
+}
+
+template<class T, size_t Exponent>
+inline bool mpsc_queue<T, Exponent>::empty() const
+{
+    return size() == 0;
+}
+
+template<class T, size_t Exponent>
+inline size_t mpsc_queue<T, Exponent>::size() const
+{
+    // Counts the slots claimed by producers, including the ones still being written
+    return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed);
+}
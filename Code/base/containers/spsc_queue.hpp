@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+// Bounded single producer, single consumer queue, neither side ever waits on the other.
+template<class T, size_t Exponent = 8>
+struct spsc_queue
+{
+    // Returns false when the queue is full, the value is left untouched
+    bool try_push(T& value);
+    std::optional<T> try_pop();
+
+    bool empty() const;
+    bool full() const;
+    size_t size() const;
+
+private:
+
+    enum
+    {
+        kSize = 1 << Exponent,
+        kMask = kSize - 1,
+        // Keeps the producer and consumer indices on their own cache line
+        kCacheLine = 64
+    };
+
+    alignas(kCacheLine) std::atomic<size_t> m_head{ 0 };
+    alignas(kCacheLine) std::atomic<size_t> m_tail{ 0 };
+    T m_buffer[kSize];
+};
+
+template<class T, size_t Exponent>
+bool spsc_queue<T, Exponent>::try_push(T& value)
+{
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == kSize)
+        return false;
+
+    m_buffer[tail & kMask] = std::move(value);
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<class T, size_t Exponent>
+std::optional<T> spsc_queue<T, Exponent>::try_pop()
+{
+    const auto head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire))
+        return std::nullopt;
+
+    std::optional<T> value{ std::move(m_buffer[head & kMask]) };
+    m_head.store(head + 1, std::memory_order_release);
+
+    return value;
+}
+
+template<class T, size_t Exponent>
+inline bool spsc_queue<T, Exponent>::empty() const
+{
+    return m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_relaxed);
+}
+
+template<class T, size_t Exponent>
+inline bool spsc_queue<T, Exponent>::full() const
+{
+    return size() == kSize;
+}
+
+template<class T, size_t Exponent>
+inline size_t spsc_queue<T, Exponent>::size() const
+{
+    return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <base/allocator/SlabAllocator.h>
+#include <base/allocator/TrackingAllocator.h>
+
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Base::AllocationScope;
+using Base::SlabAllocator;
+using Base::TrackingAllocator;
+
+TEST(SlabAllocator, ServesEverySize)
+{
+    auto& allocator = SlabAllocator::Get();
+
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t size = 0; size <= 2 * SlabAllocator::kMaxBlockSize; size += 7)
+    {
+        auto* pData = allocator.Allocate(size);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(pData) % 16, 0);
+        EXPECT_GE(allocator.Size(pData), size);
+
+        std::memset(pData, static_cast<int>(size & 0xFF), size);
+        blocks.emplace_back(pData, size);
+    }
+
+    // Nothing overlaps
+    for (auto& [pData, size] : blocks)
+    {
+        const auto* pBytes = static_cast<uint8_t*>(pData);
+        for (size_t i = 0; i < size; ++i)
+            ASSERT_EQ(pBytes[i], static_cast<uint8_t>(size & 0xFF));
+
+        allocator.Free(pData);
+    }
+}
+
+TEST(SlabAllocator, ReusesFreedBlocks)
+{
+    auto& allocator = SlabAllocator::Get();
+
+    auto* pFirst = allocator.Allocate(40);
+    allocator.Free(pFirst);
+
+    // The thread cache hands back the last block freed
+    auto* pSecond = allocator.Allocate(33);
+    EXPECT_EQ(pFirst, pSecond);
+    allocator.Free(pSecond);
+}
+
+TEST(SlabAllocator, BlocksCanBeFreedByAnotherThread)
+{
+    auto& allocator = SlabAllocator::Get();
+
+    constexpr size_t kCount = 20000;
+    constexpr uint32_t kRounds = 10;
+    std::vector<void*> blocks(kCount);
+
+    // One thread only allocates, the other only frees, both give their caches back when exiting
+    const auto cRound = [&]
+    {
+        std::thread producer(
+            [&]
+            {
+                for (auto& pBlock : blocks)
+                    pBlock = allocator.Allocate(100);
+            });
+        producer.join();
+
+        std::thread consumer(
+            [&]
+            {
+                for (auto* pBlock : blocks)
+                    allocator.Free(pBlock);
+            });
+        consumer.join();
+    };
+
+    cRound();
+    const auto cReserved = allocator.GetStats().ReservedBytes;
+
+    // A cache left behind by any of them would eventually need new chunks
+    for (uint32_t i = 0; i < kRounds; ++i)
+        cRound();
+
+    EXPECT_EQ(allocator.GetStats().ReservedBytes, cReserved);
+}
+
+TEST(TrackingAllocator, ChargesAllocations)
+{
+    TrackingAllocator allocator("Test");
+
+    auto* pData = allocator.Allocate(64);
+    ASSERT_NE(pData, nullptr);
+    allocator.Free(pData);
+    allocator.Charge(16);
+
+    EXPECT_EQ(allocator.GetStats().Allocations, 2);
+    EXPECT_EQ(allocator.GetStats().Bytes, 80);
+
+    bool listed = false;
+    TrackingAllocator::ForEach([&](TrackingAllocator& aAllocator) { listed |= &aAllocator == &allocator; });
+    EXPECT_TRUE(listed);
+
+    allocator.ResetStats();
+    EXPECT_EQ(allocator.GetStats().Allocations, 0);
+}
+
+TEST(TrackingAllocator, ScopesNest)
+{
+    TrackingAllocator outer("Outer");
+    TrackingAllocator inner("Inner");
+
+    EXPECT_EQ(Base::GetAllocationTag(), nullptr);
+    {
+        AllocationScope outerScope(outer);
+        {
+            AllocationScope innerScope(inner);
+            EXPECT_EQ(Base::GetAllocationTag(), &inner);
+        }
+        EXPECT_EQ(Base::GetAllocationTag(), &outer);
+
+        // operator new charges the current tag
+        auto pValue = std::make_unique<uint64_t>(42);
+        EXPECT_EQ(outer.GetStats().Allocations, 1);
+        EXPECT_EQ(outer.GetStats().Bytes, sizeof(uint64_t));
+    }
+    EXPECT_EQ(Base::GetAllocationTag(), nullptr);
+    EXPECT_EQ(inner.GetStats().Allocations, 0);
+}
+} // namespace
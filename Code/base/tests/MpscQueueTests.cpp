@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <base/containers/mpsc_queue.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace std::chrono_literals;
+
+TEST(MpscQueue, PushPopInOrder)
+{
+    mpsc_queue<int, 2> queue;
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.try_push(i));
+
+    // Bounded, the value stays with the caller
+    int extra = 42;
+    EXPECT_FALSE(queue.try_push(extra));
+    EXPECT_EQ(extra, 42);
+    EXPECT_EQ(queue.size(), 4);
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(queue.try_pop(), i);
+
+    EXPECT_FALSE(queue.try_pop());
+    EXPECT_TRUE(queue.empty());
+
+    // Wraps around
+    EXPECT_TRUE(queue.try_push(extra));
+    EXPECT_EQ(queue.try_pop(), 42);
+}
+
+TEST(MpscQueue, WaitTimesOutWhenEmpty)
+{
+    mpsc_queue<int> queue;
+
+    EXPECT_FALSE(queue.wait_for(1ms));
+
+    queue.interrupt();
+    EXPECT_FALSE(queue.wait_for(10s));
+}
+
+TEST(MpscQueue, ProducersWakeTheConsumer)
+{
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+
+    mpsc_queue<std::pair<int, int>, 8> queue;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back(
+            [&queue, p]
+            {
+                for (int i = 0; i < kPerProducer; ++i)
+                {
+                    std::pair<int, int> value{p, i};
+                    while (!queue.try_push(value))
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    // Each producer's items come out in the order they were pushed
+    std::vector<int> next(kProducers, 0);
+    int received = 0;
+    while (received < kProducers * kPerProducer)
+    {
+        if (!queue.wait_for(10s))
+            break;
+
+        while (auto value = queue.try_pop())
+        {
+            EXPECT_EQ(value->second, next[value->first]);
+            next[value->first] = value->second + 1;
+            ++received;
+        }
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    EXPECT_EQ(received, kProducers * kPerProducer);
+}
+} // namespace
@@ -12,3 +12,10 @@ target("BaseLib")
         "hopscotch-map", 
         "gtest",
         "spdlog")
+
+    if is_config("allocator", "mimalloc") then
+        add_packages("mimalloc")
+        add_defines("TP_ALLOCATOR_MIMALLOC")
+    elseif is_config("allocator", "slab") then
+        add_defines("TP_ALLOCATOR_SLAB")
+    end
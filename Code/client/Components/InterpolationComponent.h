@@ -4,23 +4,12 @@
 #error Include Components.h instead
 #endif
 
-#include <Structs/AnimationVariables.h>
+#include <Interpolation.h>
 
 struct InterpolationComponent
 {
-    struct TimePoint
-    {
-        uint64_t Tick{};
-        glm::vec3 Position{};
-        glm::vec3 Rotation{};
-        AnimationVariables Variables{};
-        float Direction{};
+    using TimePoint = InterpolationBuffer::Point;
 
-        TimePoint() = default;
-        TimePoint(const TimePoint&) = default;
-        TimePoint& operator=(const TimePoint&) = default;
-    };
-
-    List<TimePoint> TimePoints;
+    InterpolationBuffer TimePoints;
     glm::vec3 Position;
 };
@@ -738,6 +738,7 @@ Inventory TESObjectREFR::GetInventory(std::function<bool(TESForm&)> aFilter) con
     spdlog::debug("MinExtraInventory count after: {}", minimizedExtraInventory.Entries.size());
 
     inventory.Entries.insert(inventory.Entries.end(), minimizedExtraInventory.Entries.begin(), minimizedExtraInventory.Entries.end());
+    inventory.MarkEntriesDirty();
 
     spdlog::debug("Inventory count before: {}", inventory.Entries.size());
 
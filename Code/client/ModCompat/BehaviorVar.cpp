@@ -31,7 +31,7 @@
 #include <BSAnimationGraphManager.h>
 #include <Games/ActorExtension.h>
 #include "BehaviorVar.h"
-#include "BehaviorVarsMap.h"
+#include <BehaviorVarTable.h>
 
 #include <Camera/TESCamera.h> // Camera 1st person is only in Skyrim?
 #include <Camera/PlayerCamera.h>
@@ -137,8 +137,8 @@ void ProcessVariableSet(
 // We do this with a hack to translate old numeric value back to a string, then we
 // can forward-translate the string to its new numeric value.
 //
-// The machine-generated table hack to do this can be removed with STR-devs'
-// permission to also embed the string information in the Code\encoding\structs files.
+// The original names come from the BehaviorVarTables generated from the
+// Code\encoding\Structs descriptors, see Tools/Scripts/generate_behavior_var_tables.py.
 //
 void BehaviorVar::SeedAnimationVariables(
     const uint64_t acHash,
@@ -148,7 +148,12 @@ void BehaviorVar::SeedAnimationVariables(
     TiltedPhoques::Set<uint32_t>& aFloatVars,
     TiltedPhoques::Set<uint32_t>& aIntVars)
 {
-    auto& origVars = BehaviorVarsMap::getInstance();
+    const auto* cpOrigVars = BehaviorVarTables::Get(acHash);
+    if (!cpOrigVars)
+    {
+        spdlog::error(__FUNCTION__ ": no original BehaviorVars for behavior {}", acHash);
+        return;
+    }
 
     // Prepare lists of variables to process
     TiltedPhoques::Vector<TiltedPhoques::String> boolVarNames;
@@ -156,24 +161,24 @@ void BehaviorVar::SeedAnimationVariables(
     TiltedPhoques::Vector<TiltedPhoques::String> intVarNames;
 
     // Populate lists from the original descriptor
-    TiltedPhoques::String strValue;
+    std::string_view strValue;
     for (auto& item : acpDescriptor->BooleanLookUpTable)
-        if ((strValue = origVars.find(acHash, item)).empty())
+        if ((strValue = cpOrigVars->GetName(item)).empty())
             spdlog::error(__FUNCTION__ ": unable to find string for original BooleanVar {}", item);
         else
-            boolVarNames.push_back(strValue);
+            boolVarNames.push_back(TiltedPhoques::String(strValue));
 
     for (auto& item : acpDescriptor->FloatLookupTable)
-        if ((strValue = origVars.find(acHash, item)).empty())
+        if ((strValue = cpOrigVars->GetName(item)).empty())
             spdlog::error(__FUNCTION__ ": unable to find string for original FloatVar {}", item);
         else
-            floatVarNames.push_back(strValue);
+            floatVarNames.push_back(TiltedPhoques::String(strValue));
 
     for (auto& item : acpDescriptor->IntegerLookupTable)
-        if ((strValue = origVars.find(acHash, item)).empty())
+        if ((strValue = cpOrigVars->GetName(item)).empty())
             spdlog::error(__FUNCTION__ ": unable to find string for original IntVar {}", item);
         else
-            intVarNames.push_back(strValue);
+            intVarNames.push_back(TiltedPhoques::String(strValue));
 
     // Process each set of variables
     ProcessVariableSet(acReverseMap, aBoolVars, boolVarNames, spdlog::level::level_enum::err);
@@ -655,26 +660,24 @@ BehaviorVar::Replacer* BehaviorVar::LoadReplacerFromDir(const std::filesystem::p
 //
 TiltedPhoques::Vector<uint64_t> BehaviorVar::SignatureMatches(const uint64_t acHash, const TiltedPhoques::String& acSignature) const
 {
-    auto& bvMap = BehaviorVarsMap::getInstance();
     TiltedPhoques::Vector<uint64_t> hashes;
 
-    bvMap.Hashes(hashes);
     auto tokens = TokenizeBehaviorSig(acSignature);
-    for (size_t i = 0; i < hashes.size(); i++)
+    for (const auto& table : BehaviorVarTables::GetAll())
     {
-        if (hashes[i] == acHash)
+        if (table.Key == acHash)
             continue;
 
         auto found = true;
         for (auto titer = tokens.begin(); found && titer < tokens.end(); titer++)
         {
             if (*titer == "!")
-                found = bvMap.find(hashes[i], *++titer) == UINT32_MAX;
+                found = table.Find(*++titer) == BehaviorVarTable::kNotFound;
             else
-                found = bvMap.find(hashes[i], *titer) != UINT32_MAX;
+                found = table.Find(*titer) != BehaviorVarTable::kNotFound;
         }
-        if (!found)
-            hashes.erase(hashes.begin() + i--);
+        if (found)
+            hashes.push_back(table.Key);
     }
 
     return hashes;
@@ -682,9 +685,6 @@ TiltedPhoques::Vector<uint64_t> BehaviorVar::SignatureMatches(const uint64_t acH
 
 void BehaviorVar::Init()
 {
-    // Initialize original (base STR) behaviors so we can search them.
-    BehaviorOrig::BehaviorOrigInit();
-
     // Check if the behaviors folder exists
     std::filesystem::path pBehaviorsPath;
     pBehaviorsPath = launcher::GetLaunchContext()->gamePath / L"Data" / L"SkyrimTogetherRebornBehaviors";
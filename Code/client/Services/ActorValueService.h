@@ -16,6 +16,7 @@ struct NotifyActorValueChanges;
 struct NotifyActorMaxValueChanges;
 struct NotifyHealthChangeBroadcast;
 struct NotifyDeathStateChange;
+struct NotifyActorValuesBatch;
 
 struct Actor;
 
@@ -84,6 +85,14 @@ private:
      * @brief Receives death state changes and applies them locally.
      */
     void OnDeathStateChange(const NotifyDeathStateChange& acEvent) const noexcept;
+    /**
+     * @brief Receives the changes the server merged during a tick and applies them locally.
+     */
+    void OnActorValuesBatch(const NotifyActorValuesBatch& acMessage) const noexcept;
+
+    void ApplyActorValues(uint32_t aServerId, const Map<uint32_t, float>& acValues) const noexcept;
+    void ApplyActorMaxValues(uint32_t aServerId, const Map<uint32_t, float>& acValues) const noexcept;
+    void ApplyDeltaHealth(uint32_t aServerId, float aDeltaHealth) const noexcept;
 
     /**
      * @brief Checks and broadcasts new actor values.
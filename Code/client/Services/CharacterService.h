@@ -2,6 +2,8 @@
 #include "Structs/Inventory.h"
 #include "Structs/ActorData.h"
 
+#include <Interpolation.h>
+
 struct ActorAddedEvent;
 struct ActorRemovedEvent;
 struct UpdateEvent;
@@ -64,10 +66,10 @@ struct CharacterService
     void OnActorRemoved(const ActorRemovedEvent& acEvent) noexcept;
     void OnUpdate(const UpdateEvent& acUpdateEvent) noexcept;
     void OnConnected(const ConnectedEvent& acConnectedEvent) const noexcept;
-    void OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) const noexcept;
+    void OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) noexcept;
     void OnAssignCharacter(const AssignCharacterResponse& acMessage) noexcept;
     void OnCharacterSpawn(const CharacterSpawnRequest& acMessage) const noexcept;
-    void OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) const noexcept;
+    void OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) noexcept;
     void OnActionEvent(const ActionEvent& acActionEvent) const noexcept;
     void OnFactionsChanges(const NotifyFactionsChanges& acEvent) const noexcept;
     void OnOwnershipTransfer(const NotifyOwnershipTransfer& acMessage) const noexcept;
@@ -112,6 +114,9 @@ private:
     entt::dispatcher& m_dispatcher;
     TransportService& m_transport;
 
+    // How far behind the server clock remote references are played back
+    PlayoutDelay m_playoutDelay;
+
     float m_cachedExperience = 0.f;
 
     // TODO: revamp this, read the local anim var like vampire lord?
@@ -19,6 +19,7 @@
 #include <Messages/NotifyHealthChangeBroadcast.h>
 #include <Messages/RequestHealthChangeBroadcast.h>
 #include <Messages/NotifyDeathStateChange.h>
+#include <Messages/NotifyActorValuesBatch.h>
 #include <Messages/RequestDeathStateChange.h>
 
 #include <misc/ActorValueOwner.h>
@@ -37,6 +38,7 @@ ActorValueService::ActorValueService(World& aWorld, entt::dispatcher& aDispatche
     m_dispatcher.sink<HealthChangeEvent>().connect<&ActorValueService::OnHealthChange>(this);
     m_dispatcher.sink<NotifyHealthChangeBroadcast>().connect<&ActorValueService::OnHealthChangeBroadcast>(this);
     m_dispatcher.sink<NotifyDeathStateChange>().connect<&ActorValueService::OnDeathStateChange>(this);
+    m_dispatcher.sink<NotifyActorValuesBatch>().connect<&ActorValueService::OnActorValuesBatch>(this);
 }
 
 void ActorValueService::CreateActorValuesComponent(const entt::entity aEntity, Actor* apActor) noexcept
@@ -277,14 +279,19 @@ void ActorValueService::RunActorValuesUpdates() noexcept
 
 void ActorValueService::OnHealthChangeBroadcast(const NotifyHealthChangeBroadcast& acMessage) const noexcept
 {
-    Actor* pActor = Utils::GetByServerId<Actor>(acMessage.Id);
+    ApplyDeltaHealth(acMessage.Id, acMessage.DeltaHealth);
+}
+
+void ActorValueService::ApplyDeltaHealth(uint32_t aServerId, float aDeltaHealth) const noexcept
+{
+    Actor* pActor = Utils::GetByServerId<Actor>(aServerId);
     if (!pActor)
     {
-        spdlog::error("{}: could not find actor server id {:X}", __FUNCTION__, acMessage.Id);
+        spdlog::error("{}: could not find actor server id {:X}", __FUNCTION__, aServerId);
         return;
     }
 
-    const float newHealth = pActor->GetActorValue(ActorValueInfo::kHealth) + acMessage.DeltaHealth;
+    const float newHealth = pActor->GetActorValue(ActorValueInfo::kHealth) + aDeltaHealth;
     pActor->ForceActorValue(ActorValueOwner::ForceMode::DAMAGE, ActorValueInfo::kHealth, newHealth);
 
     const float health = pActor->GetActorValue(ActorValueInfo::kHealth);
@@ -304,10 +311,15 @@ void ActorValueService::OnHealthChangeBroadcast(const NotifyHealthChangeBroadcas
 }
 
 void ActorValueService::OnActorValueChanges(const NotifyActorValueChanges& acMessage) const noexcept
+{
+    ApplyActorValues(acMessage.Id, acMessage.Values);
+}
+
+void ActorValueService::ApplyActorValues(uint32_t aServerId, const Map<uint32_t, float>& acValues) const noexcept
 {
     auto view = m_world.view<FormIdComponent, RemoteComponent>();
 
-    const auto itor = std::find_if(std::begin(view), std::end(view), [id = acMessage.Id, view](entt::entity entity) { return view.get<RemoteComponent>(entity).Id == id; });
+    const auto itor = std::find_if(std::begin(view), std::end(view), [id = aServerId, view](entt::entity entity) { return view.get<RemoteComponent>(entity).Id == id; });
 
     if (itor == std::end(view))
         return;
@@ -318,13 +330,13 @@ void ActorValueService::OnActorValueChanges(const NotifyActorValueChanges& acMes
     if (!pActor)
         return;
 
-    for (const auto& [key, value] : acMessage.Values)
+    for (const auto& [key, value] : acValues)
     {
         // Syncing dragon souls triggers "Dragon soul collected" event
         if (key == ActorValueInfo::kDragonSouls || key == ActorValueInfo::kHealth)
             continue;
 
-        spdlog::debug("Actor value update, server ID: {:X}, key: {}, value: {}", acMessage.Id, key, value);
+        spdlog::debug("Actor value update, server ID: {:X}, key: {}, value: {}", aServerId, key, value);
 
         if (key == ActorValueInfo::kStamina || key == ActorValueInfo::kMagicka || key == ActorValueInfo::kHealth)
         {
@@ -336,10 +348,15 @@ void ActorValueService::OnActorValueChanges(const NotifyActorValueChanges& acMes
 }
 
 void ActorValueService::OnActorMaxValueChanges(const NotifyActorMaxValueChanges& acMessage) const noexcept
+{
+    ApplyActorMaxValues(acMessage.Id, acMessage.Values);
+}
+
+void ActorValueService::ApplyActorMaxValues(uint32_t aServerId, const Map<uint32_t, float>& acValues) const noexcept
 {
     auto view = m_world.view<FormIdComponent, RemoteComponent>();
 
-    const auto it = std::find_if(std::begin(view), std::end(view), [id = acMessage.Id, view](entt::entity entity) { return view.get<RemoteComponent>(entity).Id == id; });
+    const auto it = std::find_if(std::begin(view), std::end(view), [id = aServerId, view](entt::entity entity) { return view.get<RemoteComponent>(entity).Id == id; });
 
     if (it == std::end(view))
         return;
@@ -350,17 +367,33 @@ void ActorValueService::OnActorMaxValueChanges(const NotifyActorMaxValueChanges&
     if (!pActor)
         return;
 
-    for (const auto& [key, value] : acMessage.Values)
+    for (const auto& [key, value] : acValues)
     {
         if (key == ActorValueInfo::kDragonSouls)
             continue;
 
-        spdlog::debug("Actor max value update, server ID: {:X}, key: {}, value: {}", acMessage.Id, key, value);
+        spdlog::debug("Actor max value update, server ID: {:X}, key: {}, value: {}", aServerId, key, value);
 
         pActor->ForceActorValue(ActorValueOwner::ForceMode::PERMANENT, key, value);
     }
 }
 
+void ActorValueService::OnActorValuesBatch(const NotifyActorValuesBatch& acMessage) const noexcept
+{
+    for (const auto& changes : acMessage.Changes)
+    {
+        // Max values first so that the current values are not clamped to the old ones
+        if (!changes.MaxValues.empty())
+            ApplyActorMaxValues(changes.Id, changes.MaxValues);
+
+        if (!changes.Values.empty())
+            ApplyActorValues(changes.Id, changes.Values);
+
+        if (changes.HasDeltaHealth)
+            ApplyDeltaHealth(changes.Id, changes.DeltaHealth);
+    }
+}
+
 void ActorValueService::OnDeathStateChange(const NotifyDeathStateChange& acMessage) const noexcept
 {
     auto view = m_world.view<FormIdComponent, RemoteComponent>();
@@ -51,6 +51,8 @@ void CalendarService::OnDisconnected(const DisconnectedEvent&) noexcept
 {
     // signal a time transition
     m_fadeTimer = 0.f;
+    // the next server has its own clock
+    m_lastTick = 0;
     ToggleGameClock(true);
 }
 
@@ -93,7 +95,7 @@ void CalendarService::HandleUpdate(const UpdateEvent& aEvent) noexcept
 
         const auto now = m_world.GetTick();
 
-        // we got disconnected or the client got ahead of us
+        // the server tick only goes backwards when the first time sync exchange replaces the connection's clock
         if (now < m_lastTick)
             return;
 
@@ -261,8 +261,11 @@ void CharacterService::OnConnected(const ConnectedEvent& acConnectedEvent) const
     }
 }
 
-void CharacterService::OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) const noexcept
+void CharacterService::OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) noexcept
 {
+    // The next server has its own clock and link
+    m_playoutDelay.Reset();
+
     auto remoteView = m_world.view<FormIdComponent, RemoteComponent>();
     for (auto entity : remoteView)
     {
@@ -518,8 +521,10 @@ void CharacterService::OnRemoteSpawnDataReceived(const NotifySpawnData& acMessag
     spdlog::info("Applied remote spawn data, actor form id: {:X}", pActor->formID);
 }
 
-void CharacterService::OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) const noexcept
+void CharacterService::OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) noexcept
 {
+    m_playoutDelay.OnSnapshot(acMessage.Tick, m_transport.GetServerTick());
+
     auto view = m_world.view<RemoteComponent, InterpolationComponent, RemoteAnimationComponent>();
 
     for (const auto& [serverId, update] : acMessage.Updates)
@@ -1027,6 +1032,16 @@ void CharacterService::OnNotifyActorTeleport(const NotifyActorTeleport& acMessag
 
     MoveActor(pActor, acMessage.WorldSpaceId, acMessage.CellId, acMessage.Position);
 
+    // Points from before the teleport would drag the actor back, playback restarts from the next snapshot
+    auto view = m_world.view<FormIdComponent, InterpolationComponent>();
+    const auto entityIt = std::find_if(view.begin(), view.end(), [view, cActorId](auto aEntity) { return view.get<FormIdComponent>(aEntity).Id == cActorId; });
+    if (entityIt != view.end())
+    {
+        auto& interpolationComponent = view.get<InterpolationComponent>(*entityIt);
+        interpolationComponent.TimePoints.Clear();
+        interpolationComponent.Position = acMessage.Position;
+    }
+
     spdlog::info("Successfully teleported actor, form id: {:X}, world space: {:X}, cell: {:X}, position: ({}, {}, {})", pActor->formID, acMessage.WorldSpaceId.BaseId, acMessage.CellId.BaseId, acMessage.Position.x, acMessage.Position.y, acMessage.Position.z);
 }
 
@@ -1424,7 +1439,7 @@ void CharacterService::RunLocalUpdates() const noexcept
     lastSendTimePoint = now;
 
     ClientReferencesMoveRequest message;
-    message.Tick = m_transport.GetClock().GetCurrentTick();
+    message.Tick = m_transport.GetServerTick();
 
     auto animatedLocalView = m_world.view<LocalComponent, LocalAnimationComponent, FormIdComponent>();
 
@@ -1442,8 +1457,8 @@ void CharacterService::RunLocalUpdates() const noexcept
 
 void CharacterService::RunRemoteUpdates() noexcept
 {
-    // Delay by 300ms to let the interpolation system accumulate interpolation points
-    const auto tick = m_transport.GetClock().GetCurrentTick() - 300;
+    // Play back late enough for the interpolation system to have the points around the tick
+    const auto tick = m_playoutDelay.Update(m_transport.GetServerTick());
 
     // Interpolation has to keep running even if the actor is not in view, otherwise we will never know if we need to spawn it
     auto interpolatedEntities = m_world.view<RemoteComponent, InterpolationComponent>();
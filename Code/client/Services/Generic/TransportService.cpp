@@ -18,8 +18,11 @@
 #include <World.h>
 
 #include <Messages/AuthenticationRequest.h>
+#include <MessageCompression.h>
 #include <Messages/ServerMessageFactory.h>
 #include <Messages/NotifySettingsChange.h>
+#include <Messages/TimeSyncRequest.h>
+#include <Messages/TimeSyncResponse.h>
 #include <Packet.hpp>
 
 #include <ScriptExtender.h>
@@ -29,6 +32,19 @@
 
 static constexpr wchar_t kMO2DllName[] = L"usvfs_x64.dll";
 
+// A few quick exchanges fill the window after connecting, then the drift estimate carries the clock
+static constexpr uint32_t kTimeSyncBurst = 8;
+static constexpr uint64_t kTimeSyncBurstInterval = 250;
+static constexpr uint64_t kTimeSyncInterval = 2000;
+
+namespace
+{
+uint64_t GetLocalTick() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
 using TiltedPhoques::Packet;
 
 TransportService::TransportService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
@@ -63,6 +79,13 @@ TransportService::TransportService(World& aWorld, entt::dispatcher& aDispatcher)
         const auto pRealMessage = TiltedPhoques::CastUnique<AuthenticationResponse>(std::move(apMessage));
         HandleAuthenticationResponse(*pRealMessage);
     };
+
+    // Handled here, the receive tick has to be taken before anything else runs
+    m_messageHandlers[TimeSyncResponse::Opcode] = [this](UniquePtr<ServerMessage>& apMessage)
+    {
+        const auto pRealMessage = TiltedPhoques::CastUnique<TimeSyncResponse>(std::move(apMessage));
+        HandleTimeSyncResponse(*pRealMessage);
+    };
 }
 
 bool TransportService::Send(const ClientMessage& acMessage) const noexcept
@@ -78,7 +101,7 @@ bool TransportService::Send(const ClientMessage& acMessage) const noexcept
     {
         ScopedAllocator _{s_allocator};
 
-        Buffer buffer(1 << 16);
+        Buffer buffer(1 + acMessage.SerializedSizeBound());
         Buffer::Writer writer(&buffer);
         writer.WriteBits(0, 8); // Write first byte as packet needs it
 
@@ -95,6 +118,18 @@ bool TransportService::Send(const ClientMessage& acMessage) const noexcept
 
 void TransportService::OnConsume(const void* apData, uint32_t aSize)
 {
+    if (MessageCompression::IsEnvelope(static_cast<const uint8_t*>(apData), aSize))
+    {
+        if (!MessageCompression::Decompress(static_cast<const uint8_t*>(apData), aSize, m_inflated))
+        {
+            spdlog::error("Couldn't decompress packet from server");
+            return;
+        }
+
+        apData = m_inflated.data();
+        aSize = static_cast<uint32_t>(m_inflated.size());
+    }
+
     ServerMessageFactory factory;
     TiltedPhoques::ViewBuffer buf((uint8_t*)apData, aSize);
     Buffer::Reader reader(&buf);
@@ -115,6 +150,7 @@ void TransportService::OnConnected()
     request.Version = BUILD_COMMIT;
     request.SKSEActive = IsScriptExtenderLoaded();
     request.MO2Active = GetModuleHandleW(kMO2DllName);
+    request.Capabilities = AuthenticationRequest::kCompressedMessages | AuthenticationRequest::kActorValuesBatch;
 
     request.Token = m_serverPassword;
     m_serverPassword = "";
@@ -181,6 +217,7 @@ void TransportService::OnUpdate()
 void TransportService::HandleUpdate(const UpdateEvent& acEvent) noexcept
 {
     Update();
+    RunTimeSync();
 }
 
 void TransportService::HandleConnected(const ConnectedEvent& acEvent) noexcept
@@ -191,6 +228,43 @@ void TransportService::HandleConnected(const ConnectedEvent& acEvent) noexcept
 void TransportService::HandleDisconnected(const DisconnectedEvent& acEvent) noexcept
 {
     m_localPlayerId = NULL;
+
+    // The next server has its own clock
+    m_timeSync.Reset();
+    m_nextTimeSync = 0;
+}
+
+uint64_t TransportService::GetServerTick() const noexcept
+{
+    if (!m_timeSync.IsSynchronized())
+        return GetClock().GetCurrentTick();
+
+    return m_timeSync.GetServerTick(GetLocalTick());
+}
+
+void TransportService::RunTimeSync() noexcept
+{
+    if (!m_connected)
+        return;
+
+    const auto cNow = GetLocalTick();
+    if (cNow < m_nextTimeSync)
+        return;
+
+    m_nextTimeSync = cNow + (m_timeSync.GetExchangeCount() < kTimeSyncBurst ? kTimeSyncBurstInterval : kTimeSyncInterval);
+
+    TimeSyncRequest request;
+    request.ClientTick = cNow;
+    request.RoundTripTime = static_cast<uint32_t>(m_timeSync.GetRoundTripTime());
+    request.Jitter = static_cast<uint32_t>(m_timeSync.GetJitter());
+
+    Send(request);
+}
+
+void TransportService::HandleTimeSyncResponse(const TimeSyncResponse& acMessage) noexcept
+{
+    if (!m_timeSync.AddExchange(acMessage.ClientTick, acMessage.ServerReceiveTick, acMessage.ServerSendTick, GetLocalTick()))
+        spdlog::warn("Discarded inconsistent time sync response");
 }
 
 void TransportService::HandleAuthenticationResponse(const AuthenticationResponse& acMessage) noexcept
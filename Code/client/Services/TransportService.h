@@ -6,11 +6,14 @@
 #include <atomic>
 #include <Client.hpp>
 
+#include <TimeSync.h>
+
 struct ImguiService;
 struct UpdateEvent;
 struct ClientMessage;
 struct AuthenticationResponse;
 struct NotifySettingsChange;
+struct TimeSyncResponse;
 
 struct World;
 
@@ -37,6 +40,10 @@ struct TransportService : Client
     void SetServerPassword(const std::string& acPassword) noexcept { m_serverPassword = acPassword; }
     const uint32_t& GetLocalPlayerId() const noexcept { return m_localPlayerId; }
 
+    // Server clock estimated from our own exchanges, falls back to the connection's clock until the first one
+    [[nodiscard]] uint64_t GetServerTick() const noexcept;
+    [[nodiscard]] const TimeSync& GetTimeSync() const noexcept { return m_timeSync; }
+
 protected:
     // Event handlers
     void HandleUpdate(const UpdateEvent& acEvent) noexcept;
@@ -46,6 +53,9 @@ protected:
     // Packet handlers
     void HandleAuthenticationResponse(const AuthenticationResponse& acMessage) noexcept;
     void HandleNotifySettingsChange(const NotifySettingsChange& acMessage) noexcept;
+    void HandleTimeSyncResponse(const TimeSyncResponse& acMessage) noexcept;
+
+    void RunTimeSync() noexcept;
 
 private:
     World& m_world;
@@ -60,4 +70,9 @@ private:
     entt::scoped_connection m_connectedConnection;
     entt::scoped_connection m_disconnectedConnection;
     std::function<void(UniquePtr<ServerMessage>&)> m_messageHandlers[kServerOpcodeMax];
+    // Messages restored from compressed envelopes, reused from one packet to the next
+    Vector<uint8_t> m_inflated;
+    // Reading the server tick slews it
+    mutable TimeSync m_timeSync;
+    uint64_t m_nextTimeSync{0};
 };
@@ -92,7 +92,7 @@ ModSystem& World::GetModSystem() noexcept
 
 uint64_t World::GetTick() const noexcept
 {
-    return m_transport.GetClock().GetCurrentTick();
+    return m_transport.GetServerTick();
 }
 
 void World::Create() noexcept
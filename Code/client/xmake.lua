@@ -49,6 +49,7 @@ target(name)
         "minhook",
         "entt",
         "glm",
+        "zlib",
         "mem",
         "xbyak")
 
@@ -14,4 +14,8 @@ public:
 
     // update the server logic
     virtual void Update() = 0;
+
+    // pacing hints for the runner
+    virtual uint32_t GetTickRate() = 0;
+    virtual bool HasClients() = 0;
 };
@@ -0,0 +1,81 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <array>
+#include <vector>
+
+namespace ECS
+{
+// Set of the entities whose components were constructed or patched since the last time it was consumed.
+// Changes made in place without going through patch/replace have to be reported with Mark.
+// Each processor owns its own tracker, so every one of them sees every change exactly once.
+template <class... T> class ChangeTracker
+{
+public:
+    explicit ChangeTracker(entt::registry& aRegistry) noexcept
+        : m_registry(aRegistry)
+    {
+        size_t index = 0;
+        (Connect<T>(index), ...);
+    }
+
+    ChangeTracker(const ChangeTracker&) = delete;
+    ChangeTracker& operator=(const ChangeTracker&) = delete;
+
+    void Mark(entt::entity aEntity) noexcept
+    {
+        if (!m_changed.contains(aEntity))
+            m_changed.emplace(aEntity);
+    }
+
+    [[nodiscard]] bool IsChanged(entt::entity aEntity) const noexcept { return m_changed.contains(aEntity); }
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_changed.empty(); }
+    [[nodiscard]] size_t GetCount() const noexcept { return m_changed.size(); }
+
+    // Visits the changed entities and forgets them, entities marked while visiting are kept for the next run
+    template <class TFunc> void Consume(TFunc&& aFunc)
+    {
+        m_visiting.assign(m_changed.begin(), m_changed.end());
+        m_changed.clear();
+
+        for (auto entity : m_visiting)
+        {
+            // Destroyed, or stripped of what we track, by an earlier visit
+            if (!m_registry.valid(entity) || !m_registry.template any_of<T...>(entity))
+                continue;
+
+            aFunc(entity);
+        }
+
+        m_visiting.clear();
+    }
+
+    void Clear() noexcept { m_changed.clear(); }
+
+private:
+    template <class U> void Connect(size_t& aIndex) noexcept
+    {
+        m_connections[aIndex++] = m_registry.template on_construct<U>().template connect<&ChangeTracker::OnChanged>(*this);
+        m_connections[aIndex++] = m_registry.template on_update<U>().template connect<&ChangeTracker::OnChanged>(*this);
+        m_connections[aIndex++] = m_registry.template on_destroy<U>().template connect<&ChangeTracker::OnDestroyed>(*this);
+    }
+
+    void OnChanged(entt::registry&, entt::entity aEntity) noexcept { Mark(aEntity); }
+
+    // Entity ids are recycled, a destroyed entity must not linger in the set. The component is still attached while the
+    // signal runs, an entity that keeps another tracked component stays
+    void OnDestroyed(entt::registry& aRegistry, entt::entity aEntity) noexcept
+    {
+        if ((static_cast<size_t>(aRegistry.all_of<T>(aEntity)) + ...) <= 1)
+            m_changed.remove(aEntity);
+    }
+
+    entt::registry& m_registry;
+    entt::sparse_set m_changed;
+    std::vector<entt::entity> m_visiting;
+    std::array<entt::scoped_connection, sizeof...(T) * 3> m_connections;
+};
+} // namespace ECS
@@ -0,0 +1,184 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <gtest/gtest.h>
+#include <ecs/ChangeTracker.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace ECS
+{
+namespace
+{
+struct Position
+{
+    float X{};
+    float Y{};
+};
+
+struct Health
+{
+    float Value{100.f};
+};
+
+TEST(ChangeTracker, SeesConstructionAndPatches)
+{
+    entt::registry registry;
+    ChangeTracker<Position> tracker(registry);
+
+    const auto cFirst = registry.create();
+    const auto cSecond = registry.create();
+    registry.emplace<Position>(cFirst);
+    registry.emplace<Position>(cSecond);
+
+    EXPECT_EQ(tracker.GetCount(), 2);
+
+    size_t visited = 0;
+    tracker.Consume([&visited](entt::entity) { ++visited; });
+    EXPECT_EQ(visited, 2);
+    EXPECT_TRUE(tracker.IsEmpty());
+
+    registry.patch<Position>(cSecond, [](auto& aPosition) { aPosition.X = 1.f; });
+    EXPECT_FALSE(tracker.IsChanged(cFirst));
+    EXPECT_TRUE(tracker.IsChanged(cSecond));
+
+    // Untracked components don't count
+    registry.emplace<Health>(cFirst);
+    registry.patch<Health>(cFirst);
+    EXPECT_EQ(tracker.GetCount(), 1);
+}
+
+TEST(ChangeTracker, ForgetsDestroyedEntities)
+{
+    entt::registry registry;
+    ChangeTracker<Position, Health> tracker(registry);
+
+    const auto cEntity = registry.create();
+    registry.emplace<Position>(cEntity);
+    registry.emplace<Health>(cEntity);
+    EXPECT_EQ(tracker.GetCount(), 1);
+
+    registry.destroy(cEntity);
+    EXPECT_TRUE(tracker.IsEmpty());
+
+    // The id gets recycled with a new version
+    const auto cRecycled = registry.create();
+    registry.emplace<Health>(cRecycled);
+    EXPECT_TRUE(tracker.IsChanged(cRecycled));
+}
+
+TEST(ChangeTracker, KeepsEntitiesWithAnotherTrackedComponent)
+{
+    entt::registry registry;
+    ChangeTracker<Position, Health> tracker(registry);
+
+    const auto cEntity = registry.create();
+    registry.emplace<Position>(cEntity);
+    registry.emplace<Health>(cEntity);
+
+    registry.remove<Position>(cEntity);
+    EXPECT_TRUE(tracker.IsChanged(cEntity));
+
+    registry.remove<Health>(cEntity);
+    EXPECT_TRUE(tracker.IsEmpty());
+}
+
+TEST(ChangeTracker, MarksDuringConsumeWaitForTheNextRun)
+{
+    entt::registry registry;
+    ChangeTracker<Position> tracker(registry);
+
+    const auto cEntity = registry.create();
+    registry.emplace<Position>(cEntity);
+
+    tracker.Consume([&tracker](entt::entity aEntity) { tracker.Mark(aEntity); });
+    EXPECT_TRUE(tracker.IsChanged(cEntity));
+
+    // Trackers are independent from each other
+    ChangeTracker<Position> other(registry);
+    registry.patch<Position>(cEntity);
+    EXPECT_TRUE(other.IsChanged(cEntity));
+
+    tracker.Consume([](entt::entity) {});
+    EXPECT_TRUE(tracker.IsEmpty());
+    EXPECT_TRUE(other.IsChanged(cEntity));
+}
+
+TEST(ChangeTracker, SkipsEntitiesDestroyedWhileVisiting)
+{
+    entt::registry registry;
+    ChangeTracker<Position> tracker(registry);
+
+    for (auto i = 0; i < 4; ++i)
+        registry.emplace<Position>(registry.create());
+
+    size_t visited = 0;
+    tracker.Consume(
+        [&](entt::entity)
+        {
+            ++visited;
+            // Destroys the entities still waiting to be visited
+            registry.clear();
+        });
+
+    EXPECT_EQ(visited, 1);
+}
+
+// Run with --gtest_also_run_disabled_tests
+TEST(ChangeTracker, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+    using std::chrono::duration;
+
+    constexpr uint32_t kTicks = 1000;
+    constexpr uint32_t kActive = 100;
+
+    printf("%10s %10s %16s %16s\n", "entities", "active", "full scan (us)", "tracked (us)");
+
+    for (const uint32_t cCount : {1000u, 10000u, 100000u})
+    {
+        entt::registry registry;
+        ChangeTracker<Position> tracker(registry);
+
+        for (uint32_t i = 0; i < cCount; ++i)
+            registry.emplace<Position>(registry.create());
+
+        tracker.Clear();
+
+        const auto cView = registry.view<Position>();
+        const std::vector<entt::entity> cEntities(cView.begin(), cView.end());
+
+        // The same handful of entities moves every tick, as in a mostly idle world
+        Clock::duration fullScan{};
+        Clock::duration tracked{};
+        float checksum = 0.f;
+
+        for (uint32_t tick = 0; tick < kTicks; ++tick)
+        {
+            for (uint32_t i = 0; i < kActive; ++i)
+                registry.patch<Position>(cEntities[(tick * 7 + i * 13) % cCount], [tick](auto& aPosition) { aPosition.X = static_cast<float>(tick + 1); });
+
+            // Every entity is visited and compared, like the periodic processors used to do
+            const auto cFullStart = Clock::now();
+            registry.view<Position>().each(
+                [&checksum, tick](const auto& acPosition)
+                {
+                    if (acPosition.X == static_cast<float>(tick + 1))
+                        checksum += 1.f;
+                });
+            fullScan += Clock::now() - cFullStart;
+
+            const auto cTrackedStart = Clock::now();
+            tracker.Consume([&registry, &checksum](entt::entity aEntity) { checksum -= registry.get<Position>(aEntity).X > 0.f ? 1.f : 0.f; });
+            tracked += Clock::now() - cTrackedStart;
+        }
+
+        EXPECT_EQ(checksum, 0.f);
+
+        printf("%10u %10u %16.2f %16.2f\n", cCount, kActive, duration<double, std::micro>(fullScan).count() / kTicks, duration<double, std::micro>(tracked).count() / kTicks);
+    }
+}
+} // namespace
+} // namespace ECS
@@ -0,0 +1,8 @@
+local function include_ecs()
+	add_packages("entt")
+end
+
+component("ECS")
+	include_ecs()
+unittest("ECS")
+	include_ecs()
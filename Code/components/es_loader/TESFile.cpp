@@ -3,6 +3,8 @@
 #include <filesystem>
 #include <fstream>
 
+#include <logging/RateLimiter.h>
+
 namespace ESLoader
 {
 TESFile::TESFile(Map<String, uint8_t>& aMasterFiles)
@@ -198,7 +200,7 @@ uint32_t TESFile::GetFormIdPrefix(uint32_t aFormId, Map<uint8_t, uint32_t>& aPar
     {
         // TODO: this is weird, but for some reason, in Skyrim.esm,
         // the GMST record with EDID "iDaysToRespawnVendor" has a base id of 0x01
-        spdlog::warn("Form id prefix not found: {:X}", baseId);
+        LOG_LIMITED(spdlog::level::warn, "Form id prefix not found: {:X}", baseId);
         return 0;
     }
 
@@ -3,9 +3,11 @@ component("ESLoader")
 	add_headerfiles("stdafx.h", {prefixdir = "ESLoader"})
 	add_files("stdafx.cpp")
 	add_packages("zlib", "glm")
+	add_deps("Logging")
 
 unittest("ESLoader")
 	set_pcxxheader("stdafx.h")
 	add_headerfiles("stdafx.h", {prefixdir = "ESLoader"})
 	add_files("stdafx.cpp")
 	add_packages("zlib", "glm")
+	add_deps("Logging")
@@ -0,0 +1,189 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <logging/AsyncSink.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace Logging
+{
+namespace
+{
+// Sinks buffer their output, they are flushed once the writer has been idle for this long
+constexpr auto kIdleFlush = std::chrono::milliseconds(250);
+} // namespace
+
+AsyncSink::AsyncSink(std::vector<spdlog::sink_ptr> aSinks)
+    : m_sinks(std::move(aSinks))
+{
+    m_writer = std::thread(&AsyncSink::Run, this);
+}
+
+AsyncSink::~AsyncSink()
+{
+    Stop();
+}
+
+void AsyncSink::Stop()
+{
+    if (!m_writer.joinable())
+        return;
+
+    m_running.store(false, std::memory_order_release);
+    m_queue.interrupt();
+    m_writer.join();
+}
+
+void AsyncSink::AddSink(spdlog::sink_ptr aSink)
+{
+    std::scoped_lock _(m_sinksLock);
+    m_sinks.push_back(std::move(aSink));
+}
+
+void AsyncSink::RemoveSink(const spdlog::sink_ptr& acSink)
+{
+    std::scoped_lock _(m_sinksLock);
+    m_sinks.erase(std::remove(std::begin(m_sinks), std::end(m_sinks), acSink), std::end(m_sinks));
+}
+
+void AsyncSink::log(const spdlog::details::log_msg& acMsg)
+{
+    if (!m_running.load(std::memory_order_acquire))
+    {
+        std::scoped_lock _(m_sinksLock);
+        Write(acMsg);
+        return;
+    }
+
+    // Copies the name and the payload, the pattern is applied by the writer
+    spdlog::details::log_msg_buffer message(acMsg);
+    if (!m_queue.try_push(message))
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncSink::flush()
+{
+    if (!m_running.load(std::memory_order_acquire))
+    {
+        std::scoped_lock _(m_sinksLock);
+        for (auto& sink : m_sinks)
+            sink->flush();
+        return;
+    }
+
+    std::unique_lock lock(m_flushLock);
+    const auto cTicket = ++m_flushRequests;
+    m_queue.interrupt();
+    m_flushed.wait(lock, [this, cTicket] { return m_flushesDone >= cTicket; });
+}
+
+void AsyncSink::set_pattern(const std::string& acPattern)
+{
+    std::scoped_lock _(m_sinksLock);
+    for (auto& sink : m_sinks)
+        sink->set_pattern(acPattern);
+}
+
+void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> aFormatter)
+{
+    std::scoped_lock _(m_sinksLock);
+    for (auto& sink : m_sinks)
+        sink->set_formatter(aFormatter->clone());
+}
+
+AsyncSink::Stats AsyncSink::GetStats() const noexcept
+{
+    Stats stats;
+    stats.Written = m_written.load(std::memory_order_relaxed);
+    stats.Dropped = m_dropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AsyncSink::Run()
+{
+    bool dirty = false;
+
+    for (;;)
+    {
+        const auto cStopping = !m_running.load(std::memory_order_acquire);
+
+        // Everything logged before a flush request is queued by the time we read it
+        uint64_t flushRequests;
+        {
+            std::scoped_lock _(m_flushLock);
+            flushRequests = m_flushRequests;
+        }
+
+        dirty |= Drain();
+        ReportDropped();
+
+        if (cStopping || flushRequests != m_flushesDone)
+        {
+            {
+                std::scoped_lock _(m_sinksLock);
+                for (auto& sink : m_sinks)
+                    sink->flush();
+            }
+            dirty = false;
+
+            {
+                std::scoped_lock _(m_flushLock);
+                m_flushesDone = flushRequests;
+            }
+            m_flushed.notify_all();
+        }
+
+        if (cStopping)
+            break;
+
+        if (!m_queue.wait_for(kIdleFlush) && dirty)
+        {
+            std::scoped_lock _(m_sinksLock);
+            for (auto& sink : m_sinks)
+                sink->flush();
+            dirty = false;
+        }
+    }
+}
+
+bool AsyncSink::Drain()
+{
+    auto message = m_queue.try_pop();
+    if (!message)
+        return false;
+
+    std::scoped_lock _(m_sinksLock);
+
+    for (; message; message = m_queue.try_pop())
+        Write(*message);
+
+    return true;
+}
+
+void AsyncSink::ReportDropped()
+{
+    const auto cDropped = m_dropped.load(std::memory_order_relaxed);
+    if (cDropped == m_reportedDropped)
+        return;
+
+    const auto cText = fmt::format("Logging fell behind, {} lines were dropped", cDropped - m_reportedDropped);
+    m_reportedDropped = cDropped;
+
+    const spdlog::details::log_msg message(spdlog::source_loc{}, "", spdlog::level::warn, cText);
+
+    std::scoped_lock _(m_sinksLock);
+    Write(message);
+}
+
+void AsyncSink::Write(const spdlog::details::log_msg& acMsg)
+{
+    for (auto& sink : m_sinks)
+    {
+        if (sink->should_log(acMsg.level))
+            sink->log(acMsg);
+    }
+
+    m_written.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace Logging
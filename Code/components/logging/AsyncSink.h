@@ -0,0 +1,77 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+#pragma once
+
+#include <base/containers/mpsc_queue.hpp>
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Logging
+{
+// Hands log lines to a background thread that formats them and writes them to the wrapped sinks.
+// Logging only copies the message into a lock free queue, it never waits on the console or the disk.
+// When the writer falls too far behind new lines are dropped and counted, a warning reports them later.
+class AsyncSink final : public spdlog::sinks::sink
+{
+public:
+    struct Stats
+    {
+        uint64_t Written{0};
+        // Lines lost because the queue was full
+        uint64_t Dropped{0};
+    };
+
+    explicit AsyncSink(std::vector<spdlog::sink_ptr> aSinks = {});
+    ~AsyncSink() override;
+
+    AsyncSink(const AsyncSink&) = delete;
+    AsyncSink& operator=(const AsyncSink&) = delete;
+
+    // The sinks are only called from the writer thread, they don't need to be thread safe on their own
+    void AddSink(spdlog::sink_ptr aSink);
+    void RemoveSink(const spdlog::sink_ptr& acSink);
+
+    // Writes what is queued and joins the writer, later lines are written by the caller. Meant to be called
+    // before the process starts tearing down, joining from a static destructor is not safe everywhere.
+    void Stop();
+
+    void log(const spdlog::details::log_msg& acMsg) override;
+    // Blocks until everything logged before the call is written and the sinks are flushed
+    void flush() override;
+    void set_pattern(const std::string& acPattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> aFormatter) override;
+
+    [[nodiscard]] Stats GetStats() const noexcept;
+
+private:
+    void Run();
+    // Writes what is queued, returns false if there was nothing
+    bool Drain();
+    void ReportDropped();
+    // m_sinksLock must be held
+    void Write(const spdlog::details::log_msg& acMsg);
+
+    mpsc_queue<spdlog::details::log_msg_buffer, 13> m_queue;
+
+    std::mutex m_sinksLock;
+    std::vector<spdlog::sink_ptr> m_sinks;
+
+    std::atomic<uint64_t> m_written{0};
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reportedDropped{0};
+
+    std::mutex m_flushLock;
+    std::condition_variable m_flushed;
+    uint64_t m_flushRequests{0};
+    uint64_t m_flushesDone{0};
+
+    std::atomic<bool> m_running{true};
+    std::thread m_writer;
+};
+} // namespace Logging
@@ -0,0 +1,190 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <gtest/gtest.h>
+#include <logging/AsyncSink.h>
+#include <logging/RateLimiter.h>
+
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <sstream>
+#include <vector>
+
+namespace Logging
+{
+namespace
+{
+// Holds the writer on its first line until released
+struct BlockingSink final : spdlog::sinks::base_sink<std::mutex>
+{
+    void sink_it_(const spdlog::details::log_msg&) override
+    {
+        if (Lines++ == 0)
+        {
+            Blocked.set_value();
+            Release.get_future().wait();
+        }
+    }
+
+    void flush_() override {}
+
+    size_t Lines{0};
+    std::promise<void> Blocked;
+    std::promise<void> Release;
+};
+
+TEST(AsyncSink, WritesInOrderAndFlushes)
+{
+    std::ostringstream stream;
+    auto output = std::make_shared<spdlog::sinks::ostream_sink_st>(stream);
+
+    auto sink = std::make_shared<AsyncSink>(std::vector<spdlog::sink_ptr>{output});
+    sink->set_pattern("[%l] %v");
+
+    spdlog::logger logger("async", sink);
+    for (uint32_t i = 0; i < 1000; ++i)
+        logger.info("line {}", i);
+    logger.warn("last");
+    logger.flush();
+
+    std::ostringstream expected;
+    for (uint32_t i = 0; i < 1000; ++i)
+        expected << "[info] line " << i << "\n";
+    expected << "[warning] last\n";
+
+    EXPECT_EQ(stream.str(), expected.str());
+    EXPECT_EQ(sink->GetStats().Written, 1001);
+    EXPECT_EQ(sink->GetStats().Dropped, 0);
+}
+
+TEST(AsyncSink, DropsAndReportsWhenTheWriterIsStuck)
+{
+    auto blocking = std::make_shared<BlockingSink>();
+    auto blocked = blocking->Blocked.get_future();
+
+    std::ostringstream stream;
+    auto output = std::make_shared<spdlog::sinks::ostream_sink_st>(stream);
+    output->set_pattern("%v");
+
+    auto sink = std::make_shared<AsyncSink>(std::vector<spdlog::sink_ptr>{blocking, output});
+    spdlog::logger logger("async", sink);
+
+    logger.info("first");
+    blocked.wait();
+
+    // Never waits on the writer, what doesn't fit is dropped
+    constexpr uint32_t kLines = 20000;
+    for (uint32_t i = 0; i < kLines; ++i)
+        logger.info("line {}", i);
+
+    const auto cDropped = sink->GetStats().Dropped;
+    EXPECT_GT(cDropped, 0);
+
+    blocking->Release.set_value();
+    logger.flush();
+
+    EXPECT_EQ(blocking->Lines, kLines + 1 - cDropped + 1);
+    EXPECT_NE(stream.str().find(fmt::format("Logging fell behind, {} lines were dropped", cDropped)), std::string::npos);
+}
+
+TEST(AsyncSink, SinksCanBeAddedAndRemoved)
+{
+    std::ostringstream first, second;
+    auto firstOutput = std::make_shared<spdlog::sinks::ostream_sink_st>(first);
+    auto secondOutput = std::make_shared<spdlog::sinks::ostream_sink_st>(second);
+
+    auto sink = std::make_shared<AsyncSink>(std::vector<spdlog::sink_ptr>{firstOutput});
+    spdlog::logger logger("async", sink);
+
+    sink->AddSink(secondOutput);
+    sink->set_pattern("%v");
+    logger.info("both");
+    logger.flush();
+
+    sink->RemoveSink(secondOutput);
+    logger.info("first only");
+    logger.flush();
+
+    EXPECT_EQ(first.str(), "both\nfirst only\n");
+    EXPECT_EQ(second.str(), "both\n");
+}
+
+TEST(AsyncSink, WritesDirectlyOnceStopped)
+{
+    std::ostringstream stream;
+    auto output = std::make_shared<spdlog::sinks::ostream_sink_st>(stream);
+    output->set_pattern("%v");
+
+    auto sink = std::make_shared<AsyncSink>(std::vector<spdlog::sink_ptr>{output});
+    spdlog::logger logger("async", sink);
+
+    logger.info("queued");
+    sink->Stop();
+    EXPECT_EQ(stream.str(), "queued\n");
+
+    logger.info("direct");
+    EXPECT_EQ(stream.str(), "queued\ndirect\n");
+}
+
+// Run with --gtest_also_run_disabled_tests
+TEST(AsyncSink, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+    using std::chrono::duration;
+
+    // A storm of a few thousand warnings per tick, like a client spamming moves for entities it doesn't own
+    constexpr uint32_t kTicks = 300;
+    constexpr uint32_t kLinesPerTick = 2000;
+
+    const auto cPath = std::filesystem::temp_directory_path() / "tp_logging_benchmark.log";
+
+    const auto cRun = [&](const char* apName, const std::shared_ptr<spdlog::logger>& acpLogger, auto&& aLog)
+    {
+        const auto cPrevious = spdlog::default_logger();
+        spdlog::set_default_logger(acpLogger);
+
+        std::vector<double> ticks;
+        for (uint32_t tick = 0; tick < kTicks; ++tick)
+        {
+            const auto cStart = Clock::now();
+            for (uint32_t i = 0; i < kLinesPerTick; ++i)
+                aLog(i);
+            ticks.push_back(duration<double, std::micro>(Clock::now() - cStart).count());
+        }
+
+        acpLogger->flush();
+        spdlog::set_default_logger(cPrevious);
+
+        std::sort(std::begin(ticks), std::end(ticks));
+        printf("%-24s p50 %10.1f us, p99 %10.1f us, max %10.1f us\n", apName, ticks[ticks.size() / 2], ticks[ticks.size() * 99 / 100], ticks.back());
+    };
+
+    {
+        auto file = std::make_shared<spdlog::sinks::basic_file_sink_mt>(cPath.string(), true);
+        cRun("synchronous", std::make_shared<spdlog::logger>("sync", file), [](uint32_t aId) { spdlog::warn("{:x} requested move of {:x} but does not exist", 42, aId); });
+    }
+
+    {
+        auto file = std::make_shared<spdlog::sinks::basic_file_sink_st>(cPath.string(), true);
+        auto sink = std::make_shared<AsyncSink>(std::vector<spdlog::sink_ptr>{file});
+        cRun("async", std::make_shared<spdlog::logger>("async", sink), [](uint32_t aId) { spdlog::warn("{:x} requested move of {:x} but does not exist", 42, aId); });
+        printf("%24s %llu written, %llu dropped\n", "", static_cast<unsigned long long>(sink->GetStats().Written), static_cast<unsigned long long>(sink->GetStats().Dropped));
+    }
+
+    {
+        auto file = std::make_shared<spdlog::sinks::basic_file_sink_st>(cPath.string(), true);
+        auto sink = std::make_shared<AsyncSink>(std::vector<spdlog::sink_ptr>{file});
+        cRun("async, rate limited", std::make_shared<spdlog::logger>("limited", sink), [](uint32_t aId) { LOG_LIMITED(spdlog::level::warn, "{:x} requested move of {:x} but does not exist", 42, aId); });
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(cPath, ec);
+}
+} // namespace
+} // namespace Logging
@@ -0,0 +1,98 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <logging/RateLimiter.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace Logging
+{
+namespace
+{
+// Function statics, limiters are constructed from other statics
+std::mutex& GetListLock() noexcept
+{
+    static std::mutex s_lock;
+    return s_lock;
+}
+
+RateLimiter*& GetListHead() noexcept
+{
+    static RateLimiter* s_pHead = nullptr;
+    return s_pHead;
+}
+} // namespace
+
+RateLimiter::RateLimiter(spdlog::level::level_enum aLevel, const char* apFormat, uint32_t aBurst, uint64_t aWindowMs) noexcept
+    : m_level(aLevel)
+    , m_pFormat(apFormat)
+    , m_burst(aBurst)
+    , m_windowMs(aWindowMs)
+{
+    std::scoped_lock _(GetListLock());
+
+    auto& pHead = GetListHead();
+    m_pNext = pHead;
+    if (pHead)
+        pHead->m_pPrevious = this;
+    pHead = this;
+}
+
+RateLimiter::~RateLimiter() noexcept
+{
+    std::scoped_lock _(GetListLock());
+
+    if (m_pPrevious)
+        m_pPrevious->m_pNext = m_pNext;
+    else
+        GetListHead() = m_pNext;
+
+    if (m_pNext)
+        m_pNext->m_pPrevious = m_pPrevious;
+}
+
+bool RateLimiter::Allow(uint64_t aNowMs, uint64_t& aSuppressed) noexcept
+{
+    aSuppressed = 0;
+
+    // Only one caller gets to open the new window
+    auto windowStart = m_windowStart.load(std::memory_order_relaxed);
+    if (aNowMs - windowStart >= m_windowMs && m_windowStart.compare_exchange_strong(windowStart, aNowMs, std::memory_order_relaxed))
+    {
+        m_count.store(0, std::memory_order_relaxed);
+        aSuppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+    }
+
+    if (m_count.fetch_add(1, std::memory_order_relaxed) < m_burst)
+        return true;
+
+    // Lost the race against the callers of the new window, the count goes back for the next one
+    m_suppressed.fetch_add(aSuppressed + 1, std::memory_order_relaxed);
+    aSuppressed = 0;
+
+    return false;
+}
+
+void RateLimiter::ReportSuppressed(uint64_t aNowMs) noexcept
+{
+    std::scoped_lock _(GetListLock());
+
+    for (auto* pLimiter = GetListHead(); pLimiter; pLimiter = pLimiter->m_pNext)
+    {
+        // Still within the window, the next message from that site can carry the count
+        if (aNowMs - pLimiter->m_windowStart.load(std::memory_order_relaxed) < pLimiter->m_windowMs)
+            continue;
+
+        const auto cSuppressed = pLimiter->m_suppressed.exchange(0, std::memory_order_relaxed);
+        if (cSuppressed)
+            spdlog::log(pLimiter->m_level, "Suppressed {} messages like \"{}\"", cSuppressed, pLimiter->m_pFormat);
+    }
+}
+
+uint64_t RateLimiter::GetTimeMs() noexcept
+{
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+} // namespace Logging
@@ -0,0 +1,83 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace Logging
+{
+// Lets a burst of messages through per window and counts the rest. Meant to be a static at the call
+// site of a message that can be triggered by every packet, see LOG_LIMITED.
+// Limiters are linked in a list so the suppressed counts can be reported once the storm is over.
+class RateLimiter
+{
+public:
+    static constexpr uint32_t kDefaultBurst = 5;
+    static constexpr uint64_t kDefaultWindowMs = 1000;
+
+    // The format must outlive the limiter, it is used to describe what was suppressed
+    RateLimiter(spdlog::level::level_enum aLevel, const char* apFormat, uint32_t aBurst = kDefaultBurst, uint64_t aWindowMs = kDefaultWindowMs) noexcept;
+    ~RateLimiter() noexcept;
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    // Returns true if the message should be logged, aSuppressed is set to the messages held back
+    // since the last one that got through, if they haven't been reported yet.
+    bool Allow(uint64_t aNowMs, uint64_t& aSuppressed) noexcept;
+    bool Allow(uint64_t& aSuppressed) noexcept { return Allow(GetTimeMs(), aSuppressed); }
+
+    [[nodiscard]] uint64_t GetSuppressed() const noexcept { return m_suppressed.load(std::memory_order_relaxed); }
+
+    // Logs a summary for every limiter whose window ended with messages held back
+    static void ReportSuppressed(uint64_t aNowMs) noexcept;
+    static void ReportSuppressed() noexcept { ReportSuppressed(GetTimeMs()); }
+
+    [[nodiscard]] static uint64_t GetTimeMs() noexcept;
+
+private:
+    spdlog::level::level_enum m_level;
+    const char* m_pFormat;
+    uint32_t m_burst;
+    uint64_t m_windowMs;
+
+    std::atomic<uint64_t> m_windowStart{0};
+    std::atomic<uint32_t> m_count{0};
+    std::atomic<uint64_t> m_suppressed{0};
+
+    RateLimiter* m_pPrevious{nullptr};
+    RateLimiter* m_pNext{nullptr};
+};
+
+template <class... Args> void LogLimited(spdlog::level::level_enum aLevel, uint64_t aSuppressed, spdlog::format_string_t<Args...> aFormat, Args&&... aArgs)
+{
+    if (aSuppressed == 0)
+    {
+        spdlog::log(aLevel, aFormat, std::forward<Args>(aArgs)...);
+        return;
+    }
+
+    spdlog::memory_buf_t buffer;
+    fmt::format_to(std::back_inserter(buffer), aFormat, std::forward<Args>(aArgs)...);
+    spdlog::log(aLevel, "{} (suppressed {} similar messages)", std::string_view(buffer.data(), buffer.size()), aSuppressed);
+}
+} // namespace Logging
+
+// Logs like spdlog::log but at most a few times per second from this call site, nothing is formatted
+// for the messages that are held back.
+#define LOG_LIMITED(Level, Format, ...)                                                     \
+    do                                                                                      \
+    {                                                                                       \
+        if (spdlog::default_logger_raw()->should_log(Level))                                \
+        {                                                                                   \
+            static ::Logging::RateLimiter s_limiter(Level, Format);                         \
+            uint64_t suppressed = 0;                                                        \
+            if (s_limiter.Allow(suppressed))                                                \
+                ::Logging::LogLimited(Level, suppressed, Format, ##__VA_ARGS__);             \
+        }                                                                                   \
+    } while (0)
@@ -0,0 +1,105 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <gtest/gtest.h>
+#include <logging/RateLimiter.h>
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <limits>
+#include <sstream>
+
+namespace Logging
+{
+namespace
+{
+// Captures what goes through the default logger for the duration of a test
+struct ScopedCapture
+{
+    ScopedCapture()
+        : m_pPrevious(spdlog::default_logger())
+    {
+        auto sink = std::make_shared<spdlog::sinks::ostream_sink_st>(Stream);
+        sink->set_pattern("%v");
+        spdlog::set_default_logger(std::make_shared<spdlog::logger>("capture", sink));
+    }
+
+    ~ScopedCapture() { spdlog::set_default_logger(m_pPrevious); }
+
+    std::ostringstream Stream;
+
+private:
+    std::shared_ptr<spdlog::logger> m_pPrevious;
+};
+
+TEST(RateLimiter, LetsABurstThroughPerWindow)
+{
+    RateLimiter limiter(spdlog::level::warn, "test", 3, 1000);
+
+    uint64_t allowed = 0;
+    uint64_t suppressed = 0;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        if (limiter.Allow(5000 + i, suppressed))
+            ++allowed;
+        EXPECT_EQ(suppressed, 0);
+    }
+
+    EXPECT_EQ(allowed, 3);
+    EXPECT_EQ(limiter.GetSuppressed(), 97);
+
+    // The first message of the next window carries the count
+    EXPECT_TRUE(limiter.Allow(6000, suppressed));
+    EXPECT_EQ(suppressed, 97);
+    EXPECT_EQ(limiter.GetSuppressed(), 0);
+}
+
+TEST(RateLimiter, ReportsOnceTheWindowIsOver)
+{
+    // Clears what the call sites of other tests held back
+    RateLimiter::ReportSuppressed(std::numeric_limits<uint64_t>::max());
+
+    ScopedCapture capture;
+
+    RateLimiter limiter(spdlog::level::warn, "Form id prefix not found: {:X}", 1, 1000);
+
+    uint64_t suppressed = 0;
+    EXPECT_TRUE(limiter.Allow(5000, suppressed));
+    EXPECT_FALSE(limiter.Allow(5001, suppressed));
+    EXPECT_FALSE(limiter.Allow(5002, suppressed));
+
+    RateLimiter::ReportSuppressed(5500);
+    EXPECT_TRUE(capture.Stream.str().empty());
+
+    RateLimiter::ReportSuppressed(6000);
+    EXPECT_EQ(capture.Stream.str(), "Suppressed 2 messages like \"Form id prefix not found: {:X}\"\n");
+
+    // Already reported, the next message doesn't repeat it
+    EXPECT_TRUE(limiter.Allow(6001, suppressed));
+    EXPECT_EQ(suppressed, 0);
+}
+
+TEST(RateLimiter, MacroHoldsBackTheStorm)
+{
+    ScopedCapture capture;
+
+    const auto cNow = RateLimiter::GetTimeMs();
+    for (uint32_t i = 0; i < RateLimiter::kDefaultBurst + 10; ++i)
+        LOG_LIMITED(spdlog::level::warn, "Storm {}", i);
+
+    // Unless the loop straddled a window the extra messages are held back
+    if (RateLimiter::GetTimeMs() - cNow < RateLimiter::kDefaultWindowMs / 2)
+    {
+        std::ostringstream expected;
+        for (uint32_t i = 0; i < RateLimiter::kDefaultBurst; ++i)
+            expected << "Storm " << i << "\n";
+
+        EXPECT_EQ(capture.Stream.str(), expected.str());
+    }
+
+    // Messages below the level don't count
+    LOG_LIMITED(spdlog::level::trace, "Hidden {}", 1);
+    EXPECT_EQ(capture.Stream.str().find("Hidden"), std::string::npos);
+}
+} // namespace
+} // namespace Logging
@@ -0,0 +1,2 @@
+component("Logging")
+unittest("Logging")
@@ -0,0 +1,329 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <persistence/WriteBehindStore.h>
+
+#include <spdlog/spdlog.h>
+#include <sqlite3.h>
+
+namespace Persistence
+{
+namespace
+{
+constexpr char kSchema[] = "CREATE TABLE IF NOT EXISTS records(kind INTEGER NOT NULL, key BLOB NOT NULL, data BLOB NOT NULL, PRIMARY KEY(kind, key)) WITHOUT ROWID;";
+constexpr char kUpsert[] = "INSERT OR REPLACE INTO records(kind, key, data) VALUES(?1, ?2, ?3);";
+constexpr char kDelete[] = "DELETE FROM records WHERE kind = ?1 AND key = ?2;";
+constexpr char kSelect[] = "SELECT key, data FROM records WHERE kind = ?1;";
+
+// The writer checks the queue at least this often even if nobody wakes it up
+constexpr auto kWriterIdleWait = std::chrono::milliseconds(50);
+// Time between two attempts at a batch that failed to commit
+constexpr auto kWriterRetryWait = std::chrono::milliseconds(250);
+
+bool Execute(sqlite3* apDatabase, const char* acpQuery)
+{
+    char* pError = nullptr;
+    if (sqlite3_exec(apDatabase, acpQuery, nullptr, nullptr, &pError) != SQLITE_OK)
+    {
+        spdlog::error("[Persistence] \"{}\" failed: {}", acpQuery, pError ? pError : "unknown error");
+        sqlite3_free(pError);
+        return false;
+    }
+
+    return true;
+}
+
+// sqlite already rolls back on some errors, ROLLBACK without a transaction would only log another one
+void Rollback(sqlite3* apDatabase)
+{
+    if (!sqlite3_get_autocommit(apDatabase))
+        Execute(apDatabase, "ROLLBACK;");
+}
+
+void ReadBlob(sqlite3_stmt* apStatement, int aColumn, String& aOut)
+{
+    // Empty blobs come back as null
+    const auto* cpData = static_cast<const char*>(sqlite3_column_blob(apStatement, aColumn));
+    const auto cSize = sqlite3_column_bytes(apStatement, aColumn);
+
+    if (cpData)
+        aOut.assign(cpData, cSize);
+    else
+        aOut.clear();
+}
+} // namespace
+
+WriteBehindStore::~WriteBehindStore()
+{
+    Close();
+}
+
+bool WriteBehindStore::Open(const std::filesystem::path& acPath, std::function<void()> aOnWriterStart)
+{
+    if (IsOpen())
+        return false;
+
+    if (sqlite3_open(acPath.string().c_str(), &m_pDatabase) != SQLITE_OK)
+    {
+        spdlog::error("[Persistence] Unable to open {}: {}", acPath.string(), sqlite3_errmsg(m_pDatabase));
+        sqlite3_close(m_pDatabase);
+        m_pDatabase = nullptr;
+        return false;
+    }
+
+    // WAL lets the startup restore read while the writer commits, NORMAL sync is safe with WAL
+    if (!Execute(m_pDatabase, "PRAGMA journal_mode=WAL;") || !Execute(m_pDatabase, "PRAGMA synchronous=NORMAL;") || !Execute(m_pDatabase, kSchema) ||
+        sqlite3_prepare_v2(m_pDatabase, kUpsert, -1, &m_pUpsertStatement, nullptr) != SQLITE_OK || sqlite3_prepare_v2(m_pDatabase, kDelete, -1, &m_pDeleteStatement, nullptr) != SQLITE_OK)
+    {
+        spdlog::error("[Persistence] Unable to initialize {}: {}", acPath.string(), sqlite3_errmsg(m_pDatabase));
+        sqlite3_finalize(m_pUpsertStatement);
+        sqlite3_finalize(m_pDeleteStatement);
+        sqlite3_close(m_pDatabase);
+        m_pUpsertStatement = nullptr;
+        m_pDeleteStatement = nullptr;
+        m_pDatabase = nullptr;
+        return false;
+    }
+
+    m_path = acPath;
+    m_onWriterStart = std::move(aOnWriterStart);
+    m_running = true;
+    m_writer = std::thread(&WriteBehindStore::Run, this);
+
+    return true;
+}
+
+void WriteBehindStore::Close()
+{
+    if (!IsOpen())
+        return;
+
+    // The writer might be behind, give it time to make room for the last batch. If it can't write at all there is no point.
+    while (!Flush() && !m_failing.load(std::memory_order_acquire))
+        WaitIdle();
+
+    if (!m_pending.empty())
+        spdlog::error("[Persistence] {} changes are lost, the database can't be written to", m_pending.size());
+
+    m_running = false;
+    m_wakeCondition.notify_all();
+    m_writer.join();
+
+    sqlite3_finalize(m_pUpsertStatement);
+    sqlite3_finalize(m_pDeleteStatement);
+    sqlite3_close(m_pDatabase);
+
+    m_pUpsertStatement = nullptr;
+    m_pDeleteStatement = nullptr;
+    m_pDatabase = nullptr;
+}
+
+void WriteBehindStore::Put(uint32_t aKind, const String& acKey, String aData)
+{
+    auto [itor, inserted] = m_pending.try_emplace(MakePendingKey(aKind, acKey));
+    if (!inserted)
+        ++m_coalesced;
+
+    auto& record = itor.value();
+    record.Kind = aKind;
+    record.Key = acKey;
+    record.Data = std::move(aData);
+    record.Erased = false;
+
+    ++m_changes;
+}
+
+void WriteBehindStore::Erase(uint32_t aKind, const String& acKey)
+{
+    auto [itor, inserted] = m_pending.try_emplace(MakePendingKey(aKind, acKey));
+    if (!inserted)
+        ++m_coalesced;
+
+    auto& record = itor.value();
+    record.Kind = aKind;
+    record.Key = acKey;
+    record.Data.clear();
+    record.Erased = true;
+
+    ++m_changes;
+}
+
+bool WriteBehindStore::Flush()
+{
+    if (m_pending.empty())
+        return true;
+
+    if (!IsOpen() || m_batches.full())
+    {
+        ++m_deferredFlushes;
+        return false;
+    }
+
+    Batch batch;
+    batch.reserve(m_pending.size());
+
+    for (auto itor = std::begin(m_pending); itor != std::end(m_pending); ++itor)
+        batch.push_back(std::move(itor.value()));
+
+    m_pending.clear();
+
+    // Only this thread pushes, the queue can't have filled up since the check
+    m_batches.try_push(batch);
+    ++m_submittedBatches;
+
+    m_wakeCondition.notify_all();
+
+    return true;
+}
+
+size_t WriteBehindStore::Load(uint32_t aKind, const std::function<void(const String& acKey, const String& acData)>& acCallback) const
+{
+    sqlite3* pDatabase = nullptr;
+    if (sqlite3_open_v2(m_path.string().c_str(), &pDatabase, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK)
+    {
+        spdlog::error("[Persistence] Unable to open {} for reading: {}", m_path.string(), sqlite3_errmsg(pDatabase));
+        sqlite3_close(pDatabase);
+        return 0;
+    }
+
+    size_t count = 0;
+
+    sqlite3_stmt* pStatement = nullptr;
+    if (sqlite3_prepare_v2(pDatabase, kSelect, -1, &pStatement, nullptr) == SQLITE_OK)
+    {
+        sqlite3_bind_int64(pStatement, 1, aKind);
+
+        String key;
+        String data;
+        while (sqlite3_step(pStatement) == SQLITE_ROW)
+        {
+            ReadBlob(pStatement, 0, key);
+            ReadBlob(pStatement, 1, data);
+
+            acCallback(key, data);
+            ++count;
+        }
+    }
+    else
+    {
+        spdlog::error("[Persistence] Unable to read {}: {}", m_path.string(), sqlite3_errmsg(pDatabase));
+    }
+
+    sqlite3_finalize(pStatement);
+    sqlite3_close(pDatabase);
+
+    return count;
+}
+
+void WriteBehindStore::WaitIdle()
+{
+    while (m_committedBatches.load(std::memory_order_acquire) < m_submittedBatches && !m_failing.load(std::memory_order_acquire))
+    {
+        std::unique_lock lock(m_wakeMutex);
+        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+WriteBehindStore::Stats WriteBehindStore::GetStats() const noexcept
+{
+    Stats stats;
+    stats.Changes = m_changes;
+    stats.Coalesced = m_coalesced;
+    stats.DeferredFlushes = m_deferredFlushes;
+    stats.WrittenRecords = m_writtenRecords.load(std::memory_order_relaxed);
+    stats.Transactions = m_transactions.load(std::memory_order_relaxed);
+    stats.FailedTransactions = m_failedTransactions.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void WriteBehindStore::Run()
+{
+    if (m_onWriterStart)
+        m_onWriterStart();
+
+    while (true)
+    {
+        if (auto batch = m_batches.try_pop())
+        {
+            // Retried until it goes through, the batches behind it must not overtake it
+            while (!Commit(*batch))
+            {
+                m_failedTransactions.fetch_add(1, std::memory_order_relaxed);
+                m_failing.store(true, std::memory_order_release);
+                m_wakeCondition.notify_all();
+
+                if (!m_running)
+                {
+                    spdlog::error("[Persistence] Dropping {} records on shutdown, the database can't be written to", batch->size());
+                    break;
+                }
+
+                std::unique_lock lock(m_wakeMutex);
+                m_wakeCondition.wait_for(lock, kWriterRetryWait);
+            }
+
+            m_committedBatches.fetch_add(1, std::memory_order_release);
+            m_wakeCondition.notify_all();
+            continue;
+        }
+
+        // Only leave once the queue is drained
+        if (!m_running)
+            break;
+
+        std::unique_lock lock(m_wakeMutex);
+        m_wakeCondition.wait_for(lock, kWriterIdleWait);
+    }
+}
+
+bool WriteBehindStore::Commit(const Batch& acBatch)
+{
+    if (!Execute(m_pDatabase, "BEGIN;"))
+        return false;
+
+    for (const auto& record : acBatch)
+    {
+        auto* pStatement = record.Erased ? m_pDeleteStatement : m_pUpsertStatement;
+
+        sqlite3_bind_int64(pStatement, 1, record.Kind);
+        sqlite3_bind_blob(pStatement, 2, record.Key.data(), static_cast<int>(record.Key.size()), SQLITE_STATIC);
+        if (!record.Erased)
+            sqlite3_bind_blob(pStatement, 3, record.Data.data(), static_cast<int>(record.Data.size()), SQLITE_STATIC);
+
+        const bool cWritten = sqlite3_step(pStatement) == SQLITE_DONE;
+        if (!cWritten)
+            spdlog::error("[Persistence] Unable to write record {}: {}", record.Kind, sqlite3_errmsg(m_pDatabase));
+
+        sqlite3_reset(pStatement);
+        sqlite3_clear_bindings(pStatement);
+
+        if (!cWritten)
+        {
+            Rollback(m_pDatabase);
+            return false;
+        }
+    }
+
+    // A failed commit can leave the transaction open, every later BEGIN would fail
+    if (!Execute(m_pDatabase, "COMMIT;"))
+    {
+        Rollback(m_pDatabase);
+        return false;
+    }
+
+    m_failing.store(false, std::memory_order_release);
+    m_writtenRecords.fetch_add(acBatch.size(), std::memory_order_relaxed);
+    m_transactions.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+String WriteBehindStore::MakePendingKey(uint32_t aKind, const String& acKey)
+{
+    String pendingKey(reinterpret_cast<const char*>(&aKind), sizeof(aKind));
+    pendingKey += acKey;
+
+    return pendingKey;
+}
+} // namespace Persistence
@@ -0,0 +1,118 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+#pragma once
+
+#include <TiltedCore/Stl.hpp>
+#include <base/containers/spsc_queue.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace Persistence
+{
+using TiltedPhoques::String;
+using TiltedPhoques::Vector;
+
+// Key/value store backed by sqlite where writes are batched and committed by a background thread.
+// Put, Erase and Flush are meant for a single thread (the game thread) and never touch the disk.
+class WriteBehindStore
+{
+public:
+    struct Stats
+    {
+        // Changes received through Put and Erase
+        uint64_t Changes{0};
+        // Changes overwritten by a later one before reaching the writer
+        uint64_t Coalesced{0};
+        uint64_t WrittenRecords{0};
+        uint64_t Transactions{0};
+        // Flushes refused because the writer was too far behind
+        uint64_t DeferredFlushes{0};
+        // Transactions rolled back, a batch counts once per attempt
+        uint64_t FailedTransactions{0};
+    };
+
+    WriteBehindStore() = default;
+    ~WriteBehindStore();
+
+    WriteBehindStore(const WriteBehindStore&) = delete;
+    WriteBehindStore& operator=(const WriteBehindStore&) = delete;
+
+    // Opens or creates the database in WAL mode and starts the writer thread, aOnWriterStart runs first on that thread
+    bool Open(const std::filesystem::path& acPath, std::function<void()> aOnWriterStart = {});
+    // Flushes what is pending, waits for the writer to finish and closes the database
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_pDatabase != nullptr; }
+
+    // The last change to a key before a Flush wins
+    void Put(uint32_t aKind, const String& acKey, String aData);
+    void Erase(uint32_t aKind, const String& acKey);
+
+    // Hands the pending changes to the writer thread, returns false and keeps them if the writer is behind
+    bool Flush();
+
+    // Reads every record of a kind, meant for startup before any change of that kind is journaled
+    size_t Load(uint32_t aKind, const std::function<void(const String& acKey, const String& acData)>& acCallback) const;
+
+    // Blocks until everything flushed so far is committed, for shutdown and tests. Returns early while commits fail.
+    void WaitIdle();
+
+    [[nodiscard]] size_t GetPendingCount() const noexcept { return m_pending.size(); }
+    [[nodiscard]] Stats GetStats() const noexcept;
+
+private:
+    struct Record
+    {
+        uint32_t Kind{};
+        String Key{};
+        String Data{};
+        bool Erased{false};
+    };
+
+    using Batch = Vector<Record>;
+
+    void Run();
+    // Rolls back and returns false if any part of the batch can't be written
+    bool Commit(const Batch& acBatch);
+
+    static String MakePendingKey(uint32_t aKind, const String& acKey);
+
+    sqlite3* m_pDatabase{nullptr};
+    sqlite3_stmt* m_pUpsertStatement{nullptr};
+    sqlite3_stmt* m_pDeleteStatement{nullptr};
+    std::filesystem::path m_path;
+
+    // Game thread side
+    TiltedPhoques::Map<String, Record> m_pending;
+    uint64_t m_submittedBatches{0};
+    uint64_t m_changes{0};
+    uint64_t m_coalesced{0};
+    uint64_t m_deferredFlushes{0};
+
+    spsc_queue<Batch, 6> m_batches;
+
+    // Writer thread side
+    std::thread m_writer;
+    std::function<void()> m_onWriterStart;
+    std::atomic<bool> m_running{false};
+    // Committed, or dropped because the database still couldn't be written to at shutdown
+    std::atomic<uint64_t> m_committedBatches{0};
+    std::atomic<uint64_t> m_writtenRecords{0};
+    std::atomic<uint64_t> m_transactions{0};
+    std::atomic<uint64_t> m_failedTransactions{0};
+    // Set while the oldest batch keeps failing, the later ones wait behind it
+    std::atomic<bool> m_failing{false};
+
+    // Only used to put the writer to sleep, the data itself goes through the queue
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+};
+} // namespace Persistence
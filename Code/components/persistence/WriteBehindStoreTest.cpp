@@ -0,0 +1,253 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <gtest/gtest.h>
+#include <persistence/WriteBehindStore.h>
+
+#include <chrono>
+#include <cstdio>
+#include <sqlite3.h>
+#include <thread>
+
+namespace Persistence
+{
+namespace
+{
+constexpr uint32_t kObjects = 1;
+constexpr uint32_t kQuests = 2;
+
+std::filesystem::path MakeDatabasePath(const char* acpName)
+{
+    auto path = std::filesystem::temp_directory_path() / acpName;
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    std::filesystem::remove(path.string() + "-wal", ec);
+    std::filesystem::remove(path.string() + "-shm", ec);
+
+    return path;
+}
+
+TiltedPhoques::Map<String, String> LoadAll(const WriteBehindStore& acStore, uint32_t aKind)
+{
+    TiltedPhoques::Map<String, String> records;
+    acStore.Load(aKind, [&records](const String& acKey, const String& acData) { records[acKey] = acData; });
+
+    return records;
+}
+
+TEST(WriteBehindStore, RestoresCommittedRecords)
+{
+    const auto cPath = MakeDatabasePath("tp_persistence_restore.db");
+
+    {
+        WriteBehindStore store;
+        ASSERT_TRUE(store.Open(cPath));
+
+        store.Put(kObjects, "door", "locked");
+        store.Put(kObjects, "chest", "");
+        store.Put(kQuests, "player", "quests");
+        EXPECT_EQ(store.GetPendingCount(), 3);
+
+        EXPECT_TRUE(store.Flush());
+        EXPECT_EQ(store.GetPendingCount(), 0);
+    }
+
+    WriteBehindStore store;
+    ASSERT_TRUE(store.Open(cPath));
+
+    auto objects = LoadAll(store, kObjects);
+    ASSERT_EQ(objects.size(), 2);
+    EXPECT_EQ(objects["door"], "locked");
+    EXPECT_EQ(objects["chest"], "");
+
+    auto quests = LoadAll(store, kQuests);
+    ASSERT_EQ(quests.size(), 1);
+    EXPECT_EQ(quests["player"], "quests");
+}
+
+TEST(WriteBehindStore, LastChangeWins)
+{
+    const auto cPath = MakeDatabasePath("tp_persistence_coalesce.db");
+
+    WriteBehindStore store;
+    ASSERT_TRUE(store.Open(cPath));
+
+    store.Put(kObjects, "door", "locked");
+    store.Put(kObjects, "door", "unlocked");
+    store.Put(kObjects, "chest", "full");
+    store.Erase(kObjects, "chest");
+    EXPECT_EQ(store.GetPendingCount(), 2);
+
+    ASSERT_TRUE(store.Flush());
+    store.WaitIdle();
+
+    auto objects = LoadAll(store, kObjects);
+    ASSERT_EQ(objects.size(), 1);
+    EXPECT_EQ(objects["door"], "unlocked");
+
+    const auto cStats = store.GetStats();
+    EXPECT_EQ(cStats.Changes, 4);
+    EXPECT_EQ(cStats.Coalesced, 2);
+    EXPECT_EQ(cStats.WrittenRecords, 2);
+    EXPECT_EQ(cStats.Transactions, 1);
+}
+
+TEST(WriteBehindStore, EraseRemovesCommittedRecord)
+{
+    const auto cPath = MakeDatabasePath("tp_persistence_erase.db");
+
+    WriteBehindStore store;
+    ASSERT_TRUE(store.Open(cPath));
+
+    store.Put(kObjects, "door", "locked");
+    ASSERT_TRUE(store.Flush());
+    store.WaitIdle();
+    EXPECT_EQ(LoadAll(store, kObjects).size(), 1);
+
+    store.Erase(kObjects, "door");
+    ASSERT_TRUE(store.Flush());
+    store.WaitIdle();
+    EXPECT_TRUE(LoadAll(store, kObjects).empty());
+}
+
+TEST(WriteBehindStore, KeepsChangesWhileClosed)
+{
+    WriteBehindStore store;
+
+    store.Put(kObjects, "door", "locked");
+    EXPECT_FALSE(store.Flush());
+    EXPECT_EQ(store.GetPendingCount(), 1);
+    EXPECT_EQ(store.GetStats().DeferredFlushes, 1);
+}
+
+TEST(WriteBehindStore, RunsStartHookOnWriter)
+{
+    const auto cPath = MakeDatabasePath("tp_persistence_start_hook.db");
+
+    std::thread::id writerId;
+    {
+        WriteBehindStore store;
+        ASSERT_TRUE(store.Open(cPath, [&writerId] { writerId = std::this_thread::get_id(); }));
+    }
+
+    // Closing joined the writer, the hook ran before it did anything else
+    EXPECT_NE(writerId, std::thread::id{});
+    EXPECT_NE(writerId, std::this_thread::get_id());
+}
+
+TEST(WriteBehindStore, RetriesFailedCommits)
+{
+    using namespace std::chrono_literals;
+
+    const auto cPath = MakeDatabasePath("tp_persistence_retry.db");
+
+    WriteBehindStore store;
+    ASSERT_TRUE(store.Open(cPath));
+
+    // Another connection holding the write lock makes every write of the store fail
+    sqlite3* pBlocker = nullptr;
+    ASSERT_EQ(sqlite3_open(cPath.string().c_str(), &pBlocker), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(pBlocker, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr), SQLITE_OK);
+
+    store.Put(kObjects, "door", "locked");
+    ASSERT_TRUE(store.Flush());
+    store.WaitIdle();
+
+    EXPECT_GE(store.GetStats().FailedTransactions, 1);
+    EXPECT_EQ(store.GetStats().WrittenRecords, 0);
+    EXPECT_TRUE(LoadAll(store, kObjects).empty());
+
+    // Queued behind the failed batch, it must not overtake it
+    store.Put(kObjects, "door", "unlocked");
+    ASSERT_TRUE(store.Flush());
+
+    ASSERT_EQ(sqlite3_exec(pBlocker, "COMMIT;", nullptr, nullptr, nullptr), SQLITE_OK);
+    sqlite3_close(pBlocker);
+
+    const auto cDeadline = std::chrono::steady_clock::now() + 10s;
+    while (store.GetStats().WrittenRecords < 2 && std::chrono::steady_clock::now() < cDeadline)
+        std::this_thread::sleep_for(10ms);
+
+    EXPECT_EQ(store.GetStats().Transactions, 2);
+
+    auto objects = LoadAll(store, kObjects);
+    ASSERT_EQ(objects.size(), 1);
+    EXPECT_EQ(objects["door"], "unlocked");
+}
+
+TEST(WriteBehindStore, ClosesWhileCommitsFail)
+{
+    const auto cPath = MakeDatabasePath("tp_persistence_failing.db");
+
+    sqlite3* pBlocker = nullptr;
+    {
+        WriteBehindStore store;
+        ASSERT_TRUE(store.Open(cPath));
+
+        ASSERT_EQ(sqlite3_open(cPath.string().c_str(), &pBlocker), SQLITE_OK);
+        ASSERT_EQ(sqlite3_exec(pBlocker, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr), SQLITE_OK);
+
+        store.Put(kObjects, "door", "locked");
+        ASSERT_TRUE(store.Flush());
+        store.WaitIdle();
+
+        // Gives up on the batch instead of waiting forever
+        store.Close();
+        EXPECT_EQ(store.GetStats().WrittenRecords, 0);
+    }
+
+    sqlite3_exec(pBlocker, "ROLLBACK;", nullptr, nullptr, nullptr);
+    sqlite3_close(pBlocker);
+}
+
+// Run with --gtest_also_run_disabled_tests
+TEST(WriteBehindStore, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t kCount = 100000;
+    constexpr uint32_t kBatch = 1000;
+
+    const auto cPath = MakeDatabasePath("tp_persistence_benchmark.db");
+
+    WriteBehindStore store;
+    ASSERT_TRUE(store.Open(cPath));
+
+    // Game thread cost: journal a tick worth of changes and hand them over
+    const String cPayload(96, 'x');
+    Clock::duration worstTick{};
+
+    const auto cStart = Clock::now();
+    for (uint32_t i = 0; i < kCount; i += kBatch)
+    {
+        const auto cTickStart = Clock::now();
+
+        for (uint32_t j = i; j < i + kBatch; ++j)
+            store.Put(kObjects, String(reinterpret_cast<const char*>(&j), sizeof(j)), cPayload);
+
+        store.Flush();
+
+        worstTick = std::max(worstTick, Clock::now() - cTickStart);
+    }
+    const auto cJournaled = Clock::now();
+
+    while (!store.Flush())
+        store.WaitIdle();
+    store.WaitIdle();
+    const auto cCommitted = Clock::now();
+
+    const auto cRestored = LoadAll(store, kObjects).size();
+    const auto cLoaded = Clock::now();
+
+    EXPECT_EQ(cRestored, kCount);
+
+    using std::chrono::duration;
+    printf("journal: %.2f ms total, worst tick %.3f ms\n", duration<double, std::milli>(cJournaled - cStart).count(),
+           duration<double, std::milli>(worstTick).count());
+    printf("commit: %.2f ms after the last flush, %llu transactions, %llu deferred flushes\n", duration<double, std::milli>(cCommitted - cJournaled).count(),
+           static_cast<unsigned long long>(store.GetStats().Transactions), static_cast<unsigned long long>(store.GetStats().DeferredFlushes));
+    printf("restore: %.2f ms for %zu records\n", duration<double, std::milli>(cLoaded - cCommitted).count(), cRestored);
+}
+} // namespace
+} // namespace Persistence
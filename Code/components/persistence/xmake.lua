@@ -0,0 +1,8 @@
+local function include_persistence()
+	add_packages("sqlite3")
+end
+
+component("Persistence")
+	include_persistence()
+unittest("Persistence")
+	include_persistence()
@@ -0,0 +1,74 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include "TickPacer.h"
+
+#include <algorithm>
+
+namespace Timing
+{
+namespace
+{
+TickPacer::Duration ToPeriod(uint32_t aTickRate) noexcept
+{
+    return std::chrono::duration_cast<TickPacer::Duration>(std::chrono::seconds(1)) / std::max(aTickRate, 1u);
+}
+} // namespace
+
+TickPacer::TickPacer(uint32_t aTickRate, uint32_t aMaxCatchUpTicks) noexcept
+    : m_tickRate(std::max(aTickRate, 1u))
+    , m_maxCatchUpTicks(aMaxCatchUpTicks)
+    , m_period(ToPeriod(aTickRate))
+{
+}
+
+void TickPacer::Start(TimePoint aNow) noexcept
+{
+    m_nextTick = aNow;
+}
+
+void TickPacer::SetTickRate(uint32_t aTickRate) noexcept
+{
+    aTickRate = std::max(aTickRate, 1u);
+    if (aTickRate == m_tickRate)
+        return;
+
+    const auto cPeriod = ToPeriod(aTickRate);
+    m_nextTick += cPeriod - m_period;
+    m_period = cPeriod;
+    m_tickRate = aTickRate;
+}
+
+TickPacer::Duration TickPacer::GetTimeUntilNextTick(TimePoint aNow) const noexcept
+{
+    if (aNow >= m_nextTick)
+        return Duration::zero();
+
+    return m_nextTick - aNow;
+}
+
+void TickPacer::OnTick(TimePoint aNow) noexcept
+{
+    const auto cLateness = aNow - m_nextTick;
+    const auto cJitterUs = static_cast<uint64_t>(std::chrono::abs(std::chrono::duration_cast<std::chrono::microseconds>(cLateness)).count());
+
+    m_stats.Ticks++;
+    m_stats.TotalJitterUs += cJitterUs;
+    m_stats.MaxJitterUs = std::max(m_stats.MaxJitterUs, cJitterUs);
+
+    if (cLateness >= m_period)
+        m_stats.Overruns++;
+
+    m_nextTick += m_period;
+
+    if (aNow < m_nextTick)
+        return;
+
+    const auto cDueTicks = static_cast<uint64_t>((aNow - m_nextTick) / m_period) + 1;
+    if (cDueTicks <= m_maxCatchUpTicks)
+        return;
+
+    m_stats.SkippedTicks += cDueTicks;
+    m_nextTick += m_period * cDueTicks;
+}
+} // namespace Timing
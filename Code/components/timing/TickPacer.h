@@ -0,0 +1,60 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace Timing
+{
+struct TickStats
+{
+    uint64_t Ticks{0};
+    // Ticks that started after the deadline of the following one
+    uint64_t Overruns{0};
+    // Ticks given up on because the loop fell too far behind to catch up
+    uint64_t SkippedTicks{0};
+    uint64_t TotalJitterUs{0};
+    uint64_t MaxJitterUs{0};
+
+    [[nodiscard]] double GetAverageJitterUs() const noexcept { return Ticks ? static_cast<double>(TotalJitterUs) / static_cast<double>(Ticks) : 0.0; }
+};
+
+// Keeps a loop on a fixed tick schedule. Deadlines move by whole periods rather than from when a tick ran,
+// so a late tick doesn't push back the ones after it. They run back to back to catch up, unless more than
+// aMaxCatchUpTicks are due at once, then the due ones are dropped and the schedule keeps its phase.
+// Time is passed in so the policy can be driven by any clock.
+class TickPacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = Clock::duration;
+
+    explicit TickPacer(uint32_t aTickRate, uint32_t aMaxCatchUpTicks = 3) noexcept;
+
+    // Restarts the schedule with the first tick due at aNow
+    void Start(TimePoint aNow) noexcept;
+    // Restarts the schedule if the rate changed, the next tick is due one new period after the last one
+    void SetTickRate(uint32_t aTickRate) noexcept;
+
+    // Zero when the next tick is due
+    [[nodiscard]] Duration GetTimeUntilNextTick(TimePoint aNow) const noexcept;
+    [[nodiscard]] bool IsTickDue(TimePoint aNow) const noexcept { return aNow >= m_nextTick; }
+
+    // Records the tick starting at aNow and moves on to the next deadline
+    void OnTick(TimePoint aNow) noexcept;
+
+    [[nodiscard]] uint32_t GetTickRate() const noexcept { return m_tickRate; }
+    [[nodiscard]] Duration GetPeriod() const noexcept { return m_period; }
+    [[nodiscard]] const TickStats& GetStats() const noexcept { return m_stats; }
+    void ResetStats() noexcept { m_stats = {}; }
+
+private:
+    uint32_t m_tickRate;
+    uint32_t m_maxCatchUpTicks;
+    Duration m_period;
+    TimePoint m_nextTick{};
+    TickStats m_stats{};
+};
+} // namespace Timing
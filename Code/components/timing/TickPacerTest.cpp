@@ -0,0 +1,93 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <gtest/gtest.h>
+#include <timing/TickPacer.h>
+
+namespace Timing
+{
+namespace
+{
+using namespace std::chrono_literals;
+
+const TickPacer::TimePoint kStart = TickPacer::TimePoint{} + 1h;
+
+TEST(TickPacer, WaitsUntilTheNextDeadline)
+{
+    TickPacer pacer(50);
+    pacer.Start(kStart);
+
+    EXPECT_TRUE(pacer.IsTickDue(kStart));
+    pacer.OnTick(kStart);
+
+    EXPECT_FALSE(pacer.IsTickDue(kStart + 5ms));
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(kStart + 5ms), 15ms);
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(kStart + 25ms), 0ms);
+}
+
+TEST(TickPacer, LateTicksDontShiftTheSchedule)
+{
+    TickPacer pacer(50);
+    pacer.Start(kStart);
+
+    pacer.OnTick(kStart);
+    pacer.OnTick(kStart + 27ms);
+
+    // Due 40ms after the start, not 20ms after the late tick
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(kStart + 27ms), 13ms);
+    EXPECT_EQ(pacer.GetStats().MaxJitterUs, 7000);
+    EXPECT_EQ(pacer.GetStats().Overruns, 0);
+}
+
+TEST(TickPacer, CatchesUpShortStalls)
+{
+    TickPacer pacer(50, 3);
+    pacer.Start(kStart);
+
+    pacer.OnTick(kStart);
+
+    // Stalled through the ticks at 20 and 40, the one at 60 isn't due yet
+    const auto cNow = kStart + 55ms;
+    pacer.OnTick(cNow);
+    EXPECT_EQ(pacer.GetStats().Overruns, 1);
+    EXPECT_TRUE(pacer.IsTickDue(cNow));
+
+    pacer.OnTick(cNow);
+    EXPECT_FALSE(pacer.IsTickDue(cNow));
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(cNow), 5ms);
+    EXPECT_EQ(pacer.GetStats().SkippedTicks, 0);
+}
+
+TEST(TickPacer, DropsLongStalls)
+{
+    TickPacer pacer(50, 3);
+    pacer.Start(kStart);
+
+    pacer.OnTick(kStart);
+
+    // 10 ticks behind, running them back to back would only make things worse
+    const auto cNow = kStart + 210ms;
+    pacer.OnTick(cNow);
+
+    EXPECT_EQ(pacer.GetStats().Ticks, 2);
+    EXPECT_EQ(pacer.GetStats().Overruns, 1);
+    EXPECT_EQ(pacer.GetStats().SkippedTicks, 9);
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(cNow), 10ms);
+}
+
+TEST(TickPacer, ChangingTheRateKeepsTheLastTick)
+{
+    TickPacer pacer(60);
+    pacer.Start(kStart);
+    pacer.OnTick(kStart);
+
+    pacer.SetTickRate(5);
+    EXPECT_EQ(pacer.GetTickRate(), 5);
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(kStart), 200ms);
+
+    pacer.SetTickRate(0);
+    EXPECT_EQ(pacer.GetTickRate(), 1);
+    EXPECT_EQ(pacer.GetTimeUntilNextTick(kStart), 1s);
+}
+} // namespace
+} // namespace Timing
@@ -0,0 +1,281 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include "TimerWheel.h"
+
+#include <algorithm>
+
+namespace Timing
+{
+TimerWheel::TimerWheel(uint64_t aNowMs) noexcept
+    : m_current(aNowMs)
+    , m_target(aNowMs)
+{
+    m_heads.fill(kNone);
+}
+
+TimerWheel::TimerId TimerWheel::ScheduleOnce(const char* apName, uint64_t aDelayMs, TCallback aCallback) noexcept
+{
+    return Schedule(apName, aDelayMs, 0, std::move(aCallback));
+}
+
+TimerWheel::TimerId TimerWheel::ScheduleRepeating(const char* apName, uint64_t aPeriodMs, TCallback aCallback, uint64_t aFirstDelayMs) noexcept
+{
+    // A zero period would fire on every millisecond, this is never what is wanted
+    return Schedule(apName, aFirstDelayMs, aPeriodMs ? aPeriodMs : 1, std::move(aCallback));
+}
+
+bool TimerWheel::Cancel(TimerId aTimer) noexcept
+{
+    const auto cIndex = Find(aTimer);
+    if (cIndex == kNone)
+        return false;
+
+    Release(cIndex);
+    return true;
+}
+
+bool TimerWheel::IsScheduled(TimerId aTimer) const noexcept
+{
+    return Find(aTimer) != kNone;
+}
+
+const TimerStats* TimerWheel::GetStats(TimerId aTimer) const noexcept
+{
+    const auto cIndex = Find(aTimer);
+    if (cIndex == kNone)
+        return nullptr;
+
+    return &m_timers[cIndex].Stats;
+}
+
+void TimerWheel::Advance(uint64_t aNowMs) noexcept
+{
+    m_target = aNowMs;
+
+    if (aNowMs <= m_current)
+        return;
+
+    // Nothing to run, skip the whole interval
+    if (m_count == 0)
+    {
+        m_current = aNowMs;
+        return;
+    }
+
+    // Stepping through more than the wheel covers is pointless, lay everything out again from just before now
+    if (aNowMs - m_current >= kWheelSpan)
+    {
+        m_current = aNowMs - 1;
+        for (uint32_t list = 0; list <= kOverflowList; ++list)
+            Redistribute(list, NextSlot());
+    }
+
+    while (m_current < aNowMs)
+    {
+        const auto cTime = ++m_current;
+        const auto cSlot = static_cast<uint32_t>(cTime & (kSlotCount - 1));
+
+        // Entering a new rotation of a level pulls the next slot of the level above down,
+        // what became due lands in the slot about to fire
+        if (cSlot == 0)
+        {
+            uint32_t level = 1;
+            for (; level < kLevelCount; ++level)
+            {
+                const auto cUpperSlot = static_cast<uint32_t>(cTime >> (kSlotBits * level)) & (kSlotCount - 1);
+                Redistribute(level * kSlotCount + cUpperSlot, cSlot);
+
+                if (cUpperSlot != 0)
+                    break;
+            }
+
+            if (level == kLevelCount)
+                Redistribute(kOverflowList, cSlot);
+        }
+
+        if (m_heads[cSlot] != kNone)
+        {
+            // Timers scheduled by the callbacks must not end up in the list being fired
+            for (auto index = m_heads[cSlot]; index != kNone; index = m_timers[index].Next)
+                m_timers[index].List = kFiringList;
+
+            m_heads[kFiringList] = m_heads[cSlot];
+            m_heads[cSlot] = kNone;
+
+            while (m_heads[kFiringList] != kNone)
+                Fire(m_heads[kFiringList]);
+        }
+
+        if (m_count == 0)
+        {
+            m_current = aNowMs;
+            break;
+        }
+    }
+}
+
+TimerWheel::TimerId TimerWheel::Schedule(const char* apName, uint64_t aDelayMs, uint64_t aPeriodMs, TCallback aCallback) noexcept
+{
+    uint32_t index = m_heads[kFreeList];
+    if (index != kNone)
+    {
+        Unlink(index);
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_timers.size());
+        m_timers.emplace_back().Generation = 1;
+    }
+
+    auto& timer = m_timers[index];
+    timer.Callback = std::move(aCallback);
+    timer.pName = apName;
+    timer.Deadline = m_current + aDelayMs;
+    timer.Period = aPeriodMs;
+    timer.Stats = {};
+
+    Insert(index, NextSlot());
+    ++m_count;
+
+    return static_cast<TimerId>(timer.Generation) << 32 | (index + 1);
+}
+
+void TimerWheel::Insert(uint32_t aIndex, uint32_t aDueList) noexcept
+{
+    const auto cDeadline = m_timers[aIndex].Deadline;
+
+    if (cDeadline <= m_current)
+    {
+        Link(aIndex, aDueList);
+        return;
+    }
+
+    const auto cDelta = cDeadline - m_current;
+    for (uint32_t level = 0; level < kLevelCount; ++level)
+    {
+        if (cDelta < uint64_t(1) << (kSlotBits * (level + 1)))
+        {
+            const auto cSlot = static_cast<uint32_t>(cDeadline >> (kSlotBits * level)) & (kSlotCount - 1);
+            Link(aIndex, level * kSlotCount + cSlot);
+            return;
+        }
+    }
+
+    Link(aIndex, kOverflowList);
+}
+
+void TimerWheel::Link(uint32_t aIndex, uint32_t aList) noexcept
+{
+    auto& timer = m_timers[aIndex];
+    timer.List = aList;
+    timer.Prev = kNone;
+    timer.Next = m_heads[aList];
+
+    if (timer.Next != kNone)
+        m_timers[timer.Next].Prev = aIndex;
+
+    m_heads[aList] = aIndex;
+}
+
+void TimerWheel::Unlink(uint32_t aIndex) noexcept
+{
+    auto& timer = m_timers[aIndex];
+
+    if (timer.Prev != kNone)
+        m_timers[timer.Prev].Next = timer.Next;
+    else
+        m_heads[timer.List] = timer.Next;
+
+    if (timer.Next != kNone)
+        m_timers[timer.Next].Prev = timer.Prev;
+
+    timer.Prev = kNone;
+    timer.Next = kNone;
+}
+
+void TimerWheel::Release(uint32_t aIndex) noexcept
+{
+    Unlink(aIndex);
+
+    auto& timer = m_timers[aIndex];
+    timer.Callback = nullptr;
+    ++timer.Generation;
+
+    Link(aIndex, kFreeList);
+    --m_count;
+}
+
+void TimerWheel::Redistribute(uint32_t aList, uint32_t aDueList) noexcept
+{
+    auto index = m_heads[aList];
+    m_heads[aList] = kNone;
+
+    while (index != kNone)
+    {
+        const auto cNext = m_timers[index].Next;
+        m_timers[index].Prev = kNone;
+        m_timers[index].Next = kNone;
+
+        Insert(index, aDueList);
+        index = cNext;
+    }
+}
+
+void TimerWheel::Fire(uint32_t aIndex) noexcept
+{
+    auto& timer = m_timers[aIndex];
+    const auto cGeneration = timer.Generation;
+
+    const auto cLateness = m_target - timer.Deadline;
+    timer.Stats.Fires++;
+    timer.Stats.TotalLatenessMs += cLateness;
+    timer.Stats.MaxLatenessMs = std::max(timer.Stats.MaxLatenessMs, cLateness);
+
+    // The callback is moved out as it may schedule timers and grow the storage under us
+    auto callback = std::move(timer.Callback);
+
+    if (timer.Period == 0)
+    {
+        Release(aIndex);
+        callback();
+        return;
+    }
+
+    Unlink(aIndex);
+
+    // Periods that went by entirely before we got here are dropped rather than fired in a burst
+    auto next = timer.Deadline + timer.Period;
+    if (next <= m_target)
+    {
+        const auto cMissed = (m_target - timer.Deadline) / timer.Period;
+        timer.Stats.Overruns += cMissed;
+        next = timer.Deadline + timer.Period * (cMissed + 1);
+    }
+
+    timer.Deadline = next;
+    Insert(aIndex, NextSlot());
+
+    callback();
+
+    // Still the same timer unless the callback cancelled it
+    auto& current = m_timers[aIndex];
+    if (current.Generation == cGeneration)
+        current.Callback = std::move(callback);
+}
+
+uint32_t TimerWheel::Find(TimerId aTimer) const noexcept
+{
+    const auto cIndex = static_cast<uint32_t>(aTimer & 0xFFFFFFFF) - 1;
+    const auto cGeneration = static_cast<uint32_t>(aTimer >> 32);
+
+    if (aTimer == kInvalidTimer || cIndex >= m_timers.size())
+        return kNone;
+
+    const auto& timer = m_timers[cIndex];
+    if (timer.Generation != cGeneration || timer.List == kFreeList)
+        return kNone;
+
+    return cIndex;
+}
+} // namespace Timing
@@ -0,0 +1,114 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Timing
+{
+struct TimerStats
+{
+    uint64_t Fires{0};
+    // Periods a repeating timer skipped because it was serviced too late
+    uint64_t Overruns{0};
+    uint64_t TotalLatenessMs{0};
+    uint64_t MaxLatenessMs{0};
+
+    [[nodiscard]] double GetAverageLatenessMs() const noexcept { return Fires ? static_cast<double>(TotalLatenessMs) / static_cast<double>(Fires) : 0.0; }
+};
+
+// Hierarchical timer wheel with a millisecond resolution, four levels of 64 slots cover about 4.6 hours,
+// later deadlines wait in an overflow list. Scheduling and cancelling are O(1), advancing only touches
+// the slots that are due so an empty wheel costs nothing.
+// Callbacks may schedule and cancel timers, including their own.
+class TimerWheel
+{
+public:
+    using TimerId = uint64_t;
+    using TCallback = std::function<void()>;
+
+    static constexpr TimerId kInvalidTimer = 0;
+
+    explicit TimerWheel(uint64_t aNowMs = 0) noexcept;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // The name must outlive the timer, it is only used for reporting. Due timers run on the next step of Advance.
+    TimerId ScheduleOnce(const char* apName, uint64_t aDelayMs, TCallback aCallback) noexcept;
+    TimerId ScheduleRepeating(const char* apName, uint64_t aPeriodMs, TCallback aCallback, uint64_t aFirstDelayMs) noexcept;
+    TimerId ScheduleRepeating(const char* apName, uint64_t aPeriodMs, TCallback aCallback) noexcept { return ScheduleRepeating(apName, aPeriodMs, std::move(aCallback), aPeriodMs); }
+
+    bool Cancel(TimerId aTimer) noexcept;
+    [[nodiscard]] bool IsScheduled(TimerId aTimer) const noexcept;
+
+    // Runs every timer due up to aNowMs
+    void Advance(uint64_t aNowMs) noexcept;
+
+    [[nodiscard]] uint64_t GetTime() const noexcept { return m_current; }
+    [[nodiscard]] size_t GetCount() const noexcept { return m_count; }
+    [[nodiscard]] const TimerStats* GetStats(TimerId aTimer) const noexcept;
+
+    // aFunc(const char* apName, uint64_t aPeriodMs, const TimerStats& acStats)
+    template <class TFunc> void ForEachTimer(TFunc&& aFunc) const
+    {
+        for (const auto& timer : m_timers)
+        {
+            if (timer.List != kFreeList)
+                aFunc(timer.pName, timer.Period, timer.Stats);
+        }
+    }
+
+private:
+    static constexpr uint32_t kSlotBits = 6;
+    static constexpr uint32_t kSlotCount = 1 << kSlotBits;
+    static constexpr uint32_t kLevelCount = 4;
+    static constexpr uint32_t kNone = 0xFFFFFFFF;
+
+    // Lists are the wheel slots followed by a few special ones
+    static constexpr uint32_t kOverflowList = kSlotCount * kLevelCount;
+    static constexpr uint32_t kFiringList = kOverflowList + 1;
+    static constexpr uint32_t kFreeList = kOverflowList + 2;
+    static constexpr uint32_t kListCount = kOverflowList + 3;
+
+    static constexpr uint64_t kWheelSpan = uint64_t(1) << (kSlotBits * kLevelCount);
+
+    struct Timer
+    {
+        TCallback Callback;
+        const char* pName{nullptr};
+        uint64_t Deadline{0};
+        uint64_t Period{0};
+        uint32_t Generation{0};
+        uint32_t List{kFreeList};
+        uint32_t Prev{kNone};
+        uint32_t Next{kNone};
+        TimerStats Stats;
+    };
+
+    TimerId Schedule(const char* apName, uint64_t aDelayMs, uint64_t aPeriodMs, TCallback aCallback) noexcept;
+
+    // Timers already due go to aDueList
+    void Insert(uint32_t aIndex, uint32_t aDueList) noexcept;
+    void Link(uint32_t aIndex, uint32_t aList) noexcept;
+    void Unlink(uint32_t aIndex) noexcept;
+    void Release(uint32_t aIndex) noexcept;
+    // Moves every timer of a list back into the wheel relative to the current time
+    void Redistribute(uint32_t aList, uint32_t aDueList) noexcept;
+    void Fire(uint32_t aIndex) noexcept;
+
+    [[nodiscard]] uint32_t Find(TimerId aTimer) const noexcept;
+    // Slot of the next step, where anything due goes once the current one has been fired
+    [[nodiscard]] uint32_t NextSlot() const noexcept { return static_cast<uint32_t>((m_current + 1) & (kSlotCount - 1)); }
+
+    std::vector<Timer> m_timers;
+    std::array<uint32_t, kListCount> m_heads;
+    uint64_t m_current;
+    // Time Advance was asked to reach, lateness is measured against it
+    uint64_t m_target;
+    size_t m_count{0};
+};
+} // namespace Timing
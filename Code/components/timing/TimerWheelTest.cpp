@@ -0,0 +1,199 @@
+// Copyright (C) 2022 TiltedPhoques SRL.
+// For licensing information see LICENSE at the root of this distribution.
+
+#include <gtest/gtest.h>
+#include <timing/TimerWheel.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace Timing
+{
+namespace
+{
+TEST(TimerWheel, OneShotFiresOnceAtItsDeadline)
+{
+    TimerWheel wheel(1000);
+
+    uint32_t fired = 0;
+    const auto cTimer = wheel.ScheduleOnce("once", 10, [&fired] { ++fired; });
+
+    wheel.Advance(1009);
+    EXPECT_EQ(fired, 0);
+    EXPECT_TRUE(wheel.IsScheduled(cTimer));
+
+    wheel.Advance(1010);
+    EXPECT_EQ(fired, 1);
+    EXPECT_FALSE(wheel.IsScheduled(cTimer));
+    EXPECT_EQ(wheel.GetCount(), 0);
+
+    wheel.Advance(5000);
+    EXPECT_EQ(fired, 1);
+}
+
+TEST(TimerWheel, RepeatingTimersTrackLatenessAndOverruns)
+{
+    TimerWheel wheel;
+
+    uint32_t fired = 0;
+    const auto cTimer = wheel.ScheduleRepeating("repeat", 20, [&fired] { ++fired; });
+
+    for (uint64_t now = 5; now <= 100; now += 5)
+        wheel.Advance(now);
+
+    EXPECT_EQ(fired, 5);
+    EXPECT_EQ(wheel.GetStats(cTimer)->MaxLatenessMs, 0);
+
+    // A stall of 95ms: one late run instead of a burst, the periods in between are counted as overruns
+    wheel.Advance(195);
+    EXPECT_EQ(fired, 6);
+    EXPECT_EQ(wheel.GetStats(cTimer)->MaxLatenessMs, 75);
+    EXPECT_EQ(wheel.GetStats(cTimer)->Overruns, 3);
+
+    wheel.Advance(200);
+    EXPECT_EQ(fired, 7);
+}
+
+TEST(TimerWheel, CallbacksCanScheduleAndCancel)
+{
+    TimerWheel wheel;
+
+    std::vector<int> order;
+    TimerWheel::TimerId repeating = TimerWheel::kInvalidTimer;
+    TimerWheel::TimerId doomed = TimerWheel::kInvalidTimer;
+
+    repeating = wheel.ScheduleRepeating("self cancel", 10,
+                                        [&]
+                                        {
+                                            order.push_back(1);
+                                            wheel.Cancel(repeating);
+                                            wheel.Cancel(doomed);
+                                            wheel.ScheduleOnce("chained", 0, [&order] { order.push_back(2); });
+                                        });
+    doomed = wheel.ScheduleOnce("doomed", 11, [&order] { order.push_back(3); });
+
+    wheel.Advance(100);
+
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+    EXPECT_EQ(wheel.GetCount(), 0);
+}
+
+TEST(TimerWheel, StaleIdsDoNotTouchNewTimers)
+{
+    TimerWheel wheel;
+
+    const auto cFirst = wheel.ScheduleOnce("first", 10, [] {});
+    EXPECT_TRUE(wheel.Cancel(cFirst));
+    EXPECT_FALSE(wheel.Cancel(cFirst));
+
+    // Reuses the storage of the first one
+    const auto cSecond = wheel.ScheduleOnce("second", 10, [] {});
+    EXPECT_NE(cFirst, cSecond);
+    EXPECT_FALSE(wheel.Cancel(cFirst));
+    EXPECT_TRUE(wheel.IsScheduled(cSecond));
+    EXPECT_FALSE(wheel.IsScheduled(TimerWheel::kInvalidTimer));
+}
+
+// Compares against a plain sorted map with random delays spanning every level and the overflow list
+TEST(TimerWheel, MatchesReferenceScheduler)
+{
+    std::mt19937_64 random(42);
+
+    TimerWheel wheel(123456);
+    std::multimap<uint64_t, uint32_t> reference;
+    std::map<uint32_t, TimerWheel::TimerId> ids;
+    std::vector<std::pair<uint64_t, uint32_t>> fired;
+
+    uint64_t now = 123456;
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        uint64_t delay = random() % 100;
+        switch (random() % 4)
+        {
+        case 0: delay = random() % 5000; break;
+        case 1: delay = random() % 400000; break;
+        case 2: delay = random() % 40000000; break;
+        default: break;
+        }
+
+        // Time already went up to now, a zero delay runs on the next step
+        const auto cDeadline = now + std::max<uint64_t>(delay, 1);
+        ids[i] = wheel.ScheduleOnce("random", delay, [&fired, &now, i] { fired.emplace_back(now, i); });
+        reference.emplace(cDeadline, i);
+
+        // Cancel an earlier one from time to time
+        if (random() % 8 == 0 && !ids.empty())
+        {
+            const auto cVictim = static_cast<uint32_t>(random() % (i + 1));
+            const auto cIdItor = ids.find(cVictim);
+            if (cIdItor != std::end(ids) && wheel.Cancel(cIdItor->second))
+            {
+                for (auto itor = std::begin(reference); itor != std::end(reference); ++itor)
+                {
+                    if (itor->second == cVictim)
+                    {
+                        reference.erase(itor);
+                        break;
+                    }
+                }
+            }
+        }
+
+        now += random() % (i % 100 == 0 ? 3000000 : 50);
+        wheel.Advance(now);
+
+        std::vector<std::pair<uint64_t, uint32_t>> expected;
+        while (!reference.empty() && std::begin(reference)->first <= now)
+        {
+            expected.emplace_back(now, std::begin(reference)->second);
+            reference.erase(std::begin(reference));
+        }
+
+        std::sort(std::begin(fired), std::end(fired));
+        std::sort(std::begin(expected), std::end(expected));
+        ASSERT_EQ(fired, expected) << "after advancing to " << now;
+        fired.clear();
+    }
+
+    EXPECT_EQ(wheel.GetCount(), reference.size());
+}
+
+// Run with --gtest_also_run_disabled_tests
+TEST(TimerWheel, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+    using std::chrono::duration;
+
+    constexpr uint32_t kTicks = 60 * 60;
+    constexpr uint64_t kTickMs = 16;
+
+    printf("%10s %16s %16s\n", "timers", "advance (us)", "fired");
+
+    for (const uint32_t cCount : {0u, 100u, 10000u, 100000u})
+    {
+        TimerWheel wheel;
+        uint64_t fired = 0;
+
+        // Mostly long running timers like invitation expiries, some fast repeating ones
+        for (uint32_t i = 0; i < cCount; ++i)
+        {
+            if (i % 100 == 0)
+                wheel.ScheduleRepeating("fast", 20 + i % 50, [&fired] { ++fired; });
+            else
+                wheel.ScheduleOnce("slow", 1000 + (i * 7919) % 120000, [&fired] { ++fired; });
+        }
+
+        const auto cStart = Clock::now();
+        for (uint32_t tick = 1; tick <= kTicks; ++tick)
+            wheel.Advance(tick * kTickMs);
+        const auto cElapsed = Clock::now() - cStart;
+
+        printf("%10u %16.3f %16llu\n", cCount, duration<double, std::micro>(cElapsed).count() / kTicks, static_cast<unsigned long long>(fired));
+    }
+}
+} // namespace
+} // namespace Timing
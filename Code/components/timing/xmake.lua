@@ -0,0 +1,2 @@
+component("Timing")
+unittest("Timing")
@@ -48,4 +48,8 @@ includes("console")
 includes("imgui")
 includes("es_loader")
 includes("crash_handler")
-includes("resources")	
\ No newline at end of file
+includes("resources")
+includes("persistence")
+includes("ecs")	
+includes("timing")
+includes("logging")
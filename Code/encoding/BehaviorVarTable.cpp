@@ -0,0 +1,38 @@
+#include <BehaviorVarTable.h>
+#include <Structs/Skyrim/BehaviorVarTables.h>
+
+#include <algorithm>
+
+namespace
+{
+// The human graph, every character has it
+constexpr uint64_t kMasterBehaviorKey = 17585368238253125375ull;
+
+constexpr const BehaviorVarTable& MasterBehavior()
+{
+    return *std::ranges::find(BehaviorVarTables::kTables, kMasterBehaviorKey, &BehaviorVarTable::Key);
+}
+
+// The tables are plain constants, a generator out of step with the lookups shows up while compiling
+static_assert(std::ranges::is_sorted(BehaviorVarTables::kTables, {}, &BehaviorVarTable::Key));
+static_assert(MasterBehavior().GetName(MasterBehavior().Find("Speed")) == "Speed");
+static_assert(MasterBehavior().FindFolded("SPEED") == MasterBehavior().Find("Speed"));
+static_assert(MasterBehavior().Find("speed") == BehaviorVarTable::kNotFound);
+} // namespace
+
+namespace BehaviorVarTables
+{
+const BehaviorVarTable* Get(uint64_t aKey) noexcept
+{
+    const auto itor = std::ranges::lower_bound(kTables, aKey, {}, &BehaviorVarTable::Key);
+    if (itor == std::end(kTables) || itor->Key != aKey)
+        return nullptr;
+
+    return &*itor;
+}
+
+std::span<const BehaviorVarTable> GetAll() noexcept
+{
+    return kTables;
+}
+} // namespace BehaviorVarTables
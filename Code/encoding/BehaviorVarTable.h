@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+// Names are hashed 8 bytes at a time, the generator packs them the same way
+static_assert(std::endian::native == std::endian::little);
+
+/**
+ * @brief Variables of one behavior graph as the game ships it, resolved by name or by value without building a map.
+ *
+ * The tables are generated by Tools/Scripts/generate_behavior_var_tables.py from the enums of the animation graph
+ * descriptors, the value of a variable is its index in Names. Names are found through a perfect hash of their
+ * case-folded text: the bucket of the hash picks a displacement, the displaced hash picks the slot, and the slot
+ * holds the only index the name can have, so a lookup is one hash and one comparison. Both arrays have a power of
+ * two size so they are indexed with a mask. Empty slots hold 0, a name that hashes there can't be Names[0] since
+ * that one has a slot of its own.
+ */
+struct BehaviorVarTable
+{
+    static constexpr uint32_t kNotFound = UINT32_MAX;
+
+    uint64_t Key;
+    std::span<const std::string_view> Names;
+    // Names in lower case, mods don't always spell a variable the way the game does
+    std::span<const std::string_view> FoldedNames;
+    std::span<const uint16_t> Displacements;
+    std::span<const uint16_t> Slots;
+
+    [[nodiscard]] static constexpr char Fold(char aChar) noexcept { return aChar >= 'A' && aChar <= 'Z' ? static_cast<char>(aChar - 'A' + 'a') : aChar; }
+
+    // Fold of the 8 bytes of a word at once
+    [[nodiscard]] static constexpr uint64_t FoldWord(uint64_t aWord) noexcept
+    {
+        constexpr uint64_t cOnes = 0x0101010101010101ull;
+        constexpr uint64_t cHighBits = 0x8080808080808080ull;
+
+        // Without their high bit the additions can't carry into the next byte
+        const uint64_t cLow = aWord & ~cHighBits;
+        const uint64_t cAtLeastA = cLow + (0x80 - 'A') * cOnes;
+        const uint64_t cAboveZ = cLow + (0x80 - 'Z' - 1) * cOnes;
+        const uint64_t cUpper = cAtLeastA & ~cAboveZ & ~aWord & cHighBits;
+
+        return aWord | (cUpper >> 2);
+    }
+
+    // Up to 8 bytes of aName from aOffset, little endian and zero padded
+    [[nodiscard]] static constexpr uint64_t Load(std::string_view aName, size_t aOffset, size_t aCount) noexcept
+    {
+        if (!std::is_constant_evaluated() && aCount == sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, aName.data() + aOffset, sizeof(word));
+            return word;
+        }
+
+        uint64_t word = 0;
+        for (size_t i = 0; i < aCount; ++i)
+            word |= static_cast<uint64_t>(static_cast<uint8_t>(aName[aOffset + i])) << (i * 8);
+
+        return word;
+    }
+
+    // splitmix64 finalizer
+    [[nodiscard]] static constexpr uint64_t Mix(uint64_t aValue) noexcept
+    {
+        aValue ^= aValue >> 30;
+        aValue *= 0xBF58476D1CE4E5B9ull;
+        aValue ^= aValue >> 27;
+        aValue *= 0x94D049BB133111EBull;
+        aValue ^= aValue >> 31;
+
+        return aValue;
+    }
+
+    // Hash of the case-folded name, the generator computes the same
+    [[nodiscard]] static constexpr uint64_t Hash(std::string_view aName) noexcept
+    {
+        uint64_t hash = 0x9E3779B97F4A7C15ull ^ aName.size();
+        for (size_t i = 0; i < aName.size(); i += sizeof(uint64_t))
+        {
+            hash = (hash ^ FoldWord(Load(aName, i, std::min(aName.size() - i, sizeof(uint64_t))))) * 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 29;
+        }
+
+        return Mix(hash);
+    }
+
+    // Value of the variable named exactly aName, kNotFound when the graph has none
+    [[nodiscard]] constexpr uint32_t Find(std::string_view aName) const noexcept
+    {
+        const uint32_t cIndex = Candidate(Hash(aName));
+        return Names[cIndex] == aName ? cIndex : kNotFound;
+    }
+
+    // Same as Find ignoring case
+    [[nodiscard]] constexpr uint32_t FindFolded(std::string_view aName) const noexcept
+    {
+        const uint32_t cIndex = Candidate(Hash(aName));
+        const auto cFolded = FoldedNames[cIndex];
+        if (cFolded.size() != aName.size())
+            return kNotFound;
+
+        for (size_t i = 0; i < aName.size(); i += sizeof(uint64_t))
+        {
+            const auto cCount = std::min(aName.size() - i, sizeof(uint64_t));
+            if (FoldWord(Load(aName, i, cCount)) != Load(cFolded, i, cCount))
+                return kNotFound;
+        }
+
+        return cIndex;
+    }
+
+    // Name of the variable with this value, empty when the graph has none
+    [[nodiscard]] constexpr std::string_view GetName(uint32_t aValue) const noexcept { return aValue < Names.size() ? Names[aValue] : std::string_view{}; }
+
+    [[nodiscard]] constexpr size_t Size() const noexcept { return Names.size(); }
+
+private:
+    [[nodiscard]] constexpr uint32_t Candidate(uint64_t aHash) const noexcept
+    {
+        const auto cDisplacement = Displacements[aHash & (Displacements.size() - 1)];
+        return Slots[Mix(aHash + cDisplacement) & (Slots.size() - 1)];
+    }
+};
+
+namespace BehaviorVarTables
+{
+// Table of the behavior graph with this key, nullptr for graphs the game doesn't ship
+[[nodiscard]] const BehaviorVarTable* Get(uint64_t aKey) noexcept;
+// Every table, sorted by key
+[[nodiscard]] std::span<const BehaviorVarTable> GetAll() noexcept;
+} // namespace BehaviorVarTables
@@ -0,0 +1,71 @@
+#include <DeadReckoning.h>
+
+#include <glm/geometric.hpp>
+
+#include <cmath>
+
+namespace
+{
+float AngleDistance(float aFrom, float aTo) noexcept
+{
+    constexpr float cTwoPi = 6.28318530718f;
+
+    return std::abs(std::remainder(aTo - aFrom, cTwoPi));
+}
+} // namespace
+
+bool DeadReckoning::State::IsMoving() const noexcept
+{
+    return Velocity != glm::vec3{};
+}
+
+glm::vec3 DeadReckoning::State::Predict(uint64_t aTick, uint64_t aMaxExtrapolation) const noexcept
+{
+    if (aTick <= Tick)
+        return Position;
+
+    const auto cElapsed = std::min(aTick - Tick, aMaxExtrapolation);
+
+    return Position + Velocity * static_cast<float>(cElapsed);
+}
+
+bool DeadReckoning::State::ShouldSend(const glm::vec3& acPosition, const glm::vec3& acRotation, uint64_t aTick, uint32_t aRevision, bool aHasActions, const Settings& acSettings) const noexcept
+{
+    if (!IsValid() || aHasActions || aRevision != Revision)
+        return true;
+
+    // Even a perfect prediction gets refreshed every now and then so packet loss can't leave a reference stuck
+    if (aTick - Tick >= acSettings.MaxRefreshInterval)
+        return true;
+
+    if (AngleDistance(Rotation.x, acRotation.x) > acSettings.MaxRotationError || AngleDistance(Rotation.z, acRotation.z) > acSettings.MaxRotationError)
+        return true;
+
+    const auto cPredicted = Predict(aTick, acSettings.MaxRefreshInterval);
+
+    return glm::distance(cPredicted, acPosition) > acSettings.MaxPositionError;
+}
+
+void DeadReckoning::State::Commit(const glm::vec3& acPosition, const glm::vec3& acRotation, uint64_t aTick, uint32_t aRevision) noexcept
+{
+    if (IsValid() && aTick > Tick)
+        Velocity = (acPosition - Position) / static_cast<float>(aTick - Tick);
+    else
+        Velocity = {};
+
+    Position = acPosition;
+    Rotation = acRotation;
+    Tick = aTick;
+    Revision = aRevision;
+}
+
+glm::vec3 DeadReckoning::Extrapolate(const glm::vec3& acPrevious, uint64_t aPreviousTick, const glm::vec3& acLast, uint64_t aLastTick, uint64_t aTick, uint64_t aMaxExtrapolation) noexcept
+{
+    if (aTick <= aLastTick || aLastTick <= aPreviousTick)
+        return acLast;
+
+    const auto cVelocity = (acLast - acPrevious) / static_cast<float>(aLastTick - aPreviousTick);
+    const auto cElapsed = std::min(aTick - aLastTick, aMaxExtrapolation);
+
+    return acLast + cVelocity * static_cast<float>(cElapsed);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @brief Linear extrapolation model shared by the server snapshot filter and the client interpolation.
+ *
+ * Both sides predict a reference's position from the last two snapshots exchanged for it, so the server
+ * can skip a snapshot as long as the receiver's prediction stays close enough to the real position.
+ */
+struct DeadReckoning
+{
+    // Receivers stop extrapolating after this long without a snapshot
+    static constexpr uint64_t kMaxExtrapolation = 500;
+
+    struct Settings
+    {
+        // Maximum distance, in game units, between the predicted and the real position
+        float MaxPositionError{8.f};
+        // Maximum rotation drift, in radians, before a snapshot is forced
+        float MaxRotationError{0.05f};
+        // Maximum time, in ms, between two snapshots of a moving reference
+        uint64_t MaxRefreshInterval{kMaxExtrapolation};
+    };
+
+    // What the receiver last got for a reference
+    struct State
+    {
+        [[nodiscard]] bool IsValid() const noexcept { return Tick != 0; }
+        [[nodiscard]] bool IsMoving() const noexcept;
+
+        /**
+         * Position the receiver will display at the given tick.
+         * @param aTick Tick in ms, extrapolation is capped to the refresh interval.
+         */
+        [[nodiscard]] glm::vec3 Predict(uint64_t aTick, uint64_t aMaxExtrapolation) const noexcept;
+
+        /**
+         * Checks if a snapshot has to be sent for the receiver to stay in sync.
+         * @param acPosition Current position of the reference.
+         * @param acRotation Current rotation of the reference.
+         * @param aTick Tick of the snapshot being built.
+         * @param aRevision Revision of the animation state (variables, direction).
+         * @param aHasActions True when action events are pending, these can never be skipped.
+         */
+        [[nodiscard]] bool ShouldSend(const glm::vec3& acPosition, const glm::vec3& acRotation, uint64_t aTick, uint32_t aRevision, bool aHasActions, const Settings& acSettings) const noexcept;
+
+        // Record a snapshot as sent to the receiver
+        void Commit(const glm::vec3& acPosition, const glm::vec3& acRotation, uint64_t aTick, uint32_t aRevision) noexcept;
+
+        glm::vec3 Position{};
+        glm::vec3 Rotation{};
+        // Units per ms, derived from the last two snapshots like the receiver does
+        glm::vec3 Velocity{};
+        uint64_t Tick{0};
+        uint32_t Revision{0};
+    };
+
+    /**
+     * Extrapolates past the last of two snapshots, this is what remote clients do while no new snapshot arrives.
+     * @return The position at aTick, extrapolation is capped to aMaxExtrapolation ms past acLast.
+     */
+    [[nodiscard]] static glm::vec3 Extrapolate(const glm::vec3& acPrevious, uint64_t aPreviousTick, const glm::vec3& acLast, uint64_t aLastTick, uint64_t aTick, uint64_t aMaxExtrapolation) noexcept;
+};
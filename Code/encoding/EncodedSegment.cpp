@@ -0,0 +1,19 @@
+#include <EncodedSegment.h>
+
+void EncodedSegment::Assign(const TiltedPhoques::Buffer& acBuffer, const TiltedPhoques::Buffer::Writer& acWriter) noexcept
+{
+    BitCount = acWriter.GetBitPosition();
+    Data.assign(acBuffer.GetData(), acBuffer.GetData() + acWriter.Size());
+}
+
+void EncodedSegment::Write(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    // Copy whole bytes then the remaining bits
+    const auto cFullBytes = BitCount / 8;
+    const auto cRemainingBits = BitCount % 8;
+
+    aWriter.WriteBytes(Data.data(), cFullBytes);
+
+    if (cRemainingBits)
+        aWriter.WriteBits(Data[cFullBytes] & ((1u << cRemainingBits) - 1), cRemainingBits);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+using TiltedPhoques::Vector;
+
+/**
+ * @brief A piece of an encoded message kept aside to be copied into several packets.
+ *
+ * The stream is bit packed so a segment is rarely byte aligned once copied, it keeps the exact number
+ * of bits written along with the bytes holding them.
+ */
+struct EncodedSegment
+{
+    /**
+     * Captures everything written so far.
+     * @param acBuffer Buffer wrapped by the writer.
+     * @param acWriter Writer the segment was encoded with, starting at the beginning of the buffer.
+     */
+    void Assign(const TiltedPhoques::Buffer& acBuffer, const TiltedPhoques::Buffer::Writer& acWriter) noexcept;
+    // Appends the segment at the writer's current bit position
+    void Write(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+
+    [[nodiscard]] size_t GetBitCount() const noexcept { return BitCount; }
+
+    size_t BitCount{};
+    // Storage is kept when the segment is reassigned
+    Vector<uint8_t> Data{};
+};
@@ -0,0 +1,198 @@
+#include <Interpolation.h>
+
+#include <DeadReckoning.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+constexpr float cTwoPi = 6.28318530718f;
+constexpr float cHalfPi = 1.57079632679f;
+// Share of each new measurement in the transit and jitter averages, RFC 3550 uses 1/16
+constexpr float cSmoothing = 1.f / 16.f;
+
+// Signed shortest rotation from aFrom to aTo
+float DeltaAngle(float aFrom, float aTo) noexcept
+{
+    return std::remainder(aTo - aFrom, cTwoPi);
+}
+
+float WrapAngle(float aAngle) noexcept
+{
+    return std::fmod(std::fmod(aAngle, cTwoPi) + cTwoPi, cTwoPi);
+}
+} // namespace
+
+bool InterpolationBuffer::Add(const Point& acPoint) noexcept
+{
+    // Snapshots arrive in order nearly every time, check the back before searching
+    uint32_t index = m_size;
+    if (m_size > 0 && acPoint.Tick <= At(m_size - 1).Tick)
+    {
+        uint32_t low = 0;
+        uint32_t high = m_size;
+        while (low < high)
+        {
+            const auto cMiddle = (low + high) / 2;
+            if (At(cMiddle).Tick < acPoint.Tick)
+                low = cMiddle + 1;
+            else
+                high = cMiddle;
+        }
+
+        index = low;
+
+        if (At(index).Tick == acPoint.Tick)
+        {
+            At(index) = acPoint;
+            return true;
+        }
+    }
+
+    if (m_size == kCapacity)
+    {
+        // Playback needs the newest points, an older one can go
+        if (index == 0)
+            return false;
+
+        PopFront();
+        --index;
+    }
+
+    // Copy into the free slot, which keeps its animation variable storage, then bubble it into place
+    auto& slot = At(m_size);
+    slot = acPoint;
+    ++m_size;
+
+    for (auto i = m_size - 1; i > index; --i)
+        std::swap(At(i), At(i - 1));
+
+    return true;
+}
+
+bool InterpolationBuffer::Update(uint64_t aTick, Sample& aSample) noexcept
+{
+    if (m_size < 2)
+        return false;
+
+    while (m_size > 2 && aTick > At(1).Tick)
+        PopFront();
+
+    const auto& first = At(0);
+    const auto& second = At(1);
+
+    // Calculate delta movement since the first point, playback before it holds still
+    auto delta = 0.0001f;
+    const auto cTickDelta = static_cast<float>(second.Tick - first.Tick);
+    if (cTickDelta > 0.f)
+        delta = aTick > first.Tick ? static_cast<float>(aTick - first.Tick) / cTickDelta : 0.f;
+
+    delta = std::clamp(delta, 0.f, 1.f);
+
+    // The server skips snapshots it knows we can extrapolate, keep moving along the last known velocity
+    aSample.Extrapolated = aTick > second.Tick;
+    aSample.Position = aSample.Extrapolated
+                           ? DeadReckoning::Extrapolate(first.Position, first.Tick, second.Position, second.Tick, aTick, DeadReckoning::kMaxExtrapolation)
+                           : first.Position + (second.Position - first.Position) * delta;
+
+    const auto& rotA = first.Rotation;
+    const auto& rotB = second.Rotation;
+
+    auto finalX = WrapAngle(rotA.x + DeltaAngle(rotA.x, rotB.x) * delta);
+    if (finalX > cHalfPi)
+        finalX -= cTwoPi;
+
+    aSample.Rotation.x = finalX;
+    aSample.Rotation.y = WrapAngle(rotA.y + DeltaAngle(rotA.y, rotB.y) * delta);
+    aSample.Rotation.z = WrapAngle(rotA.z + DeltaAngle(rotA.z, rotB.z) * delta);
+
+    aSample.pTarget = &second;
+
+    return true;
+}
+
+void InterpolationBuffer::Clear() noexcept
+{
+    // Points stay allocated, the next ones will reuse them
+    m_head = 0;
+    m_size = 0;
+}
+
+void InterpolationBuffer::PopFront() noexcept
+{
+    m_head = (m_head + 1) % kCapacity;
+    --m_size;
+}
+
+PlayoutDelay::PlayoutDelay() noexcept
+    : PlayoutDelay(Settings{})
+{
+}
+
+PlayoutDelay::PlayoutDelay(const Settings& acSettings) noexcept
+    : m_settings(acSettings)
+    , m_delay(static_cast<float>(acSettings.MaxDelay))
+{
+}
+
+void PlayoutDelay::OnSnapshot(uint64_t aTick, uint64_t aNow) noexcept
+{
+    // Both clocks are synchronized, what's left is the one way delay plus the offset error
+    const auto cTransit = static_cast<int64_t>(aNow - aTick);
+
+    if (m_lastTick == 0)
+    {
+        m_transit = static_cast<float>(std::max<int64_t>(cTransit, 0));
+    }
+    else
+    {
+        m_transit += (static_cast<float>(std::max<int64_t>(cTransit, 0)) - m_transit) * cSmoothing;
+
+        const auto cVariation = static_cast<float>(std::abs(cTransit - m_lastTransit));
+        m_jitter += (cVariation - m_jitter) * cSmoothing;
+
+        if (aTick > m_lastTick && aTick - m_lastTick <= m_settings.MaxInterval)
+        {
+            const auto cInterval = static_cast<float>(aTick - m_lastTick);
+            m_interval = m_interval == 0.f ? cInterval : m_interval + (cInterval - m_interval) * cSmoothing;
+        }
+    }
+
+    m_lastTransit = cTransit;
+    m_lastTick = std::max(m_lastTick, aTick);
+}
+
+uint64_t PlayoutDelay::Update(uint64_t aNow) noexcept
+{
+    if (m_lastUpdate != 0 && aNow > m_lastUpdate)
+    {
+        const auto cMaxStep = static_cast<float>(aNow - m_lastUpdate) * m_settings.MaxSlewRate;
+        const auto cTarget = GetTargetDelay();
+
+        m_delay += std::clamp(cTarget - m_delay, -cMaxStep, cMaxStep);
+    }
+
+    m_lastUpdate = aNow;
+
+    const auto cDelay = static_cast<uint64_t>(m_delay);
+
+    return aNow > cDelay ? aNow - cDelay : 0;
+}
+
+void PlayoutDelay::Reset() noexcept
+{
+    *this = PlayoutDelay(m_settings);
+}
+
+float PlayoutDelay::GetTargetDelay() const noexcept
+{
+    // Until snapshots have been measured, keep the conservative delay
+    if (m_lastTick == 0)
+        return static_cast<float>(m_settings.MaxDelay);
+
+    const auto cTarget = m_transit + m_interval + m_settings.JitterMultiplier * m_jitter;
+
+    return std::clamp(cTarget, static_cast<float>(m_settings.MinDelay), static_cast<float>(m_settings.MaxDelay));
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <Structs/AnimationVariables.h>
+
+#include <array>
+
+/**
+ * @brief Snapshots of a remote reference waiting to be played back, and the math to sample them.
+ *
+ * Points live in a fixed ring kept sorted by tick, late snapshots are inserted with a binary search.
+ * Slots are reused once the ring has wrapped, animation variables included, so steady state playback
+ * doesn't allocate.
+ */
+struct InterpolationBuffer
+{
+    // Enough for the longest playout delay at the highest snapshot rate
+    static constexpr uint32_t kCapacity = 16;
+
+    struct Point
+    {
+        uint64_t Tick{};
+        glm::vec3 Position{};
+        glm::vec3 Rotation{};
+        AnimationVariables Variables{};
+        float Direction{};
+    };
+
+    struct Sample
+    {
+        glm::vec3 Position{};
+        glm::vec3 Rotation{};
+        // Point whose animation state applies, valid until the next Add
+        const Point* pTarget{nullptr};
+        // Playback went past the last point, the position follows the last known velocity
+        bool Extrapolated{false};
+    };
+
+    /**
+     * Stores a snapshot, a point with the tick of one already stored replaces it.
+     * @return False when the ring is full and the point is older than all the others.
+     */
+    bool Add(const Point& acPoint) noexcept;
+
+    /**
+     * Drops the points playback moved past and samples the buffer.
+     * @param aTick Playback tick, the current tick minus the playout delay.
+     * @return False with less than two points to interpolate between.
+     */
+    [[nodiscard]] bool Update(uint64_t aTick, Sample& aSample) noexcept;
+
+    void Clear() noexcept;
+
+    [[nodiscard]] uint32_t Size() const noexcept { return m_size; }
+    [[nodiscard]] bool Empty() const noexcept { return m_size == 0; }
+    // 0 is the oldest point
+    [[nodiscard]] const Point& operator[](uint32_t aIndex) const noexcept { return m_points[(m_head + aIndex) % kCapacity]; }
+
+private:
+    Point& At(uint32_t aIndex) noexcept { return m_points[(m_head + aIndex) % kCapacity]; }
+    void PopFront() noexcept;
+
+    std::array<Point, kCapacity> m_points{};
+    uint32_t m_head{0};
+    uint32_t m_size{0};
+};
+
+/**
+ * @brief Picks how far behind the synchronized clock remote references are played back.
+ *
+ * The delay has to cover the time a snapshot takes to arrive, the wait for the next one and how much
+ * both vary, otherwise playback runs out of points and has to extrapolate. Transit time and jitter are
+ * measured the way RTP does (RFC 3550), the delay then moves towards its target slowly enough for the
+ * change in playback speed not to show.
+ */
+struct PlayoutDelay
+{
+    struct Settings
+    {
+        uint64_t MinDelay{50};
+        uint64_t MaxDelay{300};
+        // Safety margin, in mean deviations of the transit time
+        float JitterMultiplier{3.f};
+        // How much faster or slower than real time playback may run to reach the target, 0.1 is +-10%
+        float MaxSlewRate{0.1f};
+        // Gaps longer than this are the server skipping snapshots, not the snapshot rate
+        uint64_t MaxInterval{250};
+    };
+
+    PlayoutDelay() noexcept;
+    explicit PlayoutDelay(const Settings& acSettings) noexcept;
+
+    /**
+     * Records a snapshot arrival.
+     * @param aTick Tick the server took the snapshot at.
+     * @param aNow Synchronized tick it arrived at.
+     */
+    void OnSnapshot(uint64_t aTick, uint64_t aNow) noexcept;
+
+    /**
+     * Moves the delay towards its target, call once per frame.
+     * @return The tick to play back at.
+     */
+    uint64_t Update(uint64_t aNow) noexcept;
+
+    void Reset() noexcept;
+
+    [[nodiscard]] float GetDelay() const noexcept { return m_delay; }
+    [[nodiscard]] float GetTargetDelay() const noexcept;
+    [[nodiscard]] float GetTransit() const noexcept { return m_transit; }
+    [[nodiscard]] float GetJitter() const noexcept { return m_jitter; }
+    [[nodiscard]] float GetInterval() const noexcept { return m_interval; }
+
+private:
+    Settings m_settings;
+    // Starts at the maximum, being late is worse than being smooth for the first few snapshots
+    float m_delay;
+    float m_transit{0.f};
+    float m_jitter{0.f};
+    float m_interval{0.f};
+    int64_t m_lastTransit{0};
+    uint64_t m_lastTick{0};
+    uint64_t m_lastUpdate{0};
+};
@@ -0,0 +1,165 @@
+#include <MessageCompression.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+
+namespace MessageCompression
+{
+namespace
+{
+// Bump when the dictionary changes, clients and servers of another build can't read each other's envelopes
+constexpr uint8_t kDictionaryId = 1;
+// Only sent on spawns and connections, level 1 halves the cost but spawn requests come out 25% larger
+constexpr int kLevel = 6;
+
+// zlib matches against the end of the dictionary first, the most common strings come last
+constexpr char kDictionary[] =
+    // Load orders sent with AuthenticationResponse
+    "ccBGSSSE001-Fish.esmccQDRSSE001-SurvivalMode.eslccBGSSSE037-Curios.eslccBGSSSE025-AdvDSGS.esm"
+    "_ResourcePack.eslunofficial skyrim special edition patch.espSkyUI_SE.espRaceMenu.espAlternate Start - Live Another Life.esp"
+    "SkyrimTogether.espSkyrim.esmUpdate.esmDawnguard.esmHearthFires.esmDragonborn.esm"
+    // Tint layers sent through StringCacheUpdate and CharacterSpawnRequest
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadWarPaint_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadDirt_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadBlackBloodTattoo_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHeadWarPaint_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHeadDirt_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\RedguardMaleEyeLinerStyle_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleNordEyeLinerStyle_01.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadCheeks.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHead_Cheeks2.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadLaughLines.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHead_FrownLines.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadNord_Lips.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHead_Nose.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHeadForehead.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleHead_Chin.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleUpperEyeSocket.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleLowerEyeSocket.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\MaleNeck.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHeadCheeks.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHead_Cheeks2.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHeadLaughLines.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHead_FrownLines.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHeadNord_Lips.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHead_Nose.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHeadForehead.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleHead_Chin.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleUpperEyeSocket.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleLowerEyeSocket.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\FemaleNeck.dds"
+    "Actors\\Character\\Character Assets\\TintMasks\\SkinTone.dds";
+
+struct Deflater
+{
+    Deflater() noexcept { Ready = deflateInit2(&Stream, kLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK; }
+    ~Deflater() noexcept
+    {
+        if (Ready)
+            deflateEnd(&Stream);
+    }
+
+    z_stream Stream{};
+    bool Ready;
+};
+
+struct Inflater
+{
+    Inflater() noexcept { Ready = inflateInit2(&Stream, -MAX_WBITS) == Z_OK; }
+    ~Inflater() noexcept
+    {
+        if (Ready)
+            inflateEnd(&Stream);
+    }
+
+    z_stream Stream{};
+    bool Ready;
+};
+
+// Setting a stream up costs more than compressing a small message, each thread keeps its own
+thread_local Deflater t_deflater;
+thread_local Inflater t_inflater;
+} // namespace
+
+uint8_t GetDictionaryId() noexcept
+{
+    return kDictionaryId;
+}
+
+const uint8_t* GetDictionary(size_t& aSize) noexcept
+{
+    aSize = sizeof(kDictionary) - 1;
+    return reinterpret_cast<const uint8_t*>(kDictionary);
+}
+
+size_t GetMaxEnvelopeSize(size_t aSize) noexcept
+{
+    return kHeaderSize + compressBound(static_cast<uLong>(aSize));
+}
+
+size_t Compress(const uint8_t* apMessage, size_t aSize, uint8_t* apOut, size_t aCapacity) noexcept
+{
+    // Give up as soon as the envelope can't be smaller than the message
+    const auto cCapacity = std::min(aCapacity, aSize);
+    if (aSize == 0 || aSize > kMaxMessageSize || cCapacity <= kHeaderSize || !t_deflater.Ready)
+        return 0;
+
+    size_t dictionarySize;
+    const auto* pDictionary = GetDictionary(dictionarySize);
+
+    auto& stream = t_deflater.Stream;
+    if (deflateReset(&stream) != Z_OK || deflateSetDictionary(&stream, pDictionary, static_cast<uInt>(dictionarySize)) != Z_OK)
+        return 0;
+
+    stream.next_in = const_cast<Bytef*>(apMessage);
+    stream.avail_in = static_cast<uInt>(aSize);
+    stream.next_out = apOut + kHeaderSize;
+    stream.avail_out = static_cast<uInt>(cCapacity - 1 - kHeaderSize);
+
+    if (deflate(&stream, Z_FINISH) != Z_STREAM_END)
+        return 0;
+
+    apOut[0] = kEnvelopeOpcode;
+    apOut[1] = kDictionaryId;
+    for (auto i = 0u; i < 4; ++i)
+        apOut[2 + i] = static_cast<uint8_t>(aSize >> (i * 8));
+
+    return kHeaderSize + stream.total_out;
+}
+
+bool IsEnvelope(const uint8_t* apData, size_t aSize) noexcept
+{
+    return aSize > 0 && apData[0] == kEnvelopeOpcode;
+}
+
+bool Decompress(const uint8_t* apEnvelope, size_t aSize, TiltedPhoques::Vector<uint8_t>& aOut) noexcept
+{
+    if (aSize <= kHeaderSize || !IsEnvelope(apEnvelope, aSize) || apEnvelope[1] != kDictionaryId || !t_inflater.Ready)
+        return false;
+
+    size_t messageSize = 0;
+    for (auto i = 0u; i < 4; ++i)
+        messageSize |= static_cast<size_t>(apEnvelope[2 + i]) << (i * 8);
+
+    if (messageSize == 0 || messageSize > kMaxMessageSize)
+        return false;
+
+    size_t dictionarySize;
+    const auto* pDictionary = GetDictionary(dictionarySize);
+
+    auto& stream = t_inflater.Stream;
+    if (inflateReset(&stream) != Z_OK || inflateSetDictionary(&stream, pDictionary, static_cast<uInt>(dictionarySize)) != Z_OK)
+        return false;
+
+    aOut.resize(messageSize);
+
+    stream.next_in = const_cast<Bytef*>(apEnvelope + kHeaderSize);
+    stream.avail_in = static_cast<uInt>(aSize - kHeaderSize);
+    stream.next_out = aOut.data();
+    stream.avail_out = static_cast<uInt>(messageSize);
+
+    // The stream has to end exactly where the header said the message does
+    return inflate(&stream, Z_FINISH) == Z_STREAM_END && stream.avail_out == 0 && stream.avail_in == 0;
+}
+} // namespace MessageCompression
@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * @brief Optional deflate envelope for large server messages.
+ *
+ * An envelope replaces a serialized message when the client asked for it at authentication. It starts
+ * with kEnvelopeOpcode, which is never a valid ServerOpcode, so receivers can tell it apart from a plain
+ * message by its first byte:
+ *
+ *   [kEnvelopeOpcode : 8][dictionary id : 8][message size : 32, little endian][raw deflate stream]
+ *
+ * Both sides prime zlib with a dictionary shipped with the encoding library, it holds the strings every
+ * session sends (plugin names, tint masks, ...) so even messages of a few hundred bytes shrink.
+ */
+namespace MessageCompression
+{
+static constexpr uint8_t kEnvelopeOpcode = 0xFF;
+static constexpr size_t kHeaderSize = 6;
+// Messages inflating past this are rejected rather than allocated
+static constexpr size_t kMaxMessageSize = 16 << 20;
+// Below this compressing rarely pays off, the deflate stream has a fixed cost
+static constexpr size_t kDefaultThreshold = 256;
+
+// Id of the dictionary built into this version, envelopes made with another one are rejected
+[[nodiscard]] uint8_t GetDictionaryId() noexcept;
+[[nodiscard]] const uint8_t* GetDictionary(size_t& aSize) noexcept;
+
+// Worst case envelope size for a message of aSize bytes
+[[nodiscard]] size_t GetMaxEnvelopeSize(size_t aSize) noexcept;
+
+/**
+ * Wraps a serialized message in an envelope.
+ * @param apMessage The message, starting with its opcode.
+ * @param apOut Receives the envelope, GetMaxEnvelopeSize(aSize) bytes are always enough.
+ * @return The envelope size, 0 when it wouldn't be smaller than the message or zlib failed.
+ */
+[[nodiscard]] size_t Compress(const uint8_t* apMessage, size_t aSize, uint8_t* apOut, size_t aCapacity) noexcept;
+
+[[nodiscard]] bool IsEnvelope(const uint8_t* apData, size_t aSize) noexcept;
+
+/**
+ * Restores the message wrapped in an envelope.
+ * @param aOut Resized to the message, storage is reused across calls.
+ * @return False when the envelope is corrupt or was made with another dictionary.
+ */
+[[nodiscard]] bool Decompress(const uint8_t* apEnvelope, size_t aSize, TiltedPhoques::Vector<uint8_t>& aOut) noexcept;
+} // namespace MessageCompression
@@ -8,6 +8,18 @@ void ActivateRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     aWriter.WriteBits(PreActivationOpenState, 8);
 }
 
+size_t ActivateRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(ActivatorId);
+    bits += 8;
+
+    return bits;
+}
+
 void ActivateRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -12,6 +12,22 @@ void AddTargetRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     Serialization::WriteBool(aWriter, ApplyStaminaPerkBonus);
 }
 
+size_t AddTargetRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(TargetId);
+    bits += SerializedSize::VarInt(CasterId);
+    bits += SpellId.SerializedBitsBound();
+    bits += EffectId.SerializedBitsBound();
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void AddTargetRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
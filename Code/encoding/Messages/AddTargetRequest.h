@@ -13,6 +13,7 @@ struct AddTargetRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const AddTargetRequest& acRhs) const noexcept
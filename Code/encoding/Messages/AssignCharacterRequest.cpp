@@ -21,6 +21,31 @@ void AssignCharacterRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     CurrentActorData.Serialize(aWriter);
 }
 
+size_t AssignCharacterRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Cookie);
+    bits += ReferenceId.SerializedBitsBound();
+    bits += FormId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+    bits += Rotation.SerializedBitsBound();
+    bits += 32;
+    bits += SerializedSize::String(AppearanceBuffer);
+    bits += FactionsContent.SerializedBitsBound();
+    bits += LatestAction.DifferentialBitsBound(ActionEvent{});
+    bits += QuestContent.SerializedBitsBound();
+    bits += FaceTints.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += CurrentActorData.SerializedBitsBound();
+
+    return bits;
+}
+
 void AssignCharacterRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
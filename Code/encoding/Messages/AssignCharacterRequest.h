@@ -25,6 +25,7 @@ struct AssignCharacterRequest final : ClientMessage
     virtual ~AssignCharacterRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const AssignCharacterRequest& acRhs) const noexcept
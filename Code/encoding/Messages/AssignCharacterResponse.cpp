@@ -15,6 +15,25 @@ void AssignCharacterResponse::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     Serialization::WriteBool(aWriter, IsWeaponDrawn);
 }
 
+size_t AssignCharacterResponse::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Cookie);
+    bits += SerializedSize::VarInt(ServerId);
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += Position.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += AllActorValues.SerializedBitsBound();
+    bits += CurrentInventory.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void AssignCharacterResponse::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     Cookie = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
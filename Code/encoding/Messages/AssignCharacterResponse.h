@@ -17,6 +17,7 @@ struct AssignCharacterResponse final : ServerMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const AssignCharacterResponse& achRhs) const noexcept
@@ -10,6 +10,20 @@ void AssignObjectsRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     }
 }
 
+size_t AssignObjectsRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 8;
+
+    for (const auto& object : Objects)
+    {
+        bits += object.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void AssignObjectsRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -17,6 +17,7 @@ struct AssignObjectsRequest final : ClientMessage
     virtual ~AssignObjectsRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const AssignObjectsRequest& acRhs) const noexcept { return Objects == acRhs.Objects && GetOpcode() == acRhs.GetOpcode(); }
@@ -10,6 +10,20 @@ void AssignObjectsResponse::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     }
 }
 
+size_t AssignObjectsResponse::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 8;
+
+    for (const auto& object : Objects)
+    {
+        bits += object.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void AssignObjectsResponse::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
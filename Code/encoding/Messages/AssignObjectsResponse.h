@@ -16,6 +16,7 @@ struct AssignObjectsResponse final : ServerMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const AssignObjectsResponse& achRhs) const noexcept { return GetOpcode() == achRhs.GetOpcode() && Objects == achRhs.Objects; }
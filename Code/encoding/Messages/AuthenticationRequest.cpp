@@ -1,5 +1,24 @@
 #include <Messages/AuthenticationRequest.h>
 
+namespace
+{
+// Same encoding as Serialization::ReadVarInt, but a group that isn't fully in the buffer ends the value instead of
+// being read from past the end. Reader::Eof only counts whole bytes and misses the padding of the last one.
+uint64_t ReadTrailingVarInt(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    uint64_t value = 0;
+    uint64_t group = 0;
+    for (uint32_t shift = 0; shift < 64 && aReader.ReadBits(group, 8); shift += 7)
+    {
+        value |= (group & 0x7F) << shift;
+        if ((group & 0x80) == 0)
+            break;
+    }
+
+    return value;
+}
+} // namespace
+
 void AuthenticationRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, DiscordId);
@@ -13,6 +32,27 @@ void AuthenticationRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     CellId.Serialize(aWriter);
     Serialization::WriteVarInt(aWriter, Level);
     PlayerTime.Serialize(aWriter);
+    Serialization::WriteVarInt(aWriter, Capabilities);
+}
+
+size_t AuthenticationRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(DiscordId);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::String(Token);
+    bits += SerializedSize::String(Version);
+    bits += UserMods.SerializedBitsBound();
+    bits += SerializedSize::String(Username);
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(Level);
+    bits += PlayerTime.SerializedBitsBound();
+    bits += SerializedSize::VarInt(Capabilities);
+
+    return bits;
 }
 
 void AuthenticationRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -30,4 +70,7 @@ void AuthenticationRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReade
     CellId.Deserialize(aReader);
     Level = Serialization::ReadVarInt(aReader) & 0xFFFF;
     PlayerTime.Deserialize(aReader);
+
+    // Clients from before capabilities existed end the message here, fewer than 8 bits of padding can be left
+    Capabilities = ReadTrailingVarInt(aReader) & 0xFFFFFFFF;
 }
@@ -10,6 +10,14 @@ struct AuthenticationRequest final : ClientMessage
 {
     static constexpr ClientOpcode Opcode = kAuthenticationRequest;
 
+    // Optional protocol features the client can handle, the server only uses the ones listed
+    enum Capability : uint32_t
+    {
+        kCompressedMessages = 1 << 0,
+        // Handles NotifyActorValuesBatch, older clients get the separate actor value messages
+        kActorValuesBatch = 1 << 1,
+    };
+
     AuthenticationRequest()
         : ClientMessage(Opcode)
     {
@@ -18,13 +26,14 @@ struct AuthenticationRequest final : ClientMessage
     virtual ~AuthenticationRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const AuthenticationRequest& achRhs) const noexcept
     {
         return GetOpcode() == achRhs.GetOpcode() && DiscordId == achRhs.DiscordId && SKSEActive == achRhs.SKSEActive && MO2Active == achRhs.MO2Active && Token == achRhs.Token && Version == achRhs.Version && UserMods == achRhs.UserMods && Username == achRhs.Username &&
                WorldSpaceId == achRhs.WorldSpaceId && CellId == achRhs.CellId && Level == achRhs.Level
-            && PlayerTime == achRhs.PlayerTime;
+            && PlayerTime == achRhs.PlayerTime && Capabilities == achRhs.Capabilities;
     }
 
     uint64_t DiscordId{};
@@ -38,4 +47,5 @@ struct AuthenticationRequest final : ClientMessage
     GameId CellId{};
     uint16_t Level{};
     TimeModel PlayerTime{};
+    uint32_t Capabilities{};
 };
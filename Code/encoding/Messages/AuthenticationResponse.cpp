@@ -11,6 +11,21 @@ void AuthenticationResponse::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     Serialization::WriteVarInt(aWriter, PlayerId);
 }
 
+size_t AuthenticationResponse::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(static_cast<uint32_t>(Type));
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::String(Version);
+    bits += UserMods.SerializedBitsBound();
+    bits += Settings.SerializedBitsBound();
+    bits += SerializedSize::VarInt(PlayerId);
+
+    return bits;
+}
+
 void AuthenticationResponse::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     Type = static_cast<ResponseType>(Serialization::ReadVarInt(aReader) & 0xFFFFFFFF);
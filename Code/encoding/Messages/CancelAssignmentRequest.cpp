@@ -5,6 +5,11 @@ void CancelAssignmentRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     Serialization::WriteVarInt(aWriter, Cookie);
 }
 
+size_t CancelAssignmentRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(Cookie);
+}
+
 void CancelAssignmentRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
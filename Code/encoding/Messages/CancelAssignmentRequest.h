@@ -14,6 +14,7 @@ struct CancelAssignmentRequest final : ClientMessage
     virtual ~CancelAssignmentRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const CancelAssignmentRequest& achRhs) const noexcept { return Cookie == achRhs.Cookie && GetOpcode() == achRhs.GetOpcode(); }
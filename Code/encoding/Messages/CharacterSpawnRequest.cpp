@@ -8,12 +8,19 @@ void CharacterSpawnRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     CellId.Serialize(aWriter);
     Position.Serialize(aWriter);
     Rotation.Serialize(aWriter);
-    aWriter.WriteBits(ChangeFlags, 32);
-    Serialization::WriteString(aWriter, AppearanceBuffer);
-    InventoryContent.Serialize(aWriter);
-    FactionsContent.Serialize(aWriter);
+
+    if (pCachedData)
+        pCachedData->Appearance.Write(aWriter);
+    else
+        SerializeAppearance(aWriter);
+
     LatestAction.GenerateDifferential(ActionEvent{}, aWriter);
-    FaceTints.Serialize(aWriter);
+
+    if (pCachedData)
+        pCachedData->FaceTints.Write(aWriter);
+    else
+        FaceTints.Serialize(aWriter);
+
     InitialActorValues.Serialize(aWriter);
     Serialization::WriteVarInt(aWriter, PlayerId);
     Serialization::WriteBool(aWriter, IsDead);
@@ -22,6 +29,39 @@ void CharacterSpawnRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteBool(aWriter, IsPlayerSummon);
 }
 
+size_t CharacterSpawnRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += FormId.SerializedBitsBound();
+    bits += BaseId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+    bits += Rotation.SerializedBitsBound();
+
+    if (pCachedData)
+        bits += pCachedData->Appearance.GetBitCount();
+    else
+        bits += AppearanceBitsBound();
+
+    bits += LatestAction.DifferentialBitsBound(ActionEvent{});
+
+    if (pCachedData)
+        bits += pCachedData->FaceTints.GetBitCount();
+    else
+        bits += FaceTints.SerializedBitsBound();
+
+    bits += InitialActorValues.SerializedBitsBound();
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void CharacterSpawnRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -56,3 +96,38 @@ void CharacterSpawnRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReade
     IsWeaponDrawn = Serialization::ReadBool(aReader);
     IsPlayerSummon = Serialization::ReadBool(aReader);
 }
+
+void CharacterSpawnRequest::EncodeCachedData(CachedData& aCachedData, TiltedPhoques::Buffer& aScratch) const noexcept
+{
+    {
+        TiltedPhoques::Buffer::Writer writer(&aScratch);
+        SerializeAppearance(writer);
+        aCachedData.Appearance.Assign(aScratch, writer);
+    }
+
+    {
+        TiltedPhoques::Buffer::Writer writer(&aScratch);
+        FaceTints.Serialize(writer);
+        aCachedData.FaceTints.Assign(aScratch, writer);
+    }
+}
+
+void CharacterSpawnRequest::SerializeAppearance(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    aWriter.WriteBits(ChangeFlags, 32);
+    Serialization::WriteString(aWriter, AppearanceBuffer);
+    InventoryContent.Serialize(aWriter);
+    FactionsContent.Serialize(aWriter);
+}
+
+size_t CharacterSpawnRequest::AppearanceBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 32;
+    bits += SerializedSize::String(AppearanceBuffer);
+    bits += InventoryContent.SerializedBitsBound();
+    bits += FactionsContent.SerializedBitsBound();
+
+    return bits;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include <EncodedSegment.h>
 #include <Structs/GameId.h>
 #include <Structs/ActionEvent.h>
 #include <Structs/Tints.h>
@@ -11,6 +12,7 @@
 #include <Structs/ActorValues.h>
 
 using TiltedPhoques::String;
+using TiltedPhoques::SharedPtr;
 
 struct CharacterSpawnRequest final : ServerMessage
 {
@@ -21,9 +23,28 @@ struct CharacterSpawnRequest final : ServerMessage
     {
     }
 
+    /**
+     * @brief Pre-encoded fields that rarely change and make up most of the message.
+     *
+     * When a request carries it, ChangeFlags, AppearanceBuffer, InventoryContent, FactionsContent and
+     * FaceTints are not read from the request but copied from the segments, the wire format is the same.
+     */
+    struct CachedData
+    {
+        EncodedSegment Appearance{};
+        EncodedSegment FaceTints{};
+    };
+
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
+    /**
+     * Encodes the cacheable fields of this request.
+     * @param aScratch Buffer large enough to hold the appearance and inventory, reused between calls.
+     */
+    void EncodeCachedData(CachedData& aCachedData, TiltedPhoques::Buffer& aScratch) const noexcept;
+
     bool operator==(const CharacterSpawnRequest& acRhs) const noexcept
     {
         return ServerId == acRhs.ServerId && FormId == acRhs.FormId && BaseId == acRhs.BaseId && CellId == acRhs.CellId && Position == acRhs.Position && Rotation == acRhs.Rotation && ChangeFlags == acRhs.ChangeFlags && AppearanceBuffer == acRhs.AppearanceBuffer &&
@@ -49,4 +70,11 @@ struct CharacterSpawnRequest final : ServerMessage
     bool IsPlayer{};
     bool IsWeaponDrawn{};
     bool IsPlayerSummon{};
+
+    // Not part of the comparison, it only changes how the message is encoded
+    SharedPtr<const CachedData> pCachedData{};
+
+private:
+    void SerializeAppearance(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t AppearanceBitsBound() const noexcept;
 };
@@ -13,6 +13,22 @@ void ClientReferencesMoveRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aW
     }
 }
 
+size_t ClientReferencesMoveRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Tick);
+    bits += SerializedSize::VarInt(Updates.size());
+
+    for (const auto& kvp : Updates)
+    {
+        bits += SerializedSize::VarInt(kvp.first);
+        bits += kvp.second.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void ClientReferencesMoveRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -3,7 +3,17 @@
 void DialogueRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, ServerId);
-    Serialization::WriteString(aWriter, SoundFilename);
+    SoundFilename.Serialize(aWriter);
+}
+
+size_t DialogueRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += SoundFilename.SerializedBitsBound();
+
+    return bits;
 }
 
 void DialogueRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -11,5 +21,5 @@ void DialogueRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noe
     ClientMessage::DeserializeRaw(aReader);
 
     ServerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-    SoundFilename = Serialization::ReadString(aReader);
+    SoundFilename.Deserialize(aReader);
 }
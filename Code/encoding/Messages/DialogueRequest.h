@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include <Structs/MessageString.h>
 
 using TiltedPhoques::String;
 
@@ -14,10 +15,11 @@ struct DialogueRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const DialogueRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && ServerId == acRhs.ServerId && SoundFilename == acRhs.SoundFilename; }
 
     uint32_t ServerId{};
-    TiltedPhoques::String SoundFilename{};
+    MessageString SoundFilename{};
 };
@@ -6,6 +6,16 @@ void DrawWeaponRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     Serialization::WriteBool(aWriter, IsWeaponDrawn);
 }
 
+size_t DrawWeaponRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void DrawWeaponRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
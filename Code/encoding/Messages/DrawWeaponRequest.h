@@ -12,6 +12,7 @@ struct DrawWeaponRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const DrawWeaponRequest& acRhs) const noexcept { return Id == acRhs.Id && IsWeaponDrawn == acRhs.IsWeaponDrawn && GetOpcode() == acRhs.GetOpcode(); }
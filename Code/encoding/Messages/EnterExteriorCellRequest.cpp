@@ -8,6 +8,17 @@ void EnterExteriorCellRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     CurrentCoords.Serialize(aWriter);
 }
 
+size_t EnterExteriorCellRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += CurrentCoords.SerializedBitsBound();
+
+    return bits;
+}
+
 void EnterExteriorCellRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
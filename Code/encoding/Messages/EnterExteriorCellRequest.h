@@ -18,6 +18,7 @@ struct EnterExteriorCellRequest final : ClientMessage
     virtual ~EnterExteriorCellRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const EnterExteriorCellRequest& acRhs) const noexcept { return WorldSpaceId == acRhs.WorldSpaceId && CellId == acRhs.CellId && CurrentCoords == acRhs.CurrentCoords && GetOpcode() == acRhs.GetOpcode(); }
@@ -6,6 +6,11 @@ void EnterInteriorCellRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     CellId.Serialize(aWriter);
 }
 
+size_t EnterInteriorCellRequest::RawBitsBound() const noexcept
+{
+    return CellId.SerializedBitsBound();
+}
+
 void EnterInteriorCellRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -17,6 +17,7 @@ struct EnterInteriorCellRequest final : ClientMessage
     virtual ~EnterInteriorCellRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const EnterInteriorCellRequest& acRhs) const noexcept { return CellId == acRhs.CellId && GetOpcode() == acRhs.GetOpcode(); }
@@ -6,6 +6,16 @@ void InterruptCastRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteVarInt(aWriter, CastingSource);
 }
 
+size_t InterruptCastRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(CasterId);
+    bits += SerializedSize::VarInt(CastingSource);
+
+    return bits;
+}
+
 void InterruptCastRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -12,6 +12,7 @@ struct InterruptCastRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const InterruptCastRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && CasterId == acRhs.CasterId && CastingSource == acRhs.CastingSource; }
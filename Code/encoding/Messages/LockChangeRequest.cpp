@@ -8,6 +8,18 @@ void LockChangeRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     aWriter.WriteBits(LockLevel, 8);
 }
 
+size_t LockChangeRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+    bits += 8;
+
+    return bits;
+}
+
 void LockChangeRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
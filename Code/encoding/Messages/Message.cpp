@@ -26,6 +26,12 @@ void ClientMessage::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const n
     aWriter.WriteBits(m_opcode, sizeof(m_opcode) * 8);
 }
 
+size_t ClientMessage::SerializedSizeBound() const noexcept
+{
+    // No message overrides SerializeDifferential, it writes nothing
+    return SerializedSize::ToBytes(sizeof(m_opcode) * 8 + RawBitsBound());
+}
+
 void ClientMessage::SerializeDifferential(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
 }
@@ -56,6 +62,12 @@ void ServerMessage::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const n
     aWriter.WriteBits(m_opcode, sizeof(m_opcode) * 8);
 }
 
+size_t ServerMessage::SerializedSizeBound() const noexcept
+{
+    // No message overrides SerializeDifferential, it writes nothing
+    return SerializedSize::ToBytes(sizeof(m_opcode) * 8 + RawBitsBound());
+}
+
 void ServerMessage::SerializeDifferential(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
 }
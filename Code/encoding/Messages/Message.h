@@ -2,6 +2,7 @@
 
 #include "../Opcodes.h"
 #include "../ChatMessageTypes.h"
+#include "../SerializedSize.h"
 
 using TiltedPhoques::Serialization;
 using TiltedPhoques::String;
@@ -16,8 +17,12 @@ struct ClientMessage : TiltedPhoques::AllocatorCompatible
     virtual ~ClientMessage() = default;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    // Bytes Serialize writes at most, to size a buffer before encoding
+    [[nodiscard]] size_t SerializedSizeBound() const noexcept;
     // Serialize values that are not dependent on previous states
     virtual void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    // Bits the override of SerializeRaw writes at most, the opcode excluded
+    [[nodiscard]] virtual size_t RawBitsBound() const noexcept = 0;
     // Serialize values that are dependent on previous states
     virtual void SerializeDifferential(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
     // Deserialize values that are dependent on previous states, this function will already be called
@@ -40,7 +45,9 @@ struct ServerMessage : TiltedPhoques::AllocatorCompatible
     virtual ~ServerMessage() = default;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedSizeBound() const noexcept;
     virtual void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] virtual size_t RawBitsBound() const noexcept = 0;
     virtual void SerializeDifferential(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
     virtual void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept;
     virtual void DeserializeDifferential(TiltedPhoques::Buffer::Reader& aReader) noexcept;
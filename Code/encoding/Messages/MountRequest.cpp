@@ -6,6 +6,16 @@ void MountRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const no
     Serialization::WriteVarInt(aWriter, MountId);
 }
 
+size_t MountRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(RiderId);
+    bits += SerializedSize::VarInt(MountId);
+
+    return bits;
+}
+
 void MountRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
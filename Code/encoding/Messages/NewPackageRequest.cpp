@@ -6,6 +6,16 @@ void NewPackageRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     PackageId.Serialize(aWriter);
 }
 
+size_t NewPackageRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ActorId);
+    bits += PackageId.SerializedBitsBound();
+
+    return bits;
+}
+
 void NewPackageRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -7,6 +7,17 @@ void NotifyActivate::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     aWriter.WriteBits(PreActivationOpenState, 8);
 }
 
+size_t NotifyActivate::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += SerializedSize::VarInt(ActivatorId);
+    bits += 8;
+
+    return bits;
+}
+
 void NotifyActivate::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -12,6 +12,22 @@ void NotifyActorMaxValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWr
     }
 }
 
+size_t NotifyActorMaxValueChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+
+    bits += SerializedSize::VarInt(Values.size());
+    for (auto& value : Values)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    return bits;
+}
+
 void NotifyActorMaxValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
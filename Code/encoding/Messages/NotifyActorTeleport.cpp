@@ -8,6 +8,18 @@ void NotifyActorTeleport::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) c
     Position.Serialize(aWriter);
 }
 
+size_t NotifyActorTeleport::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += FormId.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifyActorTeleport::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
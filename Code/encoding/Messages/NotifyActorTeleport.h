@@ -14,6 +14,7 @@ struct NotifyActorTeleport final : ServerMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyActorTeleport& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && FormId == acRhs.FormId && WorldSpaceId == acRhs.WorldSpaceId && CellId == acRhs.CellId && Position == acRhs.Position; }
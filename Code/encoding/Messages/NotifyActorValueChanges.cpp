@@ -12,6 +12,22 @@ void NotifyActorValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     }
 }
 
+size_t NotifyActorValueChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+
+    bits += SerializedSize::VarInt(Values.size());
+    for (auto& value : Values)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    return bits;
+}
+
 void NotifyActorValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -0,0 +1,29 @@
+#include <Messages/NotifyActorValuesBatch.h>
+
+void NotifyActorValuesBatch::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, Changes.size());
+    for (const auto& changes : Changes)
+        changes.Serialize(aWriter);
+}
+
+size_t NotifyActorValuesBatch::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Changes.size());
+    for (const auto& changes : Changes)
+        bits += changes.SerializedBitsBound();
+
+    return bits;
+}
+
+void NotifyActorValuesBatch::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ServerMessage::DeserializeRaw(aReader);
+
+    const auto count = Serialization::ReadVarInt(aReader);
+    Changes.resize(count);
+    for (auto& changes : Changes)
+        changes.Deserialize(aReader);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Message.h"
+#include <Structs/ActorValueChanges.h>
+
+using TiltedPhoques::Vector;
+
+/**
+ * @brief Actor value, max value and health changes of every actor in range, sent once per tick.
+ */
+struct NotifyActorValuesBatch final : ServerMessage
+{
+    static constexpr ServerOpcode Opcode = kNotifyActorValuesBatch;
+
+    NotifyActorValuesBatch()
+        : ServerMessage(Opcode)
+    {
+    }
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const NotifyActorValuesBatch& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && Changes == acRhs.Changes; }
+
+    Vector<ActorValueChanges> Changes{};
+};
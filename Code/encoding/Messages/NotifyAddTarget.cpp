@@ -12,6 +12,22 @@ void NotifyAddTarget::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     Serialization::WriteBool(aWriter, ApplyStaminaPerkBonus);
 }
 
+size_t NotifyAddTarget::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(TargetId);
+    bits += SerializedSize::VarInt(CasterId);
+    bits += SpellId.SerializedBitsBound();
+    bits += EffectId.SerializedBitsBound();
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void NotifyAddTarget::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -7,6 +7,17 @@ void NotifyChatMessageBroadcast::SerializeRaw(TiltedPhoques::Buffer::Writer& aWr
     Serialization::WriteString(aWriter, ChatMessage);
 }
 
+size_t NotifyChatMessageBroadcast::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(static_cast<uint64_t>(MessageType));
+    bits += SerializedSize::String(PlayerName);
+    bits += SerializedSize::String(ChatMessage);
+
+    return bits;
+}
+
 void NotifyChatMessageBroadcast::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void NotifyDeathStateChange::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     Serialization::WriteBool(aWriter, IsDead);
 }
 
+size_t NotifyDeathStateChange::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void NotifyDeathStateChange::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
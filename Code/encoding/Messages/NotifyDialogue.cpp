@@ -6,6 +6,16 @@ void NotifyDialogue::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     Serialization::WriteString(aWriter, SoundFilename);
 }
 
+size_t NotifyDialogue::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += SerializedSize::String(SoundFilename);
+
+    return bits;
+}
+
 void NotifyDialogue::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void NotifyDrawWeapon::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     Serialization::WriteBool(aWriter, IsWeaponDrawn);
 }
 
+size_t NotifyDrawWeapon::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void NotifyDrawWeapon::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
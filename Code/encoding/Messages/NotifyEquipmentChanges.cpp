@@ -12,6 +12,21 @@ void NotifyEquipmentChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     Serialization::WriteBool(aWriter, IsShout);
 }
 
+size_t NotifyEquipmentChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += ItemId.SerializedBitsBound();
+    bits += EquipSlotId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(Count);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void NotifyEquipmentChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
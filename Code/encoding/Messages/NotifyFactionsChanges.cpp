@@ -17,6 +17,21 @@ void NotifyFactionsChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     }
 }
 
+size_t NotifyFactionsChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Changes.size());
+
+    for (auto& change : Changes)
+    {
+        bits += SerializedSize::VarInt(change.first);
+        bits += change.second.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void NotifyFactionsChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
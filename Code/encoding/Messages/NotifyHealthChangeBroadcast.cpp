@@ -6,6 +6,16 @@ void NotifyHealthChangeBroadcast::SerializeRaw(TiltedPhoques::Buffer::Writer& aW
     Serialization::WriteFloat(aWriter, DeltaHealth);
 }
 
+size_t NotifyHealthChangeBroadcast::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+    bits += SerializedSize::kFloat;
+
+    return bits;
+}
+
 void NotifyHealthChangeBroadcast::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void NotifyInterruptCast::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) c
     Serialization::WriteVarInt(aWriter, CastingSource);
 }
 
+size_t NotifyInterruptCast::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(CasterId);
+    bits += SerializedSize::VarInt(CastingSource);
+
+    return bits;
+}
+
 void NotifyInterruptCast::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -8,6 +8,17 @@ void NotifyInventoryChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     Serialization::WriteBool(aWriter, Drop);
 }
 
+size_t NotifyInventoryChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += Item.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void NotifyInventoryChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
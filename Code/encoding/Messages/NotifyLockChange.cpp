@@ -7,6 +7,17 @@ void NotifyLockChange::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     aWriter.WriteBits(LockLevel, 8);
 }
 
+size_t NotifyLockChange::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+    bits += 8;
+
+    return bits;
+}
+
 void NotifyLockChange::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
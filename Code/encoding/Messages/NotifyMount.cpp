@@ -6,6 +6,16 @@ void NotifyMount::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noe
     Serialization::WriteVarInt(aWriter, MountId);
 }
 
+size_t NotifyMount::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(RiderId);
+    bits += SerializedSize::VarInt(MountId);
+
+    return bits;
+}
+
 void NotifyMount::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void NotifyNewPackage::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     PackageId.Serialize(aWriter);
 }
 
+size_t NotifyNewPackage::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ActorId);
+    bits += PackageId.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifyNewPackage::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -12,6 +12,21 @@ void NotifyObjectInventoryChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& a
     }
 }
 
+size_t NotifyObjectInventoryChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Changes.size());
+
+    for (auto& change : Changes)
+    {
+        bits += change.first.SerializedBitsBound();
+        bits += change.second.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void NotifyObjectInventoryChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -5,6 +5,11 @@ void NotifyOwnershipTransfer::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     Serialization::WriteVarInt(aWriter, ServerId);
 }
 
+size_t NotifyOwnershipTransfer::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(ServerId);
+}
+
 void NotifyOwnershipTransfer::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -13,6 +13,22 @@ void NotifyPartyInfo::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     }
 }
 
+size_t NotifyPartyInfo::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::VarInt(LeaderPlayerId);
+    bits += 8;
+
+    for (auto player : PlayerIds)
+    {
+        bits += SerializedSize::VarInt(player);
+    }
+
+    return bits;
+}
+
 void NotifyPartyInfo::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     IsLeader = Serialization::ReadBool(aReader);
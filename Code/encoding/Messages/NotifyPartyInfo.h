@@ -18,6 +18,7 @@ struct NotifyPartyInfo final : ServerMessage
     virtual ~NotifyPartyInfo() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyPartyInfo& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && PlayerIds == acRhs.PlayerIds && LeaderPlayerId == acRhs.LeaderPlayerId; }
@@ -7,6 +7,16 @@ void NotifyPartyInvite::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     Serialization::WriteVarInt(aWriter, ExpiryTick);
 }
 
+size_t NotifyPartyInvite::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(InviterId);
+    bits += SerializedSize::VarInt(ExpiryTick);
+
+    return bits;
+}
+
 void NotifyPartyInvite::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
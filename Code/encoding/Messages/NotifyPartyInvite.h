@@ -14,6 +14,7 @@ struct NotifyPartyInvite final : ServerMessage
     virtual ~NotifyPartyInvite() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyPartyInvite& acRhs) const noexcept { return InviterId == acRhs.InviterId && ExpiryTick == acRhs.ExpiryTick && GetOpcode() == acRhs.GetOpcode(); }
@@ -13,6 +13,22 @@ void NotifyPartyJoined::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     }
 }
 
+size_t NotifyPartyJoined::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::VarInt(LeaderPlayerId);
+    bits += 8;
+
+    for (auto player : PlayerIds)
+    {
+        bits += SerializedSize::VarInt(player);
+    }
+
+    return bits;
+}
+
 void NotifyPartyJoined::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     IsLeader = Serialization::ReadBool(aReader);
@@ -18,6 +18,7 @@ struct NotifyPartyJoined final : ServerMessage
     virtual ~NotifyPartyJoined() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyPartyJoined& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && PlayerIds == acRhs.PlayerIds && IsLeader == acRhs.IsLeader && LeaderPlayerId == acRhs.LeaderPlayerId; }
@@ -5,6 +5,11 @@ void NotifyPartyLeft::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
 {
 }
 
+size_t NotifyPartyLeft::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void NotifyPartyLeft::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -8,6 +8,17 @@ void NotifyPlayerCellChanged::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     CellId.Serialize(aWriter);
 }
 
+size_t NotifyPlayerCellChanged::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifyPlayerCellChanged::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
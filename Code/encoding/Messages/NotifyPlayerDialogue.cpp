@@ -6,6 +6,16 @@ void NotifyPlayerDialogue::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteString(aWriter, Text);
 }
 
+size_t NotifyPlayerDialogue::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::String(Name);
+    bits += SerializedSize::String(Text);
+
+    return bits;
+}
+
 void NotifyPlayerDialogue::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
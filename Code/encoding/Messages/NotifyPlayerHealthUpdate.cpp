@@ -7,6 +7,16 @@ void NotifyPlayerHealthUpdate::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     Serialization::WriteFloat(aWriter, Percentage);
 }
 
+size_t NotifyPlayerHealthUpdate::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += SerializedSize::kFloat;
+
+    return bits;
+}
+
 void NotifyPlayerHealthUpdate::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
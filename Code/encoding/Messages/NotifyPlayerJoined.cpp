@@ -10,6 +10,19 @@ void NotifyPlayerJoined::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     Serialization::WriteVarInt(aWriter, Level);
 }
 
+size_t NotifyPlayerJoined::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += SerializedSize::String(Username);
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(Level);
+
+    return bits;
+}
+
 void NotifyPlayerJoined::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
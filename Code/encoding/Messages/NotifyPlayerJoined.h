@@ -16,6 +16,7 @@ struct NotifyPlayerJoined final : ServerMessage
     virtual ~NotifyPlayerJoined() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyPlayerJoined& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && PlayerId == acRhs.PlayerId && Username == acRhs.Username && WorldSpaceId == acRhs.WorldSpaceId && CellId == acRhs.CellId && Level == acRhs.Level; }
@@ -7,6 +7,16 @@ void NotifyPlayerLeft::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     Serialization::WriteString(aWriter, Username);
 }
 
+size_t NotifyPlayerLeft::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += SerializedSize::String(Username);
+
+    return bits;
+}
+
 void NotifyPlayerLeft::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
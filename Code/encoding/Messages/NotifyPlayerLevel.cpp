@@ -6,6 +6,16 @@ void NotifyPlayerLevel::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     Serialization::WriteVarInt(aWriter, NewLevel);
 }
 
+size_t NotifyPlayerLevel::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(PlayerId);
+    bits += SerializedSize::VarInt(NewLevel);
+
+    return bits;
+}
+
 void NotifyPlayerLevel::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
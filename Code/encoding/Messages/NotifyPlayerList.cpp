@@ -12,6 +12,21 @@ void NotifyPlayerList::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     }
 }
 
+size_t NotifyPlayerList::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Players.size());
+
+    for (auto& player : Players)
+    {
+        bits += SerializedSize::VarInt(player.first);
+        bits += SerializedSize::String(player.second);
+    }
+
+    return bits;
+}
+
 void NotifyPlayerList::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -16,6 +16,7 @@ struct NotifyPlayerList final : ServerMessage
     virtual ~NotifyPlayerList() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyPlayerList& acRhs) const noexcept { return Players == acRhs.Players && GetOpcode() == acRhs.GetOpcode(); }
@@ -5,6 +5,11 @@ void NotifyPlayerRespawn::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) c
     Serialization::WriteVarInt(aWriter, GoldLost);
 }
 
+size_t NotifyPlayerRespawn::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(GoldLost);
+}
+
 void NotifyPlayerRespawn::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -12,6 +12,7 @@ struct NotifyPlayerRespawn final : ServerMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyPlayerRespawn& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && GoldLost == acRhs.GoldLost; }
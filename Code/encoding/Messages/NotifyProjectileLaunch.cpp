@@ -35,6 +35,45 @@ void NotifyProjectileLaunch::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     Serialization::WriteBool(aWriter, UnkBool2);
 }
 
+size_t NotifyProjectileLaunch::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ShooterID);
+
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kFloat;
+
+    bits += ProjectileBaseID.SerializedBitsBound();
+    bits += WeaponID.SerializedBitsBound();
+    bits += AmmoID.SerializedBitsBound();
+
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kFloat;
+
+    bits += ParentCellID.SerializedBitsBound();
+    bits += SpellID.SerializedBitsBound();
+
+    bits += SerializedSize::VarInt(CastingSource);
+
+    bits += SerializedSize::VarInt(Area);
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kFloat;
+
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void NotifyProjectileLaunch::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -9,6 +9,17 @@ void NotifyQuestUpdate::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     aWriter.WriteBits(Status, 8);
 }
 
+size_t NotifyQuestUpdate::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += 16;
+    bits += 8;
+
+    return bits;
+}
+
 void NotifyQuestUpdate::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
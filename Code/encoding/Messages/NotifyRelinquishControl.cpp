@@ -5,6 +5,11 @@ void NotifyRelinquishControl::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     Serialization::WriteVarInt(aWriter, ServerId);
 }
 
+size_t NotifyRelinquishControl::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(ServerId);
+}
+
 void NotifyRelinquishControl::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
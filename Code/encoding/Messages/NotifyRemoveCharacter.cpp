@@ -5,6 +5,11 @@ void NotifyRemoveCharacter::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteVarInt(aWriter, ServerId);
 }
 
+size_t NotifyRemoveCharacter::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(ServerId);
+}
+
 void NotifyRemoveCharacter::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
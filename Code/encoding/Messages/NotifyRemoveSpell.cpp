@@ -6,6 +6,16 @@ void NotifyRemoveSpell::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     SpellId.Serialize(aWriter);
 }
 
+size_t NotifyRemoveSpell::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(TargetId);
+    bits += SpellId.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifyRemoveSpell::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     TargetId = Serialization::ReadVarInt(aReader);
@@ -11,6 +11,7 @@ struct NotifyRemoveSpell final : ServerMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
 
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
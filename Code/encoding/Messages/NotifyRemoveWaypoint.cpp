@@ -4,6 +4,11 @@ void NotifyRemoveWaypoint::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
 {
 }
 
+size_t NotifyRemoveWaypoint::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void NotifyRemoveWaypoint::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
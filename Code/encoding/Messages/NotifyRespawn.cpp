@@ -5,6 +5,11 @@ void NotifyRespawn::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const n
     Serialization::WriteVarInt(aWriter, ActorId);
 }
 
+size_t NotifyRespawn::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(ActorId);
+}
+
 void NotifyRespawn::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
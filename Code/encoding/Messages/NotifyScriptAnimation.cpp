@@ -7,6 +7,17 @@ void NotifyScriptAnimation::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     EventName.Serialize(aWriter);
 }
 
+size_t NotifyScriptAnimation::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(FormID);
+    bits += Animation.SerializedBitsBound();
+    bits += EventName.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifyScriptAnimation::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
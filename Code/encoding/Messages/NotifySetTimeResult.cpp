@@ -5,6 +5,11 @@ void NotifySetTimeResult::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) c
     aWriter.WriteBits(static_cast<uint64_t>(Result), 8);
 }
 
+size_t NotifySetTimeResult::RawBitsBound() const noexcept
+{
+    return 8;
+}
+
 void NotifySetTimeResult::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void NotifySetWaypoint::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     WorldSpaceFormID.Serialize(aWriter);
 }
 
+size_t NotifySetWaypoint::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Position.SerializedBitsBound();
+    bits += WorldSpaceFormID.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifySetWaypoint::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
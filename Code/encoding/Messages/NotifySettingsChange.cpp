@@ -6,6 +6,11 @@ void NotifySettingsChange::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Settings.Serialize(aWriter);
 }
 
+size_t NotifySettingsChange::RawBitsBound() const noexcept
+{
+    return Settings.SerializedBitsBound();
+}
+
 void NotifySettingsChange::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void NotifySpawnData::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     NewActorData.Serialize(aWriter);
 }
 
+size_t NotifySpawnData::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+    bits += NewActorData.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifySpawnData::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -9,6 +9,19 @@ void NotifySpellCast::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     Serialization::WriteVarInt(aWriter, DesiredTarget);
 }
 
+size_t NotifySpellCast::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(CasterId);
+    bits += SpellFormId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(CastingSource);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::VarInt(DesiredTarget);
+
+    return bits;
+}
+
 void NotifySpellCast::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -7,6 +7,17 @@ void NotifySubtitle::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     Serialization::WriteVarInt(aWriter, TopicFormId);
 }
 
+size_t NotifySubtitle::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += SerializedSize::String(Text);
+    bits += SerializedSize::VarInt(TopicFormId);
+
+    return bits;
+}
+
 void NotifySubtitle::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
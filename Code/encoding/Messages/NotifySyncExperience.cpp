@@ -5,6 +5,11 @@ void NotifySyncExperience::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteFloat(aWriter, Experience);
 }
 
+size_t NotifySyncExperience::RawBitsBound() const noexcept
+{
+    return SerializedSize::kFloat;
+}
+
 void NotifySyncExperience::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -8,6 +8,17 @@ void NotifyTeleport::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     WorldSpaceId.Serialize(aWriter);
 }
 
+size_t NotifyTeleport::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += CellId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+
+    return bits;
+}
+
 void NotifyTeleport::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -16,6 +16,7 @@ struct NotifyTeleport final : ServerMessage
     virtual ~NotifyTeleport() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const NotifyTeleport& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && CellId == acRhs.CellId && Position == acRhs.Position && WorldSpaceId == acRhs.WorldSpaceId; }
@@ -5,6 +5,11 @@ void NotifyWeatherChange::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) c
     Id.Serialize(aWriter);
 }
 
+size_t NotifyWeatherChange::RawBitsBound() const noexcept
+{
+    return Id.SerializedBitsBound();
+}
+
 void NotifyWeatherChange::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
@@ -5,6 +5,11 @@ void PartyAcceptInviteRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     Serialization::WriteVarInt(aWriter, InviterId);
 }
 
+size_t PartyAcceptInviteRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(InviterId);
+}
+
 void PartyAcceptInviteRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
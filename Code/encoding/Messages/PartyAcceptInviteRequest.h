@@ -14,6 +14,7 @@ struct PartyAcceptInviteRequest final : ClientMessage
     virtual ~PartyAcceptInviteRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const PartyAcceptInviteRequest& achRhs) const noexcept { return InviterId == achRhs.InviterId && GetOpcode() == achRhs.GetOpcode(); }
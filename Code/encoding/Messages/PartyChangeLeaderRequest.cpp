@@ -5,6 +5,11 @@ void PartyChangeLeaderRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     Serialization::WriteVarInt(aWriter, PartyMemberPlayerId);
 }
 
+size_t PartyChangeLeaderRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(PartyMemberPlayerId);
+}
+
 void PartyChangeLeaderRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -4,6 +4,11 @@ void PartyCreateRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
 {
 }
 
+size_t PartyCreateRequest::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void PartyCreateRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
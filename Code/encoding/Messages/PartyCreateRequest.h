@@ -14,6 +14,7 @@ struct PartyCreateRequest final : ClientMessage
     virtual ~PartyCreateRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const PartyCreateRequest& achRhs) const noexcept { return GetOpcode() == achRhs.GetOpcode(); }
@@ -5,6 +5,11 @@ void PartyInviteRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     Serialization::WriteVarInt(aWriter, PlayerId);
 }
 
+size_t PartyInviteRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(PlayerId);
+}
+
 void PartyInviteRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
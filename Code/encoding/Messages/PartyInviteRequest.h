@@ -14,6 +14,7 @@ struct PartyInviteRequest final : ClientMessage
     virtual ~PartyInviteRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const PartyInviteRequest& achRhs) const noexcept { return PlayerId == achRhs.PlayerId && GetOpcode() == achRhs.GetOpcode(); }
@@ -5,6 +5,11 @@ void PartyKickRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     Serialization::WriteVarInt(aWriter, PartyMemberPlayerId);
 }
 
+size_t PartyKickRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(PartyMemberPlayerId);
+}
+
 void PartyKickRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
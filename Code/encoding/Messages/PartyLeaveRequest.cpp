@@ -4,6 +4,11 @@ void PartyLeaveRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
 {
 }
 
+size_t PartyLeaveRequest::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void PartyLeaveRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -14,6 +14,7 @@ struct PartyLeaveRequest final : ClientMessage
     virtual ~PartyLeaveRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const PartyLeaveRequest& achRhs) const noexcept { return GetOpcode() == achRhs.GetOpcode(); }
@@ -2,12 +2,17 @@
 
 void PlayerDialogueRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
-    Serialization::WriteString(aWriter, Text);
+    Text.Serialize(aWriter);
+}
+
+size_t PlayerDialogueRequest::RawBitsBound() const noexcept
+{
+    return Text.SerializedBitsBound();
 }
 
 void PlayerDialogueRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
 
-    Text = Serialization::ReadString(aReader);
+    Text.Deserialize(aReader);
 }
@@ -5,6 +5,11 @@ void PlayerLevelRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     Serialization::WriteVarInt(aWriter, NewLevel);
 }
 
+size_t PlayerLevelRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(NewLevel);
+}
+
 void PlayerLevelRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -13,6 +13,7 @@ struct PlayerLevelRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const PlayerLevelRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && NewLevel == acRhs.NewLevel; }
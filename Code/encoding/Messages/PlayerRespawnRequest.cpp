@@ -4,6 +4,11 @@ void PlayerRespawnRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
 {
 }
 
+size_t PlayerRespawnRequest::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void PlayerRespawnRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
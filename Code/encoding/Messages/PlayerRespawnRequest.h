@@ -12,6 +12,7 @@ struct PlayerRespawnRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const PlayerRespawnRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode(); }
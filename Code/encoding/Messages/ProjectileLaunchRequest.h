@@ -16,6 +16,7 @@ struct ProjectileLaunchRequest final : ClientMessage
     virtual ~ProjectileLaunchRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const ProjectileLaunchRequest& acRhs) const noexcept
@@ -7,6 +7,16 @@ void RemoveSpellRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     SpellId.Serialize(aWriter);
 }
 
+size_t RemoveSpellRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(TargetId);
+    bits += SpellId.SerializedBitsBound();
+
+    return bits;
+}
+
 void RemoveSpellRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     TargetId = Serialization::ReadVarInt(aReader);
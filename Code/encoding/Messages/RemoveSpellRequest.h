@@ -8,6 +8,7 @@ struct RemoveSpellRequest final: ClientMessage
     RemoveSpellRequest() : ClientMessage(Opcode) {}
     virtual ~RemoveSpellRequest() = default;
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
     bool operator==(const RemoveSpellRequest& achRhs) const noexcept { return  Opcode == achRhs.Opcode && TargetId == achRhs.TargetId && SpellId == achRhs.SpellId; }
 
@@ -12,6 +12,22 @@ void RequestActorMaxValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aW
     }
 }
 
+size_t RequestActorMaxValueChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+
+    bits += SerializedSize::VarInt(Values.size());
+    for (const auto& value : Values)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    return bits;
+}
+
 void RequestActorMaxValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -12,6 +12,22 @@ void RequestActorValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     }
 }
 
+size_t RequestActorValueChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+
+    bits += SerializedSize::VarInt(Values.size());
+    for (auto& value : Values)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    return bits;
+}
+
 void RequestActorValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -4,6 +4,11 @@ void RequestCurrentWeather::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
 {
 }
 
+size_t RequestCurrentWeather::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void RequestCurrentWeather::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
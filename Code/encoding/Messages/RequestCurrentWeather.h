@@ -14,6 +14,7 @@ struct RequestCurrentWeather final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const RequestCurrentWeather& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode(); }
@@ -14,6 +14,23 @@ void RequestEquipmentChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     CurrentInventory.Serialize(aWriter);
 }
 
+size_t RequestEquipmentChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += ItemId.SerializedBitsBound();
+    bits += EquipSlotId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(Count);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += CurrentInventory.SerializedBitsBound();
+
+    return bits;
+}
+
 void RequestEquipmentChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -16,6 +16,7 @@ struct RequestEquipmentChanges final : ClientMessage
     virtual ~RequestEquipmentChanges() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const RequestEquipmentChanges& acRhs) const noexcept
@@ -15,6 +15,21 @@ void RequestFactionsChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter
     }
 }
 
+size_t RequestFactionsChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 8;
+
+    for (auto& change : Changes)
+    {
+        bits += SerializedSize::VarInt(change.first);
+        bits += change.second.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void RequestFactionsChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -6,6 +6,16 @@ void RequestHealthChangeBroadcast::SerializeRaw(TiltedPhoques::Buffer::Writer& a
     Serialization::WriteFloat(aWriter, DeltaHealth);
 }
 
+size_t RequestHealthChangeBroadcast::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+    bits += SerializedSize::kFloat;
+
+    return bits;
+}
+
 void RequestHealthChangeBroadcast::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
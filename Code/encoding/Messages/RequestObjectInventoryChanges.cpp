@@ -12,6 +12,21 @@ void RequestObjectInventoryChanges::SerializeRaw(TiltedPhoques::Buffer::Writer&
     }
 }
 
+size_t RequestObjectInventoryChanges::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Changes.size());
+
+    for (auto& change : Changes)
+    {
+        bits += change.first.SerializedBitsBound();
+        bits += change.second.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void RequestObjectInventoryChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
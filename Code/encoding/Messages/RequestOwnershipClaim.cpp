@@ -6,6 +6,16 @@ void RequestOwnershipClaim::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     NewActorData.Serialize(aWriter);
 }
 
+size_t RequestOwnershipClaim::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += NewActorData.SerializedBitsBound();
+
+    return bits;
+}
+
 void RequestOwnershipClaim::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
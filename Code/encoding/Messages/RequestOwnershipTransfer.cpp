@@ -8,6 +8,18 @@ void RequestOwnershipTransfer::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrit
     Position.Serialize(aWriter);
 }
 
+size_t RequestOwnershipTransfer::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+
+    return bits;
+}
+
 void RequestOwnershipTransfer::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
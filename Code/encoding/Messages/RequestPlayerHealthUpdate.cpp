@@ -6,6 +6,11 @@ void RequestPlayerHealthUpdate::SerializeRaw(TiltedPhoques::Buffer::Writer& aWri
     Serialization::WriteFloat(aWriter, Percentage);
 }
 
+size_t RequestPlayerHealthUpdate::RawBitsBound() const noexcept
+{
+    return SerializedSize::kFloat;
+}
+
 void RequestPlayerHealthUpdate::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
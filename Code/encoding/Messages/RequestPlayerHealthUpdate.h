@@ -14,6 +14,7 @@ struct RequestPlayerHealthUpdate final : ClientMessage
     virtual ~RequestPlayerHealthUpdate() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const RequestPlayerHealthUpdate& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && Percentage == acRhs.Percentage; }
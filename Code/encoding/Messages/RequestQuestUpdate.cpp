@@ -9,6 +9,17 @@ void RequestQuestUpdate::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     aWriter.WriteBits(Status, 8);
 }
 
+size_t RequestQuestUpdate::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += 16;
+    bits += 8;
+
+    return bits;
+}
+
 void RequestQuestUpdate::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
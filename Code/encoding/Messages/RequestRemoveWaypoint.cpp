@@ -4,6 +4,11 @@ void RequestRemoveWaypoint::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
 {
 }
 
+size_t RequestRemoveWaypoint::RawBitsBound() const noexcept
+{
+    return 0;
+}
+
 void RequestRemoveWaypoint::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -13,6 +13,7 @@ struct RequestRemoveWaypoint final : ClientMessage
     virtual ~RequestRemoveWaypoint() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const RequestRemoveWaypoint& acRhs) const noexcept
@@ -7,6 +7,17 @@ void RequestRespawn::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     Serialization::WriteVarInt(aWriter, ChangeFlags);
 }
 
+size_t RequestRespawn::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ActorId);
+    bits += SerializedSize::String(AppearanceBuffer);
+    bits += SerializedSize::VarInt(ChangeFlags);
+
+    return bits;
+}
+
 void RequestRespawn::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
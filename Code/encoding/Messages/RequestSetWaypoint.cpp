@@ -6,6 +6,16 @@ void RequestSetWaypoint::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     WorldSpaceFormID.Serialize(aWriter);
 }
 
+size_t RequestSetWaypoint::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Position.SerializedBitsBound();
+    bits += WorldSpaceFormID.SerializedBitsBound();
+
+    return bits;
+}
+
 void RequestSetWaypoint::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
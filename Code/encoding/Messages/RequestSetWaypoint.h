@@ -15,6 +15,7 @@ struct RequestSetWaypoint final : ClientMessage
     virtual ~RequestSetWaypoint() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const RequestSetWaypoint& acRhs) const noexcept
@@ -5,6 +5,11 @@ void RequestWeatherChange::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Id.Serialize(aWriter);
 }
 
+size_t RequestWeatherChange::RawBitsBound() const noexcept
+{
+    return Id.SerializedBitsBound();
+}
+
 void RequestWeatherChange::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -3,8 +3,19 @@
 void ScriptAnimationRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, FormID);
-    Animation.Serialize(aWriter);
-    EventName.Serialize(aWriter);
+    Animation.SerializeCached(aWriter);
+    EventName.SerializeCached(aWriter);
+}
+
+size_t ScriptAnimationRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(FormID);
+    bits += Animation.CachedBitsBound();
+    bits += EventName.CachedBitsBound();
+
+    return bits;
 }
 
 void ScriptAnimationRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -12,6 +23,6 @@ void ScriptAnimationRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aRead
     ClientMessage::DeserializeRaw(aReader);
 
     FormID = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-    Animation.Deserialize(aReader);
-    EventName.Deserialize(aReader);
+    Animation.DeserializeCached(aReader);
+    EventName.DeserializeCached(aReader);
 }
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Message.h"
-#include "Structs/CachedString.h"
+#include <Structs/MessageString.h>
 
 struct ScriptAnimationRequest final : ClientMessage
 {
@@ -13,11 +13,12 @@ struct ScriptAnimationRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const ScriptAnimationRequest& acRhs) const noexcept { return FormID == acRhs.FormID && Animation == acRhs.Animation && EventName == acRhs.EventName && GetOpcode() == acRhs.GetOpcode(); }
 
     uint32_t FormID;
-    CachedString Animation;
-    CachedString EventName;
+    MessageString Animation;
+    MessageString EventName;
 };
@@ -3,7 +3,17 @@
 void SendChatMessageRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, static_cast<uint64_t>(MessageType));
-    Serialization::WriteString(aWriter, ChatMessage);
+    ChatMessage.Serialize(aWriter);
+}
+
+size_t SendChatMessageRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(static_cast<uint64_t>(MessageType));
+    bits += ChatMessage.SerializedBitsBound();
+
+    return bits;
 }
 
 void SendChatMessageRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -11,5 +21,5 @@ void SendChatMessageRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aRead
     ClientMessage::DeserializeRaw(aReader);
 
     MessageType = static_cast<ChatMessageType>(Serialization::ReadVarInt(aReader));
-    ChatMessage = Serialization::ReadString(aReader);
+    ChatMessage.Deserialize(aReader);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include <Structs/MessageString.h>
 
 using TiltedPhoques::String;
 
@@ -16,10 +17,11 @@ struct SendChatMessageRequest final : ClientMessage
     virtual ~SendChatMessageRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const SendChatMessageRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && MessageType == acRhs.MessageType && ChatMessage == acRhs.ChatMessage; }
 
     ChatMessageType MessageType;
-    TiltedPhoques::String ChatMessage;
+    MessageString ChatMessage;
 };
@@ -0,0 +1,42 @@
+#include <Messages/ServerReferencesMoveSnapshot.h>
+#include <TiltedCore/Serialization.hpp>
+
+void ServerReferencesMoveSnapshot::Encode(uint32_t aServerId, const ReferenceUpdate& acUpdate, Segment& aSegment, TiltedPhoques::Buffer& aScratch) noexcept
+{
+    TiltedPhoques::Buffer::Writer writer(&aScratch);
+
+    // Same layout as a ServerReferencesMoveRequest entry
+    Serialization::WriteVarInt(writer, aServerId);
+    acUpdate.Serialize(writer);
+
+    aSegment.ServerId = aServerId;
+    aSegment.Assign(aScratch, writer);
+}
+
+void ServerReferencesMoveSnapshot::Reset(uint64_t aTick) noexcept
+{
+    Tick = aTick;
+    Segments.clear();
+}
+
+void ServerReferencesMoveSnapshot::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, Tick);
+    Serialization::WriteVarInt(aWriter, Segments.size());
+
+    for (const auto* pSegment : Segments)
+        pSegment->Write(aWriter);
+}
+
+size_t ServerReferencesMoveSnapshot::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Tick);
+    bits += SerializedSize::VarInt(Segments.size());
+
+    for (const auto* pSegment : Segments)
+        bits += pSegment->GetBitCount();
+
+    return bits;
+}
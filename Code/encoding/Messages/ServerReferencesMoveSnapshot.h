@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Message.h"
+#include <EncodedSegment.h>
+#include <Structs/ReferenceUpdate.h>
+
+/**
+ * @brief Server side encoder for ServerReferencesMoveRequest built from pre-encoded updates.
+ *
+ * Each reference update is encoded once per snapshot into a Segment shared by every recipient,
+ * packets are then assembled by copying segments, the wire format is the one of ServerReferencesMoveRequest.
+ */
+struct ServerReferencesMoveSnapshot final : ServerMessage
+{
+    static constexpr ServerOpcode Opcode = kServerReferencesMoveRequest;
+
+    struct Segment : EncodedSegment
+    {
+        uint32_t ServerId{};
+    };
+
+    ServerReferencesMoveSnapshot()
+        : ServerMessage(Opcode)
+    {
+    }
+
+    /**
+     * Encodes an update so that it can be shared by several snapshots.
+     * @param aScratch Buffer large enough to hold a single update, reused between calls.
+     */
+    static void Encode(uint32_t aServerId, const ReferenceUpdate& acUpdate, Segment& aSegment, TiltedPhoques::Buffer& aScratch) noexcept;
+
+    // Clears the segments while keeping the storage around for the next snapshot
+    void Reset(uint64_t aTick) noexcept;
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
+
+    uint64_t Tick{};
+    Vector<const Segment*> Segments{};
+};
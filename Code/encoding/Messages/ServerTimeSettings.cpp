@@ -5,6 +5,11 @@ void ServerTimeSettings::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) co
     timeModel.Serialize(aWriter);
 }
 
+size_t ServerTimeSettings::RawBitsBound() const noexcept
+{
+    return timeModel.SerializedBitsBound();
+}
+
 void ServerTimeSettings::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     timeModel.Deserialize(aReader);
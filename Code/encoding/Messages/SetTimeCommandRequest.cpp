@@ -7,6 +7,17 @@ void SetTimeCommandRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     aWriter.WriteBits(PlayerId, 32);
 }
 
+size_t SetTimeCommandRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 8;
+    bits += 8;
+    bits += 32;
+
+    return bits;
+}
+
 void SetTimeCommandRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
@@ -14,6 +14,24 @@ void ShiftGridCellRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     }
 }
 
+size_t ShiftGridCellRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += PlayerCell.SerializedBitsBound();
+    bits += CenterCoords.SerializedBitsBound();
+
+    bits += 8;
+
+    for (const auto& cell : Cells)
+    {
+        bits += cell.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void ShiftGridCellRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
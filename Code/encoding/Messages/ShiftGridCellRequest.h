@@ -18,6 +18,7 @@ struct ShiftGridCellRequest final : ClientMessage
     virtual ~ShiftGridCellRequest() = default;
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const ShiftGridCellRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && WorldSpaceId == acRhs.WorldSpaceId && PlayerCell == acRhs.PlayerCell && CenterCoords == acRhs.CenterCoords && Cells == acRhs.Cells; }
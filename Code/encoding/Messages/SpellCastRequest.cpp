@@ -9,6 +9,19 @@ void SpellCastRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) cons
     Serialization::WriteVarInt(aWriter, DesiredTarget);
 }
 
+size_t SpellCastRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(CasterId);
+    bits += SpellFormId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(CastingSource);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::VarInt(DesiredTarget);
+
+    return bits;
+}
+
 void SpellCastRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
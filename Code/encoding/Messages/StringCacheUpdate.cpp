@@ -10,6 +10,20 @@ void StringCacheUpdate::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) con
     }
 }
 
+size_t StringCacheUpdate::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(StartId);
+    bits += SerializedSize::VarInt(Values.size() & 0xFFFF);
+    for (const auto& value : Values)
+    {
+        bits += SerializedSize::String(value);
+    }
+
+    return bits;
+}
+
 void StringCacheUpdate::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     StartId = Serialization::ReadVarInt(aReader) & 0xFFFF;
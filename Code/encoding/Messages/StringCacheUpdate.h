@@ -12,6 +12,7 @@ struct StringCacheUpdate final : ServerMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const StringCacheUpdate& achRhs) const noexcept { return GetOpcode() == achRhs.GetOpcode() && StartId == achRhs.StartId && Values == achRhs.Values; }
@@ -3,15 +3,26 @@
 void SubtitleRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, ServerId);
-    Serialization::WriteString(aWriter, Text);
+    Text.Serialize(aWriter);
     Serialization::WriteVarInt(aWriter, TopicFormId);
 }
 
+size_t SubtitleRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += Text.SerializedBitsBound();
+    bits += SerializedSize::VarInt(TopicFormId);
+
+    return bits;
+}
+
 void SubtitleRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
 
     ServerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-    Text = Serialization::ReadString(aReader);
+    Text.Deserialize(aReader);
     TopicFormId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
 }
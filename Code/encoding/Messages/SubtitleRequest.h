@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include <Structs/MessageString.h>
 
 using TiltedPhoques::String;
 
@@ -14,11 +15,12 @@ struct SubtitleRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const SubtitleRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && ServerId == acRhs.ServerId && Text == acRhs.Text && TopicFormId == acRhs.TopicFormId; }
 
     uint32_t ServerId{};
-    TiltedPhoques::String Text{};
+    MessageString Text{};
     uint32_t TopicFormId{};
 };
@@ -5,6 +5,11 @@ void SyncExperienceRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteFloat(aWriter, Experience);
 }
 
+size_t SyncExperienceRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::kFloat;
+}
+
 void SyncExperienceRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
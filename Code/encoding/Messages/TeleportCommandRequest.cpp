@@ -2,12 +2,17 @@
 
 void TeleportCommandRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
-    Serialization::WriteString(aWriter, TargetPlayer);
+    TargetPlayer.Serialize(aWriter);
+}
+
+size_t TeleportCommandRequest::RawBitsBound() const noexcept
+{
+    return TargetPlayer.SerializedBitsBound();
 }
 
 void TeleportCommandRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
 
-    TargetPlayer = Serialization::ReadString(aReader);
+    TargetPlayer.Deserialize(aReader);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include <Structs/MessageString.h>
 
 using TiltedPhoques::String;
 
@@ -14,9 +15,10 @@ struct TeleportCommandRequest final : ClientMessage
     }
 
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
     bool operator==(const TeleportCommandRequest& acRhs) const noexcept { return GetOpcode() == acRhs.GetOpcode() && TargetPlayer == acRhs.TargetPlayer; }
 
-    TiltedPhoques::String TargetPlayer;
+    MessageString TargetPlayer;
 };
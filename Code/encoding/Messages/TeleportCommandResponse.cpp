@@ -7,6 +7,17 @@ void TeleportCommandResponse::SerializeRaw(TiltedPhoques::Buffer::Writer& aWrite
     WorldSpaceId.Serialize(aWriter);
 }
 
+size_t TeleportCommandResponse::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += CellId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+
+    return bits;
+}
+
 void TeleportCommandResponse::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerMessage::DeserializeRaw(aReader);
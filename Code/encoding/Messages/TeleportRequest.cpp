@@ -5,6 +5,11 @@ void TeleportRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const
     Serialization::WriteVarInt(aWriter, PlayerId);
 }
 
+size_t TeleportRequest::RawBitsBound() const noexcept
+{
+    return SerializedSize::VarInt(PlayerId);
+}
+
 void TeleportRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ClientMessage::DeserializeRaw(aReader);
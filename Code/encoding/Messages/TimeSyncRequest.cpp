@@ -0,0 +1,28 @@
+#include <Messages/TimeSyncRequest.h>
+
+void TimeSyncRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, ClientTick);
+    Serialization::WriteVarInt(aWriter, RoundTripTime);
+    Serialization::WriteVarInt(aWriter, Jitter);
+}
+
+size_t TimeSyncRequest::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ClientTick);
+    bits += SerializedSize::VarInt(RoundTripTime);
+    bits += SerializedSize::VarInt(Jitter);
+
+    return bits;
+}
+
+void TimeSyncRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ClientMessage::DeserializeRaw(aReader);
+
+    ClientTick = Serialization::ReadVarInt(aReader);
+    RoundTripTime = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+    Jitter = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Message.h"
+
+/**
+ * @brief Starts a clock synchronization exchange, see TimeSync.
+ */
+struct TimeSyncRequest final : ClientMessage
+{
+    static constexpr ClientOpcode Opcode = kTimeSyncRequest;
+
+    TimeSyncRequest()
+        : ClientMessage(Opcode)
+    {
+    }
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const TimeSyncRequest& acRhs) const noexcept
+    {
+        return GetOpcode() == acRhs.GetOpcode() && ClientTick == acRhs.ClientTick && RoundTripTime == acRhs.RoundTripTime && Jitter == acRhs.Jitter;
+    }
+
+    // Local tick of the client when sending, echoed back
+    uint64_t ClientTick{};
+    // What the client measured so far, in ms, so the server knows each connection's link
+    uint32_t RoundTripTime{};
+    uint32_t Jitter{};
+};
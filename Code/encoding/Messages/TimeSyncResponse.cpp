@@ -0,0 +1,29 @@
+#include <Messages/TimeSyncResponse.h>
+
+void TimeSyncResponse::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, ClientTick);
+    Serialization::WriteVarInt(aWriter, ServerReceiveTick);
+    // Both server ticks are close, the hold time is much smaller to encode
+    Serialization::WriteVarInt(aWriter, ServerSendTick - ServerReceiveTick);
+}
+
+size_t TimeSyncResponse::RawBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ClientTick);
+    bits += SerializedSize::VarInt(ServerReceiveTick);
+    bits += SerializedSize::VarInt(ServerSendTick - ServerReceiveTick);
+
+    return bits;
+}
+
+void TimeSyncResponse::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ServerMessage::DeserializeRaw(aReader);
+
+    ClientTick = Serialization::ReadVarInt(aReader);
+    ServerReceiveTick = Serialization::ReadVarInt(aReader);
+    ServerSendTick = ServerReceiveTick + Serialization::ReadVarInt(aReader);
+}
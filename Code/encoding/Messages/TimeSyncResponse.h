@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Message.h"
+
+/**
+ * @brief Server side timestamps of a clock synchronization exchange, see TimeSync.
+ */
+struct TimeSyncResponse final : ServerMessage
+{
+    static constexpr ServerOpcode Opcode = kTimeSyncResponse;
+
+    TimeSyncResponse()
+        : ServerMessage(Opcode)
+    {
+    }
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    [[nodiscard]] size_t RawBitsBound() const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const TimeSyncResponse& acRhs) const noexcept
+    {
+        return GetOpcode() == acRhs.GetOpcode() && ClientTick == acRhs.ClientTick && ServerReceiveTick == acRhs.ServerReceiveTick && ServerSendTick == acRhs.ServerSendTick;
+    }
+
+    uint64_t ClientTick{};
+    uint64_t ServerReceiveTick{};
+    uint64_t ServerSendTick{};
+};
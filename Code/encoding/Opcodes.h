@@ -54,6 +54,7 @@ enum ClientOpcode : unsigned char
     kRequestSetWaypoint,
     kRequestRemoveWaypoint,
     kSetTimeCommandRequest,
+    kTimeSyncRequest,
     kClientOpcodeMax
 };
 
@@ -115,5 +116,7 @@ enum ServerOpcode : unsigned char
     kNotifySetWaypoint,
     kNotifyRemoveWaypoint,
     kNotifySetTimeResult,
+    kNotifyActorValuesBatch,
+    kTimeSyncResponse,
     kServerOpcodeMax
 };
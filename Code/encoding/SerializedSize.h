@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Bits written by the Serialization helpers, to know what a message costs without encoding it.
+ *
+ * The stream is bit packed, so nested structs report their size in bits and only whole messages round up to bytes.
+ * Each *BitsBound function sits next to the function it measures and follows it write for write, changing one
+ * means changing the other. The property tests in Code/tests check them against the encoded output.
+ */
+struct SerializedSize
+{
+    static constexpr size_t kBool = 1;
+    static constexpr size_t kFloat = 32;
+    static constexpr size_t kDouble = 64;
+
+    // WriteVarInt stores 7 bits of the value per byte
+    [[nodiscard]] static constexpr size_t VarInt(uint64_t aValue) noexcept
+    {
+        size_t bytes = 1;
+        while (aValue >= 0x80)
+        {
+            aValue >>= 7;
+            ++bytes;
+        }
+
+        return bytes * 8;
+    }
+
+    [[nodiscard]] static constexpr size_t String(std::string_view aValue) noexcept { return VarInt(aValue.size()) + aValue.size() * 8; }
+
+    [[nodiscard]] static constexpr size_t ToBytes(size_t aBits) noexcept { return (aBits + 7) / 8; }
+};
@@ -101,8 +101,16 @@ void StringCache::ClearDirty() noexcept
     m_wantedStrings.clear();
 }
 
+namespace
+{
+thread_local StringCache* t_pCurrent = nullptr;
+}
+
 StringCache& StringCache::Get() noexcept
 {
+    if (t_pCurrent)
+        return *t_pCurrent;
+
     TiltedPhoques::ScopedAllocator _{TiltedPhoques::Allocator::GetDefault()};
     {
         static StringCache s_instance;
@@ -110,6 +118,11 @@ StringCache& StringCache::Get() noexcept
     }
 }
 
+void StringCache::SetCurrent(StringCache* apCache) noexcept
+{
+    t_pCurrent = apCache;
+}
+
 StringCache::StringCache()
 {
 }
@@ -4,6 +4,8 @@
 
 struct StringCache
 {
+    StringCache();
+
     TP_NOCOPYMOVE(StringCache);
 
     [[nodiscard]] bool Contains(const TiltedPhoques::String&) const noexcept;
@@ -19,12 +21,13 @@ struct StringCache
     bool ProcessDirty() noexcept;
     void ClearDirty() noexcept;
 
+    // Returns the cache made current on the calling thread, or the process wide one when there is none
     static StringCache& Get() noexcept;
+    // Each server instance owns a cache and makes it current on the threads it runs on, nullptr restores the process wide one
+    static void SetCurrent(StringCache* apCache) noexcept;
 
 private:
     TiltedPhoques::Vector<TiltedPhoques::String> m_idToString;
     mutable TiltedPhoques::Set<TiltedPhoques::String> m_wantedStrings;
     TiltedPhoques::Map<TiltedPhoques::String, uint32_t> m_stringToId;
-
-    StringCache();
 };
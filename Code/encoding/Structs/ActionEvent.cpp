@@ -1,5 +1,6 @@
 #include <Structs/ActionEvent.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <sstream>
 #include <TiltedCore/StackAllocator.hpp>
 
@@ -17,46 +18,56 @@ enum DifferentialFlags
     kVariables = 1 << 7
 };
 
-bool ActionEvent::operator==(const ActionEvent& acRhs) const noexcept
+namespace
 {
-    return Tick == acRhs.Tick &&
-           // ActorId == acRhs.ActorId && // ActorId is a local field as it is filled up latter by the game client
-           ActionId == acRhs.ActionId && State1 == acRhs.State1 && State2 == acRhs.State2 && Type == acRhs.Type && TargetId == acRhs.TargetId && IdleId == acRhs.IdleId && EventName == acRhs.EventName && TargetEventName == acRhs.TargetEventName && Variables == acRhs.Variables;
-}
-
-bool ActionEvent::operator!=(const ActionEvent& acRhs) const noexcept
-{
-    return !operator==(acRhs);
-}
-
-void ActionEvent::GenerateDifferential(const ActionEvent& aPrevious, TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+uint8_t ChangedFields(const ActionEvent& acCurrent, const ActionEvent& acPrevious) noexcept
 {
     uint8_t flags = 0;
 
-    if (ActionId != aPrevious.ActionId)
+    if (acCurrent.ActionId != acPrevious.ActionId)
         flags |= kActionId;
 
-    if (TargetId != aPrevious.TargetId)
+    if (acCurrent.TargetId != acPrevious.TargetId)
         flags |= kTargetId;
 
-    if (IdleId != aPrevious.IdleId)
+    if (acCurrent.IdleId != acPrevious.IdleId)
         flags |= kIdleId;
 
-    if (State1 != aPrevious.State1 || State2 != aPrevious.State2)
+    if (acCurrent.State1 != acPrevious.State1 || acCurrent.State2 != acPrevious.State2)
         flags |= kState;
 
-    if (Type != aPrevious.Type)
+    if (acCurrent.Type != acPrevious.Type)
         flags |= kType;
 
-    if (EventName != aPrevious.EventName)
+    if (acCurrent.EventName != acPrevious.EventName)
         flags |= kEventName;
 
-    if (TargetEventName != aPrevious.TargetEventName)
+    if (acCurrent.TargetEventName != acPrevious.TargetEventName)
         flags |= kTargetEventName;
 
-    if (Variables != aPrevious.Variables)
+    if (acCurrent.Variables != acPrevious.Variables)
         flags |= kVariables;
 
+    return flags;
+}
+} // namespace
+
+bool ActionEvent::operator==(const ActionEvent& acRhs) const noexcept
+{
+    return Tick == acRhs.Tick &&
+           // ActorId == acRhs.ActorId && // ActorId is a local field as it is filled up latter by the game client
+           ActionId == acRhs.ActionId && State1 == acRhs.State1 && State2 == acRhs.State2 && Type == acRhs.Type && TargetId == acRhs.TargetId && IdleId == acRhs.IdleId && EventName == acRhs.EventName && TargetEventName == acRhs.TargetEventName && Variables == acRhs.Variables;
+}
+
+bool ActionEvent::operator!=(const ActionEvent& acRhs) const noexcept
+{
+    return !operator==(acRhs);
+}
+
+void ActionEvent::GenerateDifferential(const ActionEvent& aPrevious, TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    const uint8_t flags = ChangedFields(*this, aPrevious);
+
     // Missing variables
     aWriter.WriteBits(flags, 8);
 
@@ -107,6 +118,40 @@ void ActionEvent::GenerateDifferential(const ActionEvent& aPrevious, TiltedPhoqu
     }
 }
 
+size_t ActionEvent::DifferentialBitsBound(const ActionEvent& aPrevious) const noexcept
+{
+    const uint8_t flags = ChangedFields(*this, aPrevious);
+
+    size_t bits = 8;
+    bits += SerializedSize::VarInt(Tick - aPrevious.Tick);
+
+    if (flags & kActionId)
+        bits += SerializedSize::VarInt(ActionId);
+
+    if (flags & kTargetId)
+        bits += SerializedSize::VarInt(TargetId);
+
+    if (flags & kIdleId)
+        bits += SerializedSize::VarInt(IdleId);
+
+    if (flags & kState)
+        bits += 64;
+
+    if (flags & kType)
+        bits += SerializedSize::VarInt(Type);
+
+    if (flags & kEventName)
+        bits += EventName.SerializedBitsBound();
+
+    if (flags & kTargetEventName)
+        bits += TargetEventName.SerializedBitsBound();
+
+    if (flags & kVariables)
+        bits += Variables.DiffBitsBound(aPrevious.Variables);
+
+    return bits;
+}
+
 void ActionEvent::ApplyDifferential(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t flags = 0;
@@ -34,5 +34,6 @@ struct ActionEvent
     void Save(std::ostream&) const;
 
     void GenerateDifferential(const ActionEvent& aPrevious, TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t DifferentialBitsBound(const ActionEvent& aPrevious) const noexcept;
     void ApplyDifferential(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 };
@@ -1,5 +1,6 @@
 #include <Structs/ActorData.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -11,6 +12,18 @@ void ActorData::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     Serialization::WriteBool(aWriter, IsWeaponDrawn);
 }
 
+size_t ActorData::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += InitialActorValues.SerializedBitsBound();
+    bits += InitialInventory.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void ActorData::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     InitialActorValues.Deserialize(aReader);
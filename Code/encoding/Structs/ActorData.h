@@ -6,6 +6,7 @@
 struct ActorData
 {
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     bool operator==(const ActorData& acRhs) const noexcept
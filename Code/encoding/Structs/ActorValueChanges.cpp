@@ -0,0 +1,90 @@
+#include <Structs/ActorValueChanges.h>
+#include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
+
+using TiltedPhoques::Serialization;
+
+namespace
+{
+void WriteValues(TiltedPhoques::Buffer::Writer& aWriter, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept
+{
+    Serialization::WriteVarInt(aWriter, acValues.size());
+    for (auto& value : acValues)
+    {
+        Serialization::WriteVarInt(aWriter, value.first);
+        Serialization::WriteFloat(aWriter, value.second);
+    }
+}
+
+size_t ValuesBitsBound(const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept
+{
+    size_t bits = SerializedSize::VarInt(acValues.size());
+    for (auto& value : acValues)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    return bits;
+}
+
+void ReadValues(TiltedPhoques::Buffer::Reader& aReader, TiltedPhoques::Map<uint32_t, float>& aValues) noexcept
+{
+    const auto count = Serialization::ReadVarInt(aReader);
+    for (auto i = 0u; i < count; ++i)
+    {
+        const auto key = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+        const auto value = Serialization::ReadFloat(aReader);
+        aValues[static_cast<uint32_t>(key)] = value;
+    }
+}
+} // namespace
+
+bool ActorValueChanges::operator==(const ActorValueChanges& acRhs) const noexcept
+{
+    return Id == acRhs.Id && Values == acRhs.Values && MaxValues == acRhs.MaxValues && HasDeltaHealth == acRhs.HasDeltaHealth && DeltaHealth == acRhs.DeltaHealth;
+}
+
+bool ActorValueChanges::operator!=(const ActorValueChanges& acRhs) const noexcept
+{
+    return !this->operator==(acRhs);
+}
+
+void ActorValueChanges::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, Id);
+
+    WriteValues(aWriter, Values);
+    WriteValues(aWriter, MaxValues);
+
+    Serialization::WriteBool(aWriter, HasDeltaHealth);
+    if (HasDeltaHealth)
+        Serialization::WriteFloat(aWriter, DeltaHealth);
+}
+
+size_t ActorValueChanges::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Id);
+
+    bits += ValuesBitsBound(Values);
+    bits += ValuesBitsBound(MaxValues);
+
+    bits += SerializedSize::kBool;
+    if (HasDeltaHealth)
+        bits += SerializedSize::kFloat;
+
+    return bits;
+}
+
+void ActorValueChanges::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    Id = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+
+    ReadValues(aReader, Values);
+    ReadValues(aReader, MaxValues);
+
+    HasDeltaHealth = Serialization::ReadBool(aReader);
+    DeltaHealth = HasDeltaHealth ? Serialization::ReadFloat(aReader) : 0.f;
+}
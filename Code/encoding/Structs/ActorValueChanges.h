@@ -0,0 +1,23 @@
+#pragma once
+
+/**
+ * @brief Actor value, max value and health changes of a single actor.
+ */
+struct ActorValueChanges
+{
+    ActorValueChanges() = default;
+    ~ActorValueChanges() = default;
+
+    bool operator==(const ActorValueChanges& acRhs) const noexcept;
+    bool operator!=(const ActorValueChanges& acRhs) const noexcept;
+
+    void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
+    void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+
+    uint32_t Id{};
+    TiltedPhoques::Map<uint32_t, float> Values{};
+    TiltedPhoques::Map<uint32_t, float> MaxValues{};
+    bool HasDeltaHealth{false};
+    float DeltaHealth{0.f};
+};
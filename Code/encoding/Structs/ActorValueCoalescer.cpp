@@ -0,0 +1,67 @@
+#include <Structs/ActorValueCoalescer.h>
+
+void ActorValueCoalescer::SetValues(uint32_t aId, uint32_t aSourceId, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept
+{
+    Merge(GetActor(aId).Values, aSourceId, acValues);
+}
+
+void ActorValueCoalescer::SetMaxValues(uint32_t aId, uint32_t aSourceId, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept
+{
+    Merge(GetActor(aId).MaxValues, aSourceId, acValues);
+}
+
+void ActorValueCoalescer::AddDeltaHealth(uint32_t aId, uint32_t aSourceId, float aDeltaHealth) noexcept
+{
+    auto& deltaHealth = GetActor(aId).DeltaHealth;
+
+    const auto itor = std::find_if(std::begin(deltaHealth), std::end(deltaHealth), [aSourceId](const auto& acDelta) { return acDelta.first == aSourceId; });
+    if (itor == std::end(deltaHealth))
+    {
+        deltaHealth.emplace_back(aSourceId, aDeltaHealth);
+        return;
+    }
+
+    itor->second += aDeltaHealth;
+    ++m_mergedCount;
+}
+
+void ActorValueCoalescer::Clear() noexcept
+{
+    for (auto i = 0u; i < m_actorCount; ++i)
+    {
+        auto& actor = m_actors[i];
+        actor.Values.clear();
+        actor.MaxValues.clear();
+        actor.DeltaHealth.clear();
+    }
+
+    m_actorCount = 0;
+    m_actorIndices.clear();
+}
+
+ActorValueCoalescer::PendingActor& ActorValueCoalescer::GetActor(uint32_t aId) noexcept
+{
+    const auto [itor, inserted] = m_actorIndices.try_emplace(aId, static_cast<uint32_t>(m_actorCount));
+    if (!inserted)
+        return m_actors[itor->second];
+
+    if (m_actorCount == m_actors.size())
+        m_actors.emplace_back();
+
+    auto& actor = m_actors[m_actorCount++];
+    actor.Id = aId;
+
+    return actor;
+}
+
+void ActorValueCoalescer::Merge(TiltedPhoques::Map<uint32_t, Value>& aPending, uint32_t aSourceId, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept
+{
+    for (const auto& [key, value] : acValues)
+    {
+        auto [itor, inserted] = aPending.try_emplace(key);
+        if (!inserted)
+            ++m_mergedCount;
+
+        itor.value() = {value, aSourceId};
+    }
+}
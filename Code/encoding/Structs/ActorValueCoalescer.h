@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Structs/ActorValueChanges.h>
+
+using TiltedPhoques::Vector;
+
+/**
+ * @brief Merges the actor value changes reported during a tick so they can be sent as one batch per recipient.
+ *
+ * Values and max values are last-write-wins, health deltas are summed. Each change remembers the player
+ * that reported it so that it is never sent back to them. Storage is kept between ticks.
+ */
+class ActorValueCoalescer
+{
+public:
+    ActorValueCoalescer() = default;
+    ~ActorValueCoalescer() = default;
+
+    void SetValues(uint32_t aId, uint32_t aSourceId, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept;
+    void SetMaxValues(uint32_t aId, uint32_t aSourceId, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept;
+    void AddDeltaHealth(uint32_t aId, uint32_t aSourceId, float aDeltaHealth) noexcept;
+
+    /**
+     * Appends the changes that were not reported by the recipient itself.
+     * @param acFilter Called with the id of each changed actor, returns whether the recipient should see it.
+     */
+    template <class T> void Collect(uint32_t aRecipientId, const T& acFilter, Vector<ActorValueChanges>& aOut) const noexcept;
+
+    void Clear() noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_actorCount == 0; }
+    [[nodiscard]] size_t GetActorCount() const noexcept { return m_actorCount; }
+    // Changes that overwrote or were added to one already pending
+    [[nodiscard]] uint64_t GetMergedCount() const noexcept { return m_mergedCount; }
+
+private:
+    struct Value
+    {
+        float Current{};
+        uint32_t SourceId{};
+    };
+
+    struct PendingActor
+    {
+        uint32_t Id{};
+        TiltedPhoques::Map<uint32_t, Value> Values{};
+        TiltedPhoques::Map<uint32_t, Value> MaxValues{};
+        // Sum per source, a handful of attackers at most
+        Vector<std::pair<uint32_t, float>> DeltaHealth{};
+    };
+
+    PendingActor& GetActor(uint32_t aId) noexcept;
+    void Merge(TiltedPhoques::Map<uint32_t, Value>& aPending, uint32_t aSourceId, const TiltedPhoques::Map<uint32_t, float>& acValues) noexcept;
+
+    Vector<PendingActor> m_actors;
+    size_t m_actorCount{0};
+    TiltedPhoques::Map<uint32_t, uint32_t> m_actorIndices;
+    uint64_t m_mergedCount{0};
+};
+
+template <class T> void ActorValueCoalescer::Collect(uint32_t aRecipientId, const T& acFilter, Vector<ActorValueChanges>& aOut) const noexcept
+{
+    for (auto i = 0u; i < m_actorCount; ++i)
+    {
+        const auto& actor = m_actors[i];
+        if (!acFilter(actor.Id))
+            continue;
+
+        auto& changes = aOut.emplace_back();
+        changes.Id = actor.Id;
+
+        for (const auto& [key, value] : actor.Values)
+        {
+            if (value.SourceId != aRecipientId)
+                changes.Values[key] = value.Current;
+        }
+
+        for (const auto& [key, value] : actor.MaxValues)
+        {
+            if (value.SourceId != aRecipientId)
+                changes.MaxValues[key] = value.Current;
+        }
+
+        for (const auto& [sourceId, delta] : actor.DeltaHealth)
+        {
+            if (sourceId == aRecipientId)
+                continue;
+
+            changes.HasDeltaHealth = true;
+            changes.DeltaHealth += delta;
+        }
+
+        if (changes.Values.empty() && changes.MaxValues.empty() && !changes.HasDeltaHealth)
+            aOut.pop_back();
+    }
+}
@@ -1,5 +1,6 @@
 #include <Structs/ActorValues.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -30,6 +31,27 @@ void ActorValues::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexce
     }
 }
 
+size_t ActorValues::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ActorValuesList.size());
+    for (auto& value : ActorValuesList)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    bits += SerializedSize::VarInt(ActorMaxValuesList.size());
+    for (auto& value : ActorMaxValuesList)
+    {
+        bits += SerializedSize::VarInt(value.first);
+        bits += SerializedSize::kFloat;
+    }
+
+    return bits;
+}
+
 void ActorValues::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     auto count = Serialization::ReadVarInt(aReader);
@@ -9,6 +9,7 @@ struct ActorValues
     bool operator!=(const ActorValues& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     TiltedPhoques::Map<uint32_t, float> ActorValuesList{};
@@ -2,6 +2,8 @@
 
 #include <Structs/AnimationGraphDescriptor.h>
 
+// Filled by the descriptor builders during static initialization and only read afterwards on the server, so every
+// server instance of the process shares it. UpdateKey and Update are for the client, which owns a single game.
 struct AnimationGraphDescriptorManager
 {
     TP_NOCOPYMOVE(AnimationGraphDescriptorManager);
@@ -1,5 +1,6 @@
 #include <Structs/AnimationVariables.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <iostream>
 
 bool AnimationVariables::operator==(const AnimationVariables& acRhs) const noexcept
@@ -108,6 +109,26 @@ void AnimationVariables::GenerateDiff(const AnimationVariables& aPrevious, Tilte
 // The Changed? table is scanned and for each true bit, the corresponsing Integer
 // or Float is deserialized.
 // 
+size_t AnimationVariables::DiffBitsBound(const AnimationVariables& aPrevious) const noexcept
+{
+    const size_t cChangedBits = Booleans.size() + Integers.size() + Floats.size();
+
+    size_t bits = 0;
+    bits += SerializedSize::VarInt(Booleans.size());
+    bits += SerializedSize::VarInt(Integers.size());
+    bits += SerializedSize::VarInt(Floats.size());
+    bits += SerializedSize::VarInt((cChangedBits + 7) >> 3) + ((cChangedBits + 7) >> 3) * 8;
+
+    for (size_t i = 0; i < Integers.size(); i++)
+        if (aPrevious.Integers.size() != Integers.size() || aPrevious.Integers[i] != Integers[i])
+            bits += SerializedSize::VarInt(Integers[i] & 0xFFFFFFFF);
+    for (size_t i = 0; i < Floats.size(); i++)
+        if (aPrevious.Floats.size() != Floats.size() || aPrevious.Floats[i] != Floats[i])
+            bits += SerializedSize::kFloat;
+
+    return bits;
+}
+
 void AnimationVariables::ApplyDiff(TiltedPhoques::Buffer::Reader& aReader)
 {
     size_t booleansSize = TiltedPhoques::Serialization::ReadVarInt(aReader);
@@ -17,6 +17,7 @@ struct AnimationVariables
     void Save(std::ostream&) const;
 
     void GenerateDiff(const AnimationVariables& aPrevious, TiltedPhoques::Buffer::Writer& aWriter) const;
+    [[nodiscard]] size_t DiffBitsBound(const AnimationVariables& aPrevious) const noexcept;
     void ApplyDiff(TiltedPhoques::Buffer::Reader& aReader);
     void VectorBool_to_String(const Vector<bool>& bools, TiltedPhoques::String& chars) const;
     void String_to_VectorBool(const TiltedPhoques::String& chars, Vector<bool>& bools);
@@ -1,6 +1,7 @@
 #include <Structs/CachedString.h>
 #include <TiltedCore/Serialization.hpp>
 #include "StringCache.h"
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -27,6 +28,13 @@ void CachedString::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexc
     }
 }
 
+size_t CachedString::SerializedBitsBound() const noexcept
+{
+    const auto cId = StringCache::Get()[*this];
+
+    return SerializedSize::kBool + (cId ? SerializedSize::VarInt(*cId) : SerializedSize::String(*this));
+}
+
 void CachedString::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     const auto cHasId = Serialization::ReadBool(aReader);
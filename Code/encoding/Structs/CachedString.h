@@ -8,5 +8,6 @@ struct CachedString : TiltedPhoques::String
     CachedString& operator=(const TiltedPhoques::String& acRhs) noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 };
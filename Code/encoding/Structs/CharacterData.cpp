@@ -1,5 +1,6 @@
 #include <Structs/CharacterData.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -23,6 +24,30 @@ void CharacterData::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noex
     Serialization::WriteBool(aWriter, IsWeaponDrawn);
 }
 
+size_t CharacterData::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += ReferenceId.SerializedBitsBound();
+    bits += FormId.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+    bits += Rotation.SerializedBitsBound();
+    bits += 32;
+    bits += SerializedSize::String(AppearanceBuffer);
+    bits += InventoryContent.SerializedBitsBound();
+    bits += FactionsContent.SerializedBitsBound();
+    bits += LatestAction.DifferentialBitsBound(ActionEvent{});
+    bits += QuestContent.SerializedBitsBound();
+    bits += FaceTints.SerializedBitsBound();
+    bits += AllActorValues.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void CharacterData::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ReferenceId.Deserialize(aReader);
@@ -28,6 +28,7 @@ struct CharacterData
     bool operator!=(const CharacterData& acRhs) const noexcept { return !this->operator==(acRhs); }
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     GameId ReferenceId{};
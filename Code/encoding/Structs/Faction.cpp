@@ -1,4 +1,5 @@
 #include <Structs/Faction.h>
+#include <SerializedSize.h>
 
 bool Faction::operator==(const Faction& acRhs) const noexcept
 {
@@ -16,6 +17,16 @@ void Faction::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     aWriter.WriteBits(Rank, 8);
 }
 
+size_t Faction::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += Id.SerializedBitsBound();
+    bits += 8;
+
+    return bits;
+}
+
 void Faction::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     Id.Deserialize(aReader);
@@ -1,5 +1,6 @@
 #include <Structs/Factions.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <stdexcept>
 
 using TiltedPhoques::Serialization;
@@ -32,6 +33,27 @@ void Factions::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     }
 }
 
+size_t Factions::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(NpcFactions.size() & 0x1FF);
+
+    for (auto& entry : NpcFactions)
+    {
+        bits += entry.SerializedBitsBound();
+    }
+
+    bits += SerializedSize::VarInt(ExtraFactions.size() & 0x1FF);
+
+    for (auto& entry : ExtraFactions)
+    {
+        bits += entry.SerializedBitsBound();
+    }
+
+    return bits;
+}
+
 void Factions::Deserialize(TiltedPhoques::Buffer::Reader& aReader)
 {
     auto npcCount = Serialization::ReadVarInt(aReader);
@@ -13,6 +13,7 @@ struct Factions
     bool operator!=(const Factions& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader);
 
     Vector<Faction> NpcFactions;
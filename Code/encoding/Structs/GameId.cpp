@@ -1,5 +1,6 @@
 #include <Structs/GameId.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -30,6 +31,16 @@ void GameId::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     Serialization::WriteVarInt(aWriter, ModId);
 }
 
+size_t GameId::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(BaseId);
+    bits += SerializedSize::VarInt(ModId);
+
+    return bits;
+}
+
 void GameId::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     BaseId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
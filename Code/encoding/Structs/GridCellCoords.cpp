@@ -1,5 +1,6 @@
 #include <Structs/GridCellCoords.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -30,6 +31,16 @@ void GridCellCoords::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noe
     Serialization::WriteVarInt(aWriter, Y);
 }
 
+size_t GridCellCoords::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(X);
+    bits += SerializedSize::VarInt(Y);
+
+    return bits;
+}
+
 void GridCellCoords::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     X = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
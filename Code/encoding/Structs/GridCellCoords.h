@@ -22,6 +22,7 @@ struct GridCellCoords
     bool operator!=(const GridCellCoords& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     void Reset() noexcept { X = Y = std::numeric_limits<int32_t>::max(); }
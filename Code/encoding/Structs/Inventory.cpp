@@ -1,8 +1,14 @@
 #include <Structs/Inventory.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
+namespace
+{
+constexpr uint32_t kNoEntry = UINT32_MAX;
+} // namespace
+
 void Inventory::EffectItem::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteFloat(aWriter, Magnitude);
@@ -12,6 +18,19 @@ void Inventory::EffectItem::Serialize(TiltedPhoques::Buffer::Writer& aWriter) co
     EffectId.Serialize(aWriter);
 }
 
+size_t Inventory::EffectItem::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::VarInt(Area);
+    bits += SerializedSize::VarInt(Duration);
+    bits += SerializedSize::kFloat;
+    bits += EffectId.SerializedBitsBound();
+
+    return bits;
+}
+
 void Inventory::EffectItem::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     Magnitude = Serialization::ReadFloat(aReader);
@@ -50,6 +69,39 @@ void Inventory::Entry::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const n
     Serialization::WriteBool(aWriter, IsQuestItem);
 }
 
+size_t Inventory::Entry::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += BaseId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(Count);
+
+    bits += SerializedSize::kFloat;
+
+    bits += ExtraEnchantId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(ExtraEnchantCharge);
+    bits += SerializedSize::VarInt(EnchantData.Effects.size());
+    for (const EffectItem& effect : EnchantData.Effects)
+    {
+        bits += effect.SerializedBitsBound();
+    }
+
+    bits += SerializedSize::kFloat;
+
+    bits += ExtraPoisonId.SerializedBitsBound();
+    bits += SerializedSize::VarInt(ExtraPoisonCount);
+
+    bits += SerializedSize::VarInt(ExtraSoulLevel);
+
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void Inventory::Entry::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     BaseId.Deserialize(aReader);
@@ -112,6 +164,21 @@ void Inventory::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     CurrentMagicEquipment.Serialize(aWriter);
 }
 
+size_t Inventory::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Entries.size());
+    for (const Entry& entry : Entries)
+    {
+        bits += entry.SerializedBitsBound();
+    }
+
+    bits += CurrentMagicEquipment.SerializedBitsBound();
+
+    return bits;
+}
+
 void Inventory::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint32_t count = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
@@ -123,67 +190,67 @@ void Inventory::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
     }
 
     CurrentMagicEquipment.Deserialize(aReader);
+
+    m_indexValid = false;
 }
 
 std::optional<Inventory::Entry> Inventory::GetEntryById(GameId& aItemId) const noexcept
 {
-    auto entry = std::find_if(Entries.begin(), Entries.end(), [aItemId](auto entry) { return entry.BaseId == aItemId; });
-    if (entry == Entries.end())
+    const auto cIndex = FindFirst(aItemId);
+    if (!cIndex)
         return std::nullopt;
 
-    return {*entry};
+    return {Entries[*cIndex]};
 }
 
 int32_t Inventory::GetEntryCountById(GameId& aItemId) const noexcept
 {
-    auto entry = GetEntryById(aItemId);
-    if (!entry)
+    const auto cIndex = FindFirst(aItemId);
+    if (!cIndex)
         return 0;
 
-    return entry->Count;
+    return Entries[*cIndex].Count;
 }
 
-// TODO: unit testing
 void Inventory::AddOrRemoveEntry(const Entry& acEntry) noexcept
 {
-    auto duplicate = std::find_if(Entries.begin(), Entries.end(), [acEntry](Entry& entry) { return entry.CanBeMerged(acEntry); });
-
-    if (duplicate != Entries.end())
+    if (const auto cIndex = FindMergeable(acEntry))
     {
-        duplicate->Count += acEntry.Count;
-        if (duplicate->Count <= 0)
-            Entries.erase(duplicate);
+        auto& duplicate = Entries[*cIndex];
+        duplicate.Count += acEntry.Count;
+
+        if (duplicate.Count <= 0)
+            RemoveAt(*cIndex);
     }
     else
     {
         Entries.push_back(acEntry);
+
+        // Appending keeps the index valid as long as the new entry is chained last, FindMergeable brought it up to date
+        if (m_indexValid)
+            AppendToIndex(Entries.size() - 1);
     }
 }
 
 void Inventory::UpdateEquipment(const Inventory& acNewInventory) noexcept
 {
-    while (true)
-    {
-        auto wornEntry = std::find_if(Entries.begin(), Entries.end(), [](auto& aEntry) { return aEntry.IsWorn(); });
-        if (wornEntry == Entries.end())
-            break;
-
-        wornEntry->ExtraWorn = wornEntry->ExtraWornLeft = false;
-    }
+    for (auto& entry : Entries)
+        entry.ExtraWorn = entry.ExtraWornLeft = false;
 
     for (const auto& newEntry : acNewInventory.Entries)
     {
         if (!newEntry.IsWorn())
             continue;
 
-        auto entry = std::find_if(Entries.begin(), Entries.end(), [&newEntry](auto& aEntry) { return aEntry.BaseId == newEntry.BaseId; });
+        const auto cIndex = FindFirst(newEntry.BaseId);
 
         // This shouldn't happen
-        if (entry == Entries.end())
+        if (!cIndex)
             continue;
 
-        entry->ExtraWorn = newEntry.ExtraWorn;
-        entry->ExtraWornLeft = newEntry.ExtraWornLeft;
+        auto& entry = Entries[*cIndex];
+        entry.ExtraWorn = newEntry.ExtraWorn;
+        entry.ExtraWornLeft = newEntry.ExtraWornLeft;
     }
 
     CurrentMagicEquipment = acNewInventory.CurrentMagicEquipment;
@@ -191,5 +258,132 @@ void Inventory::UpdateEquipment(const Inventory& acNewInventory) noexcept
 
 void Inventory::RemoveByFilter(std::function<bool(const Entry&)> aFilter) noexcept
 {
-    Entries.erase(std::remove_if(Entries.begin(), Entries.end(), aFilter), Entries.end());
+    const auto cItor = std::remove_if(Entries.begin(), Entries.end(), aFilter);
+    if (cItor == Entries.end())
+        return;
+
+    Entries.erase(cItor, Entries.end());
+    m_indexValid = false;
+}
+
+void Inventory::MarkEntriesDirty() noexcept
+{
+    m_indexValid = false;
+}
+
+void Inventory::RemoveAt(size_t aIndex) noexcept
+{
+    if (m_indexValid)
+        RemoveFromIndex(aIndex);
+
+    Entries.erase(std::begin(Entries) + aIndex);
+}
+
+void Inventory::BuildIndex() const noexcept
+{
+    m_index.clear();
+    m_index.reserve(Entries.size());
+    m_nextSameBase.assign(Entries.size(), kNoEntry);
+
+    // Walk backwards so every chain ends up in ascending order
+    for (size_t i = Entries.size(); i-- > 0;)
+    {
+        auto [itor, inserted] = m_index.try_emplace(Entries[i].BaseId, static_cast<uint32_t>(i));
+        if (!inserted)
+        {
+            m_nextSameBase[i] = itor->second;
+            m_index[Entries[i].BaseId] = static_cast<uint32_t>(i);
+        }
+    }
+
+    m_indexValid = true;
+}
+
+void Inventory::AppendToIndex(size_t aIndex) const noexcept
+{
+    m_nextSameBase.push_back(kNoEntry);
+
+    auto [itor, inserted] = m_index.try_emplace(Entries[aIndex].BaseId, static_cast<uint32_t>(aIndex));
+    if (inserted)
+        return;
+
+    auto last = itor->second;
+    while (m_nextSameBase[last] != kNoEntry)
+        last = m_nextSameBase[last];
+
+    m_nextSameBase[last] = static_cast<uint32_t>(aIndex);
+}
+
+void Inventory::RemoveFromIndex(size_t aIndex) const noexcept
+{
+    const auto cIndex = static_cast<uint32_t>(aIndex);
+    const auto cNext = m_nextSameBase[aIndex];
+
+    auto itor = m_index.find(Entries[aIndex].BaseId);
+    if (itor->second == cIndex)
+    {
+        if (cNext == kNoEntry)
+            m_index.erase(itor);
+        else
+            itor.value() = cNext;
+    }
+    else
+    {
+        auto previous = itor->second;
+        while (m_nextSameBase[previous] != cIndex)
+            previous = m_nextSameBase[previous];
+
+        m_nextSameBase[previous] = cNext;
+    }
+
+    m_nextSameBase.erase(std::begin(m_nextSameBase) + aIndex);
+
+    // Everything after the removed entry moves down by one, still cheaper than hashing every entry again
+    for (auto& next : m_nextSameBase)
+    {
+        if (next != kNoEntry && next > cIndex)
+            --next;
+    }
+
+    for (auto itor = std::begin(m_index); itor != std::end(m_index); ++itor)
+    {
+        if (itor->second > cIndex)
+            --itor.value();
+    }
+}
+
+std::optional<size_t> Inventory::FindMergeable(const Entry& acEntry) const noexcept
+{
+    auto index = FindFirst(acEntry.BaseId);
+    while (index)
+    {
+        if (Entries[*index].CanBeMerged(acEntry))
+            return index;
+
+        const auto cNext = m_nextSameBase[*index];
+        index = cNext != kNoEntry ? std::optional<size_t>(cNext) : std::nullopt;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<size_t> Inventory::FindFirst(const GameId& acBaseId) const noexcept
+{
+    // Entries can be pushed or erased directly, that changes the size
+    if (!m_indexValid || m_nextSameBase.size() != Entries.size())
+        BuildIndex();
+
+    auto itor = m_index.find(acBaseId);
+
+    // Edited in place without MarkEntriesDirty, only noticeable when the base id changed
+    if (itor != std::end(m_index) && Entries[itor->second].BaseId != acBaseId)
+    {
+        BuildIndex();
+        itor = m_index.find(acBaseId);
+    }
+
+    if (itor == std::end(m_index))
+        return std::nullopt;
+
+    return itor->second;
 }
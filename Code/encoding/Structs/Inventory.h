@@ -17,6 +17,7 @@ struct Inventory
         GameId EffectId{};
 
         void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+        [[nodiscard]] size_t SerializedBitsBound() const noexcept;
         void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
     };
 
@@ -53,6 +54,7 @@ struct Inventory
         bool operator!=(const Entry& acRhs) const noexcept;
 
         void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+        [[nodiscard]] size_t SerializedBitsBound() const noexcept;
         void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
         bool ContainsExtraData() const noexcept { return !IsExtraDataEquals(Entry{}); }
@@ -75,6 +77,7 @@ struct Inventory
     bool operator!=(const Inventory& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     std::optional<Entry> GetEntryById(GameId& aItemId) const noexcept;
@@ -84,6 +87,24 @@ struct Inventory
     void AddOrRemoveEntry(const Entry& acEntry) noexcept;
     void UpdateEquipment(const Inventory& acNewInventory) noexcept;
 
+    // Has to be called after editing Entries directly, the index is rebuilt on next use. Lookups still notice a changed
+    // entry count or a changed base id without it
+    void MarkEntriesDirty() noexcept;
+
     Vector<Entry> Entries{};
     MagicEquipment CurrentMagicEquipment{};
+
+private:
+    void RemoveAt(size_t aIndex) noexcept;
+
+    void BuildIndex() const noexcept;
+    void AppendToIndex(size_t aIndex) const noexcept;
+    void RemoveFromIndex(size_t aIndex) const noexcept;
+    std::optional<size_t> FindMergeable(const Entry& acEntry) const noexcept;
+    std::optional<size_t> FindFirst(const GameId& acBaseId) const noexcept;
+
+    // First entry position by base id, the others sharing that base id are chained through m_nextSameBase
+    mutable TiltedPhoques::Map<GameId, uint32_t> m_index{};
+    mutable Vector<uint32_t> m_nextSameBase{};
+    mutable bool m_indexValid{false};
 };
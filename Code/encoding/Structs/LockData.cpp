@@ -1,5 +1,6 @@
 #include <Structs/LockData.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -19,6 +20,16 @@ void LockData::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     aWriter.WriteBits(LockLevel, 8);
 }
 
+size_t LockData::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::kBool;
+    bits += 8;
+
+    return bits;
+}
+
 void LockData::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     IsLocked = Serialization::ReadBool(aReader);
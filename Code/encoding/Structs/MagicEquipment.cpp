@@ -1,5 +1,6 @@
 #include <Structs/MagicEquipment.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <Messages/RequestEquipmentChanges.h>
 
 using TiltedPhoques::Serialization;
@@ -34,6 +35,30 @@ void MagicEquipment::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noe
         Shout.Serialize(aWriter);
 }
 
+size_t MagicEquipment::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bool isLeftSpellSet = LeftHandSpell != GameId{};
+    bool isRightSpellSet = RightHandSpell != GameId{};
+    bool isShoutSet = Shout != GameId{};
+
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    if (isLeftSpellSet)
+        bits += LeftHandSpell.SerializedBitsBound();
+
+    if (isRightSpellSet)
+        bits += RightHandSpell.SerializedBitsBound();
+
+    if (isShoutSet)
+        bits += Shout.SerializedBitsBound();
+
+    return bits;
+}
+
 void MagicEquipment::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     bool isLeftSpellSet = Serialization::ReadBool(aReader);
@@ -10,6 +10,7 @@ struct MagicEquipment
     bool operator!=(const MagicEquipment& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     GameId LeftHandSpell{};
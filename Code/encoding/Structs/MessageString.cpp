@@ -0,0 +1,166 @@
+#include <Structs/MessageString.h>
+#include <TiltedCore/Serialization.hpp>
+#include "StringCache.h"
+#include <SerializedSize.h>
+
+#include <cassert>
+#include <cstring>
+
+using TiltedPhoques::Serialization;
+
+std::string_view MessageString::View() const noexcept
+{
+    if (!m_borrowed)
+        return m_owned;
+
+#if TP_CHECK_MESSAGE_VIEWS
+    // The buffer or arena this points to is gone, the message should have been made to own its strings
+    assert(ViewScope::IsOpen(m_scopeId));
+#endif
+
+    return m_view;
+}
+
+bool MessageString::IsValid() const noexcept
+{
+#if TP_CHECK_MESSAGE_VIEWS
+    return !m_borrowed || ViewScope::IsOpen(m_scopeId);
+#else
+    return true;
+#endif
+}
+
+void MessageString::Own() noexcept
+{
+    if (!m_borrowed)
+        return;
+
+    m_owned = String(View());
+    m_view = {};
+    m_borrowed = false;
+}
+
+void MessageString::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    const auto cView = View();
+
+    Serialization::WriteVarInt(aWriter, cView.size());
+    aWriter.WriteBytes(reinterpret_cast<const uint8_t*>(cView.data()), cView.size());
+}
+
+size_t MessageString::SerializedBitsBound() const noexcept
+{
+    return SerializedSize::String(View());
+}
+
+void MessageString::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    auto* pScope = ViewScope::GetCurrent();
+    if (!pScope)
+    {
+        m_owned = Serialization::ReadString(aReader);
+        m_borrowed = false;
+        return;
+    }
+
+    const auto cLength = Serialization::ReadVarInt(aReader);
+    const auto* cpData = aReader.GetDataAtPosition();
+    const bool cAligned = (aReader.GetBitPosition() & 7) == 0;
+
+    // Unaligned bytes straddle one more byte of the buffer
+    if (!pScope->Contains(cpData, cLength) || (!cAligned && !pScope->Contains(cpData + cLength, 1)))
+    {
+        // Another buffer, or a length past the end of this one which the plain read reports the usual way
+        m_owned.resize(cLength);
+        aReader.ReadBytes(reinterpret_cast<uint8_t*>(m_owned.data()), cLength);
+        m_borrowed = false;
+        return;
+    }
+
+    if (cAligned)
+    {
+        Borrow({reinterpret_cast<const char*>(cpData), cLength}, *pScope);
+        aReader.Advance(cLength);
+        return;
+    }
+
+    auto* pCopy = pScope->Allocate(cLength);
+    aReader.ReadBytes(reinterpret_cast<uint8_t*>(pCopy), cLength);
+    Borrow({pCopy, cLength}, *pScope);
+}
+
+void MessageString::SerializeCached(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    // Borrowed strings are decoded to be read, sending one again is rare enough to copy it
+    const String cCopy = m_borrowed ? String(View()) : String{};
+    const auto& cValue = m_borrowed ? cCopy : m_owned;
+    const auto cId = StringCache::Get()[cValue];
+
+    Serialization::WriteBool(aWriter, cId.has_value());
+    if (cId)
+    {
+        Serialization::WriteVarInt(aWriter, *cId);
+    }
+    else
+    {
+        Serialize(aWriter);
+
+        StringCache::Get().AddWanted(cValue);
+    }
+}
+
+size_t MessageString::CachedBitsBound() const noexcept
+{
+    const String cCopy = m_borrowed ? String(View()) : String{};
+    const auto cId = StringCache::Get()[m_borrowed ? cCopy : m_owned];
+
+    return SerializedSize::kBool + (cId ? SerializedSize::VarInt(*cId) : SerializedBitsBound());
+}
+
+void MessageString::DeserializeCached(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    const auto cHasId = Serialization::ReadBool(aReader);
+    if (!cHasId)
+    {
+        Deserialize(aReader);
+
+        StringCache::Get().AddWanted(String(View()));
+        return;
+    }
+
+    const auto cId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+    const auto cValue = StringCache::Get()[cId];
+
+    // Same as CachedString, an id missing from our cache means both sides went out of sync
+    assert(cValue);
+
+    Copy(cValue ? std::string_view(*cValue) : std::string_view{});
+}
+
+void MessageString::Borrow(std::string_view aView, const ViewScope& acScope) noexcept
+{
+    m_owned.clear();
+    m_view = aView;
+    m_borrowed = true;
+#if TP_CHECK_MESSAGE_VIEWS
+    m_scopeId = acScope.GetId();
+#else
+    (void)acScope;
+#endif
+}
+
+void MessageString::Copy(std::string_view aView) noexcept
+{
+    auto* pScope = ViewScope::GetCurrent();
+    if (!pScope)
+    {
+        m_owned = String(aView);
+        m_borrowed = false;
+        return;
+    }
+
+    // The cache may grow while the message is handled and move its strings, they are copied to the arena instead
+    auto* pCopy = pScope->Allocate(aView.size());
+    std::memcpy(pCopy, aView.data(), aView.size());
+    Borrow({pCopy, aView.size()}, *pScope);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ViewScope.h>
+
+#include <string_view>
+#include <type_traits>
+
+using TiltedPhoques::String;
+
+/**
+ * @brief String field of a message that is copied on decode, or borrowed when a ViewScope is open.
+ *
+ * The wire format is the one of Serialization::WriteString, or of CachedString for the Cached variants,
+ * so a field can switch between String and MessageString without breaking older peers.
+ */
+struct MessageString
+{
+    MessageString() = default;
+
+    template <class T>
+    requires std::is_convertible_v<const T&, std::string_view>
+    MessageString(const T& acValue)
+        : m_owned(std::string_view(acValue))
+    {
+    }
+
+    [[nodiscard]] std::string_view View() const noexcept;
+    operator std::string_view() const noexcept { return View(); }
+
+    // Owned copy, for what has to outlive the handler
+    [[nodiscard]] String ToString() const noexcept { return String(View()); }
+
+    [[nodiscard]] size_t size() const noexcept { return View().size(); }
+    [[nodiscard]] bool empty() const noexcept { return View().empty(); }
+
+    [[nodiscard]] bool IsBorrowed() const noexcept { return m_borrowed; }
+    // False once the scope a borrowed string came from has closed, always true without TP_CHECK_MESSAGE_VIEWS
+    [[nodiscard]] bool IsValid() const noexcept;
+    // Copies a borrowed string so it no longer depends on the decoded buffer
+    void Own() noexcept;
+
+    friend bool operator==(const MessageString& acLhs, std::string_view aRhs) noexcept { return acLhs.View() == aRhs; }
+
+    void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
+    void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+    // Same as CachedString, an id when the string cache knows the string
+    void SerializeCached(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t CachedBitsBound() const noexcept;
+    void DeserializeCached(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+
+private:
+    void Borrow(std::string_view aView, const ViewScope& acScope) noexcept;
+    void Copy(std::string_view aView) noexcept;
+
+    String m_owned{};
+    std::string_view m_view{};
+    bool m_borrowed{false};
+#if TP_CHECK_MESSAGE_VIEWS
+    uint32_t m_scopeId{0};
+#endif
+};
@@ -1,5 +1,6 @@
 #include <Structs/Mods.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <algorithm>
 
 using TiltedPhoques::Serialization;
@@ -27,6 +28,20 @@ void Mods::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     }
 }
 
+size_t Mods::SerializedBitsBound() const noexcept
+{
+    size_t bits = 13;
+
+    for (auto& entry : ModList)
+    {
+        bits += 16;
+        bits += SerializedSize::kBool;
+        bits += SerializedSize::String(entry.Filename);
+    }
+
+    return bits;
+}
+
 void Mods::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t data = 0;
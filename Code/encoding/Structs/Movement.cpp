@@ -1,5 +1,6 @@
 #include <Structs/Movement.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -23,6 +24,20 @@ void Movement::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     aWriter.WriteBits(*reinterpret_cast<const uint32_t*>(&Direction), 32);
 }
 
+size_t Movement::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += CellId.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += Position.SerializedBitsBound();
+    bits += Rotation.SerializedBitsBound();
+    bits += Variables.DiffBitsBound(AnimationVariables{});
+    bits += 32;
+
+    return bits;
+}
+
 void Movement::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     CellId.Deserialize(aReader);
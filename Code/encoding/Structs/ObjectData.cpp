@@ -1,5 +1,6 @@
 #include <Structs/ObjectData.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -25,6 +26,22 @@ void ObjectData::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcep
     Serialization::WriteBool(aWriter, IsSenderFirst);
 }
 
+size_t ObjectData::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(ServerId);
+    bits += Id.SerializedBitsBound();
+    bits += CellId.SerializedBitsBound();
+    bits += WorldSpaceId.SerializedBitsBound();
+    bits += CurrentCoords.SerializedBitsBound();
+    bits += CurrentLockData.SerializedBitsBound();
+    bits += CurrentInventory.SerializedBitsBound();
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void ObjectData::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     ServerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
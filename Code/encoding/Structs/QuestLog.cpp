@@ -2,6 +2,7 @@
 #include <Structs/QuestLog.h>
 
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <Structs/Mods.h>
 #include <algorithm>
 
@@ -29,6 +30,21 @@ void QuestLog::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     }
 }
 
+size_t QuestLog::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 16;
+    for (auto& e : Entries)
+    {
+        bits += e.Id.SerializedBitsBound();
+
+        bits += 16;
+    }
+
+    return bits;
+}
+
 void QuestLog::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t temp;
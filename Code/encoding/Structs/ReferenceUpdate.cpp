@@ -1,5 +1,6 @@
 #include <Structs/ReferenceUpdate.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <stdexcept>
 
 using TiltedPhoques::Serialization;
@@ -26,6 +27,22 @@ void ReferenceUpdate::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const no
     }
 }
 
+size_t ReferenceUpdate::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += UpdatedMovement.SerializedBitsBound();
+
+    bits += SerializedSize::VarInt(ActionEvents.size());
+
+    for (auto& entry : ActionEvents)
+    {
+        bits += entry.DifferentialBitsBound(ActionEvent{});
+    }
+
+    return bits;
+}
+
 void ReferenceUpdate::Deserialize(TiltedPhoques::Buffer::Reader& aReader)
 {
     UpdatedMovement.Deserialize(aReader);
@@ -15,6 +15,7 @@ struct ReferenceUpdate
     bool operator!=(const ReferenceUpdate& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader);
 
     Movement UpdatedMovement{};
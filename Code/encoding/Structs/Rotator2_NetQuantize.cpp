@@ -1,6 +1,7 @@
 #include <Structs/Rotator2_NetQuantize.h>
 #include <TiltedCore/Math.hpp>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -22,6 +23,11 @@ void Rotator2_NetQuantize::Serialize(TiltedPhoques::Buffer::Writer& aWriter) con
     aWriter.WriteBits(Pack(), 32);
 }
 
+size_t Rotator2_NetQuantize::SerializedBitsBound() const noexcept
+{
+    return 32;
+}
+
 void Rotator2_NetQuantize::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t data = 0;
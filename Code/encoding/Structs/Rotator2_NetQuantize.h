@@ -15,6 +15,7 @@ struct Rotator2_NetQuantize : glm::vec2
     bool operator!=(const Rotator2_NetQuantize& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     [[nodiscard]] uint32_t Pack() const noexcept;
@@ -1,5 +1,6 @@
 #include "ServerSettings.h"
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -24,6 +25,21 @@ void ServerSettings::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noe
     Serialization::WriteBool(aWriter, AutoPartyJoin);
 }
 
+size_t ServerSettings::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::VarInt(Difficulty);
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+    bits += SerializedSize::kBool;
+
+    return bits;
+}
+
 void ServerSettings::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     Difficulty = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
@@ -8,6 +8,7 @@ struct ServerSettings
     bool operator!=(const ServerSettings& acRhs) const noexcept;
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
     uint32_t Difficulty{};
@@ -0,0 +1,1270 @@
+#pragma once
+
+// DO NOT EDIT, generated by Tools/Scripts/generate_behavior_var_tables.py from the descriptors of this folder
+
+#include <BehaviorVarTable.h>
+
+namespace BehaviorVarTables
+{
+namespace WolfRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_WolfDefault",
+    "bSkeeverLunge", "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "SpeedSampled",
+    "IsBashing", "walkBackRate", "iMovementSpeed", "staggerDirection", "bFootIKDisable", "iGetUpType", "iState_WolfRun", "iState_CowDefault",
+    "iState_DogDefault", "iState_SabreCatDefault", "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_BearDefault",
+    "iState_DeerDefault", "iState_GoatDefault", "iState_HorkerDefault", "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection",
+    "OldDirection", "bNoHeadTrack", "camerafromx", "camerafromy", "camerafromz", "walkBackSpeedMult", "IsSideAttacking", "isIdleLay", "bFootIKEnable",
+    "iState_CowSwimDefault", "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_wolfdefault",
+    "bskeeverlunge", "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "speedsampled",
+    "isbashing", "walkbackrate", "imovementspeed", "staggerdirection", "bfootikdisable", "igetuptype", "istate_wolfrun", "istate_cowdefault",
+    "istate_dogdefault", "istate_sabrecatdefault", "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_beardefault",
+    "istate_deerdefault", "istate_goatdefault", "istate_horkerdefault", "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection",
+    "olddirection", "bnoheadtrack", "camerafromx", "camerafromy", "camerafromz", "walkbackspeedmult", "issideattacking", "isidlelay", "bfootikenable",
+    "istate_cowswimdefault", "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    1, 2, 3, 5, 0, 0, 4, 7, 0, 9, 2, 5, 3, 0, 0, 9, 1, 0, 11, 1, 9, 10, 3, 7, 0, 0, 8, 7, 9, 10, 1, 15,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 4, 80, 51, 86, 48, 54, 23, 0, 39, 0, 34, 64, 25, 67, 0, 28, 20, 43, 26, 14, 70, 0, 0, 92, 1, 0, 52, 31, 33, 0, 46, 84, 72, 45, 0, 0, 36, 68, 0, 0, 37,
+    29, 2, 71, 0, 42, 22, 66, 0, 56, 32, 77, 79, 5, 74, 0, 24, 0, 0, 78, 87, 8, 7, 76, 60, 10, 63, 16, 65, 38, 0, 91, 41, 0, 17, 11, 61, 57, 3, 0, 30, 89, 40,
+    47, 0, 0, 75, 81, 82, 0, 6, 0, 59, 0, 9, 62, 19, 0, 0, 85, 0, 15, 0, 49, 0, 13, 83, 44, 0, 35, 90, 73, 0, 0, 0, 55, 50, 69, 0, 21, 27, 18, 58, 53, 0, 12,
+    88,
+};
+} // namespace WolfRootBehavior
+
+namespace DraugrBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "blendMoveStart", "blendMove1stP", "blendMoveStop", "TurnDelta", "blendDefault", "Direction", "Speed", "iWantSprint", "iSyncTurnState", "iRightHandType",
+    "iLeftHandType", "bIsSynced", "bAnimationDriven", "IsStaggering", "iSyncIdleLocomotion", "blendFast", "IsAttackReady", "bAllowRotation", "IsBlocking",
+    "IsPlayer", "Pitch", "IsFiringBow", "BowZoom", "BoolVariable", "IsEquipping", "IsUnequipping", "bWeapReady", "staggerMagnitude", "currentDefaultState",
+    "bEquipOk", "iWantBlock", "i1HMState", "IsBashing", "iState", "iState_DraugrDefault", "iState_DraugrBlocking", "SampledSpeed", "iEquippedItemState",
+    "bMLh_Ready", "IsCastingLeft", "IsCastingRight", "InDualMagicState", "IsCastingDual", "IsInCastStateDamped", "IsBlockHit", "bWantCastLeft",
+    "IsInCastState", "BlendAcc", "bInMoveState", "IsPowerAttacking", "bCastReady", "bVoiceReady", "bWantCastVoice", "TimeDelta", "iState_DraugrRanged",
+    "iState_Draugr1HM", "iState_DraugrBattleAxe", "iState_DraugrGreatSword", "iState_DraugrH2H", "iState_DraugrBow", "iState_DraugrBowDrawn",
+    "iState_Draugr2GSBlocking", "iState_Draugr2HMBlocking", "bHeadTrackingOn", "TargetLocation", "camerafromx", "camerafromy", "camerafromz", "bCanHeadTrack",
+    "IsBleedingOut", "bHeadTracking", "iState_DraugrShieldBlocking", "blendCyclic", "staggerDirection", "bInFurniture", "iGetUpType", "test",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blendmovestart", "blendmove1stp", "blendmovestop", "turndelta", "blenddefault", "direction", "speed", "iwantsprint", "isyncturnstate", "irighthandtype",
+    "ilefthandtype", "bissynced", "banimationdriven", "isstaggering", "isyncidlelocomotion", "blendfast", "isattackready", "ballowrotation", "isblocking",
+    "isplayer", "pitch", "isfiringbow", "bowzoom", "boolvariable", "isequipping", "isunequipping", "bweapready", "staggermagnitude", "currentdefaultstate",
+    "bequipok", "iwantblock", "i1hmstate", "isbashing", "istate", "istate_draugrdefault", "istate_draugrblocking", "sampledspeed", "iequippeditemstate",
+    "bmlh_ready", "iscastingleft", "iscastingright", "indualmagicstate", "iscastingdual", "isincaststatedamped", "isblockhit", "bwantcastleft",
+    "isincaststate", "blendacc", "binmovestate", "ispowerattacking", "bcastready", "bvoiceready", "bwantcastvoice", "timedelta", "istate_draugrranged",
+    "istate_draugr1hm", "istate_draugrbattleaxe", "istate_draugrgreatsword", "istate_draugrh2h", "istate_draugrbow", "istate_draugrbowdrawn",
+    "istate_draugr2gsblocking", "istate_draugr2hmblocking", "bheadtrackingon", "targetlocation", "camerafromx", "camerafromy", "camerafromz", "bcanheadtrack",
+    "isbleedingout", "bheadtracking", "istate_draugrshieldblocking", "blendcyclic", "staggerdirection", "binfurniture", "igetuptype", "test",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 4, 2, 2, 0, 0, 1, 2, 0, 0, 2, 1, 1, 3, 4, 3, 12, 1, 0, 0, 0, 6, 0, 3, 5, 0, 0, 0, 9, 2, 2, 4,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 39, 0, 26, 0, 10, 0, 9, 0, 0, 14, 53, 44, 0, 30, 0, 15, 0, 0, 0, 65, 0, 66, 73, 0, 45, 0, 57, 5, 42, 0, 0, 43, 24, 33, 0, 34, 0, 38, 0, 0, 0, 0, 0, 0,
+    0, 18, 0, 21, 0, 0, 54, 29, 0, 0, 0, 0, 32, 0, 27, 68, 23, 52, 0, 46, 0, 76, 0, 16, 62, 69, 31, 0, 55, 60, 56, 74, 63, 75, 6, 0, 17, 2, 20, 40, 7, 0, 0,
+    67, 0, 50, 0, 22, 8, 25, 47, 1, 72, 41, 19, 0, 51, 0, 36, 13, 0, 0, 59, 3, 4, 0, 70, 0, 12, 0, 61, 71, 28, 35, 0, 58, 11, 49, 0, 0, 48, 64, 37,
+};
+} // namespace DraugrBehavior
+
+namespace DeerRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_DeerDefault",
+    "bSkeeverLunge", "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing",
+    "bNoHeadTrack", "camerafromx", "camerafromy", "camerafromz", "walkBackRate", "staggerDirection", "iMovementSpeed", "iState_DeerDefaultRun", "iGetUpType",
+    "iState_CowDefault", "iState_DogDefault", "iState_WolfDefault", "iState_SabreCatDefault", "iState_SkeeverDefault", "iState_SkeeverLunge",
+    "iState_HorseDefault", "iState_BearDefault", "iState_GoatDefault", "iState_HorkerDefault", "iState_MammothDefault", "iState_HorseSprint",
+    "iSyncSprintState", "fTwistDirection", "OldDirection", "SpeedSampled", "walkBackSpeedMult", "IsSideAttacking", "isIdleLay", "bFootIKEnable",
+    "iState_CowSwimDefault", "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "SlowBlend", "DefaultBlend",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_deerdefault",
+    "bskeeverlunge", "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing",
+    "bnoheadtrack", "camerafromx", "camerafromy", "camerafromz", "walkbackrate", "staggerdirection", "imovementspeed", "istate_deerdefaultrun", "igetuptype",
+    "istate_cowdefault", "istate_dogdefault", "istate_wolfdefault", "istate_sabrecatdefault", "istate_skeeverdefault", "istate_skeeverlunge",
+    "istate_horsedefault", "istate_beardefault", "istate_goatdefault", "istate_horkerdefault", "istate_mammothdefault", "istate_horsesprint",
+    "isyncsprintstate", "ftwistdirection", "olddirection", "speedsampled", "walkbackspeedmult", "issideattacking", "isidlelay", "bfootikenable",
+    "istate_cowswimdefault", "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "slowblend", "defaultblend",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 2, 5, 2, 0, 0, 4, 7, 0, 9, 1, 26, 2, 0, 0, 9, 3, 15, 11, 1, 17, 6, 6, 5, 0, 0, 9, 7, 9, 10, 1, 9,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 4, 58, 55, 85, 48, 54, 23, 26, 39, 0, 50, 66, 25, 28, 83, 0, 20, 43, 0, 14, 46, 2, 0, 21, 1, 79, 52, 31, 33, 0, 0, 63, 74, 45, 86, 0, 36, 67, 70, 0, 37,
+    29, 0, 73, 0, 64, 22, 69, 40, 0, 32, 0, 57, 5, 76, 51, 24, 0, 65, 56, 88, 8, 7, 0, 0, 10, 0, 16, 0, 38, 0, 90, 0, 0, 17, 0, 11, 60, 3, 78, 30, 19, 0, 0, 0,
+    68, 77, 59, 81, 0, 6, 0, 61, 92, 9, 91, 0, 47, 0, 84, 0, 15, 34, 49, 71, 13, 82, 44, 0, 87, 89, 41, 27, 0, 0, 80, 35, 72, 42, 0, 75, 18, 62, 53, 0, 12, 0,
+};
+} // namespace DeerRootBehavior
+
+namespace FrostbiteSpider
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "blendFast", "blendSlow", "Direction", "IsBlocking", "Speed", "staggerMagnitude", "TurnDelta", "IsAttackReady", "weaponSpeedMult",
+    "bAllowRotation", "turnSpeedMult", "iCombatStance", "iSyncTurnState", "IntDirection", "bMotionDriven", "iSyncIdleLocomotion", "fMinTurnDelta",
+    "bAnimationDriven", "IsAttacking", "iLeftHandType", "iWeapCategory", "bWantCastLeft", "bMLh_Ready", "iState_CombatSpider_MT", "iState_DefaultSpider_MT",
+    "iState", "IsBashing", "bEquipOk", "IsStaggering", "IsRecoiling", "SpeedDamped", "SpeedSampled", "iCurrentStateID", "iGetUpType", "bIsSynced",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "blendfast", "blendslow", "direction", "isblocking", "speed", "staggermagnitude", "turndelta", "isattackready", "weaponspeedmult",
+    "ballowrotation", "turnspeedmult", "icombatstance", "isyncturnstate", "intdirection", "bmotiondriven", "isyncidlelocomotion", "fminturndelta",
+    "banimationdriven", "isattacking", "ilefthandtype", "iweapcategory", "bwantcastleft", "bmlh_ready", "istate_combatspider_mt", "istate_defaultspider_mt",
+    "istate", "isbashing", "bequipok", "isstaggering", "isrecoiling", "speeddamped", "speedsampled", "icurrentstateid", "igetuptype", "bissynced",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    2, 0, 0, 0, 7, 0, 0, 0, 1, 0, 1, 0, 0, 10, 0, 12,
+};
+inline constexpr uint16_t kSlots[] = {
+    33, 0, 0, 0, 0, 14, 0, 0, 25, 35, 16, 28, 0, 10, 1, 34, 0, 29, 0, 0, 11, 0, 0, 0, 0, 0, 12, 0, 0, 13, 0, 0, 32, 8, 26, 3, 0, 0, 23, 4, 24, 2, 0, 0, 7, 30,
+    19, 22, 20, 15, 0, 0, 0, 5, 17, 21, 27, 31, 0, 6, 0, 9, 18, 0,
+};
+} // namespace FrostbiteSpider
+
+namespace SkeeverRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_SkeeverDefault",
+    "iState_SkeeverLunge", "bSkeeverLunge", "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady",
+    "TurnDeltaDamped", "SpeedSampled", "IsBashing", "walkBackRate", "staggerDirection", "bNoHeadTrack", "iGetUpType", "bFootIKDisable", "iState_CowDefault",
+    "iState_DogDefault", "iState_WolfDefault", "iState_SabreCatDefault", "iState_HorseDefault", "iState_BearDefault", "iState_DeerDefault",
+    "iState_GoatDefault", "iState_HorkerDefault", "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection",
+    "camerafromx", "camerafromy", "camerafromz", "walkBackSpeedMult", "iMovementSpeed", "IsSideAttacking", "isIdleLay", "bFootIKEnable",
+    "iState_CowSwimDefault", "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_skeeverdefault",
+    "istate_skeeverlunge", "bskeeverlunge", "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready",
+    "turndeltadamped", "speedsampled", "isbashing", "walkbackrate", "staggerdirection", "bnoheadtrack", "igetuptype", "bfootikdisable", "istate_cowdefault",
+    "istate_dogdefault", "istate_wolfdefault", "istate_sabrecatdefault", "istate_horsedefault", "istate_beardefault", "istate_deerdefault",
+    "istate_goatdefault", "istate_horkerdefault", "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection",
+    "camerafromx", "camerafromy", "camerafromz", "walkbackspeedmult", "imovementspeed", "issideattacking", "isidlelay", "bfootikenable",
+    "istate_cowswimdefault", "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 2, 5, 5, 0, 0, 4, 7, 0, 9, 1, 26, 2, 0, 0, 9, 1, 15, 11, 1, 17, 6, 6, 5, 0, 0, 9, 7, 9, 10, 1, 9,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 4, 78, 57, 85, 49, 55, 23, 26, 39, 0, 51, 64, 25, 28, 83, 0, 20, 43, 0, 14, 69, 2, 0, 21, 1, 76, 53, 31, 33, 0, 0, 91, 71, 45, 0, 0, 36, 65, 47, 0, 37,
+    29, 0, 70, 0, 61, 22, 46, 40, 0, 32, 0, 77, 5, 73, 52, 24, 0, 63, 60, 86, 8, 7, 0, 62, 10, 0, 16, 0, 38, 0, 90, 41, 0, 17, 0, 11, 58, 3, 75, 30, 88, 0, 0,
+    0, 66, 74, 79, 80, 0, 6, 0, 59, 0, 9, 0, 19, 48, 0, 84, 0, 15, 34, 50, 67, 13, 82, 44, 0, 87, 89, 0, 27, 0, 0, 56, 35, 68, 42, 0, 72, 18, 81, 54, 0, 12, 0,
+};
+} // namespace SkeeverRootBehavior
+
+namespace Falmer_Master_Behavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "iSyncTurnState", "Speed", "blendDefault", "Direction", "bEquipOk", "iRightHandType", "iWantBlock", "iLeftHandType",
+    "iEquippedItemState", "IsAttackReady", "IsRecoiling", "IsStaggering", "bWeapReady", "IsAttacking", "currentDefaultState", "blendFast", "bAnimationDriven",
+    "staggerMagnitude", "bAllowRotation", "bHeadTracking", "TargetLocation", "bHeadTrackingOn", "bCanHeadTrack", "IsBlocking", "iBlockState",
+    "iSyncAttackStance", "IsBashing", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain",
+    "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModeFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain", "m_hipOrientationGain",
+    "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "m_footEndLS", "iState", "SpeedDamped", "TurnDelta",
+    "IsFiringBow", "Pitch", "SpeedSampled", "isCasting", "bWantCastLeft", "bMLh_Ready", "iState_FalmerDefault", "turnSpeedMult", "IsUnequipping",
+    "IsBleedingOut", "camerafromx", "camerafromy", "camerafromz", "iGetUpType", "bIsSynced", "staggerDirection", "iState_FalmerBowDrawn", "IsSquatting",
+    "iCombatState", "iLeftHandEquipped", "iStateRunWalk", "iStateCurrent", "iState_Falmer1HMRun", "iState_Falmer1HMWalk", "Int8Variable", "bWantCastRight",
+    "bMRh_Ready",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "isyncturnstate", "speed", "blenddefault", "direction", "bequipok", "irighthandtype", "iwantblock", "ilefthandtype",
+    "iequippeditemstate", "isattackready", "isrecoiling", "isstaggering", "bweapready", "isattacking", "currentdefaultstate", "blendfast", "banimationdriven",
+    "staggermagnitude", "ballowrotation", "bheadtracking", "targetlocation", "bheadtrackingon", "bcanheadtrack", "isblocking", "iblockstate",
+    "isyncattackstance", "isbashing", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain",
+    "m_footraisedgain", "m_footunlockgain", "m_worldfrommodefeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain", "m_hiporientationgain",
+    "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "m_footendls", "istate", "speeddamped", "turndelta",
+    "isfiringbow", "pitch", "speedsampled", "iscasting", "bwantcastleft", "bmlh_ready", "istate_falmerdefault", "turnspeedmult", "isunequipping",
+    "isbleedingout", "camerafromx", "camerafromy", "camerafromz", "igetuptype", "bissynced", "staggerdirection", "istate_falmerbowdrawn", "issquatting",
+    "icombatstate", "ilefthandequipped", "istaterunwalk", "istatecurrent", "istate_falmer1hmrun", "istate_falmer1hmwalk", "int8variable", "bwantcastright",
+    "bmrh_ready",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 0, 1, 2, 3, 1, 0, 0, 0, 0, 4, 7, 0, 5, 0, 1, 0, 0, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 53, 0, 40, 35, 20, 42, 0, 0, 4, 0, 54, 0, 0, 7, 0, 16, 12, 23, 0, 25, 0, 58, 62, 36, 60, 0, 18, 69, 0, 17, 0, 0, 34, 44, 0, 64, 0, 52, 0, 0, 0, 19, 73,
+    30, 0, 0, 37, 47, 0, 13, 5, 26, 68, 0, 0, 0, 39, 0, 48, 0, 0, 0, 43, 0, 29, 51, 0, 31, 0, 0, 57, 0, 70, 14, 32, 65, 0, 0, 2, 0, 66, 27, 0, 0, 0, 0, 0, 59,
+    0, 56, 67, 0, 1, 55, 0, 63, 0, 41, 0, 0, 0, 72, 11, 33, 3, 8, 0, 46, 6, 49, 0, 0, 0, 24, 38, 50, 15, 0, 22, 71, 45, 0, 61, 28, 10, 21, 9,
+};
+} // namespace Falmer_Master_Behavior
+
+namespace HagravenMasterBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "Speed", "IsStaggering", "IsAttacking", "IsRecoiling", "Direction", "SpeedSampled", "iSyncDefaultState", "iSyncIdleLocomotion", "iState",
+    "iState_HagravenDefault", "TurnDelta", "turnSpeedMult", "iSyncTurnState", "iRightHandType", "bWeapReady", "iEquippedItemState", "IsAttackReady",
+    "bMLh_Ready", "bMRh_Ready", "IntDirection", "blendFast", "blendDefault", "isCasting", "bWantCastRight", "bWantCastLeft", "bHeadTrackingOn",
+    "TargetLocation", "camerafromx", "camerafromy", "camerafromz", "bCanHeadTrack", "bHeadTracking", "bEquipOk", "bAnimationDriven", "staggerMagnitude",
+    "bIsSynced", "iGetUpType", "staggerDirection", "TimeStep", "bFullyMotionDriven", "DirectionDamped", "bFootIK", "bNoFootIK", "IsShouting", "IsBusy",
+    "IsIdle", "bVoiceReady", "bWantCastVoice", "iCombat", "TweenEntryDirection", "iDirectionForward", "PhonemeBlendTarget", "LipBigAah", "LipDST", "LipEee",
+    "LipFV", "LipK", "LipL", "LipR", "LipTh", "PhonemeBlend", "LipAcc", "InvPhonemeBlend", "bLookAtTarget", "bCanLookAtTarget", "m_worldFromModelFeedbackGain",
+    "m_alignWorldFromModelGain", "m_ankeOrientationGain", "m_frontFootPlantedAnkleHeightMS", "m_frontFootRaisedAnkleHeightMS", "m_frontMaxAnkleHeightMS",
+    "m_frontMinAnkleHeightMS", "m_rearFootPlantedAnkleHeightMS", "m_rearFootRaisedAnkleHeightMS", "m_rearMaxAnkleHeightMS", "m_rearMinAnkleHeightMS",
+    "m_rearMaxAnkleAngleDegrees", "m_raycastDistanceUp", "m_raycastDistanceDown", "m_errorOut", "m_errorOutTranslation", "m_alignWithGroundRotation",
+    "BSLookAtModifier_m_onGain", "BSLookAtModifier_m_offGain", "LookAtHeadingMaxAngle", "BSLookAtModifier_CanLookOutsideLimit", "LookAtOutOfRange",
+    "bSpeedSynced", "defaultBlend", "HasTweenSpeed", "TweenSpeed", "DistToGoal", "TurnDeltaDamped", "PitchDeltaDamped", "FlightPitchBlend", "PathAngle",
+    "MovementDirection", "MoveDirZ", "BSLookAtModifier_m_onGain_Shouting", "BSLookAtModifier_m_onGain_Combat", "BSLookAtModifier_m_offGain_Shouting",
+    "BSLookAtModifier_m_offGain_Combat", "PitchDelta", "MaxSpeedCurrent", "MaxSpeed", "MinSpeed", "MaxSpeedDamped", "PathAngleThreshold", "TargetSpeedDamped",
+    "TargetSpeed", "TweenSpeedDamped", "TweenSpeedMin", "MaxAcc", "TargetSpeedMaxScale", "MaxDec", "Drag", "TargetSpeedThresholdMin",
+    "TargetSpeedThresholdMax", "IsFeathering", "TurnDeltaTarget", "TurnDeltaScale", "TurnDeltaDampedGain", "PitchDeltaTarget", "PitchDeltaDampedGain",
+    "FlightPitchBlendTarget", "FlightPitchBlendGain", "PickNewIdleTime", "FlightHitInjuredSpeedMin", "FlightHitInjuredDecGain", "TurnMin", "IsTurningLeft",
+    "IsTurningRight", "fMinSpeed", "isMoving", "IsMovingForward", "IsMovingBackward", "BSLookAtModifier_m_onGain_Default",
+    "BSLookAtModifier_m_offGain_Default", "TweenRotation", "bAllowRotation", "TweenPosition", "ConstraintOffset", "bTweenUpdate",
+    "TweenEntryDirectionFlightKillGrab", "TweenEntryDirectionPrev", "TweenEntryDirectionCur", "LipBigAahDamped", "LipGain", "LipDSTDamped", "LipEeeDamped",
+    "LipFVDamped", "LipKDamped", "LipLDamped", "LipRDamped", "LipThDamped",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "speed", "isstaggering", "isattacking", "isrecoiling", "direction", "speedsampled", "isyncdefaultstate", "isyncidlelocomotion", "istate",
+    "istate_hagravendefault", "turndelta", "turnspeedmult", "isyncturnstate", "irighthandtype", "bweapready", "iequippeditemstate", "isattackready",
+    "bmlh_ready", "bmrh_ready", "intdirection", "blendfast", "blenddefault", "iscasting", "bwantcastright", "bwantcastleft", "bheadtrackingon",
+    "targetlocation", "camerafromx", "camerafromy", "camerafromz", "bcanheadtrack", "bheadtracking", "bequipok", "banimationdriven", "staggermagnitude",
+    "bissynced", "igetuptype", "staggerdirection", "timestep", "bfullymotiondriven", "directiondamped", "bfootik", "bnofootik", "isshouting", "isbusy",
+    "isidle", "bvoiceready", "bwantcastvoice", "icombat", "tweenentrydirection", "idirectionforward", "phonemeblendtarget", "lipbigaah", "lipdst", "lipeee",
+    "lipfv", "lipk", "lipl", "lipr", "lipth", "phonemeblend", "lipacc", "invphonemeblend", "blookattarget", "bcanlookattarget", "m_worldfrommodelfeedbackgain",
+    "m_alignworldfrommodelgain", "m_ankeorientationgain", "m_frontfootplantedankleheightms", "m_frontfootraisedankleheightms", "m_frontmaxankleheightms",
+    "m_frontminankleheightms", "m_rearfootplantedankleheightms", "m_rearfootraisedankleheightms", "m_rearmaxankleheightms", "m_rearminankleheightms",
+    "m_rearmaxankleangledegrees", "m_raycastdistanceup", "m_raycastdistancedown", "m_errorout", "m_errorouttranslation", "m_alignwithgroundrotation",
+    "bslookatmodifier_m_ongain", "bslookatmodifier_m_offgain", "lookatheadingmaxangle", "bslookatmodifier_canlookoutsidelimit", "lookatoutofrange",
+    "bspeedsynced", "defaultblend", "hastweenspeed", "tweenspeed", "disttogoal", "turndeltadamped", "pitchdeltadamped", "flightpitchblend", "pathangle",
+    "movementdirection", "movedirz", "bslookatmodifier_m_ongain_shouting", "bslookatmodifier_m_ongain_combat", "bslookatmodifier_m_offgain_shouting",
+    "bslookatmodifier_m_offgain_combat", "pitchdelta", "maxspeedcurrent", "maxspeed", "minspeed", "maxspeeddamped", "pathanglethreshold", "targetspeeddamped",
+    "targetspeed", "tweenspeeddamped", "tweenspeedmin", "maxacc", "targetspeedmaxscale", "maxdec", "drag", "targetspeedthresholdmin",
+    "targetspeedthresholdmax", "isfeathering", "turndeltatarget", "turndeltascale", "turndeltadampedgain", "pitchdeltatarget", "pitchdeltadampedgain",
+    "flightpitchblendtarget", "flightpitchblendgain", "picknewidletime", "flighthitinjuredspeedmin", "flighthitinjureddecgain", "turnmin", "isturningleft",
+    "isturningright", "fminspeed", "ismoving", "ismovingforward", "ismovingbackward", "bslookatmodifier_m_ongain_default",
+    "bslookatmodifier_m_offgain_default", "tweenrotation", "ballowrotation", "tweenposition", "constraintoffset", "btweenupdate",
+    "tweenentrydirectionflightkillgrab", "tweenentrydirectionprev", "tweenentrydirectioncur", "lipbigaahdamped", "lipgain", "lipdstdamped", "lipeeedamped",
+    "lipfvdamped", "lipkdamped", "lipldamped", "liprdamped", "lipthdamped",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 1, 5, 1, 1, 3, 1, 2, 0, 2, 0, 1, 0, 0, 0, 0, 4, 1, 2, 0, 0, 1, 0, 5, 0, 0, 1, 3, 1, 4, 1, 2, 1, 4, 0, 0, 0, 4, 4, 2, 0, 0, 1, 11, 2, 0, 0, 5, 1, 0,
+    0, 4, 0, 0, 4, 4, 0, 5, 10, 2, 0, 0, 7,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 94, 129, 0, 111, 0, 39, 0, 121, 0, 100, 11, 0, 0, 0, 0, 0, 0, 134, 102, 0, 31, 0, 40, 0, 36, 0, 34, 0, 44, 0, 0, 0, 112, 5, 57, 85, 148, 0, 62, 67, 0,
+    120, 0, 0, 139, 152, 66, 0, 0, 0, 109, 55, 0, 0, 28, 16, 136, 99, 92, 1, 86, 47, 0, 71, 127, 0, 58, 0, 126, 0, 0, 84, 59, 0, 0, 0, 0, 0, 0, 78, 0, 88, 141,
+    69, 0, 52, 151, 79, 0, 131, 6, 12, 30, 98, 65, 33, 0, 0, 0, 0, 137, 135, 24, 38, 50, 110, 0, 0, 147, 0, 2, 0, 75, 0, 0, 0, 0, 90, 0, 93, 132, 0, 0, 0, 80,
+    26, 15, 103, 87, 7, 77, 74, 118, 54, 13, 0, 51, 0, 0, 154, 0, 0, 142, 150, 140, 60, 117, 76, 20, 64, 0, 149, 116, 133, 0, 4, 145, 70, 0, 107, 104, 8, 0,
+    37, 49, 17, 128, 0, 0, 122, 89, 56, 53, 0, 0, 124, 0, 14, 21, 119, 113, 0, 73, 0, 0, 130, 19, 0, 68, 0, 91, 0, 42, 10, 97, 101, 114, 0, 123, 3, 83, 72, 32,
+    0, 0, 0, 0, 63, 0, 43, 81, 0, 45, 61, 106, 29, 0, 105, 0, 153, 143, 146, 18, 48, 96, 0, 0, 125, 46, 23, 22, 0, 0, 0, 0, 0, 0, 9, 138, 27, 41, 0, 82, 108,
+    0, 0, 25, 0, 0, 115, 35, 95, 0, 0, 144,
+};
+} // namespace HagravenMasterBehavior
+
+namespace HorseRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnDirection", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "bHeadTrackingOn", "TargetLocation", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain",
+    "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain", "m_hipOrientationGain",
+    "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast", "bAnimationDriven", "bAllowRotation",
+    "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "staggerMagnitude", "IsBleedingOut", "bIsSynced", "bEquipOk",
+    "bCanHeadTrack", "blendVerySlow", "isIdleSitting", "bMirroredAttack", "iState", "iCharacterSelector", "fMinMoveSpeed", "Direction", "IsAttackReady",
+    "iState_HorseDefault", "TurnDeltaDamped", "iSyncSprintState", "iState_HorseSprint", "fTwistDirection", "IsSprinting", "HorseSpeedSampled",
+    "DirectionDamped", "DirectionRange", "DirectionRangeDamped", "IsBashing", "IsDismounting", "blendFromAnimDriven", "walkBackRate", "walkBackSpeedMult",
+    "camerafromx", "camerafromy", "camerafromz", "bInJumpState", "iState_HorseFall", "iGetUpType", "bInSwimState", "iState_HorseSwim", "staggerDirection",
+    "blendSlow", "bForceIdleStop", "bHorseFootIKEnable", "bNoHeadTrack", "isMoving",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturndirection", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "bheadtrackingon", "targetlocation", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain",
+    "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain", "m_hiporientationgain",
+    "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast", "banimationdriven", "ballowrotation",
+    "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "staggermagnitude", "isbleedingout", "bissynced", "bequipok",
+    "bcanheadtrack", "blendveryslow", "isidlesitting", "bmirroredattack", "istate", "icharacterselector", "fminmovespeed", "direction", "isattackready",
+    "istate_horsedefault", "turndeltadamped", "isyncsprintstate", "istate_horsesprint", "ftwistdirection", "issprinting", "horsespeedsampled",
+    "directiondamped", "directionrange", "directionrangedamped", "isbashing", "isdismounting", "blendfromanimdriven", "walkbackrate", "walkbackspeedmult",
+    "camerafromx", "camerafromy", "camerafromz", "binjumpstate", "istate_horsefall", "igetuptype", "binswimstate", "istate_horseswim", "staggerdirection",
+    "blendslow", "bforceidlestop", "bhorsefootikenable", "bnoheadtrack", "ismoving",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 4, 1, 0, 2, 5, 3, 6, 0, 4, 5, 8, 6, 5, 0, 0, 1, 0, 4, 0, 0, 4, 8, 0, 0, 0, 2, 0, 0, 2,
+};
+inline constexpr uint16_t kSlots[] = {
+    68, 54, 0, 30, 0, 59, 75, 0, 50, 51, 0, 8, 0, 0, 0, 0, 46, 32, 40, 0, 3, 26, 63, 70, 19, 0, 9, 34, 45, 41, 0, 0, 0, 0, 42, 0, 0, 29, 25, 0, 0, 0, 35, 2,
+    62, 28, 66, 0, 0, 65, 0, 37, 0, 0, 0, 4, 52, 11, 31, 0, 74, 0, 0, 22, 53, 38, 61, 18, 14, 72, 0, 60, 43, 17, 0, 0, 0, 0, 71, 13, 0, 0, 57, 56, 0, 0, 0, 0,
+    64, 0, 12, 0, 0, 49, 0, 0, 20, 5, 55, 0, 23, 7, 0, 0, 44, 1, 73, 47, 6, 0, 33, 39, 58, 0, 16, 21, 0, 69, 48, 10, 0, 15, 67, 36, 24, 0, 27, 0,
+};
+} // namespace HorseRootBehavior
+
+namespace Chicken
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "blendFast", "blendSlow", "Direction", "IsBlocking", "Speed", "staggerMagnitude", "TurnDelta", "IsAttackReady", "weaponSpeedMult",
+    "FootIKEnable", "bAllowRotation", "turnSpeedMult", "iCombatStance", "iSyncTurnState", "IntDirection", "bMotionDriven", "iSyncIdleLocomotion",
+    "fMinTurnDelta", "bAnimationDriven", "BoolVariable00", "IsAttacking", "iLeftHandType", "iWeapCategory", "bWantCastLeft", "bMLh_Ready",
+    "iState_Chicken_Default_MT", "iState", "IsBashing", "IsStaggering", "IsRecoiling", "SpeedDamped", "SpeedSampled", "bHeadTracking", "TargetLocation",
+    "bHeadTrackingOff", "SlowBlend", "bNoHeadTrack", "AggroWarningBlend", "staggerDirection", "iCurrentStateID", "iGetUpType", "iTurnMirrored",
+    "EC_iSyncIdleLocomotion_1", "isIdleSitting", "isIdleLay", "bForceIdleStop",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "blendfast", "blendslow", "direction", "isblocking", "speed", "staggermagnitude", "turndelta", "isattackready", "weaponspeedmult",
+    "footikenable", "ballowrotation", "turnspeedmult", "icombatstance", "isyncturnstate", "intdirection", "bmotiondriven", "isyncidlelocomotion",
+    "fminturndelta", "banimationdriven", "boolvariable00", "isattacking", "ilefthandtype", "iweapcategory", "bwantcastleft", "bmlh_ready",
+    "istate_chicken_default_mt", "istate", "isbashing", "isstaggering", "isrecoiling", "speeddamped", "speedsampled", "bheadtracking", "targetlocation",
+    "bheadtrackingoff", "slowblend", "bnoheadtrack", "aggrowarningblend", "staggerdirection", "icurrentstateid", "igetuptype", "iturnmirrored",
+    "ec_isyncidlelocomotion_1", "isidlesitting", "isidlelay", "bforceidlestop",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 5, 4, 2, 0, 8, 17, 0, 5, 0, 1, 1, 0, 16,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 31, 1, 0, 41, 46, 45, 38, 0, 3, 15, 0, 0, 0, 2, 28, 0, 29, 44, 32, 12, 42, 0, 39, 4, 0, 13, 0, 0, 14, 35, 0, 10, 0, 27, 36, 0, 17, 25, 30, 34, 5, 11, 0,
+    7, 26, 21, 24, 22, 16, 20, 0, 43, 33, 18, 23, 40, 0, 9, 6, 37, 8, 19, 0,
+};
+} // namespace Chicken
+
+namespace GoatRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_GoatDefault",
+    "bSkeeverLunge", "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing",
+    "bNoHeadTrack", "camerafromx", "camerafromy", "camerafromz", "walkBackRate", "iGetUpType", "iState_CowDefault", "iState_DogDefault", "iState_WolfDefault",
+    "iState_SabreCatDefault", "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_BearDefault", "iState_DeerDefault",
+    "iState_HorkerDefault", "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection", "SpeedSampled",
+    "walkBackSpeedMult", "iMovementSpeed", "IsSideAttacking", "isIdleLay", "staggerDirection", "bFootIKEnable", "iState_CowSwimDefault",
+    "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun", "SlowBlend",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_goatdefault",
+    "bskeeverlunge", "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing",
+    "bnoheadtrack", "camerafromx", "camerafromy", "camerafromz", "walkbackrate", "igetuptype", "istate_cowdefault", "istate_dogdefault", "istate_wolfdefault",
+    "istate_sabrecatdefault", "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_beardefault", "istate_deerdefault",
+    "istate_horkerdefault", "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection", "speedsampled",
+    "walkbackspeedmult", "imovementspeed", "issideattacking", "isidlelay", "staggerdirection", "bfootikenable", "istate_cowswimdefault",
+    "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun", "slowblend",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 2, 5, 2, 0, 0, 4, 7, 0, 9, 1, 26, 2, 0, 0, 9, 3, 15, 11, 1, 17, 6, 6, 5, 0, 0, 9, 7, 9, 10, 1, 9,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 4, 58, 55, 84, 48, 54, 23, 26, 39, 0, 50, 63, 25, 28, 81, 0, 20, 43, 0, 14, 70, 2, 0, 21, 1, 76, 52, 31, 33, 0, 0, 90, 71, 45, 85, 0, 36, 64, 67, 0, 37,
+    29, 0, 46, 0, 61, 22, 66, 40, 0, 32, 0, 57, 5, 73, 51, 24, 0, 62, 56, 87, 8, 7, 0, 0, 10, 0, 16, 0, 38, 0, 89, 0, 0, 17, 0, 11, 60, 3, 75, 30, 19, 0, 0, 0,
+    65, 74, 59, 78, 0, 6, 0, 82, 0, 9, 91, 0, 47, 0, 83, 0, 15, 34, 49, 68, 13, 80, 44, 0, 86, 88, 41, 27, 0, 0, 77, 35, 69, 42, 0, 72, 18, 79, 53, 0, 12, 0,
+};
+} // namespace GoatRootBehavior
+
+namespace ScribRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "bSkeeverLunge",
+    "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing", "bNoHeadTrack",
+    "camerafromx", "camerafromy", "camerafromz", "walkBackRate", "m_footPlantedAnkleHeightMS_Front", "m_footRaisedAnkleHeightMS_Front",
+    "m_maxAnkleHeightMS_Front", "m_footPlantedAnkleHeightMS_Rear", "m_footRaisedAnkleHeightMS_Rear", "m_maxAnkleHeightMS_Rear",
+    "m_minCharControllerSeparation", "m_maxCharControllerSeparation", "m_errorOut", "m_hitSomething_0", "m_hitSomething_1", "m_hitSomething_2",
+    "m_hitSomething_3", "bLegCastResults", "IsSideAttacking", "iGetUpType", "iGetUpType00", "iMovementSpeed", "isMoving", "bForceIdleStop", "bFootIKEnable",
+    "isIdleLay", "isSwimming00", "iState_ScribDefault", "walkBackSpeedMult", "staggerDirection", "SpeedSampled", "SlowBlend", "defaultBlend",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "bskeeverlunge",
+    "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing", "bnoheadtrack",
+    "camerafromx", "camerafromy", "camerafromz", "walkbackrate", "m_footplantedankleheightms_front", "m_footraisedankleheightms_front",
+    "m_maxankleheightms_front", "m_footplantedankleheightms_rear", "m_footraisedankleheightms_rear", "m_maxankleheightms_rear",
+    "m_mincharcontrollerseparation", "m_maxcharcontrollerseparation", "m_errorout", "m_hitsomething_0", "m_hitsomething_1", "m_hitsomething_2",
+    "m_hitsomething_3", "blegcastresults", "issideattacking", "igetuptype", "igetuptype00", "imovementspeed", "ismoving", "bforceidlestop", "bfootikenable",
+    "isidlelay", "isswimming00", "istate_scribdefault", "walkbackspeedmult", "staggerdirection", "speedsampled", "slowblend", "defaultblend",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 6, 1, 1, 6, 5, 12, 3, 22, 1, 3, 1, 0, 0, 4, 0, 3, 1, 2, 4, 2, 5, 4, 1, 0, 7, 2, 7, 5, 0, 9,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 66, 0, 0, 62, 82, 85, 0, 25, 48, 78, 8, 6, 55, 27, 70, 0, 60, 42, 0, 3, 26, 52, 0, 20, 0, 31, 36, 58, 0, 0, 0, 69, 0, 44, 72, 0, 71, 18, 49, 0, 0, 59,
+    0, 22, 0, 74, 0, 1, 32, 0, 39, 75, 86, 46, 64, 0, 11, 45, 68, 54, 0, 9, 23, 67, 40, 83, 19, 15, 0, 61, 7, 80, 29, 34, 56, 4, 0, 41, 0, 0, 0, 53, 17, 0, 0,
+    0, 0, 57, 30, 13, 76, 0, 37, 24, 2, 21, 5, 65, 0, 79, 84, 14, 73, 47, 50, 0, 77, 81, 87, 63, 0, 10, 0, 0, 38, 0, 35, 51, 43, 0, 16, 0, 0, 12, 0, 28, 33,
+};
+} // namespace ScribRootBehavior
+
+namespace HorkerRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_HorkerDefault",
+    "bSkeeverLunge", "iCharacterSelector", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing", "walkBackRate",
+    "iState_HorkerSwimDefault", "iGetUpType", "iState_CowDefault", "iState_DogDefault", "iState_WolfDefault", "iState_SabreCatDefault",
+    "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_BearDefault", "iState_DeerDefault", "iState_GoatDefault",
+    "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection", "SpeedSampled", "bNoHeadTrack", "camerafromx",
+    "camerafromy", "camerafromz", "walkBackSpeedMult", "iMovementSpeed", "IsSideAttacking", "isIdleLay", "staggerDirection", "bFootIKEnable",
+    "iState_CowSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_horkerdefault",
+    "bskeeverlunge", "icharacterselector", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing", "walkbackrate",
+    "istate_horkerswimdefault", "igetuptype", "istate_cowdefault", "istate_dogdefault", "istate_wolfdefault", "istate_sabrecatdefault",
+    "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_beardefault", "istate_deerdefault", "istate_goatdefault",
+    "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection", "speedsampled", "bnoheadtrack", "camerafromx",
+    "camerafromy", "camerafromz", "walkbackspeedmult", "imovementspeed", "issideattacking", "isidlelay", "staggerdirection", "bfootikenable",
+    "istate_cowswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    1, 3, 2, 2, 0, 0, 3, 0, 0, 9, 2, 6, 3, 2, 0, 4, 0, 0, 5, 2, 13, 4, 0, 7, 0, 0, 8, 4, 2, 0, 0, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 7, 51, 32, 84, 0, 73, 0, 0, 37, 0, 36, 59, 25, 6, 15, 28, 76, 43, 0, 0, 66, 82, 0, 50, 57, 87, 0, 0, 0, 0, 72, 0, 46, 45, 56, 0, 63, 64, 13, 0, 0, 38,
+    2, 67, 30, 69, 22, 86, 42, 54, 0, 0, 0, 5, 11, 0, 24, 33, 0, 74, 0, 53, 9, 0, 41, 10, 58, 16, 61, 81, 75, 48, 0, 89, 17, 0, 0, 55, 3, 0, 0, 19, 40, 47, 0,
+    78, 14, 77, 31, 0, 79, 0, 70, 62, 4, 29, 8, 26, 27, 83, 65, 60, 80, 34, 1, 0, 88, 44, 0, 35, 71, 68, 0, 0, 23, 0, 49, 52, 0, 21, 20, 18, 39, 0, 0, 12, 85,
+};
+} // namespace HorkerRootBehavior
+
+namespace VampireBruteRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "Speed", "Direction", "bAnimationDriven", "BlendNormal", "IsAttacking", "blendFast", "TurnDelta", "iSyncTurnState", "IsAttackReady",
+    "IsRecoiling", "IsStaggering", "staggerMagnitude", "TargetLocation", "IsBleedingOut", "blendSlow", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain",
+    "m_groundDescendingGain", "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias",
+    "m_alignWorldFromModelGain", "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS",
+    "bEquipOk", "iSyncDefaultState", "bHeadTrackingOn", "bCanHeadTrack", "fMinSpeed", "fMinTurnSpeed", "iState", "iState_GargoyleDefault", "m_footEndLS",
+    "SpeedSampled", "IsBashing", "iState_GargoyleCombatRun", "camerafromx", "camerafromy", "camerafromz", "DirectionDamped", "DirectionGain",
+    "m_raycastDistanceUp", "m_raycastDistanceDown", "staggerDirection", "m_errorOutTranslation", "bAllowRotation", "iGetUpType", "bHeadTracking", "bIsSynced",
+    "iStateRunWalk", "iState_GargoyleCombatWalk", "iStateCurrent", "IsBleedingOutTransition",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "speed", "direction", "banimationdriven", "blendnormal", "isattacking", "blendfast", "turndelta", "isyncturnstate", "isattackready",
+    "isrecoiling", "isstaggering", "staggermagnitude", "targetlocation", "isbleedingout", "blendslow", "footikenable", "m_onoffgain", "m_groundascendinggain",
+    "m_grounddescendinggain", "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias",
+    "m_alignworldfrommodelgain", "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms",
+    "bequipok", "isyncdefaultstate", "bheadtrackingon", "bcanheadtrack", "fminspeed", "fminturnspeed", "istate", "istate_gargoyledefault", "m_footendls",
+    "speedsampled", "isbashing", "istate_gargoylecombatrun", "camerafromx", "camerafromy", "camerafromz", "directiondamped", "directiongain",
+    "m_raycastdistanceup", "m_raycastdistancedown", "staggerdirection", "m_errorouttranslation", "ballowrotation", "igetuptype", "bheadtracking", "bissynced",
+    "istaterunwalk", "istate_gargoylecombatwalk", "istatecurrent", "isbleedingouttransition",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 9, 3, 1, 0, 3, 10, 1, 0, 0, 2, 0, 12, 5, 0, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 21, 12, 0, 0, 54, 30, 41, 0, 0, 5, 11, 0, 0, 0, 0, 6, 0, 15, 43, 56, 59, 44, 50, 24, 53, 0, 0, 3, 0, 0, 0, 0, 0, 37, 46, 51, 48, 22, 0, 16, 0, 39, 58,
+    26, 0, 0, 25, 33, 0, 0, 0, 23, 0, 4, 0, 0, 27, 28, 2, 0, 0, 18, 52, 0, 34, 0, 0, 19, 0, 0, 0, 17, 0, 42, 20, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+    0, 0, 8, 10, 0, 31, 38, 29, 0, 0, 49, 0, 14, 0, 0, 35, 57, 7, 0, 40, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 36, 0, 32, 0, 9, 13, 47,
+};
+} // namespace VampireBruteRootBehavior
+
+namespace Chaurus
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "blendFast", "blendSlow", "Direction", "IsBlocking", "Speed", "staggerMagnitude", "TurnDelta", "IsAttackReady", "weaponSpeedMult",
+    "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain",
+    "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain", "m_hipOrientationGain", "m_footPlantedAnkleHeightMS",
+    "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "bAllowRotation", "turnSpeedMult", "iCombatStance", "iSyncTurnState",
+    "IntDirection", "bMotionDriven", "iSyncIdleLocomotion", "fMinTurnDelta", "bAnimationDriven", "BoolVariable00", "IsAttacking", "iLeftHandType",
+    "iWeapCategory", "bWantCastLeft", "bMLh_Ready", "iState_DefaultChaurus_MT", "iState", "IsBashing", "bEquipOk", "IsStaggering", "IsRecoiling", "m_state",
+    "m_direction", "m_goalSpeed", "m_speedOut", "SpeedDamped", "m_enable", "m_limitAngleDegrees", "m_startBoneIndex", "m_gain", "m_boneRadius",
+    "m_endBoneIndex", "m_castOffset", "SpeedSampled", "bHeadTracking", "TargetLocation", "bHeadTrackingOff", "SlowBlend", "bNoHeadTrack", "AggroWarningBlend",
+    "staggerDirection", "iCurrentStateID", "iGetUpType", "IsSideAttacking", "isIdleLay", "isIdleSitting", "speedRight", "speedMultRight", "speedLeft",
+    "speedMultLeft", "speedBackward", "speedMultBackward", "speedForward", "speedMultForward",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "blendfast", "blendslow", "direction", "isblocking", "speed", "staggermagnitude", "turndelta", "isattackready", "weaponspeedmult",
+    "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain", "m_footraisedgain", "m_footunlockgain",
+    "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain", "m_hiporientationgain", "m_footplantedankleheightms",
+    "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "ballowrotation", "turnspeedmult", "icombatstance", "isyncturnstate",
+    "intdirection", "bmotiondriven", "isyncidlelocomotion", "fminturndelta", "banimationdriven", "boolvariable00", "isattacking", "ilefthandtype",
+    "iweapcategory", "bwantcastleft", "bmlh_ready", "istate_defaultchaurus_mt", "istate", "isbashing", "bequipok", "isstaggering", "isrecoiling", "m_state",
+    "m_direction", "m_goalspeed", "m_speedout", "speeddamped", "m_enable", "m_limitangledegrees", "m_startboneindex", "m_gain", "m_boneradius",
+    "m_endboneindex", "m_castoffset", "speedsampled", "bheadtracking", "targetlocation", "bheadtrackingoff", "slowblend", "bnoheadtrack", "aggrowarningblend",
+    "staggerdirection", "icurrentstateid", "igetuptype", "issideattacking", "isidlelay", "isidlesitting", "speedright", "speedmultright", "speedleft",
+    "speedmultleft", "speedbackward", "speedmultbackward", "speedforward", "speedmultforward",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 0, 1, 1, 2, 5, 3, 0, 0, 2, 0, 1, 1, 5, 0, 0, 4, 3, 13, 0, 0, 0, 6, 0, 2, 0, 3, 2, 0, 6,
+};
+inline constexpr uint16_t kSlots[] = {
+    54, 15, 31, 0, 0, 0, 0, 0, 71, 46, 0, 0, 0, 47, 0, 0, 8, 44, 70, 57, 5, 1, 56, 65, 18, 0, 27, 0, 26, 6, 0, 73, 0, 16, 41, 48, 0, 59, 39, 34, 0, 0, 0, 0,
+    12, 0, 25, 38, 36, 2, 0, 23, 0, 24, 40, 0, 0, 60, 22, 3, 63, 9, 68, 21, 0, 4, 0, 17, 13, 53, 69, 0, 45, 0, 78, 43, 0, 0, 58, 0, 0, 0, 0, 67, 0, 64, 0, 0,
+    0, 52, 11, 0, 0, 28, 61, 0, 19, 55, 50, 0, 0, 32, 75, 51, 0, 62, 76, 49, 7, 0, 35, 0, 66, 30, 0, 0, 0, 20, 77, 37, 42, 14, 0, 72, 74, 29, 33, 10,
+};
+} // namespace Chaurus
+
+namespace SabreCatRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_SabreCatDefault",
+    "bSkeeverLunge", "iCharacterSelector", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing", "walkBackRate",
+    "iGetUpType", "iState_SabreCatRun", "iState_CowDefault", "iState_DogDefault", "iState_WolfDefault", "iState_SkeeverDefault", "iState_SkeeverLunge",
+    "iState_HorseDefault", "iState_BearDefault", "iState_DeerDefault", "iState_GoatDefault", "iState_HorkerDefault", "iState_MammothDefault",
+    "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection", "SpeedSampled", "bNoHeadTrack", "camerafromx", "camerafromy", "camerafromz",
+    "walkBackSpeedMult", "iMovementSpeed", "IsSideAttacking", "isIdleLay", "staggerDirection", "bFootIKEnable", "iState_CowSwimDefault",
+    "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_sabrecatdefault",
+    "bskeeverlunge", "icharacterselector", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing", "walkbackrate",
+    "igetuptype", "istate_sabrecatrun", "istate_cowdefault", "istate_dogdefault", "istate_wolfdefault", "istate_skeeverdefault", "istate_skeeverlunge",
+    "istate_horsedefault", "istate_beardefault", "istate_deerdefault", "istate_goatdefault", "istate_horkerdefault", "istate_mammothdefault",
+    "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection", "speedsampled", "bnoheadtrack", "camerafromx", "camerafromy", "camerafromz",
+    "walkbackspeedmult", "imovementspeed", "issideattacking", "isidlelay", "staggerdirection", "bfootikenable", "istate_cowswimdefault",
+    "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    1, 3, 2, 2, 0, 0, 3, 0, 0, 9, 2, 6, 3, 2, 0, 4, 0, 0, 5, 2, 13, 4, 0, 7, 0, 0, 8, 4, 2, 0, 0, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 7, 51, 32, 84, 0, 73, 0, 0, 37, 0, 36, 59, 25, 6, 15, 28, 76, 43, 0, 0, 65, 82, 0, 50, 56, 88, 0, 0, 0, 0, 72, 0, 67, 45, 85, 0, 62, 63, 13, 0, 0, 38,
+    2, 66, 30, 69, 22, 87, 42, 54, 57, 0, 0, 5, 11, 0, 24, 33, 0, 74, 0, 53, 9, 0, 41, 10, 58, 16, 46, 81, 75, 48, 0, 90, 17, 0, 0, 55, 3, 0, 0, 19, 40, 47, 0,
+    78, 14, 77, 31, 0, 79, 0, 70, 61, 4, 29, 8, 26, 27, 83, 64, 60, 80, 34, 1, 0, 89, 44, 0, 35, 71, 68, 0, 0, 23, 0, 49, 52, 0, 21, 20, 18, 39, 0, 0, 12, 86,
+};
+} // namespace SabreCatRootBehavior
+
+namespace AtronachStormBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "iSyncIdleLocomotion", "blendSlow", "Speed", "Direction", "IsStaggering", "IsRecoiling", "bEquipOk", "iState",
+    "iState_AtronachStormDefault", "IsAttackReady", "bHeadTracking", "blendFast", "CombatSpeedMult", "IsAttacking", "iSyncDefaultState", "DirectionDamped",
+    "SpeedAcc", "TimeDelta", "bAllowRotation", "staggerMagnitude", "bAnimationDriven", "bMLh_Ready", "isCasting", "bWantCastLeft", "iLeftHandType",
+    "IsSummoned", "IsBashing", "IsPowerAttacking", "staggerDirection", "iCombatStateID", "iGetUpType",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "isyncidlelocomotion", "blendslow", "speed", "direction", "isstaggering", "isrecoiling", "bequipok", "istate",
+    "istate_atronachstormdefault", "isattackready", "bheadtracking", "blendfast", "combatspeedmult", "isattacking", "isyncdefaultstate", "directiondamped",
+    "speedacc", "timedelta", "ballowrotation", "staggermagnitude", "banimationdriven", "bmlh_ready", "iscasting", "bwantcastleft", "ilefthandtype",
+    "issummoned", "isbashing", "ispowerattacking", "staggerdirection", "icombatstateid", "igetuptype",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 10, 0, 0, 1, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 0, 9, 0, 0, 11, 0, 27, 0, 0, 1, 18, 0, 19, 0, 3, 13, 5, 2, 0, 0, 12, 0, 17, 0, 31, 0, 0, 4, 0, 0, 0, 7, 0, 8, 0, 29, 30, 22, 0, 0, 0, 0, 15, 26, 6, 14,
+    24, 25, 0, 0, 0, 23, 16, 28, 0, 0, 0, 0, 20, 0, 10, 21, 0,
+};
+} // namespace AtronachStormBehavior
+
+namespace Mudcrab
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "blendFast", "blendSlow", "Direction", "IsBlocking", "Speed", "staggerMagnitude", "TurnDelta", "IsAttackReady", "FootIKEnable",
+    "bAllowRotation", "turnSpeedMult", "iCombatStance", "iSyncTurnState", "IntDirection", "bMotionDriven", "iSyncIdleLocomotion", "fMinTurnDelta",
+    "bAnimationDriven", "BoolVariable00", "IsAttacking", "iLeftHandType", "iWeapCategory", "bWantCastLeft", "iState_MCrab_Default_MT", "iState", "IsBashing",
+    "bEquipOk", "IsStaggering", "IsRecoiling", "SpeedDamped", "SpeedSampled", "bHeadTracking", "TargetLocation", "bHeadTrackingOff", "SlowBlend",
+    "bNoHeadTrack", "AggroWarningBlend", "staggerDirection", "iCurrentStateID", "isIdleLay", "isIdleSitting", "iGetUpType", "IsSideAttacking",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "blendfast", "blendslow", "direction", "isblocking", "speed", "staggermagnitude", "turndelta", "isattackready", "footikenable",
+    "ballowrotation", "turnspeedmult", "icombatstance", "isyncturnstate", "intdirection", "bmotiondriven", "isyncidlelocomotion", "fminturndelta",
+    "banimationdriven", "boolvariable00", "isattacking", "ilefthandtype", "iweapcategory", "bwantcastleft", "istate_mcrab_default_mt", "istate", "isbashing",
+    "bequipok", "isstaggering", "isrecoiling", "speeddamped", "speedsampled", "bheadtracking", "targetlocation", "bheadtrackingoff", "slowblend",
+    "bnoheadtrack", "aggrowarningblend", "staggerdirection", "icurrentstateid", "isidlelay", "isidlesitting", "igetuptype", "issideattacking",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 0, 2, 2, 6, 0, 0, 0, 3, 0, 8, 1, 0, 4,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 30, 33, 0, 1, 2, 31, 0, 24, 37, 0, 27, 0, 0, 42, 40, 3, 28, 41, 0, 11, 0, 0, 38, 0, 32, 12, 5, 4, 13, 34, 0, 9, 0, 25, 0, 19, 16, 14, 43, 17, 35, 10, 0,
+    7, 0, 20, 23, 21, 15, 0, 0, 39, 0, 8, 22, 26, 29, 0, 6, 36, 0, 18, 0,
+};
+} // namespace Mudcrab
+
+namespace WerewolfBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncTurnState", "TurnDelta", "Direction", "Speed", "bAnimationDriven", "bIsSynced", "IsRecoiling", "IsStaggering", "SpeedStartVar", "TurnDeltaDamped",
+    "TurnMin", "IsAttackReady", "IntDirection", "SpeedDamped", "IsAttacking", "bAllowRotation", "FootIKEnable", "bHeadTrackingOff", "staggerMagnitude",
+    "bEquipOk", "currentDefaultState", "iState", "iState_WerewolfBeastDefault", "SampledSpeed", "IsCrouching", "iSyncIdleLocomotion", "blendShort",
+    "blendNormal", "isMoving", "DirectionOffset", "DirDamped", "TimeDelta", "DirAcc", "DirectionBlendA", "DirectionBlendB", "ActiveBlend", "bDirBlendA",
+    "bDirBlendB", "blendThresh", "blendAttack", "bHeadTracking", "TargetLocation", "camerafromx", "camerafromy", "camerafromz", "iGetUpType", "Pitch",
+    "weaponSpeedMult", "iWantBlock", "iAttackState", "iState_WerewolfBeastSprint", "IsSprinting", "iSyncSprintState", "bVoiceReady", "bWantCastVoice",
+    "SpeedSampled", "FootIKDisable", "blendDefault", "bInJumpState", "VelocityZ", "iIsInSneak", "IsSneaking", "bFailMoveStart", "BeginCastVoice", "bNoStagger",
+    "bDelayMoveStart", "isHowling", "IsNPC",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncturnstate", "turndelta", "direction", "speed", "banimationdriven", "bissynced", "isrecoiling", "isstaggering", "speedstartvar", "turndeltadamped",
+    "turnmin", "isattackready", "intdirection", "speeddamped", "isattacking", "ballowrotation", "footikenable", "bheadtrackingoff", "staggermagnitude",
+    "bequipok", "currentdefaultstate", "istate", "istate_werewolfbeastdefault", "sampledspeed", "iscrouching", "isyncidlelocomotion", "blendshort",
+    "blendnormal", "ismoving", "directionoffset", "dirdamped", "timedelta", "diracc", "directionblenda", "directionblendb", "activeblend", "bdirblenda",
+    "bdirblendb", "blendthresh", "blendattack", "bheadtracking", "targetlocation", "camerafromx", "camerafromy", "camerafromz", "igetuptype", "pitch",
+    "weaponspeedmult", "iwantblock", "iattackstate", "istate_werewolfbeastsprint", "issprinting", "isyncsprintstate", "bvoiceready", "bwantcastvoice",
+    "speedsampled", "footikdisable", "blenddefault", "binjumpstate", "velocityz", "iisinsneak", "issneaking", "bfailmovestart", "begincastvoice", "bnostagger",
+    "bdelaymovestart", "ishowling", "isnpc",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 5, 1, 0, 0, 0, 4, 2, 0, 0, 0, 0, 1, 0, 3, 0, 8, 0, 0, 0, 0, 0, 2, 0, 3, 1, 1, 0, 2, 13, 2, 0,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 52, 10, 37, 0, 0, 59, 34, 22, 32, 25, 31, 0, 62, 48, 0, 0, 36, 0, 0, 42, 40, 43, 0, 0, 0, 63, 0, 0, 65, 0, 0, 0, 8, 55, 2, 0, 0, 0, 23, 0, 0, 0, 0, 0,
+    15, 0, 24, 0, 0, 0, 56, 0, 0, 0, 0, 11, 45, 6, 18, 0, 47, 54, 58, 0, 0, 0, 38, 0, 0, 0, 35, 49, 0, 0, 19, 64, 0, 0, 3, 0, 0, 0, 27, 4, 0, 0, 17, 0, 57, 51,
+    44, 46, 0, 30, 0, 16, 5, 0, 33, 0, 53, 12, 39, 0, 0, 0, 7, 1, 0, 14, 28, 0, 61, 29, 66, 0, 20, 9, 67, 0, 13, 21, 60, 50, 0, 41, 26,
+};
+} // namespace WerewolfBehavior
+
+namespace Spriggan
+{
+inline constexpr std::string_view kNames[] = {
+    "Speed", "fMinSpeed", "bHeadTrackingOn", "TargetLocation", "camerafromx", "camerafromy", "camerafromz", "TurnDelta", "iSyncTurnState", "Direction",
+    "iState", "iState_SprigganDefault", "bHeadTracking", "bCanHeadTrack", "IsStaggering", "IsRecoiling", "IsAttacking", "isCasting", "IsSummoned",
+    "bWantCastLeft", "bMLh_Ready", "bWantCastRight", "bMRh_Ready", "blendDefault", "blendSlow", "IntDirection", "IsAttackReady", "iSyncIdleLocomotion",
+    "bAnimationDriven", "iSyncDefaultState", "blendFast", "staggerMagnitude", "SpeedSampled", "SpeedSampledGain", "SpeedSampledDamped", "DirectionGain",
+    "bEquipOk", "IsDualActive", "iState_SprigganCombat", "bNoHeadTrack", "iGetUpType", "bIsSynced", "bForceIdleStop", "staggerDirection",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "speed", "fminspeed", "bheadtrackingon", "targetlocation", "camerafromx", "camerafromy", "camerafromz", "turndelta", "isyncturnstate", "direction",
+    "istate", "istate_spriggandefault", "bheadtracking", "bcanheadtrack", "isstaggering", "isrecoiling", "isattacking", "iscasting", "issummoned",
+    "bwantcastleft", "bmlh_ready", "bwantcastright", "bmrh_ready", "blenddefault", "blendslow", "intdirection", "isattackready", "isyncidlelocomotion",
+    "banimationdriven", "isyncdefaultstate", "blendfast", "staggermagnitude", "speedsampled", "speedsampledgain", "speedsampleddamped", "directiongain",
+    "bequipok", "isdualactive", "istate_spriggancombat", "bnoheadtrack", "igetuptype", "bissynced", "bforceidlestop", "staggerdirection",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 3, 0, 1, 2, 0, 3, 2, 0, 0, 0, 0, 1, 0, 4,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 13, 31, 33, 0, 42, 32, 0, 0, 0, 4, 14, 0, 18, 40, 0, 0, 0, 0, 0, 0, 30, 5, 43, 6, 12, 38, 29, 9, 8, 21, 0, 11, 0, 10, 0, 0, 27, 20, 41, 34, 0, 0, 1, 7,
+    15, 16, 19, 2, 0, 24, 23, 36, 37, 26, 22, 0, 3, 0, 25, 39, 17, 28, 35,
+};
+} // namespace Spriggan
+
+namespace Rabbit
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "blendFast", "blendSlow", "Direction", "IsBlocking", "Speed", "staggerMagnitude", "TurnDelta", "IsAttackReady", "weaponSpeedMult",
+    "FootIKEnable", "bAllowRotation", "turnSpeedMult", "iCombatStance", "iSyncTurnDirection", "IntDirection", "bMotionDriven", "iSyncIdleLocomotion",
+    "fMinTurnDelta", "bAnimationDriven", "BoolVariable00", "IsAttacking", "iLeftHandType", "iWeapCategory", "bWantCastLeft", "bMLh_Ready",
+    "iState_Hare_Default_MT", "iState", "IsBashing", "IsStaggering", "IsRecoiling", "SpeedDamped", "SpeedSampled", "bHeadTracking", "TargetLocation",
+    "bHeadTrackingOff", "SlowBlend", "bNoHeadTrack", "AggroWarningBlend", "staggerDirection", "iCurrentStateID", "iGetUpType", "EC_iSyncIdleLocomotion_1",
+    "isIdleSitting", "isIdleLay", "bForceIdleStop",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "blendfast", "blendslow", "direction", "isblocking", "speed", "staggermagnitude", "turndelta", "isattackready", "weaponspeedmult",
+    "footikenable", "ballowrotation", "turnspeedmult", "icombatstance", "isyncturndirection", "intdirection", "bmotiondriven", "isyncidlelocomotion",
+    "fminturndelta", "banimationdriven", "boolvariable00", "isattacking", "ilefthandtype", "iweapcategory", "bwantcastleft", "bmlh_ready",
+    "istate_hare_default_mt", "istate", "isbashing", "isstaggering", "isrecoiling", "speeddamped", "speedsampled", "bheadtracking", "targetlocation",
+    "bheadtrackingoff", "slowblend", "bnoheadtrack", "aggrowarningblend", "staggerdirection", "icurrentstateid", "igetuptype", "ec_isyncidlelocomotion_1",
+    "isidlesitting", "isidlelay", "bforceidlestop",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 0, 2, 0, 0, 6, 7, 0, 0, 4, 21, 1, 0, 14,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 41, 34, 0, 28, 2, 44, 0, 0, 38, 17, 0, 0, 0, 7, 11, 8, 29, 43, 33, 12, 1, 39, 0, 30, 0, 0, 5, 3, 0, 35, 0, 10, 15, 27, 0, 26, 0, 25, 32, 0, 36, 14, 45,
+    0, 9, 21, 24, 22, 16, 4, 0, 42, 0, 18, 23, 40, 31, 0, 6, 37, 20, 19, 13,
+};
+} // namespace Rabbit
+
+namespace BearRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "bSkeeverLunge",
+    "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing", "bNoHeadTrack",
+    "camerafromx", "camerafromy", "camerafromz", "walkBackRate", "iState_BearDefault", "m_footPlantedAnkleHeightMS_Front", "m_footRaisedAnkleHeightMS_Front",
+    "m_maxAnkleHeightMS_Front", "m_footPlantedAnkleHeightMS_Rear", "m_footRaisedAnkleHeightMS_Rear", "m_maxAnkleHeightMS_Rear",
+    "m_minCharControllerSeparation", "m_maxCharControllerSeparation", "m_errorOut", "m_hitSomething_0", "m_hitSomething_1", "m_hitSomething_2",
+    "m_hitSomething_3", "bLegCastResults", "IsSideAttacking", "iState_BearSwimDefault", "iGetUpType", "iGetUpType00", "iMovementSpeed", "isMoving",
+    "bForceIdleStop", "bFootIKEnable", "isIdleLay", "iState_CowDefault", "iState_DogDefault", "iState_WolfDefault", "iState_SabreCatDefault",
+    "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_DeerDefault", "iState_GoatDefault", "iState_HorkerDefault",
+    "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection", "SpeedSampled", "walkBackSpeedMult",
+    "staggerDirection", "iState_CowSwimDefault", "iState_HorkerSwimDefault", "isSwimming", "iState_DeerDefaultRun",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "bskeeverlunge",
+    "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing", "bnoheadtrack",
+    "camerafromx", "camerafromy", "camerafromz", "walkbackrate", "istate_beardefault", "m_footplantedankleheightms_front", "m_footraisedankleheightms_front",
+    "m_maxankleheightms_front", "m_footplantedankleheightms_rear", "m_footraisedankleheightms_rear", "m_maxankleheightms_rear",
+    "m_mincharcontrollerseparation", "m_maxcharcontrollerseparation", "m_errorout", "m_hitsomething_0", "m_hitsomething_1", "m_hitsomething_2",
+    "m_hitsomething_3", "blegcastresults", "issideattacking", "istate_bearswimdefault", "igetuptype", "igetuptype00", "imovementspeed", "ismoving",
+    "bforceidlestop", "bfootikenable", "isidlelay", "istate_cowdefault", "istate_dogdefault", "istate_wolfdefault", "istate_sabrecatdefault",
+    "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_deerdefault", "istate_goatdefault", "istate_horkerdefault",
+    "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection", "speedsampled", "walkbackspeedmult",
+    "staggerdirection", "istate_cowswimdefault", "istate_horkerswimdefault", "isswimming", "istate_deerdefaultrun",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    1, 2, 1, 1, 2, 0, 2, 0, 0, 1, 4, 0, 0, 3, 0, 1, 0, 1, 0, 3, 0, 2, 0, 8, 0, 0, 0, 1, 0, 0, 2, 0,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 0, 0, 0, 0, 0, 80, 0, 0, 24, 0, 0, 85, 0, 0, 63, 0, 0, 42, 0, 8, 0, 0, 0, 90, 62, 67, 3, 0, 0, 0, 0, 71, 93, 60, 65, 0, 0, 0, 86, 0, 0, 0, 0, 92, 0, 0,
+    0, 104, 0, 102, 0, 98, 0, 81, 57, 0, 77, 0, 37, 55, 0, 5, 0, 0, 41, 10, 0, 75, 0, 83, 0, 47, 0, 0, 0, 0, 30, 0, 54, 0, 0, 101, 0, 0, 50, 0, 0, 44, 0, 0, 0,
+    4, 97, 0, 0, 13, 0, 0, 0, 82, 7, 0, 89, 48, 0, 0, 34, 103, 0, 99, 35, 0, 9, 0, 0, 0, 0, 0, 79, 21, 2, 0, 0, 73, 0, 0, 0, 0, 96, 12, 32, 0, 31, 27, 76, 0,
+    0, 0, 74, 0, 0, 0, 0, 15, 20, 43, 0, 14, 91, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 45, 0, 0, 36, 19, 0, 17, 0, 29, 0, 105, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 66, 88, 0, 0, 61, 0, 53, 0, 0, 26, 6, 84, 16, 87, 0, 56, 18, 0, 0, 69, 72, 38, 59, 0, 28, 0, 78, 0, 0, 0, 0, 70, 58, 100, 0, 22, 51, 0, 0, 0, 0, 0, 0,
+    0, 0, 94, 64, 46, 0, 1, 0, 0, 0, 40, 0, 68, 11, 0, 0, 23, 0, 0, 0, 0, 25, 0, 0, 39, 0, 52, 0, 0,
+};
+} // namespace BearRootBehavior
+
+namespace SteamBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "currentDefaultState", "iSyncIdleLocomotion", "iSyncTurnState", "TurnDelta", "iState", "iState_SteamDefault", "Direction", "SampledSpeed", "Speed",
+    "iLeftHandType", "iRightHandType", "bAnimationDriven", "IsRecoiling", "IsStaggering", "IsAttacking", "bAllowRotation", "bEquipOk", "IsEquipping",
+    "IsUnequipping", "bWeapReady", "IsAttackReady", "iState_SteamCombat", "IsBlocking", "staggerMagnitude", "IsBashing", "bAttached", "isCasting",
+    "bWantCastVoice", "bMLh_Ready", "Int32Variable", "staggerDirection", "IsShouting", "iGetUpType", "bVoiceReady", "bHeadTrackingOn", "TargetLocation",
+    "camerafromx", "camerafromy", "camerafromz", "bCastReady", "bIsSynced",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "currentdefaultstate", "isyncidlelocomotion", "isyncturnstate", "turndelta", "istate", "istate_steamdefault", "direction", "sampledspeed", "speed",
+    "ilefthandtype", "irighthandtype", "banimationdriven", "isrecoiling", "isstaggering", "isattacking", "ballowrotation", "bequipok", "isequipping",
+    "isunequipping", "bweapready", "isattackready", "istate_steamcombat", "isblocking", "staggermagnitude", "isbashing", "battached", "iscasting",
+    "bwantcastvoice", "bmlh_ready", "int32variable", "staggerdirection", "isshouting", "igetuptype", "bvoiceready", "bheadtrackingon", "targetlocation",
+    "camerafromx", "camerafromy", "camerafromz", "bcastready", "bissynced",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    8, 0, 0, 0, 1, 5, 1, 5, 1, 1, 5, 1, 12, 5, 0, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 0, 3, 24, 0, 0, 5, 0, 0, 6, 0, 33, 0, 0, 0, 0, 0, 13, 30, 25, 8, 21, 0, 7, 0, 32, 27, 38, 2, 0, 12, 39, 0, 17, 0, 18, 0, 31, 34, 22, 0, 19, 0, 0, 36,
+    10, 14, 1, 9, 16, 0, 40, 26, 28, 0, 37, 29, 35, 4, 23, 0, 20, 11, 15,
+};
+} // namespace SteamBehavior
+
+namespace TrollBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncTurnState", "TurnDelta", "Direction", "Speed", "bAnimationDriven", "bIsSynced", "IsRecoiling", "IsStaggering", "SpeedStartVar", "TurnDeltaDamped",
+    "TurnMin", "IsAttackReady", "IntDirection", "SpeedDamped", "IsAttacking", "bAllowRotation", "FootIKEnable", "bHeadTrackingOff", "staggerMagnitude",
+    "bEquipOk", "currentDefaultState", "iState", "iState_TrollDefault", "SampledSpeed", "IsCrouching", "iSyncIdleLocomotion", "blendShort", "blendNormal",
+    "isMoving", "DirectionOffset", "DirDamped", "TimeDelta", "DirAcc", "DirectionBlendA", "DirectionBlendB", "ActiveBlend", "bDirBlendA", "bDirBlendB",
+    "blendThresh", "blendAttack", "bHeadTracking", "TargetLocation", "camerafromx", "camerafromy", "camerafromz", "iGetUpType", "staggerDirection",
+    "bForceIdleStop",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncturnstate", "turndelta", "direction", "speed", "banimationdriven", "bissynced", "isrecoiling", "isstaggering", "speedstartvar", "turndeltadamped",
+    "turnmin", "isattackready", "intdirection", "speeddamped", "isattacking", "ballowrotation", "footikenable", "bheadtrackingoff", "staggermagnitude",
+    "bequipok", "currentdefaultstate", "istate", "istate_trolldefault", "sampledspeed", "iscrouching", "isyncidlelocomotion", "blendshort", "blendnormal",
+    "ismoving", "directionoffset", "dirdamped", "timedelta", "diracc", "directionblenda", "directionblendb", "activeblend", "bdirblenda", "bdirblendb",
+    "blendthresh", "blendattack", "bheadtracking", "targetlocation", "camerafromx", "camerafromy", "camerafromz", "igetuptype", "staggerdirection",
+    "bforceidlestop",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    1, 0, 0, 0, 10, 1, 2, 2, 0, 3, 0, 0, 4, 18, 0, 5,
+};
+inline constexpr uint16_t kSlots[] = {
+    36, 8, 25, 31, 41, 47, 28, 34, 0, 32, 10, 0, 38, 17, 0, 44, 11, 7, 0, 0, 42, 0, 43, 46, 33, 45, 35, 21, 2, 0, 30, 0, 16, 0, 13, 0, 0, 40, 12, 23, 0, 0, 26,
+    19, 1, 0, 14, 0, 6, 0, 29, 24, 20, 0, 9, 39, 27, 15, 5, 18, 37, 22, 4, 3,
+};
+} // namespace TrollBehavior
+
+namespace MammothRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_MammothDefault",
+    "bSkeeverLunge", "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "IsBashing",
+    "bNoHeadTrack", "camerafromx", "camerafromy", "camerafromz", "walkBackRate", "staggerDirection", "m_footPlantedAnkleHeightMS_Front",
+    "m_footRaisedAnkleHeightMS_Front", "m_maxAnkleHeightMS_Front", "m_hitSomething_0", "m_hitSomething_1", "m_footPlantedAnkleHeightMS_Rear",
+    "m_footRaisedAnkleHeightMS_Rear", "m_maxAnkleHeightMS_Rear", "m_hitSomething_2", "m_errorOut", "m_hitSomething_3", "bLegCastResults", "iGetUpType",
+    "m_velocityGain", "m_positionGain", "m_positionMaxLinearVelocity", "m_snapMaxLinearVelocity", "iState_CowDefault", "iState_DogDefault",
+    "iState_WolfDefault", "iState_SabreCatDefault", "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_BearDefault",
+    "iState_DeerDefault", "iState_GoatDefault", "iState_HorkerDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection",
+    "SpeedSampled", "walkBackSpeedMult", "iMovementSpeed", "IsSideAttacking", "isIdleLay", "bFootIKEnable", "iState_CowSwimDefault",
+    "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun", "DefaultBlend",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_mammothdefault",
+    "bskeeverlunge", "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "isbashing",
+    "bnoheadtrack", "camerafromx", "camerafromy", "camerafromz", "walkbackrate", "staggerdirection", "m_footplantedankleheightms_front",
+    "m_footraisedankleheightms_front", "m_maxankleheightms_front", "m_hitsomething_0", "m_hitsomething_1", "m_footplantedankleheightms_rear",
+    "m_footraisedankleheightms_rear", "m_maxankleheightms_rear", "m_hitsomething_2", "m_errorout", "m_hitsomething_3", "blegcastresults", "igetuptype",
+    "m_velocitygain", "m_positiongain", "m_positionmaxlinearvelocity", "m_snapmaxlinearvelocity", "istate_cowdefault", "istate_dogdefault",
+    "istate_wolfdefault", "istate_sabrecatdefault", "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_beardefault",
+    "istate_deerdefault", "istate_goatdefault", "istate_horkerdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection",
+    "speedsampled", "walkbackspeedmult", "imovementspeed", "issideattacking", "isidlelay", "bfootikenable", "istate_cowswimdefault",
+    "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun", "defaultblend",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 3, 1, 0, 3, 3, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 2, 4, 1, 4, 2, 5, 0, 3, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 0, 5, 0, 0, 0, 96, 0, 0, 92, 49, 36, 6, 78, 0, 64, 0, 0, 42, 0, 0, 31, 0, 0, 0, 74, 88, 52, 0, 60, 0, 0, 0, 19, 94, 3, 0, 0, 85, 0, 0, 0, 91, 0, 0, 47,
+    89, 0, 103, 0, 0, 0, 93, 0, 16, 0, 53, 38, 0, 79, 0, 0, 9, 0, 0, 41, 0, 101, 86, 0, 98, 0, 48, 12, 106, 0, 4, 0, 0, 0, 0, 0, 107, 0, 0, 51, 82, 0, 0, 0,
+    87, 0, 97, 76, 83, 0, 29, 8, 26, 0, 0, 61, 81, 84, 0, 0, 0, 34, 73, 62, 0, 0, 0, 0, 0, 63, 0, 67, 0, 0, 0, 20, 0, 0, 72, 0, 0, 102, 0, 18, 0, 32, 0, 50,
+    27, 0, 0, 37, 105, 0, 0, 0, 0, 0, 0, 55, 33, 24, 104, 28, 69, 0, 21, 2, 0, 0, 75, 0, 0, 0, 0, 0, 35, 0, 0, 0, 43, 13, 0, 0, 10, 40, 0, 0, 90, 0, 0, 71, 0,
+    0, 0, 0, 0, 0, 0, 0, 25, 99, 22, 0, 54, 0, 0, 0, 0, 44, 0, 77, 0, 57, 65, 0, 56, 58, 70, 0, 0, 100, 0, 0, 0, 0, 0, 17, 95, 14, 0, 68, 0, 59, 66, 0, 0, 0,
+    0, 0, 7, 0, 0, 0, 15, 0, 0, 1, 0, 30, 0, 0, 0, 0, 46, 0, 0, 23, 0, 0, 0, 11, 0, 0, 45, 39, 0, 0, 80, 0,
+};
+} // namespace MammothRootBehavior
+
+namespace AtronachFrostRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "DefaultBlend", "Direction", "iSyncIdleLocomotion", "Speed", "IsStaggering", "bEquipOk", "IsRecoiling", "bAnimationDriven", "IsAttackReady", "IsAttacking",
+    "bAllowRotation", "fMinSpeed", "staggerMagnitude", "iSyncDefaultState", "FastBlend", "IsBlocking", "IsBashing", "iWantBlock",
+    "iState_AtronachFrostBlocking", "iState", "iState_AtronachFrostDefault", "TurnDelta", "iSyncTurnState", "TurnDamped", "SpeedAcc", "TimeDelta",
+    "IsSummoned", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain",
+    "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain", "m_hipOrientationGain", "m_footPlantedAnkleHeightMS",
+    "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "FootIKEnable", "SpeedDamped", "IsBlockHit", "iWantBlockFalse", "SpeedSampled",
+    "staggerDirection", "iGetUpType",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "defaultblend", "direction", "isyncidlelocomotion", "speed", "isstaggering", "bequipok", "isrecoiling", "banimationdriven", "isattackready", "isattacking",
+    "ballowrotation", "fminspeed", "staggermagnitude", "isyncdefaultstate", "fastblend", "isblocking", "isbashing", "iwantblock",
+    "istate_atronachfrostblocking", "istate", "istate_atronachfrostdefault", "turndelta", "isyncturnstate", "turndamped", "speedacc", "timedelta",
+    "issummoned", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain", "m_footraisedgain", "m_footunlockgain",
+    "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain", "m_hiporientationgain", "m_footplantedankleheightms",
+    "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "footikenable", "speeddamped", "isblockhit", "iwantblockfalse", "speedsampled",
+    "staggerdirection", "igetuptype",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    7, 0, 3, 0, 1, 12, 10, 9, 11, 0, 4, 40, 42, 0, 0, 4,
+};
+inline constexpr uint16_t kSlots[] = {
+    34, 31, 12, 33, 29, 1, 45, 23, 17, 40, 0, 4, 0, 26, 47, 20, 22, 0, 0, 43, 3, 14, 0, 0, 10, 18, 27, 24, 6, 2, 0, 0, 35, 32, 19, 16, 0, 0, 28, 0, 41, 44, 5,
+    11, 0, 0, 9, 25, 0, 0, 0, 36, 0, 46, 8, 39, 21, 30, 38, 13, 42, 15, 7, 37,
+};
+} // namespace AtronachFrostRootBehavior
+
+namespace GiantRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "Speed", "Direction", "bAnimationDriven", "blendDefault", "IsAttacking", "blendFast", "TurnDelta", "iSyncTurnState",
+    "IsAttackReady", "IsRecoiling", "IsStaggering", "staggerMagnitude", "TargetLocation", "IsBleedingOut", "blendSlow", "FootIKEnable", "m_onOffGain",
+    "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain",
+    "m_errorUpDownBias", "m_alignWorldFromModelGain", "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS",
+    "m_minAnkleHeightMS", "bEquipOk", "iSyncDefaultState", "bHeadTrackingOn", "bCanHeadTrack", "fMinSpeed", "fMinTurnSpeed", "iState", "iState_GiantDefault",
+    "m_footEndLS", "SpeedSampled", "IsBashing", "iState_GiantCombatRun", "camerafromx", "camerafromy", "camerafromz", "DirectionDamped", "DirectionGain",
+    "IsRooting", "m_raycastDistanceUp", "m_raycastDistanceDown", "staggerDirection", "m_errorOutTranslation", "bAllowRotation", "iGetUpType", "bHeadTracking",
+    "bIsSynced", "iStateRunWalk", "iState_GiantCombatWalk", "iStateCurrent", "IsBleedingOutTransition",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "speed", "direction", "banimationdriven", "blenddefault", "isattacking", "blendfast", "turndelta", "isyncturnstate",
+    "isattackready", "isrecoiling", "isstaggering", "staggermagnitude", "targetlocation", "isbleedingout", "blendslow", "footikenable", "m_onoffgain",
+    "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain",
+    "m_errorupdownbias", "m_alignworldfrommodelgain", "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms",
+    "m_minankleheightms", "bequipok", "isyncdefaultstate", "bheadtrackingon", "bcanheadtrack", "fminspeed", "fminturnspeed", "istate", "istate_giantdefault",
+    "m_footendls", "speedsampled", "isbashing", "istate_giantcombatrun", "camerafromx", "camerafromy", "camerafromz", "directiondamped", "directiongain",
+    "isrooting", "m_raycastdistanceup", "m_raycastdistancedown", "staggerdirection", "m_errorouttranslation", "ballowrotation", "igetuptype", "bheadtracking",
+    "bissynced", "istaterunwalk", "istate_giantcombatwalk", "istatecurrent", "isbleedingouttransition",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 1, 1, 0, 0, 0, 19, 2, 0, 0, 0, 0, 3, 0, 0, 1,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 21, 0, 0, 0, 55, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 15, 50, 43, 6, 44, 51, 24, 54, 32, 12, 2, 0, 38, 0, 0, 22, 37, 0, 52, 49, 17, 0, 0, 46, 0, 31, 0,
+    0, 53, 25, 0, 0, 0, 0, 0, 0, 39, 0, 0, 27, 28, 0, 0, 0, 0, 48, 0, 34, 0, 0, 19, 0, 0, 0, 10, 0, 0, 20, 0, 0, 42, 1, 60, 0, 0, 0, 0, 0, 0, 0, 45, 59, 0, 0,
+    0, 8, 0, 23, 3, 0, 29, 57, 0, 0, 18, 36, 0, 4, 0, 11, 7, 0, 40, 5, 0, 58, 0, 26, 0, 0, 0, 33, 0, 35, 14, 56, 16, 9, 13, 47,
+};
+} // namespace GiantRootBehavior
+
+namespace DwarvenSpider
+{
+inline constexpr std::string_view kNames[] = {
+    "blendDefault", "blendFast", "blendSlow", "Direction", "IsBlocking", "Speed", "staggerMagnitude", "TurnDelta", "IsAttackReady", "weaponSpeedMult",
+    "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain",
+    "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain", "m_hipOrientationGain", "m_footPlantedAnkleHeightMS",
+    "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "bAllowRotation", "turnSpeedMult", "iCombatStance", "iSyncTurnState",
+    "IntDirection", "bMotionDriven", "iSyncIdleLocomotion", "fMinTurnDelta", "bAnimationDriven", "BoolVariable00", "IsAttacking", "iLeftHandType",
+    "iWeapCategory", "bWantCastLeft", "bMLh_Ready", "iState_CombatSpider_MT", "iState_DefaultSpider_MT", "iState", "IsBashing", "bEquipOk", "IsStaggering",
+    "IsRecoiling", "m_state", "m_direction", "m_goalSpeed", "m_speedOut", "SpeedDamped", "m_enable", "m_limitAngleDegrees", "m_startBoneIndex", "m_gain",
+    "m_boneRadius", "m_endBoneIndex", "m_castOffset", "SpeedSampled", "iCurrentStateID", "speedMultForward", "speedMultBackward", "speedMultLeft",
+    "speedMultRight", "speedForward", "speedBackward", "speedLeft", "speedRight", "IsSideAttacking", "bFootIKDisable", "iGetUpType",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "blenddefault", "blendfast", "blendslow", "direction", "isblocking", "speed", "staggermagnitude", "turndelta", "isattackready", "weaponspeedmult",
+    "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain", "m_footraisedgain", "m_footunlockgain",
+    "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain", "m_hiporientationgain", "m_footplantedankleheightms",
+    "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "ballowrotation", "turnspeedmult", "icombatstance", "isyncturnstate",
+    "intdirection", "bmotiondriven", "isyncidlelocomotion", "fminturndelta", "banimationdriven", "boolvariable00", "isattacking", "ilefthandtype",
+    "iweapcategory", "bwantcastleft", "bmlh_ready", "istate_combatspider_mt", "istate_defaultspider_mt", "istate", "isbashing", "bequipok", "isstaggering",
+    "isrecoiling", "m_state", "m_direction", "m_goalspeed", "m_speedout", "speeddamped", "m_enable", "m_limitangledegrees", "m_startboneindex", "m_gain",
+    "m_boneradius", "m_endboneindex", "m_castoffset", "speedsampled", "icurrentstateid", "speedmultforward", "speedmultbackward", "speedmultleft",
+    "speedmultright", "speedforward", "speedbackward", "speedleft", "speedright", "issideattacking", "bfootikdisable", "igetuptype",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 5, 4, 2, 1, 0, 4, 2, 0, 0, 0, 0, 7, 0, 2, 0, 3, 2, 0, 6,
+};
+inline constexpr uint16_t kSlots[] = {
+    55, 15, 31, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 48, 0, 40, 68, 8, 2, 0, 5, 1, 24, 0, 18, 0, 27, 0, 26, 6, 0, 69, 0, 16, 42, 49, 0, 61, 39, 34, 0, 0, 0, 59, 58,
+    0, 25, 38, 36, 41, 0, 23, 0, 0, 32, 0, 0, 0, 22, 3, 0, 9, 12, 21, 0, 70, 54, 17, 13, 0, 0, 0, 46, 66, 0, 44, 0, 0, 0, 0, 0, 0, 0, 71, 0, 53, 0, 0, 0, 0,
+    11, 0, 0, 28, 67, 0, 19, 56, 51, 0, 0, 0, 29, 52, 45, 0, 62, 50, 7, 0, 35, 0, 60, 30, 4, 0, 0, 20, 65, 37, 43, 14, 57, 64, 63, 0, 33, 10,
+};
+} // namespace DwarvenSpider
+
+namespace DogRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_DogDefault", "bSkeeverLunge",
+    "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "SpeedSampled", "IsBashing",
+    "walkBackRate", "iMovementSpeed", "isIdleLay", "staggerDirection", "bFootIKDisable", "iGetUpType", "bForceIdleStop", "iState_DogRun", "iState_CowDefault",
+    "iState_WolfDefault", "iState_SabreCatDefault", "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_BearDefault",
+    "iState_DeerDefault", "iState_GoatDefault", "iState_HorkerDefault", "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection",
+    "OldDirection", "bNoHeadTrack", "camerafromx", "camerafromy", "camerafromz", "walkBackSpeedMult", "IsSideAttacking", "bFootIKEnable",
+    "iState_CowSwimDefault", "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "iState_DeerDefaultRun",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_dogdefault", "bskeeverlunge",
+    "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "speedsampled", "isbashing",
+    "walkbackrate", "imovementspeed", "isidlelay", "staggerdirection", "bfootikdisable", "igetuptype", "bforceidlestop", "istate_dogrun", "istate_cowdefault",
+    "istate_wolfdefault", "istate_sabrecatdefault", "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_beardefault",
+    "istate_deerdefault", "istate_goatdefault", "istate_horkerdefault", "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection",
+    "olddirection", "bnoheadtrack", "camerafromx", "camerafromy", "camerafromz", "walkbackspeedmult", "issideattacking", "bfootikenable",
+    "istate_cowswimdefault", "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "istate_deerdefaultrun",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 2, 5, 5, 0, 0, 4, 7, 0, 9, 1, 26, 2, 0, 0, 9, 1, 15, 11, 4, 17, 6, 6, 5, 0, 0, 9, 7, 9, 10, 18, 9,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 4, 82, 56, 87, 48, 54, 23, 26, 39, 0, 50, 46, 25, 28, 59, 0, 20, 43, 0, 14, 72, 2, 0, 21, 1, 79, 52, 31, 33, 0, 0, 92, 74, 45, 0, 0, 36, 66, 69, 0, 37,
+    29, 0, 73, 0, 62, 22, 68, 40, 0, 32, 58, 81, 5, 76, 51, 24, 0, 65, 80, 88, 8, 7, 0, 61, 10, 0, 16, 0, 38, 0, 63, 41, 0, 17, 0, 11, 57, 3, 78, 30, 90, 0, 0,
+    0, 67, 0, 83, 84, 0, 6, 77, 60, 0, 9, 0, 19, 47, 0, 86, 0, 15, 34, 49, 70, 13, 85, 44, 0, 89, 91, 0, 27, 0, 0, 55, 35, 71, 42, 0, 75, 18, 64, 53, 0, 12, 0,
+};
+} // namespace DogRootBehavior
+
+namespace VampireLordBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncTurnState", "TurnDelta", "Direction", "Speed", "bAnimationDriven", "bIsSynced", "IsRecoiling", "IsStaggering", "SpeedStartVar", "TurnDeltaDamped",
+    "TurnMin", "IsAttackReady", "SpeedDamped", "IsAttacking", "bAllowRotation", "FootIKEnable", "bHeadTrackingOff", "staggerMagnitude", "bEquipOk", "iState",
+    "iState_VampireLordDefault", "SampledSpeed", "iSyncIdleLocomotion", "TimeDelta", "bHeadTracking", "TargetLocation", "camerafromx", "camerafromy",
+    "camerafromz", "iGetUpType", "Pitch", "iAttackState", "iState_VampireLordSprint", "IsSprinting", "iSyncSprintState", "bVoiceReady", "bWantCastVoice",
+    "SpeedSampled", "FootIKDisable", "bInJumpState", "VelocityZ", "iIsInSneak", "bFailMoveStart", "BeginCastVoice", "bNoStagger", "bDelayMoveStart",
+    "isHowling", "IsNPC", "isLevitating", "bWantCastLeft", "bWantCastRight", "bMLh_Ready", "bMRh_Ready", "CastBlendDamped", "CastBlend", "NotCasting",
+    "staggerDirection", "AimHeadingMax", "AimPitchMax", "BowAimOffsetHeading", "BowAimOffsetPitch", "AimGainOn", "AimGainOff", "bAimActive",
+    "AimHeadingCurrent", "AimPitchCurrent", "IsCastingLeft", "IsCastingRight", "iSyncMT_Idle", "iCamera_Sync", "IsPlayer", "BatSprintDirection", "DeathSpeed",
+    "DeathSpeedDamped",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncturnstate", "turndelta", "direction", "speed", "banimationdriven", "bissynced", "isrecoiling", "isstaggering", "speedstartvar", "turndeltadamped",
+    "turnmin", "isattackready", "speeddamped", "isattacking", "ballowrotation", "footikenable", "bheadtrackingoff", "staggermagnitude", "bequipok", "istate",
+    "istate_vampirelorddefault", "sampledspeed", "isyncidlelocomotion", "timedelta", "bheadtracking", "targetlocation", "camerafromx", "camerafromy",
+    "camerafromz", "igetuptype", "pitch", "iattackstate", "istate_vampirelordsprint", "issprinting", "isyncsprintstate", "bvoiceready", "bwantcastvoice",
+    "speedsampled", "footikdisable", "binjumpstate", "velocityz", "iisinsneak", "bfailmovestart", "begincastvoice", "bnostagger", "bdelaymovestart",
+    "ishowling", "isnpc", "islevitating", "bwantcastleft", "bwantcastright", "bmlh_ready", "bmrh_ready", "castblenddamped", "castblend", "notcasting",
+    "staggerdirection", "aimheadingmax", "aimpitchmax", "bowaimoffsetheading", "bowaimoffsetpitch", "aimgainon", "aimgainoff", "baimactive",
+    "aimheadingcurrent", "aimpitchcurrent", "iscastingleft", "iscastingright", "isyncmt_idle", "icamera_sync", "isplayer", "batsprintdirection", "deathspeed",
+    "deathspeeddamped",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 4, 0, 2, 0, 0, 1, 1, 1, 3, 0, 1, 1, 0, 3, 1, 4, 3, 3, 0, 2, 0, 0, 10, 0, 0, 0, 0, 0, 0, 1, 7,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 66, 17, 46, 0, 24, 33, 23, 69, 55, 22, 61, 40, 44, 43, 0, 0, 7, 0, 26, 39, 0, 27, 56, 72, 49, 0, 0, 2, 45, 0, 0, 0, 0, 19, 0, 0, 0, 51, 58, 15, 0, 0,
+    54, 0, 6, 0, 73, 0, 0, 32, 38, 20, 0, 0, 0, 70, 67, 0, 30, 0, 0, 36, 31, 63, 0, 9, 0, 64, 18, 60, 0, 53, 0, 13, 0, 0, 14, 42, 3, 0, 0, 0, 68, 0, 52, 0, 34,
+    28, 59, 65, 0, 0, 0, 16, 0, 0, 48, 71, 0, 0, 35, 50, 21, 62, 57, 10, 0, 1, 41, 37, 0, 0, 4, 0, 0, 0, 0, 0, 47, 0, 12, 0, 5, 29, 11, 25, 8,
+};
+} // namespace VampireLordBehavior
+
+namespace CowRootBehavior
+{
+inline constexpr std::string_view kNames[] = {
+    "iSyncIdleLocomotion", "blendDefault", "fMinSpeed", "Speed", "iSyncTurnState", "iSyncForwardState", "TurnDelta", "fMinTurnDelta", "turnSpeedMult",
+    "iCombatStance", "test", "bHeadTrackingOn", "TargetLocation", "FootIKEnable", "m_onOffGain", "m_groundAscendingGain", "m_groundDescendingGain",
+    "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_worldFromModelFeedbackGain", "m_errorUpDownBias", "m_alignWorldFromModelGain",
+    "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS", "blendFast",
+    "bAnimationDriven", "bAllowRotation", "bHeadTracking", "bDisableHeadTrack", "IsRecoiling", "IsStaggering", "IsAttacking", "bIsWolf", "staggerMagnitude",
+    "IsBleedingOut", "bIsSynced", "bEquipOk", "bCanHeadTrack", "blendSlow", "isIdleSitting", "bMirroredAttack", "iState", "iState_CowDefault", "bSkeeverLunge",
+    "iCharacterSelector", "fMinMoveSpeed", "Direction", "iIsCanine", "iTurnMirrored", "IsAttackReady", "TurnDeltaDamped", "SpeedSampled", "IsBashing",
+    "bNoHeadTrack", "walkBackRate", "iState_CowSiwmDefault", "iGetUpType", "iState_DogDefault", "iState_WolfDefault", "iState_SabreCatDefault",
+    "iState_SkeeverDefault", "iState_SkeeverLunge", "iState_HorseDefault", "iState_BearDefault", "iState_DeerDefault", "iState_GoatDefault",
+    "iState_HorkerDefault", "iState_MammothDefault", "iState_HorseSprint", "iSyncSprintState", "fTwistDirection", "OldDirection", "camerafromx", "camerafromy",
+    "camerafromz", "walkBackSpeedMult", "iMovementSpeed", "IsSideAttacking", "isIdleLay", "staggerDirection", "bFootIKEnable", "iState_CowSwimDefault",
+    "iState_HorkerSwimDefault", "iState_BearSwimDefault", "isSwimming", "isMoving", "bForceIdleStop", "iState_DeerDefaultRun", "SlowBlend",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "isyncidlelocomotion", "blenddefault", "fminspeed", "speed", "isyncturnstate", "isyncforwardstate", "turndelta", "fminturndelta", "turnspeedmult",
+    "icombatstance", "test", "bheadtrackingon", "targetlocation", "footikenable", "m_onoffgain", "m_groundascendinggain", "m_grounddescendinggain",
+    "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_worldfrommodelfeedbackgain", "m_errorupdownbias", "m_alignworldfrommodelgain",
+    "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms", "blendfast",
+    "banimationdriven", "ballowrotation", "bheadtracking", "bdisableheadtrack", "isrecoiling", "isstaggering", "isattacking", "biswolf", "staggermagnitude",
+    "isbleedingout", "bissynced", "bequipok", "bcanheadtrack", "blendslow", "isidlesitting", "bmirroredattack", "istate", "istate_cowdefault", "bskeeverlunge",
+    "icharacterselector", "fminmovespeed", "direction", "iiscanine", "iturnmirrored", "isattackready", "turndeltadamped", "speedsampled", "isbashing",
+    "bnoheadtrack", "walkbackrate", "istate_cowsiwmdefault", "igetuptype", "istate_dogdefault", "istate_wolfdefault", "istate_sabrecatdefault",
+    "istate_skeeverdefault", "istate_skeeverlunge", "istate_horsedefault", "istate_beardefault", "istate_deerdefault", "istate_goatdefault",
+    "istate_horkerdefault", "istate_mammothdefault", "istate_horsesprint", "isyncsprintstate", "ftwistdirection", "olddirection", "camerafromx", "camerafromy",
+    "camerafromz", "walkbackspeedmult", "imovementspeed", "issideattacking", "isidlelay", "staggerdirection", "bfootikenable", "istate_cowswimdefault",
+    "istate_horkerswimdefault", "istate_bearswimdefault", "isswimming", "ismoving", "bforceidlestop", "istate_deerdefaultrun", "slowblend",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 2, 5, 2, 0, 0, 4, 7, 0, 9, 1, 26, 2, 2, 0, 9, 6, 19, 11, 1, 17, 6, 11, 5, 0, 0, 9, 7, 9, 10, 1, 9,
+};
+inline constexpr uint16_t kSlots[] = {
+    0, 4, 77, 56, 85, 48, 54, 23, 26, 39, 0, 50, 61, 25, 28, 15, 0, 20, 43, 0, 14, 68, 88, 2, 21, 1, 75, 52, 31, 33, 0, 82, 91, 70, 45, 86, 0, 36, 62, 65, 0,
+    37, 29, 0, 69, 0, 60, 22, 64, 40, 0, 32, 0, 76, 5, 72, 51, 24, 0, 46, 57, 59, 8, 7, 0, 0, 10, 0, 16, 0, 38, 41, 90, 0, 0, 17, 0, 11, 58, 3, 74, 30, 19, 0,
+    35, 0, 63, 73, 78, 79, 0, 6, 0, 83, 0, 9, 92, 0, 47, 0, 84, 0, 0, 34, 49, 66, 13, 81, 44, 0, 87, 89, 0, 27, 0, 0, 55, 0, 67, 42, 0, 71, 18, 80, 53, 0, 12,
+    0,
+};
+} // namespace CowRootBehavior
+
+namespace Master_Behavior
+{
+inline constexpr std::string_view kNames[] = {
+    "Speed", "Direction", "TurnDelta", "iSyncIdleLocomotion", "SpeedWalk", "SpeedRun", "fSpeedMin", "useShield", "useMLh", "blendMoveStart", "blendMoveStop",
+    "blendDefault", "WalkSpeedMult", "TurnDeltaDamped", "TurnMin", "IsFirstPerson", "Pitch", "PitchLook", "blendAttackPowerFast", "blendAttackPowerSlow",
+    "blendFast", "IsPlayer", "attackPowerStartTime", "blendMove1stP", "IntVariable", "IsNPC", "blendSlow", "PitchDefault", "PitchOverride", "staggerMagnitude",
+    "blockDown", "blockLeft", "blockRight", "blockUp", "recoilMagnitude", "iRightHandType", "IsBlocking", "iWantBlock", "IsAttackReady", "iAnnotation",
+    "SpeedSampled", "bMotionDriven", "blendAttackRelease", "attackComboStartFraction", "blendAttackCombo", "attackIntroLength", "IsShouting",
+    "weaponSpeedMult", "iSyncTurnState", "i1stPerson", "IsSprinting", "bIsSynced", "IsBlockHit", "TimeDelta", "PitchOffset", "PitchAcc", "PitchThresh",
+    "UsePitch", "DisablePitch", "weapAdj", "iLeftHandType", "weapChangeStartFraction", "1stPRot", "1stPRotDamped", "RotMax", "PitchManualOverride", "SpeedAcc",
+    "IsCastingRight", "IsCastingLeft", "CastBlend", "bVoiceReady", "bWantCastLeft", "bWantCastRight", "bWantCastVoice", "BlendDamped", "b1HM_MLh_attack",
+    "Is1HM", "i1HMState", "RawBlend", "BlendAcc", "b1HMCombat", "bAnimationDriven", "bCastReady", "IsStaggering", "IsRecoiling", "IsAttacking",
+    "IsInCastState", "bleedoutTurnMult", "IsInCastStateDamped", "bAllowRotation", "bMagicDraw", "CastBlendDamped", "bMLh_Ready", "bMRh_Ready", "iState",
+    "iState_NPCSprinting", "iState_NPCDefault", "fIsFirstPerson", "bInMoveState", "iState_NPCSneaking", "iState_NPCBowDrawn", "BoolVariable", "DualMagicState",
+    "iDualMagicState", "InDualMagicState", "iState_NPCBlocking", "iState_NPCBleedout", "iBlockState", "bSprintOK", "iSyncSprintState", "IsEquipping",
+    "IsUnequipping", "iIsInSneak", "currentDefaultState", "BowZoom", "bowZoomAmt", "bIdlePlaying", "iMagicEquipped", "iEquippedItemState", "iMagicState",
+    "IsCastingDual", "bIsDialogueExpressive", "iIsDialogueExpressive", "bAnimObjectLoaded", "fEquipWeapAdj", "bEquipUnequip", "bAttached", "bodyMorphWeight",
+    "IsBashing", "bEquipOk", "IsBleedingOut", "fMagicForceEquipBlendValue", "FemaleOffset", "blendVerySlow", "blendDialogue", "iSyncIdleState", "fIdleTimer",
+    "bIsH2HSolo", "AdditiveHeadTransl", "AdditiveHeadScale", "AdditiveHeadRot", "2HMweaponSpeedMult", "iState_NPC1HM", "iState_NPC2HM", "iState_NPCBow",
+    "iState_NPCMagic", "iState_NPCMagicCasting", "iState_NPCHorse", "iState_HorseSprint", "iCharacterSelector", "randomStartTime", "bHeadTracking",
+    "bIsRiding", "fMinSpeed", "iCombatStance", "turnSpeedMult", "iSyncTurnDirection", "fTwistDirection", "IntDirection", "DirectionRange",
+    "DirectionRangeDamped", "DirectionDamped", "IsDismounting", "TargetLocation", "bTalkable", "bNeutralState", "CastOK", "blendFromAnimDriven",
+    "walkBackRate", "bRitualSpellActive", "SwimDirection", "iRegularAttack", "IsAttackReady_32", "camerafromx", "camerafromy", "camerafromz", "VelocityZ",
+    "bInJumpState", "LookAtOutOfRange", "iRightHandEquipped", "iLeftHandEquipped", "testint", "iIsPlayer", "SpeedDamped", "bodyMorphMuscular",
+    "bHeadTrackSpine", "IsSneaking", "iGetUpType", "iState_NPCAttacking", "iState_NPCPowerAttacking", "iState_NPCAttacking2H", "LookAtOnGain", "LookAtOffGain",
+    "LookAtEyeOnGain", "LookAtEyeOffGain", "iDrunkVariable", "iState_NPCDrunk", "leftWeaponSpeedMult", "bLeftHandAttack", "BlendJump", "bIsInMT",
+    "BoolVariable00", "bHumanoidFootIKEnable", "testPitchOffset", "bBowDrawn", "IsBeastRace", "bHumanoidFootIKDisable", "iTempSwitch",
+    "iState_NPCBowDrawnQuickShot", "iState_NPCBlockingShieldCharge", "bStaggerPlayerOverride", "bNoStagger", "bIsStaffLeftCasting", "Is3rdPKillOnly",
+    "bPerkShieldCharge", "bPerkQuickShot", "m_bEnablePitchTwistModifier", "m_worldFromModelFeedbackGain", "IsBleedingOutTransition", "bMesmerize", "iIsHorse",
+    "bWantMountedWeaponAnims", "iUseMountedSwimming", "AimPitchCurrent", "AimHeadingCurrent", "bAimActive", "AimGainOff", "AimGainOnMounted",
+    "AimGainOnDragonMount", "iWantMountedWeaponAnims", "iWeaponReady", "ZoomAcc", "AimHeadingMax", "AimPitchMax", "AimGainOn", "bDisableInterp",
+    "BowAimOffsetPitch", "BowAimOffsetHeading", "bPerkQuickDraw", "bForceIdleStop", "IsInDWattack", "bShortKillMove", "bLongKillMove", "iCrossbowState",
+    "Int32Variable", "AllowBlockModify", "_iState_NPCSneaking", "MagicLeftActive", "AllowMagicModify", "MagicAimOffsetHeading", "MagicAimOffsetPitch",
+    "NotCasting", "CastBlendGain", "iWantBlock01", "staggerDirection", "iSyncForwardState", "fMinTurnDelta", "bHeadTrackingOn", "m_onOffGain",
+    "m_groundAscendingGain", "m_groundDescendingGain", "m_footPlantedGain", "m_footRaisedGain", "m_footUnlockGain", "m_errorUpDownBias",
+    "m_alignWorldFromModelGain", "m_hipOrientationGain", "m_footPlantedAnkleHeightMS", "m_footRaisedAnkleHeightMS", "m_maxAnkleHeightMS", "m_minAnkleHeightMS",
+    "bDisableHeadTrack", "bCanHeadTrack", "isIdleSitting", "bMirroredAttack", "fMinMoveSpeed", "iState_HorseDefault", "HorseSpeedSampled", "walkBackSpeedMult",
+    "iState_HorseFall", "bInSwimState", "iState_HorseSwim", "bHorseFootIKEnable", "bNoHeadTrack", "isMoving", "blendVeryFast", "AimHeadingMaxMounted",
+    "AimPitchMaxMounted", "MC_2HM_WeapSpeed", "iSyncDialogueResponse", "bBlendOutSlow", "isInFurniture", "bIdleBeforeConversation", "bMotionDrivenDialogue",
+    "bAnimationDrivenDialogue", "bHDDialogue", "bHHDialogue", "bTalkableWithItem", "isCarryItem", "IsRomanticFollower", "IsRF_Talk",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "speed", "direction", "turndelta", "isyncidlelocomotion", "speedwalk", "speedrun", "fspeedmin", "useshield", "usemlh", "blendmovestart", "blendmovestop",
+    "blenddefault", "walkspeedmult", "turndeltadamped", "turnmin", "isfirstperson", "pitch", "pitchlook", "blendattackpowerfast", "blendattackpowerslow",
+    "blendfast", "isplayer", "attackpowerstarttime", "blendmove1stp", "intvariable", "isnpc", "blendslow", "pitchdefault", "pitchoverride", "staggermagnitude",
+    "blockdown", "blockleft", "blockright", "blockup", "recoilmagnitude", "irighthandtype", "isblocking", "iwantblock", "isattackready", "iannotation",
+    "speedsampled", "bmotiondriven", "blendattackrelease", "attackcombostartfraction", "blendattackcombo", "attackintrolength", "isshouting",
+    "weaponspeedmult", "isyncturnstate", "i1stperson", "issprinting", "bissynced", "isblockhit", "timedelta", "pitchoffset", "pitchacc", "pitchthresh",
+    "usepitch", "disablepitch", "weapadj", "ilefthandtype", "weapchangestartfraction", "1stprot", "1stprotdamped", "rotmax", "pitchmanualoverride", "speedacc",
+    "iscastingright", "iscastingleft", "castblend", "bvoiceready", "bwantcastleft", "bwantcastright", "bwantcastvoice", "blenddamped", "b1hm_mlh_attack",
+    "is1hm", "i1hmstate", "rawblend", "blendacc", "b1hmcombat", "banimationdriven", "bcastready", "isstaggering", "isrecoiling", "isattacking",
+    "isincaststate", "bleedoutturnmult", "isincaststatedamped", "ballowrotation", "bmagicdraw", "castblenddamped", "bmlh_ready", "bmrh_ready", "istate",
+    "istate_npcsprinting", "istate_npcdefault", "fisfirstperson", "binmovestate", "istate_npcsneaking", "istate_npcbowdrawn", "boolvariable", "dualmagicstate",
+    "idualmagicstate", "indualmagicstate", "istate_npcblocking", "istate_npcbleedout", "iblockstate", "bsprintok", "isyncsprintstate", "isequipping",
+    "isunequipping", "iisinsneak", "currentdefaultstate", "bowzoom", "bowzoomamt", "bidleplaying", "imagicequipped", "iequippeditemstate", "imagicstate",
+    "iscastingdual", "bisdialogueexpressive", "iisdialogueexpressive", "banimobjectloaded", "fequipweapadj", "bequipunequip", "battached", "bodymorphweight",
+    "isbashing", "bequipok", "isbleedingout", "fmagicforceequipblendvalue", "femaleoffset", "blendveryslow", "blenddialogue", "isyncidlestate", "fidletimer",
+    "bish2hsolo", "additiveheadtransl", "additiveheadscale", "additiveheadrot", "2hmweaponspeedmult", "istate_npc1hm", "istate_npc2hm", "istate_npcbow",
+    "istate_npcmagic", "istate_npcmagiccasting", "istate_npchorse", "istate_horsesprint", "icharacterselector", "randomstarttime", "bheadtracking",
+    "bisriding", "fminspeed", "icombatstance", "turnspeedmult", "isyncturndirection", "ftwistdirection", "intdirection", "directionrange",
+    "directionrangedamped", "directiondamped", "isdismounting", "targetlocation", "btalkable", "bneutralstate", "castok", "blendfromanimdriven",
+    "walkbackrate", "britualspellactive", "swimdirection", "iregularattack", "isattackready_32", "camerafromx", "camerafromy", "camerafromz", "velocityz",
+    "binjumpstate", "lookatoutofrange", "irighthandequipped", "ilefthandequipped", "testint", "iisplayer", "speeddamped", "bodymorphmuscular",
+    "bheadtrackspine", "issneaking", "igetuptype", "istate_npcattacking", "istate_npcpowerattacking", "istate_npcattacking2h", "lookatongain", "lookatoffgain",
+    "lookateyeongain", "lookateyeoffgain", "idrunkvariable", "istate_npcdrunk", "leftweaponspeedmult", "blefthandattack", "blendjump", "bisinmt",
+    "boolvariable00", "bhumanoidfootikenable", "testpitchoffset", "bbowdrawn", "isbeastrace", "bhumanoidfootikdisable", "itempswitch",
+    "istate_npcbowdrawnquickshot", "istate_npcblockingshieldcharge", "bstaggerplayeroverride", "bnostagger", "bisstaffleftcasting", "is3rdpkillonly",
+    "bperkshieldcharge", "bperkquickshot", "m_benablepitchtwistmodifier", "m_worldfrommodelfeedbackgain", "isbleedingouttransition", "bmesmerize", "iishorse",
+    "bwantmountedweaponanims", "iusemountedswimming", "aimpitchcurrent", "aimheadingcurrent", "baimactive", "aimgainoff", "aimgainonmounted",
+    "aimgainondragonmount", "iwantmountedweaponanims", "iweaponready", "zoomacc", "aimheadingmax", "aimpitchmax", "aimgainon", "bdisableinterp",
+    "bowaimoffsetpitch", "bowaimoffsetheading", "bperkquickdraw", "bforceidlestop", "isindwattack", "bshortkillmove", "blongkillmove", "icrossbowstate",
+    "int32variable", "allowblockmodify", "_istate_npcsneaking", "magicleftactive", "allowmagicmodify", "magicaimoffsetheading", "magicaimoffsetpitch",
+    "notcasting", "castblendgain", "iwantblock01", "staggerdirection", "isyncforwardstate", "fminturndelta", "bheadtrackingon", "m_onoffgain",
+    "m_groundascendinggain", "m_grounddescendinggain", "m_footplantedgain", "m_footraisedgain", "m_footunlockgain", "m_errorupdownbias",
+    "m_alignworldfrommodelgain", "m_hiporientationgain", "m_footplantedankleheightms", "m_footraisedankleheightms", "m_maxankleheightms", "m_minankleheightms",
+    "bdisableheadtrack", "bcanheadtrack", "isidlesitting", "bmirroredattack", "fminmovespeed", "istate_horsedefault", "horsespeedsampled", "walkbackspeedmult",
+    "istate_horsefall", "binswimstate", "istate_horseswim", "bhorsefootikenable", "bnoheadtrack", "ismoving", "blendveryfast", "aimheadingmaxmounted",
+    "aimpitchmaxmounted", "mc_2hm_weapspeed", "isyncdialogueresponse", "bblendoutslow", "isinfurniture", "bidlebeforeconversation", "bmotiondrivendialogue",
+    "banimationdrivendialogue", "bhddialogue", "bhhdialogue", "btalkablewithitem", "iscarryitem", "isromanticfollower", "isrf_talk",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 3, 1, 9, 0, 0, 1, 2, 0, 0, 1, 0, 0, 2, 1, 2, 0, 3, 4, 3, 0, 1, 2, 0, 1, 0, 0, 4, 1, 0, 0, 1, 0, 4, 0, 3, 11, 0, 0, 1, 1, 1, 3, 1, 5, 0, 0, 0, 1, 0, 2,
+    3, 1, 0, 2, 0, 1, 0, 2, 10, 1, 1, 0, 0, 0, 3, 3, 1, 1, 14, 1, 1, 4, 5, 1, 9, 1, 0, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 5, 0, 0, 1, 9, 0, 2, 4, 3,
+    2, 2, 12, 0, 0, 0, 0, 3, 7, 2, 7, 8, 1, 0, 0, 0, 1, 4, 5, 0, 1, 0, 6, 0, 0, 5,
+};
+inline constexpr uint16_t kSlots[] = {
+    116, 186, 43, 0, 0, 0, 0, 0, 0, 157, 275, 162, 238, 0, 108, 0, 7, 174, 0, 126, 155, 296, 250, 0, 3, 265, 271, 0, 168, 242, 0, 0, 0, 86, 0, 0, 0, 6, 0, 158,
+    0, 0, 164, 214, 0, 142, 0, 0, 60, 194, 170, 0, 0, 0, 260, 39, 0, 267, 249, 0, 294, 203, 0, 230, 0, 78, 55, 0, 279, 239, 0, 0, 0, 287, 0, 0, 74, 0, 0, 0,
+    117, 154, 237, 0, 185, 0, 139, 0, 135, 0, 88, 201, 12, 109, 0, 215, 282, 150, 206, 0, 27, 0, 0, 0, 212, 62, 0, 276, 295, 96, 190, 183, 234, 0, 0, 103, 115,
+    298, 0, 0, 0, 0, 0, 106, 0, 98, 0, 0, 0, 41, 0, 0, 236, 0, 0, 156, 297, 197, 85, 209, 0, 281, 0, 199, 259, 83, 167, 0, 284, 20, 0, 0, 264, 0, 72, 207, 5,
+    0, 0, 66, 22, 110, 176, 95, 254, 226, 0, 233, 277, 0, 181, 69, 44, 220, 36, 147, 0, 210, 47, 89, 91, 202, 256, 56, 68, 196, 289, 16, 280, 0, 30, 145, 0,
+    228, 0, 274, 0, 0, 195, 77, 0, 166, 292, 0, 211, 0, 204, 290, 188, 0, 104, 0, 198, 93, 0, 258, 175, 0, 0, 244, 37, 0, 111, 79, 0, 70, 0, 65, 0, 0, 0, 45,
+    0, 11, 200, 0, 0, 0, 0, 0, 82, 253, 0, 229, 0, 0, 0, 136, 268, 0, 184, 112, 288, 120, 0, 251, 0, 161, 14, 49, 0, 0, 50, 0, 235, 10, 0, 0, 299, 137, 125, 0,
+    169, 0, 0, 252, 177, 141, 0, 114, 0, 187, 0, 0, 0, 0, 0, 0, 0, 42, 40, 31, 0, 87, 59, 0, 0, 165, 0, 153, 0, 0, 247, 285, 0, 107, 58, 205, 217, 0, 149, 0,
+    0, 286, 0, 29, 283, 178, 0, 0, 225, 127, 18, 76, 121, 113, 208, 248, 246, 0, 21, 73, 221, 32, 0, 0, 0, 0, 263, 160, 192, 218, 182, 245, 227, 0, 130, 0, 52,
+    0, 0, 48, 0, 17, 0, 0, 0, 232, 34, 84, 163, 213, 0, 0, 100, 152, 71, 138, 231, 105, 26, 90, 99, 132, 0, 25, 0, 261, 134, 243, 0, 102, 0, 118, 0, 262, 0,
+    180, 0, 28, 270, 35, 63, 0, 0, 223, 0, 0, 0, 269, 1, 189, 273, 173, 8, 216, 0, 140, 219, 179, 0, 75, 81, 0, 193, 0, 131, 0, 94, 0, 224, 0, 92, 51, 255, 4,
+    144, 0, 64, 0, 148, 53, 123, 38, 146, 0, 97, 0, 0, 159, 9, 0, 266, 240, 151, 0, 0, 222, 24, 0, 291, 0, 0, 0, 54, 61, 0, 272, 57, 129, 0, 0, 0, 0, 191, 0,
+    23, 171, 0, 0, 19, 0, 0, 241, 0, 80, 172, 0, 33, 0, 119, 300, 0, 293, 0, 46, 15, 0, 257, 101, 122, 0, 2, 278, 0, 0, 0, 0, 0, 0, 0, 67, 13, 0, 128, 0, 0,
+    124, 0, 0, 133, 143,
+};
+} // namespace Master_Behavior
+
+namespace BHR_Master
+{
+inline constexpr std::string_view kNames[] = {
+    "Pitch", "TurnDelta", "iSyncIdleLocomotion", "defaultBlend", "bHeadTracking", "Direction", "fMinSpeed", "Speed", "TargetSpeed", "TurnMin", "MaxAcc",
+    "MaxDec", "PitchDeltaDampedGain", "TargetSpeedThresholdMax", "TargetSpeedThresholdMin", "Drag", "TargetSpeedMaxScale", "TurnDeltaDamped",
+    "PitchDeltaDamped", "TurnDeltaDampedGain", "MinSpeed", "MaxSpeed", "PathAngleThreshold", "TargetSpeedDamped", "MaxSpeedDamped", "bAnimationDriven",
+    "bVoiceReady", "iInjured", "Injured", "bWantCastVoice", "InjuredScale", "InjuredScaleCurrent", "MaxSpeedCurrent", "IsAttackReady", "IsShouting", "iCombat",
+    "LookAtHeadingMaxAngle", "IsIdle", "isMoving", "bSpeedSynced", "iSyncTurnState", "iDirectionForward", "IsOnGround", "bAllowRotation", "m_errorOut",
+    "m_worldFromModelFeedbackGain", "FlightPitchBlend", "TargetLocation", "iState", "iState_DragonDefault", "iState_DragonFlying", "iState_DragonHovering",
+    "bLookAtTarget", "bCanLookAtTarget", "TweenEntryDirection", "FlightHitInjuredSpeedMin", "FlightHitInjuredDecGain", "m_rearMinAnkleHeightMS",
+    "m_rearMaxAnkleHeightMS", "m_frontMinAnkleHeightMS", "m_frontMaxAnkleHeightMS", "m_frontFootRaisedAnkleHeightMS", "m_frontFootPlantedAnkleHeightMS",
+    "m_rearFootRaisedAnkleHeightMS", "m_rearFootPlantedAnkleHeightMS", "bEquipOk", "LipBigAah", "LipDST", "LipEee", "LipFV", "LipK", "LipL", "LipR", "LipTh",
+    "PhonemeBlend", "InvPhonemeBlend", "IsBusy", "camerafromx", "camerafromy", "camerafromz", "LipAcc", "LipBigAahDamped", "LipDSTDamped", "LipEeeDamped",
+    "LipFVDamped", "LipKDamped", "LipLDamped", "LipRDamped", "LipThDamped", "iState_DragonPerching", "bIsSynced", "PitchDelta", "MovementDirection",
+    "IsFeathering", "IsFlapping", "IsGliding", "TweenPosition", "TweenRotation", "DistToGoal", "TweenSpeed", "HasTweenSpeed", "TweenSpeedMin",
+    "TweenSpeedDamped", "IsTurningLeft", "IsTurningRight", "IsMovingBackward", "IsMovingForward", "PathAngle", "BSLookAtModifier_m_onGain_Combat",
+    "BSLookAtModifier_m_offGain_Combat", "BSLookAtModifier_m_onGain_Default", "BSLookAtModifier_m_offGain_Default", "BSLookAtModifier_m_onGain",
+    "BSLookAtModifier_m_offGain", "BSLookAtModifier_CanLookOutsideLimit", "TurnDeltaScale", "PickNewIdleTimer", "PickNewIdleTime",
+    "BSLookAtModifier_m_onGain_Shouting", "BSLookAtModifier_m_offGain_Shouting", "TimeStep", "MoveDirZ", "FlightPitchBlendGain", "m_raycastDistanceDown",
+    "m_raycastDistanceUp", "m_errorOutTranslation", "m_alignWithGroundRotation", "bFullyMotionDriven", "DirectionDamped", "bNoFootIK", "bFootIK",
+    "m_ankeOrientationGain", "m_alignWorldFromModelGain", "m_rearMaxAnkleAngleDegrees", "m_useAlignWithGroundRotation", "IsTrailer", "LookAtOutOfRange",
+    "TurnDeltaTarget", "PitchDeltaTarget", "FlightPitchBlendTarget", "bFlightKillGrabAction", "bAllowFlightKillGrabTween", "bAllowFlightGrabTweenDefault",
+    "iGetUpType", "TweenEntryDirectionPrev", "TweenEntryDirectionFlightKillGrab", "ConstraintOffset", "TweenEntryDirectionCur", "bTweenUpdate", "LipGain",
+    "PhonemeBlendTarget", "bDisableInterp", "fPhonemeDefaultWeight",
+};
+inline constexpr std::string_view kFoldedNames[] = {
+    "pitch", "turndelta", "isyncidlelocomotion", "defaultblend", "bheadtracking", "direction", "fminspeed", "speed", "targetspeed", "turnmin", "maxacc",
+    "maxdec", "pitchdeltadampedgain", "targetspeedthresholdmax", "targetspeedthresholdmin", "drag", "targetspeedmaxscale", "turndeltadamped",
+    "pitchdeltadamped", "turndeltadampedgain", "minspeed", "maxspeed", "pathanglethreshold", "targetspeeddamped", "maxspeeddamped", "banimationdriven",
+    "bvoiceready", "iinjured", "injured", "bwantcastvoice", "injuredscale", "injuredscalecurrent", "maxspeedcurrent", "isattackready", "isshouting", "icombat",
+    "lookatheadingmaxangle", "isidle", "ismoving", "bspeedsynced", "isyncturnstate", "idirectionforward", "isonground", "ballowrotation", "m_errorout",
+    "m_worldfrommodelfeedbackgain", "flightpitchblend", "targetlocation", "istate", "istate_dragondefault", "istate_dragonflying", "istate_dragonhovering",
+    "blookattarget", "bcanlookattarget", "tweenentrydirection", "flighthitinjuredspeedmin", "flighthitinjureddecgain", "m_rearminankleheightms",
+    "m_rearmaxankleheightms", "m_frontminankleheightms", "m_frontmaxankleheightms", "m_frontfootraisedankleheightms", "m_frontfootplantedankleheightms",
+    "m_rearfootraisedankleheightms", "m_rearfootplantedankleheightms", "bequipok", "lipbigaah", "lipdst", "lipeee", "lipfv", "lipk", "lipl", "lipr", "lipth",
+    "phonemeblend", "invphonemeblend", "isbusy", "camerafromx", "camerafromy", "camerafromz", "lipacc", "lipbigaahdamped", "lipdstdamped", "lipeeedamped",
+    "lipfvdamped", "lipkdamped", "lipldamped", "liprdamped", "lipthdamped", "istate_dragonperching", "bissynced", "pitchdelta", "movementdirection",
+    "isfeathering", "isflapping", "isgliding", "tweenposition", "tweenrotation", "disttogoal", "tweenspeed", "hastweenspeed", "tweenspeedmin",
+    "tweenspeeddamped", "isturningleft", "isturningright", "ismovingbackward", "ismovingforward", "pathangle", "bslookatmodifier_m_ongain_combat",
+    "bslookatmodifier_m_offgain_combat", "bslookatmodifier_m_ongain_default", "bslookatmodifier_m_offgain_default", "bslookatmodifier_m_ongain",
+    "bslookatmodifier_m_offgain", "bslookatmodifier_canlookoutsidelimit", "turndeltascale", "picknewidletimer", "picknewidletime",
+    "bslookatmodifier_m_ongain_shouting", "bslookatmodifier_m_offgain_shouting", "timestep", "movedirz", "flightpitchblendgain", "m_raycastdistancedown",
+    "m_raycastdistanceup", "m_errorouttranslation", "m_alignwithgroundrotation", "bfullymotiondriven", "directiondamped", "bnofootik", "bfootik",
+    "m_ankeorientationgain", "m_alignworldfrommodelgain", "m_rearmaxankleangledegrees", "m_usealignwithgroundrotation", "istrailer", "lookatoutofrange",
+    "turndeltatarget", "pitchdeltatarget", "flightpitchblendtarget", "bflightkillgrabaction", "ballowflightkillgrabtween", "ballowflightgrabtweendefault",
+    "igetuptype", "tweenentrydirectionprev", "tweenentrydirectionflightkillgrab", "constraintoffset", "tweenentrydirectioncur", "btweenupdate", "lipgain",
+    "phonemeblendtarget", "bdisableinterp", "fphonemedefaultweight",
+};
+inline constexpr uint16_t kDisplacements[] = {
+    0, 0, 0, 5, 0, 2, 3, 1, 0, 1, 0, 0, 0, 1, 0, 3, 0, 2, 5, 1, 5, 0, 4, 0, 0, 0, 1, 0, 1, 1, 2, 1, 0, 1, 0, 0, 0, 1, 0, 2, 0, 1, 1, 1, 5, 2, 0, 0, 6, 4, 0, 0,
+    12, 3, 1, 4, 6, 0, 0, 2, 1, 1, 0, 0,
+};
+inline constexpr uint16_t kSlots[] = {
+    36, 127, 9, 64, 56, 87, 0, 24, 0, 0, 119, 116, 61, 0, 0, 27, 0, 0, 142, 91, 0, 4, 0, 0, 0, 143, 0, 0, 18, 76, 82, 0, 0, 10, 0, 5, 114, 6, 0, 75, 147, 0,
+    43, 0, 0, 84, 86, 132, 109, 0, 0, 151, 0, 0, 0, 134, 96, 0, 108, 0, 15, 136, 118, 133, 0, 55, 0, 72, 0, 117, 0, 0, 0, 0, 0, 0, 0, 62, 0, 71, 51, 0, 3, 34,
+    146, 0, 66, 85, 0, 0, 44, 0, 0, 50, 0, 45, 25, 0, 99, 140, 124, 2, 0, 0, 120, 53, 102, 0, 0, 54, 135, 115, 0, 0, 0, 112, 0, 152, 28, 29, 8, 68, 129, 0, 0,
+    130, 47, 81, 32, 0, 0, 12, 58, 93, 22, 123, 0, 150, 0, 57, 98, 105, 0, 141, 131, 94, 74, 13, 77, 49, 78, 0, 101, 0, 38, 0, 0, 19, 14, 0, 0, 21, 48, 0, 125,
+    0, 39, 90, 0, 111, 0, 100, 70, 67, 0, 92, 139, 46, 0, 149, 137, 16, 0, 63, 138, 0, 0, 0, 0, 0, 0, 148, 0, 0, 31, 121, 33, 11, 88, 69, 23, 113, 35, 65, 0,
+    0, 73, 7, 52, 0, 128, 126, 0, 37, 80, 59, 79, 145, 20, 107, 0, 40, 106, 95, 0, 26, 104, 0, 122, 103, 83, 0, 0, 0, 42, 0, 1, 0, 0, 60, 0, 41, 0, 0, 0, 0,
+    17, 0, 89, 0, 110, 30, 0, 0, 97, 144,
+};
+} // namespace BHR_Master
+
+// Sorted by key
+inline constexpr BehaviorVarTable kTables[] = {
+    {1344932221912162919ull, WolfRootBehavior::kNames, WolfRootBehavior::kFoldedNames, WolfRootBehavior::kDisplacements, WolfRootBehavior::kSlots},
+    {1556693752012287718ull, DraugrBehavior::kNames, DraugrBehavior::kFoldedNames, DraugrBehavior::kDisplacements, DraugrBehavior::kSlots},
+    {1832497254465648632ull, DeerRootBehavior::kNames, DeerRootBehavior::kFoldedNames, DeerRootBehavior::kDisplacements, DeerRootBehavior::kSlots},
+    {1928879069472700161ull, FrostbiteSpider::kNames, FrostbiteSpider::kFoldedNames, FrostbiteSpider::kDisplacements, FrostbiteSpider::kSlots},
+    {2357248884501192123ull, SkeeverRootBehavior::kNames, SkeeverRootBehavior::kFoldedNames, SkeeverRootBehavior::kDisplacements, SkeeverRootBehavior::kSlots},
+    {3009402738794250552ull, Falmer_Master_Behavior::kNames, Falmer_Master_Behavior::kFoldedNames, Falmer_Master_Behavior::kDisplacements, Falmer_Master_Behavior::kSlots},
+    {3017922126943190855ull, HagravenMasterBehavior::kNames, HagravenMasterBehavior::kFoldedNames, HagravenMasterBehavior::kDisplacements, HagravenMasterBehavior::kSlots},
+    {3064138997224155673ull, HorseRootBehavior::kNames, HorseRootBehavior::kFoldedNames, HorseRootBehavior::kDisplacements, HorseRootBehavior::kSlots},
+    {5224687413749858422ull, Chicken::kNames, Chicken::kFoldedNames, Chicken::kDisplacements, Chicken::kSlots},
+    {5260053452598805463ull, GoatRootBehavior::kNames, GoatRootBehavior::kFoldedNames, GoatRootBehavior::kDisplacements, GoatRootBehavior::kSlots},
+    {5600819660802946846ull, ScribRootBehavior::kNames, ScribRootBehavior::kFoldedNames, ScribRootBehavior::kDisplacements, ScribRootBehavior::kSlots},
+    {6046020211772183226ull, HorkerRootBehavior::kNames, HorkerRootBehavior::kFoldedNames, HorkerRootBehavior::kDisplacements, HorkerRootBehavior::kSlots},
+    {6408297713843182476ull, VampireBruteRootBehavior::kNames, VampireBruteRootBehavior::kFoldedNames, VampireBruteRootBehavior::kDisplacements, VampireBruteRootBehavior::kSlots},
+    {6432093022549018934ull, Chaurus::kNames, Chaurus::kFoldedNames, Chaurus::kDisplacements, Chaurus::kSlots},
+    {8391591236278645567ull, SabreCatRootBehavior::kNames, SabreCatRootBehavior::kFoldedNames, SabreCatRootBehavior::kDisplacements, SabreCatRootBehavior::kSlots},
+    {9011796343880008240ull, AtronachStormBehavior::kNames, AtronachStormBehavior::kFoldedNames, AtronachStormBehavior::kDisplacements, AtronachStormBehavior::kSlots},
+    {9498225481650921683ull, Mudcrab::kNames, Mudcrab::kFoldedNames, Mudcrab::kDisplacements, Mudcrab::kSlots},
+    {9732983738769370819ull, WerewolfBehavior::kNames, WerewolfBehavior::kFoldedNames, WerewolfBehavior::kDisplacements, WerewolfBehavior::kSlots},
+    {10099378323021197839ull, Spriggan::kNames, Spriggan::kFoldedNames, Spriggan::kDisplacements, Spriggan::kSlots},
+    {11071881714804970071ull, Rabbit::kNames, Rabbit::kFoldedNames, Rabbit::kDisplacements, Rabbit::kSlots},
+    {12283352931604624777ull, BearRootBehavior::kNames, BearRootBehavior::kFoldedNames, BearRootBehavior::kDisplacements, BearRootBehavior::kSlots},
+    {12323911819758128165ull, SteamBehavior::kNames, SteamBehavior::kFoldedNames, SteamBehavior::kDisplacements, SteamBehavior::kSlots},
+    {12972242470338891659ull, TrollBehavior::kNames, TrollBehavior::kFoldedNames, TrollBehavior::kDisplacements, TrollBehavior::kSlots},
+    {13065750443784029010ull, MammothRootBehavior::kNames, MammothRootBehavior::kFoldedNames, MammothRootBehavior::kDisplacements, MammothRootBehavior::kSlots},
+    {14566708169643289121ull, AtronachFrostRootBehavior::kNames, AtronachFrostRootBehavior::kFoldedNames, AtronachFrostRootBehavior::kDisplacements, AtronachFrostRootBehavior::kSlots},
+    {14787123347890181413ull, GiantRootBehavior::kNames, GiantRootBehavior::kFoldedNames, GiantRootBehavior::kDisplacements, GiantRootBehavior::kSlots},
+    {15924684633707834553ull, DwarvenSpider::kNames, DwarvenSpider::kFoldedNames, DwarvenSpider::kDisplacements, DwarvenSpider::kSlots},
+    {16093192286272613165ull, DogRootBehavior::kNames, DogRootBehavior::kFoldedNames, DogRootBehavior::kDisplacements, DogRootBehavior::kSlots},
+    {16269673692629748097ull, VampireLordBehavior::kNames, VampireLordBehavior::kFoldedNames, VampireLordBehavior::kDisplacements, VampireLordBehavior::kSlots},
+    {17103635255379484992ull, CowRootBehavior::kNames, CowRootBehavior::kFoldedNames, CowRootBehavior::kDisplacements, CowRootBehavior::kSlots},
+    {17585368238253125375ull, Master_Behavior::kNames, Master_Behavior::kFoldedNames, Master_Behavior::kDisplacements, Master_Behavior::kSlots},
+    {18331100224015734760ull, BHR_Master::kNames, BHR_Master::kFoldedNames, BHR_Master::kDisplacements, BHR_Master::kSlots},
+};
+} // namespace BehaviorVarTables
@@ -1,5 +1,6 @@
 #include <Structs/TimeModel.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -12,6 +13,19 @@ void TimeModel::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     Serialization::WriteVarInt(aWriter, Year);
 }
 
+size_t TimeModel::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::kFloat;
+    bits += SerializedSize::VarInt(Day);
+    bits += SerializedSize::VarInt(Month);
+    bits += SerializedSize::VarInt(Year);
+
+    return bits;
+}
+
 void TimeModel::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     TimeScale = Serialization::ReadFloat(aReader);
@@ -1,5 +1,6 @@
 #include <Structs/Tints.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 #include <stdexcept>
 
 using TiltedPhoques::Serialization;
@@ -37,6 +38,23 @@ void Tints::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
     }
 }
 
+size_t Tints::SerializedBitsBound() const noexcept
+{
+    size_t bits = 0;
+
+    bits += 8;
+
+    for (auto& entry : Entries)
+    {
+        bits += SerializedSize::VarInt(entry.Type);
+        bits += 32;
+        bits += entry.Name.SerializedBitsBound();
+        bits += 32;
+    }
+
+    return bits;
+}
+
 void Tints::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t tmp = 0;
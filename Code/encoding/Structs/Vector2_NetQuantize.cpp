@@ -1,5 +1,6 @@
 #include <Structs/Vector2_NetQuantize.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -24,6 +25,11 @@ void Vector2_NetQuantize::Serialize(TiltedPhoques::Buffer::Writer& aWriter) cons
     aWriter.WriteBits(Pack(), 32);
 }
 
+size_t Vector2_NetQuantize::SerializedBitsBound() const noexcept
+{
+    return 32;
+}
+
 void Vector2_NetQuantize::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t data;
@@ -18,6 +18,7 @@ struct Vector2_NetQuantize : glm::vec2
      * @param aWriter Writer wrapping the buffer.
      */
     void Serialize(Buffer::Writer& aWriter) const noexcept;
+    [[nodiscard]] size_t SerializedBitsBound() const noexcept;
     /**
      * Deserialize from a buffer.
      * @param aReader Reader wrapping the buffer.
@@ -1,5 +1,6 @@
 #include <Structs/Vector3_NetQuantize.h>
 #include <TiltedCore/Serialization.hpp>
+#include <SerializedSize.h>
 
 using TiltedPhoques::Serialization;
 
@@ -24,6 +25,11 @@ void Vector3_NetQuantize::Serialize(TiltedPhoques::Buffer::Writer& aWriter) cons
     aWriter.WriteBits(Pack(), 64);
 }
 
+size_t Vector3_NetQuantize::SerializedBitsBound() const noexcept
+{
+    return 64;
+}
+
 void Vector3_NetQuantize::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
     uint64_t data;
@@ -0,0 +1,187 @@
+#include <TimeSync.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Same gains as TCP uses for its round trip estimate (RFC 6298)
+constexpr float cRoundTripGain = 1.f / 8.f;
+constexpr float cJitterGain = 1.f / 4.f;
+} // namespace
+
+TimeSync::TimeSync(const Settings& acSettings) noexcept
+    : m_settings(acSettings)
+{
+}
+
+bool TimeSync::Measure(uint64_t aClientSend, uint64_t aServerReceive, uint64_t aServerSend, uint64_t aClientReceive, Exchange& aExchange) noexcept
+{
+    if (aClientReceive < aClientSend || aServerSend < aServerReceive)
+        return false;
+
+    const auto cElapsed = aClientReceive - aClientSend;
+    const auto cHeld = aServerSend - aServerReceive;
+    if (cHeld > cElapsed)
+        return false;
+
+    const auto cOutbound = static_cast<int64_t>(aServerReceive - aClientSend);
+    const auto cInbound = static_cast<int64_t>(aServerSend - aClientReceive);
+
+    aExchange.LocalTick = aClientReceive;
+    aExchange.RoundTripTime = cElapsed - cHeld;
+    // Halving the sum rounds towards zero, the error is below a tick either way
+    aExchange.Offset = (cOutbound + cInbound) / 2;
+
+    return true;
+}
+
+bool TimeSync::AddExchange(uint64_t aClientSend, uint64_t aServerReceive, uint64_t aServerSend, uint64_t aClientReceive) noexcept
+{
+    Exchange exchange;
+    if (!Measure(aClientSend, aServerReceive, aServerSend, aClientReceive, exchange))
+        return false;
+
+    AddExchange(exchange);
+
+    return true;
+}
+
+void TimeSync::AddExchange(const Exchange& acExchange) noexcept
+{
+    const auto cRoundTrip = static_cast<float>(acExchange.RoundTripTime);
+
+    if (m_count == 0)
+    {
+        m_roundTripTime = cRoundTrip;
+        m_jitter = cRoundTrip / 2.f;
+    }
+    else
+    {
+        m_jitter += (std::abs(m_roundTripTime - cRoundTrip) - m_jitter) * cJitterGain;
+        m_roundTripTime += (cRoundTrip - m_roundTripTime) * cRoundTripGain;
+    }
+
+    m_exchanges[m_next] = acExchange;
+    m_next = (m_next + 1) % kWindowSize;
+    m_count = std::min(m_count + 1, kWindowSize);
+    ++m_total;
+
+    UpdateDrift();
+}
+
+uint64_t TimeSync::GetServerTick(uint64_t aLocalTick) noexcept
+{
+    if (!IsSynchronized())
+        return aLocalTick;
+
+    const auto cTarget = static_cast<double>(aLocalTick) + static_cast<double>(EstimateOffset(aLocalTick));
+
+    if (!m_started)
+    {
+        m_started = true;
+        m_serverTick = cTarget;
+    }
+    else if (aLocalTick > m_lastLocalTick)
+    {
+        const auto cElapsed = static_cast<double>(aLocalTick - m_lastLocalTick);
+        const auto cPredicted = m_serverTick + cElapsed;
+        const auto cError = cTarget - cPredicted;
+        const auto cStep = static_cast<double>(m_settings.StepThreshold);
+
+        if (cError > cStep)
+        {
+            m_serverTick = cTarget;
+        }
+        else if (cError < -cStep)
+        {
+            // Far ahead of the server, hold still rather than go back in time
+            m_serverTick = std::max(m_serverTick, cTarget);
+        }
+        else
+        {
+            const auto cMaxAdjustment = cElapsed * m_settings.MaxSlewRate;
+            m_serverTick = cPredicted + std::clamp(cError, -cMaxAdjustment, cMaxAdjustment);
+        }
+    }
+
+    m_lastLocalTick = std::max(m_lastLocalTick, aLocalTick);
+
+    return static_cast<uint64_t>(std::max(m_serverTick, 0.0));
+}
+
+int64_t TimeSync::EstimateOffset(uint64_t aLocalTick) const noexcept
+{
+    if (!IsSynchronized())
+        return 0;
+
+    const auto& best = GetBestExchange();
+    const auto cSince = static_cast<double>(aLocalTick) - static_cast<double>(best.LocalTick);
+
+    return best.Offset + static_cast<int64_t>(std::llround(cSince * m_drift));
+}
+
+void TimeSync::Reset() noexcept
+{
+    *this = TimeSync(m_settings);
+}
+
+uint64_t TimeSync::GetMinRoundTripTime() const noexcept
+{
+    return IsSynchronized() ? GetBestExchange().RoundTripTime : 0;
+}
+
+const TimeSync::Exchange& TimeSync::GetBestExchange() const noexcept
+{
+    // On a tie the most recent exchange wins, it carries the least drift
+    const Exchange* pBest = nullptr;
+    for (auto i = 0u; i < m_count; ++i)
+    {
+        const auto& exchange = m_exchanges[(m_next + kWindowSize - 1 - i) % kWindowSize];
+        if (!pBest || exchange.RoundTripTime < pBest->RoundTripTime)
+            pBest = &exchange;
+    }
+
+    return *pBest;
+}
+
+void TimeSync::UpdateDrift() noexcept
+{
+    if (m_count < 2)
+        return;
+
+    // Least squares fit of offset over local time, weighted towards fast exchanges whose offset is trustworthy
+    const auto cMinRoundTrip = static_cast<double>(GetMinRoundTripTime());
+    const auto& newest = m_exchanges[(m_next + kWindowSize - 1) % kWindowSize];
+
+    double weights = 0.0, sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+    uint64_t oldest = newest.LocalTick;
+
+    for (auto i = 0u; i < m_count; ++i)
+    {
+        const auto& exchange = m_exchanges[i];
+        const auto cExcess = static_cast<double>(exchange.RoundTripTime) - cMinRoundTrip;
+        const auto cWeight = 1.0 / (1.0 + cExcess * cExcess);
+
+        // Relative to the newest exchange so the sums stay small
+        const auto cX = static_cast<double>(exchange.LocalTick) - static_cast<double>(newest.LocalTick);
+        const auto cY = static_cast<double>(exchange.Offset - newest.Offset);
+
+        weights += cWeight;
+        sumX += cWeight * cX;
+        sumY += cWeight * cY;
+        sumXX += cWeight * cX * cX;
+        sumXY += cWeight * cX * cY;
+
+        oldest = std::min(oldest, exchange.LocalTick);
+    }
+
+    if (newest.LocalTick - oldest < m_settings.MinDriftSpan)
+        return;
+
+    const auto cDenominator = weights * sumXX - sumX * sumX;
+    if (cDenominator <= 0.0)
+        return;
+
+    m_drift = (weights * sumXY - sumX * sumY) / cDenominator;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+
+/**
+ * @brief Estimates the server clock from request/response exchanges, the way NTP does.
+ *
+ * Each exchange gives four timestamps: the client sends at t0, the server receives at t1 and replies
+ * at t2, the client receives at t3. The round trip is (t3 - t0) - (t2 - t1) and the offset of the
+ * server clock is ((t1 - t0) + (t2 - t3)) / 2, exact when both directions take as long.
+ *
+ * Only the exchanges with the shortest round trip of a sliding window are trusted, queuing delay is
+ * what makes the two directions differ. The drift between both clocks is the slope of the offsets
+ * across the window. GetServerTick never goes backwards and slews towards the estimate instead of
+ * jumping, so whatever is driven by it (calendar, interpolation) stays smooth when the estimate moves.
+ */
+struct TimeSync
+{
+    // Exchanges kept to filter and fit the drift on
+    static constexpr uint32_t kWindowSize = 16;
+
+    struct Settings
+    {
+        // How much faster or slower than the local clock the reported tick may run, 0.05 is +-5%
+        float MaxSlewRate{0.05f};
+        // Errors past this many ms are corrected at once, after a reconnection or a suspended process
+        uint64_t StepThreshold{1000};
+        // Exchanges must span this long for the drift to be estimated, below it ms rounding dominates
+        uint64_t MinDriftSpan{10000};
+    };
+
+    struct Exchange
+    {
+        // Local tick the response arrived at
+        uint64_t LocalTick{0};
+        // Server tick minus local tick
+        int64_t Offset{0};
+        uint64_t RoundTripTime{0};
+    };
+
+    TimeSync() noexcept = default;
+    explicit TimeSync(const Settings& acSettings) noexcept;
+
+    /**
+     * Computes what a single exchange measured.
+     * @return False when the timestamps are inconsistent, the server claims to have held the request longer than the round trip.
+     */
+    [[nodiscard]] static bool Measure(uint64_t aClientSend, uint64_t aServerReceive, uint64_t aServerSend, uint64_t aClientReceive, Exchange& aExchange) noexcept;
+
+    // Records an exchange, see Measure for the timestamps
+    bool AddExchange(uint64_t aClientSend, uint64_t aServerReceive, uint64_t aServerSend, uint64_t aClientReceive) noexcept;
+    void AddExchange(const Exchange& acExchange) noexcept;
+
+    /**
+     * Maps a local tick to the server clock, slewing towards the estimate.
+     * @param aLocalTick Must not go backwards from one call to the next.
+     * @return The local tick while no exchange has been recorded.
+     */
+    uint64_t GetServerTick(uint64_t aLocalTick) noexcept;
+
+    // Server tick minus local tick at aLocalTick, unfiltered by the slewing
+    [[nodiscard]] int64_t EstimateOffset(uint64_t aLocalTick) const noexcept;
+
+    void Reset() noexcept;
+
+    [[nodiscard]] bool IsSynchronized() const noexcept { return m_count > 0; }
+    [[nodiscard]] uint32_t GetExchangeCount() const noexcept { return m_total; }
+    // Smoothed round trip, in ms
+    [[nodiscard]] float GetRoundTripTime() const noexcept { return m_roundTripTime; }
+    [[nodiscard]] uint64_t GetMinRoundTripTime() const noexcept;
+    // Mean deviation of the round trip, in ms
+    [[nodiscard]] float GetJitter() const noexcept { return m_jitter; }
+    // Server ms gained per local ms, 1e-4 is 100 ppm
+    [[nodiscard]] double GetDrift() const noexcept { return m_drift; }
+
+private:
+    [[nodiscard]] const Exchange& GetBestExchange() const noexcept;
+    void UpdateDrift() noexcept;
+
+    Settings m_settings{};
+    std::array<Exchange, kWindowSize> m_exchanges{};
+    uint32_t m_next{0};
+    uint32_t m_count{0};
+    uint32_t m_total{0};
+
+    float m_roundTripTime{0.f};
+    float m_jitter{0.f};
+    double m_drift{0.0};
+
+    // Last tick handed out, fractional so slewing isn't lost to rounding at high frame rates
+    double m_serverTick{0.0};
+    uint64_t m_lastLocalTick{0};
+    bool m_started{false};
+};
@@ -0,0 +1,95 @@
+#include <ViewScope.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace
+{
+thread_local ViewScope* s_pCurrent = nullptr;
+
+// Process wide so a string borrowed on one thread never matches a scope open on another
+std::atomic<uint32_t> s_nextId{1};
+
+constexpr size_t kMinBlockSize = 4096;
+} // namespace
+
+ViewScope::ViewScope(const void* apData, size_t aSize) noexcept
+    : m_pBegin(static_cast<const uint8_t*>(apData))
+    , m_pEnd(m_pBegin + aSize)
+    , m_id(s_nextId.fetch_add(1, std::memory_order_relaxed))
+    , m_pParent(s_pCurrent)
+{
+    s_pCurrent = this;
+}
+
+ViewScope::~ViewScope()
+{
+    s_pCurrent = m_pParent;
+
+#if TP_CHECK_MESSAGE_VIEWS
+    // Makes a use after close that slipped past the checks read garbage rather than plausible text
+    std::memset(m_inline, 0xDD, m_used);
+#endif
+
+    while (m_pBlocks)
+    {
+        auto* pBlock = m_pBlocks;
+        m_pBlocks = pBlock->pNext;
+
+#if TP_CHECK_MESSAGE_VIEWS
+        std::memset(pBlock + 1, 0xDD, pBlock->Size);
+#endif
+
+        delete[] reinterpret_cast<char*>(pBlock);
+    }
+}
+
+ViewScope* ViewScope::GetCurrent() noexcept
+{
+    return s_pCurrent;
+}
+
+bool ViewScope::IsOpen(uint32_t aId) noexcept
+{
+    for (auto* pScope = s_pCurrent; pScope; pScope = pScope->m_pParent)
+    {
+        if (pScope->m_id == aId)
+            return true;
+    }
+
+    return false;
+}
+
+bool ViewScope::Contains(const void* apData, size_t aSize) const noexcept
+{
+    const auto* cpData = static_cast<const uint8_t*>(apData);
+
+    return cpData >= m_pBegin && cpData <= m_pEnd && aSize <= static_cast<size_t>(m_pEnd - cpData);
+}
+
+char* ViewScope::Allocate(size_t aSize) noexcept
+{
+    if (aSize <= kInlineSize - m_used)
+    {
+        auto* pData = m_inline + m_used;
+        m_used += aSize;
+        return pData;
+    }
+
+    if (m_pBlocks && aSize <= m_pBlocks->Size - m_blockUsed)
+    {
+        auto* pData = reinterpret_cast<char*>(m_pBlocks + 1) + m_blockUsed;
+        m_blockUsed += aSize;
+        return pData;
+    }
+
+    const auto cSize = std::max(aSize, kMinBlockSize);
+    auto* pBlock = reinterpret_cast<Block*>(new char[sizeof(Block) + cSize]);
+    pBlock->pNext = m_pBlocks;
+    pBlock->Size = cSize;
+    m_pBlocks = pBlock;
+    m_blockUsed = aSize;
+
+    return reinterpret_cast<char*>(pBlock + 1);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Debug builds check that borrowed message strings are not used once the buffer they point to is gone
+#if !defined(TP_CHECK_MESSAGE_VIEWS) && defined(DEBUG)
+#define TP_CHECK_MESSAGE_VIEWS 1
+#endif
+
+/**
+ * @brief Lets the messages decoded on this thread borrow their strings instead of copying them.
+ *
+ * While a scope is open, MessageString fields point into the scope's buffer when their bytes are aligned in it,
+ * or into the scope's arena when they are not (or come from the string cache). Either way decoding them
+ * allocates nothing. Fields read from another buffer are copied as usual. Everything borrowed is only valid
+ * until the scope closes: the buffer must outlive the scope, and a message that outlives it must call
+ * MessageString::Own on its fields first.
+ *
+ * Scopes nest, the innermost one is used. With TP_CHECK_MESSAGE_VIEWS every access to a borrowed string checks
+ * that its scope is still open on the calling thread, and closing a scope overwrites its arena.
+ */
+class ViewScope
+{
+public:
+    // apData is the buffer messages are decoded from, strings can point into it
+    ViewScope(const void* apData, size_t aSize) noexcept;
+    ~ViewScope();
+
+    TP_NOCOPYMOVE(ViewScope);
+
+    // Innermost scope open on the calling thread, nullptr when strings are copied
+    [[nodiscard]] static ViewScope* GetCurrent() noexcept;
+    // Whether the scope with this id is open on the calling thread
+    [[nodiscard]] static bool IsOpen(uint32_t aId) noexcept;
+
+    [[nodiscard]] bool Contains(const void* apData, size_t aSize) const noexcept;
+
+    // Memory valid until the scope closes, for the strings that can't point into the decoded buffer
+    [[nodiscard]] char* Allocate(size_t aSize) noexcept;
+
+    [[nodiscard]] uint32_t GetId() const noexcept { return m_id; }
+
+private:
+    // Enough for the strings of a chat message or two, larger ones spill to the heap
+    static constexpr size_t kInlineSize = 1024;
+
+    struct Block
+    {
+        Block* pNext;
+        size_t Size;
+    };
+
+    char m_inline[kInlineSize];
+    size_t m_used{0};
+    // Heap blocks of the strings that didn't fit inline, the most recent first
+    Block* m_pBlocks{nullptr};
+    size_t m_blockUsed{0};
+
+    const uint8_t* m_pBegin;
+    const uint8_t* m_pEnd;
+    uint32_t m_id;
+    ViewScope* m_pParent;
+};
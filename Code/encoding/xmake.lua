@@ -15,7 +15,7 @@ target(name)
     add_headerfiles("Structs/Skyrim/**.h")
     add_includedirs("Structs/Skyrim")
 
-    add_packages("hopscotch-map", "glm", "tiltedcore")
+    add_packages("hopscotch-map", "glm", "tiltedcore", "zlib")
 end
 
 build_encoding("SkyrimEncoding")
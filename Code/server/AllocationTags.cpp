@@ -0,0 +1,9 @@
+#include <AllocationTags.h>
+
+namespace AllocationTags
+{
+Base::TrackingAllocator Encoding{"Encoding"};
+Base::TrackingAllocator ESLoader{"ESLoader"};
+Base::TrackingAllocator Scripting{"Scripting"};
+Base::TrackingAllocator Snapshots{"Snapshots"};
+} // namespace AllocationTags
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <base/allocator/TrackingAllocator.h>
+
+// Subsystems whose allocations are followed by the stats command, charge them with a Base::AllocationScope
+namespace AllocationTags
+{
+extern Base::TrackingAllocator Encoding;
+extern Base::TrackingAllocator ESLoader;
+extern Base::TrackingAllocator Scripting;
+extern Base::TrackingAllocator Snapshots;
+} // namespace AllocationTags
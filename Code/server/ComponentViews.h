@@ -0,0 +1,22 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <Components.h>
+
+/**
+ * @brief Views of the component combinations iterated every tick, so every system spells them the same way.
+ *
+ * Plain views, entt walks the smallest of the pools when iterated. Groups were tried: a non-owning group only
+ * saves the probing of the other pools, and an owning one reorders the pools it owns on every component added or
+ * removed, which no view over them may see while iterating. Neither was worth it without a measurement against
+ * the server's real worlds.
+ */
+struct ComponentViews
+{
+    // Everything the movement snapshot reads
+    static auto Movement(entt::registry& aRegistry) noexcept { return aRegistry.view<MovementComponent, AnimationComponent, CharacterComponent, CellIdComponent, OwnerComponent>(); }
+
+    // Owned characters and where they are, used by the faction broadcast, spawn streams and ownership transfers
+    static auto Characters(entt::registry& aRegistry) noexcept { return aRegistry.view<CellIdComponent, CharacterComponent, OwnerComponent>(); }
+};
@@ -13,6 +13,8 @@ struct MovementComponent
     glm::vec3 Rotation;
     AnimationVariables Variables;
     float Direction;
+    // Bumped whenever the animation state changes, used to detect when extrapolation isn't enough
+    uint32_t Revision{0};
 
     bool Sent;
 };
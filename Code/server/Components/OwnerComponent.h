@@ -14,6 +14,7 @@ struct OwnerComponent
 
     Player* GetOwner() const { return reinterpret_cast<Player*>(pOwner); }
 
+    // Use through registry.patch so the ownership index follows the change
     void SetOwner(Player* apPlayer) { pOwner = apPlayer; }
 
     Player* pOwner;
@@ -0,0 +1,95 @@
+#include "MulticastGroups.h"
+#include "Player.h"
+
+std::optional<MulticastGroupId> MulticastGroupId::ForCell(const CellIdComponent& acCell) noexcept
+{
+    if (!acCell)
+        return std::nullopt;
+
+    if (acCell.IsInInteriorCell())
+        return InteriorCell(acCell.Cell);
+
+    return WorldSpace(acCell.WorldSpaceId);
+}
+
+const MulticastGroups::TMembers& MulticastGroups::GetMembers(const MulticastGroupId& acGroup) const noexcept
+{
+    static const TMembers s_empty;
+
+    const auto itor = m_groups.find(acGroup);
+    if (itor == std::end(m_groups))
+        return s_empty;
+
+    return itor->second;
+}
+
+void MulticastGroups::Join(const MulticastGroupId& acGroup, ConnectionId_t aConnectionId) noexcept
+{
+    auto& memberships = m_memberships[aConnectionId];
+    if (std::find(std::begin(memberships), std::end(memberships), acGroup) != std::end(memberships))
+        return;
+
+    memberships.push_back(acGroup);
+    m_groups[acGroup].push_back(aConnectionId);
+}
+
+void MulticastGroups::Leave(const MulticastGroupId& acGroup, ConnectionId_t aConnectionId) noexcept
+{
+    const auto membershipItor = m_memberships.find(aConnectionId);
+    if (membershipItor == std::end(m_memberships))
+        return;
+
+    auto& memberships = membershipItor.value();
+    const auto groupItor = std::find(std::begin(memberships), std::end(memberships), acGroup);
+    if (groupItor == std::end(memberships))
+        return;
+
+    memberships.erase(groupItor);
+    if (memberships.empty())
+        m_memberships.erase(membershipItor);
+
+    auto itor = m_groups.find(acGroup);
+    auto& members = itor.value();
+
+    // Order doesn't matter, swap with the last one
+    auto memberItor = std::find(std::begin(members), std::end(members), aConnectionId);
+    *memberItor = members.back();
+    members.pop_back();
+
+    if (members.empty())
+        m_groups.erase(itor);
+}
+
+void MulticastGroups::LeaveAll(ConnectionId_t aConnectionId) noexcept
+{
+    const auto itor = m_memberships.find(aConnectionId);
+    if (itor == std::end(m_memberships))
+        return;
+
+    // Leave drops the membership list once it is empty
+    const auto cGroups = itor->second;
+    for (const auto& group : cGroups)
+        Leave(group, aConnectionId);
+}
+
+void MulticastGroups::SetPlayerCell(Player* apPlayer, const CellIdComponent& acCell) noexcept
+{
+    const auto cConnectionId = apPlayer->GetConnectionId();
+    const auto cOldGroup = MulticastGroupId::ForCell(apPlayer->GetCellComponent());
+    const auto cNewGroup = MulticastGroupId::ForCell(acCell);
+
+    apPlayer->SetCellComponent(acCell);
+
+    if (cOldGroup == cNewGroup)
+        return;
+
+    if (cOldGroup)
+        Leave(*cOldGroup, cConnectionId);
+    else
+        Join(MulticastGroupId::Loaded(), cConnectionId);
+
+    if (cNewGroup)
+        Join(*cNewGroup, cConnectionId);
+    else
+        Leave(MulticastGroupId::Loaded(), cConnectionId);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+struct Player;
+
+// Named recipient lists kept up to date as players move, join parties or become admins,
+// so broadcasts walk the members directly instead of filtering every player.
+struct MulticastGroupId
+{
+    enum Type : uint8_t
+    {
+        kParty,
+        kInteriorCell,
+        kWorldSpace,
+        // Everyone with a cell, whatever it is
+        kLoaded,
+        kAdmins
+    };
+
+    static MulticastGroupId Party(uint32_t aPartyId) noexcept { return {kParty, aPartyId}; }
+    static MulticastGroupId InteriorCell(const GameId& acCell) noexcept { return {kInteriorCell, Pack(acCell)}; }
+    static MulticastGroupId WorldSpace(const GameId& acWorldSpace) noexcept { return {kWorldSpace, Pack(acWorldSpace)}; }
+    static MulticastGroupId Loaded() noexcept { return {kLoaded, 0}; }
+    static MulticastGroupId Admins() noexcept { return {kAdmins, 0}; }
+
+    // The interior cell or worldspace group holding the players that may be in range of this cell
+    static std::optional<MulticastGroupId> ForCell(const CellIdComponent& acCell) noexcept;
+
+    bool operator==(const MulticastGroupId& acRhs) const noexcept { return GroupType == acRhs.GroupType && Value == acRhs.Value; }
+    bool operator!=(const MulticastGroupId& acRhs) const noexcept { return !operator==(acRhs); }
+
+    Type GroupType;
+    uint64_t Value;
+
+private:
+    static uint64_t Pack(const GameId& acId) noexcept { return static_cast<uint64_t>(acId.ModId) << 32 | acId.BaseId; }
+};
+
+namespace std
+{
+template <> struct hash<MulticastGroupId>
+{
+    size_t operator()(const MulticastGroupId& acId) const noexcept { return hash<uint64_t>()(acId.Value) ^ (static_cast<size_t>(acId.GroupType) << 1); }
+};
+} // namespace std
+
+struct MulticastGroups
+{
+    using TMembers = Vector<ConnectionId_t>;
+
+    MulticastGroups() = default;
+    ~MulticastGroups() noexcept = default;
+
+    TP_NOCOPYMOVE(MulticastGroups);
+
+    [[nodiscard]] const TMembers& GetMembers(const MulticastGroupId& acGroup) const noexcept;
+
+    void Join(const MulticastGroupId& acGroup, ConnectionId_t aConnectionId) noexcept;
+    void Leave(const MulticastGroupId& acGroup, ConnectionId_t aConnectionId) noexcept;
+    // Drops the connection from every group it is part of
+    void LeaveAll(ConnectionId_t aConnectionId) noexcept;
+
+    // Sets the player's cell and moves them between the cell groups
+    void SetPlayerCell(Player* apPlayer, const CellIdComponent& acCell) noexcept;
+
+private:
+    Map<MulticastGroupId, TMembers> m_groups;
+    // Groups each connection is in, to leave them all on disconnect
+    Map<ConnectionId_t, Vector<MulticastGroupId>> m_memberships;
+};
@@ -1,43 +1,48 @@
 #pragma once
 
+#include <Game/OwnershipIndex.h>
+
+// Entities owned by a player that have all of T, walks the player's list in the ownership index instead of every owned entity.
+// Ownership must not change while iterating.
 template <class... T> struct OwnerView
 {
     using TView = entt::basic_view<entt::entity, entt::get_t<OwnerComponent, T...>, entt::exclude_t<>>;
+    using TEntities = Vector<entt::entity>;
 
     struct iterator
     {
-        iterator(Player* apPlayer, typename TView::iterator aItor, typename TView::iterator aEnd, const TView& aView)
-            : m_pPlayer{apPlayer}
-            , m_itor{aItor}
-            , m_end{aEnd}
+        iterator(const TEntities& acEntities, size_t aIndex, const TView& aView)
+            : m_entities{acEntities}
+            , m_index{aIndex}
             , m_view{aView}
         {
+            SkipMissing();
         }
 
         iterator& operator++()
         {
-            do
-            {
-                m_itor++;
-            } while (m_itor != m_end && m_view.template get<OwnerComponent>(*m_itor).GetOwner() != m_pPlayer);
+            ++m_index;
+            SkipMissing();
 
             return *this;
         }
 
-        bool operator!=(const iterator& acRhs) const { return m_itor != acRhs.m_itor; }
-
-        bool operator==(const iterator& acRhs) const { return m_itor == acRhs.m_itor; }
+        bool operator!=(const iterator& acRhs) const { return m_index != acRhs.m_index; }
 
-        decltype(auto) operator*() { return m_itor.operator*(); }
+        bool operator==(const iterator& acRhs) const { return m_index == acRhs.m_index; }
 
-        [[nodiscard]] decltype(auto) operator->() const { return m_itor.operator->(); }
-
-        [[nodiscard]] decltype(auto) operator*() const { return m_itor.operator*(); }
+        [[nodiscard]] entt::entity operator*() const { return m_entities[m_index]; }
 
     private:
-        Player* m_pPlayer;
-        typename TView::iterator m_itor;
-        typename TView::iterator m_end;
+        // Owned entities without the other components are not part of the view
+        void SkipMissing()
+        {
+            while (m_index < m_entities.size() && !m_view.contains(m_entities[m_index]))
+                ++m_index;
+        }
+
+        const TEntities& m_entities;
+        size_t m_index;
         const TView& m_view;
     };
 
@@ -53,37 +58,38 @@ template <class... T> struct OwnerView
 
 private:
     TView m_view;
+    const OwnershipIndex& m_index;
+    const TEntities& m_entities;
     Player* m_pPlayer;
 };
 
 template <class... T>
 OwnerView<T...>::OwnerView(entt::registry& aRegistry, Player* apPlayer)
     : m_view(aRegistry.view<OwnerComponent, T...>())
+    , m_index(aRegistry.ctx().at<const OwnershipIndex>())
+    , m_entities(m_index.GetEntities(apPlayer))
     , m_pPlayer(apPlayer)
 {
 }
 
 template <class... T> decltype(auto) OwnerView<T...>::find(entt::entity aEntity) const
 {
-    auto it = m_view.find(aEntity);
+    const auto cIndex = m_index.IndexOf(aEntity, m_pPlayer);
 
-    if (it == m_view.end())
+    if (cIndex == OwnershipIndex::kNotOwned || !m_view.contains(aEntity))
         return end();
 
-    if (m_view.template get<OwnerComponent>(*it).GetOwner() == m_pPlayer)
-        return iterator(m_pPlayer, it, std::end(m_view), m_view);
-
-    return end();
+    return iterator(m_entities, cIndex, m_view);
 }
 
 template <class... T> decltype(auto) OwnerView<T...>::begin() const
 {
-    return iterator(m_pPlayer, std::begin(m_view), std::end(m_view), m_view);
+    return iterator(m_entities, 0, m_view);
 }
 
 template <class... T> decltype(auto) OwnerView<T...>::end() const
 {
-    return iterator(m_pPlayer, std::end(m_view), std::end(m_view), m_view);
+    return iterator(m_entities, m_entities.size(), m_view);
 }
 
 template <class... T> template <class... Components> decltype(auto) OwnerView<T...>::get(entt::entity aEntity)
@@ -0,0 +1,83 @@
+#include "OwnershipIndex.h"
+
+OwnershipIndex::OwnershipIndex(entt::registry& aRegistry) noexcept
+{
+    m_constructConnection = aRegistry.on_construct<OwnerComponent>().connect<&OwnershipIndex::OnConstruct>(this);
+    m_updateConnection = aRegistry.on_update<OwnerComponent>().connect<&OwnershipIndex::OnUpdate>(this);
+    m_destroyConnection = aRegistry.on_destroy<OwnerComponent>().connect<&OwnershipIndex::OnDestroy>(this);
+}
+
+const Vector<entt::entity>& OwnershipIndex::GetEntities(const Player* apPlayer) const noexcept
+{
+    static const Vector<entt::entity> s_empty;
+
+    const auto itor = m_entities.find(apPlayer);
+    if (itor == std::end(m_entities))
+        return s_empty;
+
+    return itor->second;
+}
+
+size_t OwnershipIndex::IndexOf(entt::entity aEntity, const Player* apPlayer) const noexcept
+{
+    const auto itor = m_entries.find(aEntity);
+    if (itor == std::end(m_entries) || itor->second.pOwner != apPlayer)
+        return kNotOwned;
+
+    return itor->second.Index;
+}
+
+void OwnershipIndex::OnConstruct(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    Add(aEntity, aRegistry.get<OwnerComponent>(aEntity).GetOwner());
+}
+
+void OwnershipIndex::OnUpdate(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    const Player* pOwner = aRegistry.get<OwnerComponent>(aEntity).GetOwner();
+
+    const auto itor = m_entries.find(aEntity);
+    if (itor != std::end(m_entries) && itor->second.pOwner == pOwner)
+        return;
+
+    Remove(aEntity);
+    Add(aEntity, pOwner);
+}
+
+void OwnershipIndex::OnDestroy(entt::registry&, entt::entity aEntity) noexcept
+{
+    Remove(aEntity);
+}
+
+void OwnershipIndex::Add(entt::entity aEntity, const Player* apPlayer) noexcept
+{
+    auto& entities = m_entities[apPlayer];
+    m_entries[aEntity] = Entry{apPlayer, entities.size()};
+    entities.push_back(aEntity);
+}
+
+void OwnershipIndex::Remove(entt::entity aEntity) noexcept
+{
+    const auto itor = m_entries.find(aEntity);
+    if (itor == std::end(m_entries))
+        return;
+
+    const auto [pOwner, index] = itor->second;
+    m_entries.erase(itor);
+
+    auto ownerItor = m_entities.find(pOwner);
+    auto& entities = ownerItor.value();
+
+    // Swap with the last one so removal stays O(1), order doesn't matter
+    const auto cLast = entities.back();
+    if (cLast != aEntity)
+    {
+        entities[index] = cLast;
+        m_entries[cLast].Index = index;
+    }
+    entities.pop_back();
+
+    // Player pointers get reused once freed, don't keep lists for players that might be gone
+    if (entities.empty())
+        m_entities.erase(ownerItor);
+}
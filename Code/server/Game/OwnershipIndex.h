@@ -0,0 +1,41 @@
+#pragma once
+
+struct Player;
+
+// Entities grouped by the player owning them, kept up to date from the OwnerComponent signals.
+// Owner changes must go through registry.patch<OwnerComponent> or the index won't see them.
+struct OwnershipIndex
+{
+    static constexpr size_t kNotOwned = std::numeric_limits<size_t>::max();
+
+    explicit OwnershipIndex(entt::registry& aRegistry) noexcept;
+    ~OwnershipIndex() noexcept = default;
+
+    TP_NOCOPYMOVE(OwnershipIndex);
+
+    [[nodiscard]] const Vector<entt::entity>& GetEntities(const Player* apPlayer) const noexcept;
+    // Position of the entity in its owner's list, kNotOwned if the player doesn't own it
+    [[nodiscard]] size_t IndexOf(entt::entity aEntity, const Player* apPlayer) const noexcept;
+    [[nodiscard]] size_t Count(const Player* apPlayer) const noexcept { return GetEntities(apPlayer).size(); }
+
+private:
+    struct Entry
+    {
+        const Player* pOwner;
+        size_t Index;
+    };
+
+    void OnConstruct(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+    void OnUpdate(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+    void OnDestroy(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+
+    void Add(entt::entity aEntity, const Player* apPlayer) noexcept;
+    void Remove(entt::entity aEntity) noexcept;
+
+    Map<const Player*, Vector<entt::entity>> m_entities;
+    Map<entt::entity, Entry> m_entries;
+
+    entt::scoped_connection m_constructConnection;
+    entt::scoped_connection m_updateConnection;
+    entt::scoped_connection m_destroyConnection;
+};
@@ -27,6 +27,9 @@ Player::Player(Player&& aRhs) noexcept
     , m_party{std::exchange(aRhs.m_party, {})}
     , m_questLog{std::exchange(aRhs.m_questLog, {})}
     , m_cell{std::exchange(aRhs.m_cell, {})}
+    , m_movementStates{std::exchange(aRhs.m_movementStates, {})}
+    , m_movementSnapshot{std::exchange(aRhs.m_movementSnapshot, {})}
+    , m_spawnStream{std::exchange(aRhs.m_spawnStream, {})}
 {
 }
 
@@ -90,12 +93,23 @@ void Player::SetLevel(uint16_t aLevel) noexcept
     m_level = aLevel;
 }
 
+void Player::SetLinkStats(uint32_t aRoundTripTime, uint32_t aJitter) noexcept
+{
+    m_roundTripTime = aRoundTripTime;
+    m_jitter = aJitter;
+}
+
+void Player::SetCapabilities(uint32_t aCapabilities) noexcept
+{
+    m_capabilities = aCapabilities;
+}
+
 void Player::SetCellComponent(const CellIdComponent& aCellComponent) noexcept
 {
     m_cell = aCellComponent;
 }
 
-void Player::Send(const ServerMessage& acServerMessage) const
+uint32_t Player::Send(const ServerMessage& acServerMessage) const
 {
-    GameServer::Get()->Send(GetConnectionId(), acServerMessage);
+    return GameServer::Get()->Send(GetConnectionId(), acServerMessage);
 }
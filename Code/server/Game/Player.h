@@ -1,5 +1,9 @@
 #pragma once
 
+#include <DeadReckoning.h>
+#include <Messages/ServerReferencesMoveSnapshot.h>
+#include <Game/SpawnStream.h>
+
 struct ServerMessage;
 struct Player
 {
@@ -21,6 +25,11 @@ struct Player
     [[nodiscard]] const uint64_t GetDiscordId() const noexcept { return m_discordId; }
     [[nodiscard]] const uint32_t GetStringCacheId() const noexcept { return m_stringCacheId; }
     [[nodiscard]] const uint16_t GetLevel() const noexcept { return m_level; }
+    // Round trip and its mean deviation in ms, as last reported by the client's time sync, listed by the players command
+    [[nodiscard]] uint32_t GetRoundTripTime() const noexcept { return m_roundTripTime; }
+    [[nodiscard]] uint32_t GetJitter() const noexcept { return m_jitter; }
+    // One of the AuthenticationRequest capabilities
+    [[nodiscard]] bool HasCapability(uint32_t aCapability) const noexcept { return (m_capabilities & aCapability) != 0; }
 
     [[nodiscard]] CellIdComponent& GetCellComponent() noexcept;
     [[nodiscard]] const CellIdComponent& GetCellComponent() const noexcept;
@@ -29,6 +38,7 @@ struct Player
 
     void SetDiscordId(uint64_t aDiscordId) noexcept;
     void SetEndpoint(String aEndpoint) noexcept;
+    // Goes through PlayerManager::SetUsername once the player is managed, the manager indexes names
     void SetUsername(String aUsername) noexcept;
     void SetMods(Vector<String> aMods) noexcept;
     void SetModIds(Vector<uint16_t> aModIds) noexcept;
@@ -36,10 +46,22 @@ struct Player
     void SetStringCacheId(uint32_t aStringCacheId) noexcept;
     // TODO(cosideci): update on level up
     void SetLevel(uint16_t aLevel) noexcept;
+    void SetLinkStats(uint32_t aRoundTripTime, uint32_t aJitter) noexcept;
+    void SetCapabilities(uint32_t aCapabilities) noexcept;
 
+    // Goes through MulticastGroups::SetPlayerCell so the cell groups follow the player
     void SetCellComponent(const CellIdComponent& aCellComponent) noexcept;
 
-    void Send(const ServerMessage& acServerMessage) const;
+    // Returns the size of the packet handed to the connection
+    uint32_t Send(const ServerMessage& acServerMessage) const;
+
+    // Last movement snapshot this player received for each reference
+    [[nodiscard]] TiltedPhoques::Map<entt::entity, DeadReckoning::State>& GetMovementStates() noexcept { return m_movementStates; }
+    // Reused every movement snapshot so the segment list keeps its storage
+    [[nodiscard]] ServerReferencesMoveSnapshot& GetMovementSnapshot() noexcept { return m_movementSnapshot; }
+    // Characters still to be spawned on this client after joining or entering cells
+    [[nodiscard]] SpawnStream& GetSpawnStream() noexcept { return m_spawnStream; }
+    [[nodiscard]] const SpawnStream& GetSpawnStream() const noexcept { return m_spawnStream; }
 
 private:
     uint32_t m_id{0};
@@ -53,6 +75,12 @@ private:
     PartyComponent m_party;
     QuestLogComponent m_questLog;
     CellIdComponent m_cell;
+    TiltedPhoques::Map<entt::entity, DeadReckoning::State> m_movementStates;
+    ServerReferencesMoveSnapshot m_movementSnapshot;
+    SpawnStream m_spawnStream;
     uint32_t m_stringCacheId{0};
     uint16_t m_level{0};
+    uint32_t m_roundTripTime{0};
+    uint32_t m_jitter{0};
+    uint32_t m_capabilities{0};
 };
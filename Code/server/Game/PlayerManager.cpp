@@ -1,55 +1,70 @@
 #include "PlayerManager.h"
 #include "Player.h"
 
-static PlayerManager* s_pInstance = nullptr;
-
-PlayerManager::PlayerManager()
+Player* PlayerManager::Create(ConnectionId_t aConnectionId) noexcept
 {
-    s_pInstance = this;
-}
+    if (m_slotsByConnection.find(aConnectionId) != std::end(m_slotsByConnection))
+        return nullptr;
 
-PlayerManager::~PlayerManager() noexcept
-{
-    s_pInstance = nullptr;
+    const auto cSlot = static_cast<uint32_t>(m_players.size());
+    auto* pPlayer = m_players.emplace_back(MakeUnique<Player>(aConnectionId)).get();
+
+    m_slotsByConnection[aConnectionId] = cSlot;
+    m_slotsById[pPlayer->GetId()] = cSlot;
+
+    return pPlayer;
 }
 
-PlayerManager* PlayerManager::Get() noexcept
+void PlayerManager::Remove(Player* apPlayer) noexcept
 {
-    if (!s_pInstance)
+    const auto itor = m_slotsByConnection.find(apPlayer->GetConnectionId());
+    if (itor == std::end(m_slotsByConnection))
+        return;
+
+    const auto cSlot = itor->second;
+    UnindexUsername(cSlot);
+    m_slotsByConnection.erase(itor);
+    m_slotsById.erase(apPlayer->GetId());
+
+    // Fill the hole with the last player so the array stays dense
+    const auto cLast = static_cast<uint32_t>(m_players.size() - 1);
+    if (cSlot != cLast)
     {
-        spdlog::error("Invalid access to playermanager");
-        return nullptr;
+        m_players[cSlot] = std::move(m_players[cLast]);
+
+        const auto* pMoved = m_players[cSlot].get();
+        m_slotsByConnection[pMoved->GetConnectionId()] = cSlot;
+        m_slotsById[pMoved->GetId()] = cSlot;
+
+        const auto usernameItor = m_slotsByUsername.find(pMoved->GetUsername());
+        if (usernameItor != std::end(m_slotsByUsername) && usernameItor->second == cLast)
+            usernameItor.value() = cSlot;
     }
 
-    return s_pInstance;
+    m_players.pop_back();
 }
 
-Player* PlayerManager::Create(ConnectionId_t aConnectionId) noexcept
+void PlayerManager::SetUsername(Player* apPlayer, String aUsername) noexcept
 {
-    const auto itor = m_players.find(aConnectionId);
-    if (itor == std::end(m_players))
+    const auto itor = m_slotsByConnection.find(apPlayer->GetConnectionId());
+    if (itor == std::end(m_slotsByConnection))
     {
-        const auto [insertedItor, inserted] = m_players.emplace(aConnectionId, MakeUnique<Player>(aConnectionId));
-        if (inserted)
-        {
-            return insertedItor.value().get();
-        }
+        apPlayer->SetUsername(std::move(aUsername));
+        return;
     }
 
-    return nullptr;
-}
-
-void PlayerManager::Remove(Player* apPlayer) noexcept
-{
-    m_players.erase(apPlayer->GetConnectionId());
+    const auto cSlot = itor->second;
+    UnindexUsername(cSlot);
+    apPlayer->SetUsername(std::move(aUsername));
+    IndexUsername(cSlot);
 }
 
 Player* PlayerManager::GetByConnectionId(ConnectionId_t aConnectionId) noexcept
 {
-    const auto itor = m_players.find(aConnectionId);
-    if (itor != std::end(m_players))
+    const auto itor = m_slotsByConnection.find(aConnectionId);
+    if (itor != std::end(m_slotsByConnection))
     {
-        return itor.value().get();
+        return m_players[itor->second].get();
     }
 
     return nullptr;
@@ -57,10 +72,10 @@ Player* PlayerManager::GetByConnectionId(ConnectionId_t aConnectionId) noexcept
 
 Player const* PlayerManager::GetByConnectionId(ConnectionId_t aConnectionId) const noexcept
 {
-    const auto itor = m_players.find(aConnectionId);
-    if (itor != std::end(m_players))
+    const auto itor = m_slotsByConnection.find(aConnectionId);
+    if (itor != std::end(m_slotsByConnection))
     {
-        return itor.value().get();
+        return m_players[itor->second].get();
     }
 
     return nullptr;
@@ -68,53 +83,72 @@ Player const* PlayerManager::GetByConnectionId(ConnectionId_t aConnectionId) con
 
 Player* PlayerManager::GetById(uint32_t aId) noexcept
 {
-    auto itor = std::begin(m_players);
-    const auto end = std::end(m_players);
-
-    for (; itor != end; ++itor)
-        if (itor.value()->GetId() == aId)
-            return itor.value().get();
+    const auto itor = m_slotsById.find(aId);
+    if (itor != std::end(m_slotsById))
+        return m_players[itor->second].get();
 
     return nullptr;
 }
 
 Player const* PlayerManager::GetById(uint32_t aId) const noexcept
 {
-    auto itor = std::begin(m_players);
-    const auto end = std::end(m_players);
-
-    for (; itor != end; ++itor)
-        if (itor.value()->GetId() == aId)
-            return itor.value().get();
+    const auto itor = m_slotsById.find(aId);
+    if (itor != std::end(m_slotsById))
+        return m_players[itor->second].get();
 
     return nullptr;
 }
 
 Player* PlayerManager::GetByUsername(const String& acUsername) const noexcept
 {
-    auto itor = std::begin(m_players);
-    const auto end = std::end(m_players);
-
-    for (; itor != end; ++itor)
-        if (itor.value()->GetUsername() == acUsername)
-            return itor.value().get();
-
-    return nullptr;
+    return FindByUsername(acUsername);
 }
 
 Player const* PlayerManager::GetByUsername(const String& acUsername) noexcept
 {
-    auto itor = std::begin(m_players);
-    const auto end = std::end(m_players);
+    return FindByUsername(acUsername);
+}
 
-    for (; itor != end; ++itor)
-        if (itor.value()->GetUsername() == acUsername)
-            return itor.value().get();
+uint32_t PlayerManager::Count() const noexcept
+{
+    return static_cast<uint32_t>(m_players.size());
+}
+
+Player* PlayerManager::FindByUsername(const String& acUsername) const noexcept
+{
+    const auto itor = m_slotsByUsername.find(acUsername);
+    if (itor != std::end(m_slotsByUsername))
+        return m_players[itor->second].get();
 
     return nullptr;
 }
 
-uint32_t PlayerManager::Count() const noexcept
+void PlayerManager::IndexUsername(uint32_t aSlot) noexcept
 {
-    return static_cast<uint32_t>(m_players.size());
+    const auto& cUsername = m_players[aSlot]->GetUsername();
+    if (cUsername.empty())
+        return;
+
+    m_slotsByUsername.emplace(cUsername, aSlot);
+}
+
+void PlayerManager::UnindexUsername(uint32_t aSlot) noexcept
+{
+    const auto cUsername = m_players[aSlot]->GetUsername();
+
+    const auto itor = m_slotsByUsername.find(cUsername);
+    if (itor == std::end(m_slotsByUsername) || itor->second != aSlot)
+        return;
+
+    m_slotsByUsername.erase(itor);
+
+    // Another player may share the name, names only change on join and leave so a scan is cheap enough
+    for (uint32_t i = 0; i < m_players.size(); ++i)
+    {
+        if (i != aSlot && m_players[i]->GetUsername() == cUsername)
+        {
+            m_slotsByUsername.emplace(cUsername, i);
+            break;
+        }
+    }
 }
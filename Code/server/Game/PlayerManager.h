@@ -2,13 +2,15 @@
 
 struct Player;
 
+// Players are kept in a dense array so broadcasts walk contiguous memory, lookups go through hash indexes
+// that map to the player's slot. Slots are compacted on removal, Player pointers themselves stay stable.
 struct PlayerManager
 {
-    using TMap = TiltedPhoques::Map<ConnectionId_t, UniquePtr<Player>>;
+    using TPlayers = Vector<UniquePtr<Player>>;
 
     struct Iterator
     {
-        Iterator(TMap::iterator aItor)
+        Iterator(TPlayers::iterator aItor)
             : m_itor(aItor)
         {
         }
@@ -18,17 +20,15 @@ struct PlayerManager
             return *this;
         }
         bool operator!=(const Iterator& acRhs) const { return m_itor != acRhs.m_itor; }
-        const Player* operator*() const { return m_itor->second.get(); }
-        Player* operator*() { return m_itor.value().get(); }
+        const Player* operator*() const { return m_itor->get(); }
+        Player* operator*() { return m_itor->get(); }
 
     private:
-        TMap::iterator m_itor;
+        TPlayers::iterator m_itor;
     };
 
-    PlayerManager();
-    ~PlayerManager() noexcept;
-
-    static PlayerManager* Get() noexcept;
+    PlayerManager() = default;
+    ~PlayerManager() noexcept = default;
 
     TP_NOCOPYMOVE(PlayerManager);
 
@@ -38,12 +38,16 @@ struct PlayerManager
     Player* Create(ConnectionId_t aConnectionId) noexcept;
     void Remove(Player* apPlayer) noexcept;
 
+    // Renames a player and keeps the username index in sync, use this rather than Player::SetUsername
+    void SetUsername(Player* apPlayer, String aUsername) noexcept;
+
     Player* GetByConnectionId(ConnectionId_t aConnectionId) noexcept;
     Player const* GetByConnectionId(ConnectionId_t aConnectionId) const noexcept;
 
     Player* GetById(uint32_t aId) noexcept;
     Player const* GetById(uint32_t aId) const noexcept;
 
+    // First player that took the name, names are not unique
     Player* GetByUsername(const String& acUsername) const noexcept;
     Player const* GetByUsername(const String& acUsername) noexcept;
 
@@ -51,14 +55,21 @@ struct PlayerManager
 
     template <class T> void ForEach(const T& acFunctor) noexcept
     {
-        auto itor = std::begin(m_players);
-        auto end = std::end(m_players);
-        for (; itor != end; ++itor)
+        for (auto& pPlayer : m_players)
         {
-            acFunctor(itor.value().get());
+            acFunctor(pPlayer.get());
         }
     }
 
 private:
-    TMap m_players;
+    [[nodiscard]] Player* FindByUsername(const String& acUsername) const noexcept;
+
+    void IndexUsername(uint32_t aSlot) noexcept;
+    void UnindexUsername(uint32_t aSlot) noexcept;
+
+    TPlayers m_players;
+    Map<ConnectionId_t, uint32_t> m_slotsByConnection;
+    Map<uint32_t, uint32_t> m_slotsById;
+    // The first player to take a name owns the entry
+    Map<String, uint32_t> m_slotsByUsername;
 };
@@ -0,0 +1,56 @@
+#include "SpawnStream.h"
+
+void SpawnStream::Start(Vector<Entry> aEntries) noexcept
+{
+    m_entries = std::move(aEntries);
+    m_cursor = 0;
+    m_sent = 0;
+
+    m_pending.clear();
+    for (const auto& cEntry : m_entries)
+        m_pending.insert(cEntry.Entity);
+
+    std::stable_sort(std::begin(m_entries), std::end(m_entries), [](const Entry& acLhs, const Entry& acRhs) { return acLhs.DistanceSquared < acRhs.DistanceSquared; });
+}
+
+void SpawnStream::Cancel(entt::entity aEntity) noexcept
+{
+    const auto itor = std::find_if(std::begin(m_entries) + m_cursor, std::end(m_entries), [aEntity](const Entry& acEntry) { return acEntry.Entity == aEntity; });
+
+    if (itor != std::end(m_entries))
+        m_entries.erase(itor);
+
+    m_pending.erase(aEntity);
+}
+
+void SpawnStream::Clear() noexcept
+{
+    m_entries.clear();
+    m_pending.clear();
+    m_cursor = 0;
+    m_sent = 0;
+}
+
+std::optional<entt::entity> SpawnStream::Pop() noexcept
+{
+    if (IsDone())
+        return std::nullopt;
+
+    ++m_sent;
+
+    const auto cEntity = m_entries[m_cursor++].Entity;
+    m_pending.erase(cEntity);
+
+    return cEntity;
+}
+
+void SpawnStream::Unpop() noexcept
+{
+    if (m_cursor == 0)
+        return;
+
+    --m_cursor;
+    --m_sent;
+
+    m_pending.insert(m_entries[m_cursor].Entity);
+}
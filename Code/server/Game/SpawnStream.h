@@ -0,0 +1,46 @@
+#pragma once
+
+/**
+ * @brief Characters a player still has to receive after joining or entering a cell.
+ *
+ * Spawns are handed out nearest first over several ticks instead of all at once, entries that
+ * were already delivered by another path are cancelled so the client never gets them twice.
+ */
+struct SpawnStream
+{
+    struct Entry
+    {
+        entt::entity Entity;
+        float DistanceSquared;
+    };
+
+    SpawnStream() = default;
+    ~SpawnStream() noexcept = default;
+
+    SpawnStream(SpawnStream&&) noexcept = default;
+    SpawnStream& operator=(SpawnStream&&) noexcept = default;
+
+    // Replaces whatever was left of the previous job, the client asked for a new set of cells
+    void Start(Vector<Entry> aEntries) noexcept;
+    // Drops an entity that was spawned or removed through a broadcast in the meantime
+    void Cancel(entt::entity aEntity) noexcept;
+    void Clear() noexcept;
+
+    // Returns the next entity to send or std::nullopt when the job is done
+    [[nodiscard]] std::optional<entt::entity> Pop() noexcept;
+    // Puts back the entity returned by the last Pop, it is the next one sent
+    void Unpop() noexcept;
+
+    // True while the entity is queued, the client doesn't know it yet
+    [[nodiscard]] bool IsPending(entt::entity aEntity) const noexcept { return !m_pending.empty() && m_pending.contains(aEntity); }
+    [[nodiscard]] bool IsDone() const noexcept { return m_cursor >= m_entries.size(); }
+    [[nodiscard]] size_t GetPendingCount() const noexcept { return m_entries.size() - m_cursor; }
+    [[nodiscard]] size_t GetSentCount() const noexcept { return m_sent; }
+
+private:
+    Vector<Entry> m_entries;
+    // Entities from the cursor on, checked for every movement update sent to the player
+    TiltedPhoques::Set<entt::entity> m_pending;
+    size_t m_cursor{0};
+    size_t m_sent{0};
+};
@@ -1,6 +1,9 @@
 ﻿#include <Components.h>
 #include <GameServer.h>
 #include <Packet.hpp>
+#include <AllocationTags.h>
+#include <MessageCompression.h>
+#include <ViewScope.h>
 
 #include <Events/AdminPacketEvent.h>
 #include <Events/CharacterRemoveEvent.h>
@@ -19,15 +22,21 @@
 #include <Messages/NotifyPlayerJoined.h>
 #include <Messages/NotifyPlayerLeft.h>
 #include <Messages/NotifySettingsChange.h>
+#include <Messages/TimeSyncResponse.h>
 #include <console/ConsoleRegistry.h>
 #include <resources/ResourceCollection.h>
 
 constexpr size_t kMaxServerNameLength = 128u;
+// Inbound events handled per tick with the network thread, the rest waits for the next tick
+constexpr size_t kMaxInboundPerTick = 4096u;
 
 // -- Cvars --
 Console::Setting uServerPort{"GameServer:uPort", "Which port to host the server on", 10578u};
 Console::Setting uMaxPlayerCount{"GameServer:uMaxPlayerCount", "Maximum number of players allowed on the server (going over the default of 8 is not recommended)", 8u};
 Console::Setting bPremiumTickrate{"GameServer:bPremiumMode", "Use premium tick rate", true};
+Console::Setting bNetworkThread{"GameServer:bNetworkThread", "Receive and send packets on a dedicated thread", false};
+Console::Setting bBorrowMessageStrings{"GameServer:bBorrowMessageStrings", "Let handled messages read their strings from the receive buffer instead of copying them", true};
+Console::Setting uCompressionThreshold{"GameServer:uCompressionThreshold", "Messages larger than this many bytes are compressed for the clients supporting it, 0 disables compression", 256u};
 
 Console::StringSetting sServerName{"GameServer:sServerName", "Name that shows up in the server list", "Dedicated Together Server"};
 Console::StringSetting sAdminPassword{"GameServer:sAdminPassword", "Admin authentication password", ""};
@@ -146,14 +155,15 @@ ServerSettings GetSettings()
     return settings;
 }
 
-GameServer::GameServer(Console::ConsoleRegistry& aConsole) noexcept
-    : m_lastFrameTime(std::chrono::high_resolution_clock::now())
+GameServer::GameServer(Console::ConsoleRegistry& aConsole, uint32_t aInstanceIndex) noexcept
+    : m_instanceIndex(aInstanceIndex)
+    , m_lastFrameTime(std::chrono::high_resolution_clock::now())
     , m_startTime(std::chrono::high_resolution_clock::now())
     , m_commands(aConsole)
     , m_requestStop(false)
 {
-    BASE_ASSERT(s_pInstance == nullptr, "Server instance already exists?");
-    s_pInstance = this;
+    BASE_ASSERT(s_pInstance == nullptr, "A server instance already runs on this thread");
+    BindToCurrentThread();
 
     auto port = uServerPort.value_as<uint16_t>();
     while (!Host(port, GetUserTickRate()))
@@ -185,17 +195,42 @@ GameServer::GameServer(Console::ConsoleRegistry& aConsole) noexcept
     spdlog::info("Server {} started on port {}", BUILD_COMMIT, GetPort());
     UpdateTitle();
 
-    m_pWorld = MakeUnique<World>();
+    // The timers are advanced with the absolute tick, starting at zero would make every timer overdue on the first update
+    m_pWorld = MakeUnique<World>(GetTick());
 
     BindMessageHandlers();
     UpdateTimeScale();
 
     m_pResources = MakeUnique<Resources::ResourceCollection>();
+
+    if (bNetworkThread)
+    {
+        m_tick.store(Server::GetTick(), std::memory_order_relaxed);
+
+        // Server::Update polls the sockets and ends up in OnConsume, OnConnection and OnDisconnection on that thread
+        m_pNetworkThread = MakeUnique<NetworkThread>(
+            [this]()
+            {
+                Update();
+
+                m_tick.store(Server::GetTick(), std::memory_order_relaxed);
+                m_clientCount.store(Server::GetClientCount(), std::memory_order_relaxed);
+            },
+            [this](NetworkThread::Outbound& aCommand) { ExecuteOutbound(aCommand); },
+            // What the network thread logs belongs to this instance
+            [this]() { m_pWorld->GetAdminService().ClaimCurrentThread(); });
+    }
 }
 
 GameServer::~GameServer()
 {
+    // Joined before the pointer goes away, the polls still running check it
+    if (m_pNetworkThread)
+        m_pNetworkThread->Stop();
+    m_pNetworkThread.reset();
+
     s_pInstance = nullptr;
+    StringCache::SetCurrent(nullptr);
 }
 
 GameServer* GameServer::Get() noexcept
@@ -203,6 +238,12 @@ GameServer* GameServer::Get() noexcept
     return s_pInstance;
 }
 
+void GameServer::BindToCurrentThread() noexcept
+{
+    s_pInstance = this;
+    StringCache::SetCurrent(&m_stringCache);
+}
+
 void GameServer::Initialize()
 {
     if (!CheckMoPo())
@@ -213,6 +254,10 @@ void GameServer::Initialize()
 
     BindServerCommands();
     m_pWorld->GetScriptService().Initialize(*m_pResources);
+
+    // Packets are only received once everything above is in place
+    if (m_pNetworkThread)
+        m_pNetworkThread->Start();
 }
 
 void GameServer::Kill()
@@ -274,6 +319,13 @@ void GameServer::BindMessageHandlers()
         HandleAuthenticationRequest(aConnectionId, pRealMessage);
     };
 
+    // Answered right away, going through the world would add a dispatch to the measured round trip
+    m_messageHandlers[TimeSyncRequest::Opcode] = [this](UniquePtr<ClientMessage>& apMessage, ConnectionId_t aConnectionId)
+    {
+        const auto pRealMessage = CastUnique<TimeSyncRequest>(std::move(apMessage));
+        HandleTimeSyncRequest(aConnectionId, pRealMessage);
+    };
+
     auto adminHandlerGenerator = [this](auto& x)
     {
         using T = typename std::remove_reference_t<decltype(x)>::Type;
@@ -315,7 +367,7 @@ void GameServer::BindServerCommands()
             out->info("<------Players-({})--->", count);
             for (Player* pPlayer : m_pWorld->GetPlayerManager())
             {
-                out->info("{}: {}", pPlayer->GetId(), pPlayer->GetUsername().c_str());
+                out->info("{}: {}, {} ms round trip, {} ms jitter", pPlayer->GetId(), pPlayer->GetUsername().c_str(), pPlayer->GetRoundTripTime(), pPlayer->GetJitter());
             }
         });
 
@@ -353,6 +405,74 @@ void GameServer::BindServerCommands()
             m_pResources->ForEachManifest([&](const auto& aManifest) { out->info("{} -> {}", aManifest.Name.c_str(), aManifest.Description.c_str()); });
         });
 
+    m_commands.RegisterCommand<>(
+        "stats", "Show network statistics",
+        [&](Console::ArgStack&)
+        {
+            auto out = spdlog::get("ConOut");
+
+            const auto& movementStats = m_pWorld->GetCharacterService().GetMovementStats();
+            const auto movementTotal = movementStats.SentUpdates + movementStats.SuppressedUpdates;
+            const auto suppressedRatio = movementTotal ? 100.0 * static_cast<double>(movementStats.SuppressedUpdates) / static_cast<double>(movementTotal) : 0.0;
+
+            out->info("<------Stats--->");
+            out->info("Movement updates: {} sent, {} suppressed ({:.1f}%)", movementStats.SentUpdates, movementStats.SuppressedUpdates, suppressedRatio);
+
+            const auto& spawnCacheStats = m_pWorld->GetCharacterService().GetSpawnCacheStats();
+            const auto spawnTotal = spawnCacheStats.Hits + spawnCacheStats.Misses;
+            const auto hitRatio = spawnTotal ? 100.0 * static_cast<double>(spawnCacheStats.Hits) / static_cast<double>(spawnTotal) : 0.0;
+
+            out->info("Spawn cache: {} hits, {} misses ({:.1f}% hit rate), {} invalidations", spawnCacheStats.Hits, spawnCacheStats.Misses, hitRatio, spawnCacheStats.Invalidations);
+
+            const auto& persistenceService = m_pWorld->GetPersistenceService();
+            if (persistenceService.IsEnabled())
+            {
+                const auto& store = persistenceService.GetStore();
+                const auto storeStats = store.GetStats();
+
+                out->info("Persistence: {} changes ({} coalesced), {} pending, {} records written in {} transactions, {} failed transactions, {} deferred flushes", storeStats.Changes,
+                          storeStats.Coalesced, store.GetPendingCount(), storeStats.WrittenRecords, storeStats.Transactions, storeStats.FailedTransactions, storeStats.DeferredFlushes);
+                out->info("Persistence: {} saved objects", persistenceService.GetSavedObjectCount());
+            }
+
+            const auto compressedRatio = m_compressionStats.RawBytes ? 100.0 * static_cast<double>(m_compressionStats.CompressedBytes) / static_cast<double>(m_compressionStats.RawBytes) : 0.0;
+            if (m_pNetworkThread)
+            {
+                out->info("Network thread: {} inbound packets dropped, {} outbound commands kept back, {} still waiting", m_pNetworkThread->GetDroppedInbound(),
+                          m_pNetworkThread->GetOutboundOverflows(), m_pNetworkThread->GetOutboundBacklog());
+            }
+
+            out->info("Compression: {} messages, {} KiB down to {} KiB ({:.1f}%)", m_compressionStats.Messages, m_compressionStats.RawBytes / 1024, m_compressionStats.CompressedBytes / 1024, compressedRatio);
+
+            out->info("Allocator: {} backend", Base::GetAllocatorBackendName());
+            Base::TrackingAllocator::ForEach(
+                [&out](Base::TrackingAllocator& aAllocator)
+                {
+                    const auto cStats = aAllocator.GetStats();
+                    out->info("Allocations {}: {} allocations, {} KiB", aAllocator.GetName(), cStats.Allocations, cStats.Bytes / 1024);
+                });
+
+            const auto& timers = m_pWorld->GetTimers();
+            out->info("Timers: {} scheduled", timers.GetCount());
+            timers.ForEachTimer(
+                [&out](const char* apName, uint64_t aPeriodMs, const Timing::TimerStats& acStats)
+                {
+                    // One shot timers come and go, only the periodic work is worth following
+                    if (aPeriodMs == 0)
+                        return;
+
+                    out->info("Timer {}: every {}ms, {} runs, {:.1f}ms average lateness, {}ms max, {} overruns", apName, aPeriodMs, acStats.Fires, acStats.GetAverageLatenessMs(), acStats.MaxLatenessMs,
+                              acStats.Overruns);
+                });
+
+            for (const auto* pPlayer : m_pWorld->GetPlayerManager())
+            {
+                const auto& spawnStream = pPlayer->GetSpawnStream();
+                if (!spawnStream.IsDone())
+                    out->info("Spawn stream of {}: {} sent, {} pending", pPlayer->GetUsername().c_str(), spawnStream.GetSentCount(), spawnStream.GetPendingCount());
+            }
+        });
+
     m_commands.RegisterCommand<>("quit", "Stop the server", [&](Console::ArgStack&) { Kill(); });
 
     m_commands.RegisterCommand<int64_t, int64_t>(
@@ -412,7 +532,7 @@ void GameServer::BindServerCommands()
                 return;
             }
 
-            auto* pPlayer = PlayerManager::Get()->GetByUsername(cUsername);
+            auto* pPlayer = m_pWorld->GetPlayerManager().GetByUsername(cUsername);
             if (pPlayer)
             {
                 AddAdminSession(pPlayer->GetConnectionId());
@@ -422,7 +542,7 @@ void GameServer::BindServerCommands()
             {
                 // retry after sanitizing username
                 String backupUsername = SanitizeUsername(cUsername);
-                pPlayer = PlayerManager::Get()->GetByUsername(backupUsername);
+                pPlayer = m_pWorld->GetPlayerManager().GetByUsername(backupUsername);
 
                 if (pPlayer)
                 {
@@ -482,7 +602,7 @@ void GameServer::BindServerCommands()
 
             for (const auto& cAdminSession : m_adminSessions)
             {
-                auto* pPlayer = PlayerManager::Get()->GetByConnectionId(cAdminSession);
+                auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(cAdminSession);
 
                 if (!pPlayer)
                 {
@@ -542,7 +662,53 @@ void GameServer::UpdateTimeScale()
     }
 }
 
+void GameServer::Tick()
+{
+    if (!m_pNetworkThread)
+    {
+        Update();
+        return;
+    }
+
+    m_pNetworkThread->FlushOutbound();
+
+    m_pNetworkThread->DrainInbound(
+        [this](NetworkThread::Inbound& aEvent)
+        {
+            switch (aEvent.EventType)
+            {
+            case NetworkThread::Inbound::kMessage: HandlePacket(aEvent.Packet.data(), static_cast<uint32_t>(aEvent.Packet.size()), aEvent.ConnectionId); break;
+            case NetworkThread::Inbound::kConnection: HandleConnection(aEvent.ConnectionId); break;
+            case NetworkThread::Inbound::kDisconnection: HandleDisconnection(aEvent.ConnectionId, aEvent.Reason); break;
+            }
+        },
+        kMaxInboundPerTick);
+
+    UpdateWorld();
+}
+
+void GameServer::Kick(ConnectionId_t aConnectionId)
+{
+    if (!m_pNetworkThread)
+    {
+        Server::Kick(aConnectionId);
+        return;
+    }
+
+    NetworkThread::Outbound command{NetworkThread::Outbound::kKick, aConnectionId};
+    m_pNetworkThread->PushOutbound(command);
+}
+
 void GameServer::OnUpdate()
+{
+    // The game thread runs the world from Tick
+    if (m_pNetworkThread)
+        return;
+
+    UpdateWorld();
+}
+
+void GameServer::UpdateWorld()
 {
     const auto cNow = std::chrono::high_resolution_clock::now();
     const auto cDelta = cNow - m_lastFrameTime;
@@ -550,19 +716,63 @@ void GameServer::OnUpdate()
 
     const auto cDeltaSeconds = std::chrono::duration_cast<std::chrono::duration<float>>(cDelta).count();
 
+    m_pWorld->GetTimers().Advance(GetTick());
+
     auto& dispatcher = m_pWorld->GetDispatcher();
 
     dispatcher.trigger(UpdateEvent{cDeltaSeconds});
 
     if (m_requestStop)
+    {
+        // Sends what is still queued, the sockets can't be closed under a running poll
+        if (m_pNetworkThread)
+            m_pNetworkThread->Stop();
+        m_pNetworkThread.reset();
+
         Close();
+    }
+}
+
+uint64_t GameServer::GetTick() const noexcept
+{
+    if (m_pNetworkThread)
+        return m_tick.load(std::memory_order_relaxed);
+
+    return Server::GetTick();
+}
+
+uint32_t GameServer::GetClientCount() const noexcept
+{
+    if (m_pNetworkThread)
+        return m_clientCount.load(std::memory_order_relaxed);
+
+    return Server::GetClientCount();
 }
 
 void GameServer::OnConsume(const void* apData, const uint32_t aSize, const ConnectionId_t aConnectionId)
+{
+    if (m_pNetworkThread)
+    {
+        const auto* pData = static_cast<const uint8_t*>(apData);
+
+        NetworkThread::Inbound event{NetworkThread::Inbound::kMessage, aConnectionId, {}, Vector<uint8_t>(pData, pData + aSize)};
+        m_pNetworkThread->PushInbound(event);
+        return;
+    }
+
+    HandlePacket(apData, aSize, aConnectionId);
+}
+
+void GameServer::HandlePacket(const void* apData, const uint32_t aSize, const ConnectionId_t aConnectionId)
 {
     ViewBuffer buf((uint8_t*)apData, aSize);
     Buffer::Reader reader(&buf);
 
+    // Messages can borrow their strings from apData, it outlives the handler
+    std::optional<ViewScope> views;
+    if (bBorrowMessageStrings)
+        views.emplace(apData, aSize);
+
     // TODO: ClientAdminMessageFactory
     /*if (m_adminSessions.contains(aConnectionId)) [[unlikely]]
     {
@@ -578,27 +788,63 @@ void GameServer::OnConsume(const void* apData, const uint32_t aSize, const Conne
     }
     else
     {*/
-    const ClientMessageFactory factory;
-    auto pMessage = factory.Extract(reader);
+    UniquePtr<ClientMessage> pMessage;
+    {
+        Base::AllocationScope _(AllocationTags::Encoding);
+
+        const ClientMessageFactory factory;
+        pMessage = factory.Extract(reader);
+    }
+
     if (!pMessage)
     {
         spdlog::error("Couldn't parse packet from {:x}", aConnectionId);
         return;
     }
 
-    m_messageHandlers[pMessage->GetOpcode()](pMessage, aConnectionId);
+    HandleMessage(pMessage, aConnectionId);
     //}
 }
 
 void GameServer::OnConnection(const ConnectionId_t aHandle)
 {
-    spdlog::info("Connection received {:x}", aHandle);
-    UpdateTitle();
+    if (m_pNetworkThread)
+    {
+        NetworkThread::Inbound event{NetworkThread::Inbound::kConnection, aHandle};
+        m_pNetworkThread->PushInbound(event);
+        return;
+    }
+
+    HandleConnection(aHandle);
 }
 
 void GameServer::OnDisconnection(const ConnectionId_t aConnectionId, EDisconnectReason aReason)
 {
-    m_adminSessions.erase(aConnectionId);
+    if (m_pNetworkThread)
+    {
+        NetworkThread::Inbound event{NetworkThread::Inbound::kDisconnection, aConnectionId, aReason};
+        m_pNetworkThread->PushInbound(event);
+        return;
+    }
+
+    HandleDisconnection(aConnectionId, aReason);
+}
+
+void GameServer::HandleMessage(UniquePtr<ClientMessage>& apMessage, ConnectionId_t aConnectionId)
+{
+    m_messageHandlers[apMessage->GetOpcode()](apMessage, aConnectionId);
+}
+
+void GameServer::HandleConnection(ConnectionId_t aConnectionId)
+{
+    spdlog::info("Connection received {:x}", aConnectionId);
+    UpdateTitle();
+}
+
+void GameServer::HandleDisconnection(ConnectionId_t aConnectionId, EDisconnectReason aReason)
+{
+    RemoveAdminSession(aConnectionId);
+    m_compressedConnections.erase(aConnectionId);
 
     auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(aConnectionId);
 
@@ -611,7 +857,7 @@ void GameServer::OnDisconnection(const ConnectionId_t aConnectionId, EDisconnect
         if (const auto& cell = pPlayer->GetCellComponent())
         {
             const auto oldCell = cell.Cell;
-            pPlayer->SetCellComponent(CellIdComponent{{}, {}, {}});
+            m_pWorld->GetMulticastGroups().SetPlayerCell(pPlayer, CellIdComponent{{}, {}, {}});
             m_pWorld->GetDispatcher().trigger(PlayerLeaveCellEvent(oldCell));
         }
 
@@ -624,9 +870,8 @@ void GameServer::OnDisconnection(const ConnectionId_t aConnectionId, EDisconnect
 
         entt::entity playerCharacter = pPlayer->GetCharacter().value_or(static_cast<entt::entity>(0));
 
-        // Cleanup all entities that we own
-        auto ownerView = m_pWorld->view<OwnerComponent>();
-        for (auto entity : ownerView)
+        // Cleanup all entities that we own, the events are only queued so the list doesn't change under us
+        for (auto entity : m_pWorld->GetOwnershipIndex().GetEntities(pPlayer))
         {
             if (entity == playerCharacter)
             {
@@ -634,62 +879,161 @@ void GameServer::OnDisconnection(const ConnectionId_t aConnectionId, EDisconnect
                 continue;
             }
 
-            const auto& [ownerComponent] = ownerView.get(entity);
-            if (ownerComponent.GetOwner() == pPlayer)
-            {
-                m_pWorld->GetDispatcher().enqueue(OwnershipTransferEvent(entity));
-            }
+            m_pWorld->GetDispatcher().enqueue(OwnershipTransferEvent(entity));
         }
 
         m_pWorld->GetDispatcher().update();
 
+        m_pWorld->GetMulticastGroups().LeaveAll(aConnectionId);
         m_pWorld->GetPlayerManager().Remove(pPlayer);
     }
 
     UpdateTitle();
 }
 
-void GameServer::Send(const ConnectionId_t aConnectionId, const ServerMessage& acServerMessage) const
+uint32_t GameServer::Send(const ConnectionId_t aConnectionId, const ServerMessage& acServerMessage) const
 {
     static thread_local TiltedPhoques::ScratchAllocator s_allocator{1 << 18};
 
-    Buffer buffer(1 << 20);
+    Base::AllocationScope _(AllocationTags::Encoding);
+
+    // The bound is exact, nothing else is reserved for the packet
+    Buffer buffer(1 + acServerMessage.SerializedSizeBound());
     Buffer::Writer writer(&buffer);
     writer.WriteBits(0, 8); // Skip the first byte as it is used by packet
 
     acServerMessage.Serialize(writer);
 
-    TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()), static_cast<uint32_t>(writer.Size()));
-    Server::Send(aConnectionId, &packet);
+    const auto cSize = static_cast<uint32_t>(writer.Size());
+
+    OutgoingPacket packet{buffer, cSize};
+    SendPacket(aConnectionId, packet);
 
     s_allocator.Reset();
+
+    return cSize;
 }
 
 void GameServer::Send(ConnectionId_t aConnectionId, const ServerAdminMessage& acServerMessage) const
 {
     static thread_local TiltedPhoques::ScratchAllocator s_allocator{1 << 18};
 
+    Base::AllocationScope _(AllocationTags::Encoding);
+
     Buffer buffer(1 << 20);
     Buffer::Writer writer(&buffer);
     writer.WriteBits(0, 8); // Skip the first byte as it is used by packet
 
     acServerMessage.Serialize(writer);
 
-    TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()), static_cast<uint32_t>(writer.Size()));
-    Server::Send(aConnectionId, &packet);
+    OutgoingPacket packet{buffer, static_cast<uint32_t>(writer.Size())};
+    SendPacket(aConnectionId, packet);
 
     s_allocator.Reset();
 }
 
-void GameServer::SendToLoaded(const ServerMessage& acServerMessage) const
+void GameServer::SendPacket(ConnectionId_t aConnectionId, OutgoingPacket& aPacket) const
 {
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
+    if (m_compressedConnections.contains(aConnectionId))
     {
-        if (pPlayer->GetCellComponent())
-            pPlayer->Send(acServerMessage);
+        if (!aPacket.CompressionTried)
+            CompressPacket(aPacket);
+
+        // The compressed buffer is already a shared copy, the network thread can use it as is
+        if (aPacket.pCompressed)
+        {
+            if (!m_pNetworkThread)
+            {
+                TiltedPhoques::PacketView packet(reinterpret_cast<char*>(aPacket.pCompressed->GetWriteData()), aPacket.CompressedSize);
+                Server::Send(aConnectionId, &packet);
+                return;
+            }
+
+            NetworkThread::Outbound command{NetworkThread::Outbound::kPacket, aConnectionId, aPacket.pCompressed, aPacket.CompressedSize};
+            m_pNetworkThread->PushOutbound(command);
+            return;
+        }
+    }
+
+    if (!m_pNetworkThread)
+    {
+        TiltedPhoques::PacketView packet(reinterpret_cast<char*>(aPacket.Data.GetWriteData()), aPacket.Size);
+        Server::Send(aConnectionId, &packet);
+        return;
+    }
+
+    // The network thread sends it later, it gets its own copy shared by all the recipients
+    if (!aPacket.pCopy)
+    {
+        aPacket.pCopy = MakeShared<Buffer>(aPacket.Size);
+        std::memcpy(aPacket.pCopy->GetWriteData(), aPacket.Data.GetWriteData(), aPacket.Size);
+    }
+
+    NetworkThread::Outbound command{NetworkThread::Outbound::kPacket, aConnectionId, aPacket.pCopy, aPacket.Size};
+    m_pNetworkThread->PushOutbound(command);
+}
+
+void GameServer::CompressPacket(OutgoingPacket& aPacket) const
+{
+    aPacket.CompressionTried = true;
+
+    // The first byte belongs to the packet, the message starts after it
+    const auto cMessageSize = aPacket.Size - 1;
+    if (cMessageSize <= uCompressionThreshold.value_as<uint32_t>())
+        return;
+
+    auto pCompressed = MakeShared<Buffer>(1 + MessageCompression::GetMaxEnvelopeSize(cMessageSize));
+    const auto cEnvelopeSize = MessageCompression::Compress(aPacket.Data.GetData() + 1, cMessageSize, pCompressed->GetWriteData() + 1, pCompressed->GetSize() - 1);
+    if (cEnvelopeSize == 0)
+        return;
+
+    aPacket.pCompressed = std::move(pCompressed);
+    aPacket.CompressedSize = static_cast<uint32_t>(1 + cEnvelopeSize);
+
+    ++m_compressionStats.Messages;
+    m_compressionStats.RawBytes += cMessageSize;
+    m_compressionStats.CompressedBytes += cEnvelopeSize;
+}
+
+void GameServer::ExecuteOutbound(NetworkThread::Outbound& aCommand)
+{
+    if (aCommand.CommandType == NetworkThread::Outbound::kKick)
+    {
+        Server::Kick(aCommand.ConnectionId);
+        return;
+    }
+
+    TiltedPhoques::PacketView packet(reinterpret_cast<char*>(aCommand.pData->GetWriteData()), aCommand.Size);
+    Server::Send(aCommand.ConnectionId, &packet);
+}
+
+template <class T> void GameServer::Multicast(const ServerMessage& acServerMessage, const MulticastGroups::TMembers& acMembers, const T& acFilter) const
+{
+    if (acMembers.empty())
+        return;
+
+    Base::AllocationScope _(AllocationTags::Encoding);
+
+    Buffer buffer(1 + acServerMessage.SerializedSizeBound());
+    Buffer::Writer writer(&buffer);
+    writer.WriteBits(0, 8); // Skip the first byte as it is used by packet
+
+    acServerMessage.Serialize(writer);
+
+    OutgoingPacket packet{buffer, static_cast<uint32_t>(writer.Size())};
+
+    for (const auto cConnectionId : acMembers)
+    {
+        if (acFilter(cConnectionId))
+            SendPacket(cConnectionId, packet);
     }
 }
 
+void GameServer::SendToLoaded(const ServerMessage& acServerMessage) const
+{
+    Multicast(acServerMessage, m_pWorld->GetMulticastGroups().GetMembers(MulticastGroupId::Loaded()), [](ConnectionId_t) { return true; });
+}
+
 void GameServer::SendToPlayers(const ServerMessage& acServerMessage, const Player* apExcludedPlayer) const
 {
     for (Player* pPlayer : m_pWorld->GetPlayerManager())
@@ -723,12 +1067,29 @@ bool GameServer::SendToPlayersInRange(const ServerMessage& acServerMessage, cons
     if (const auto* characterComponent = m_pWorld->try_get<CharacterComponent>(acOrigin))
         isDragon = characterComponent->IsDragon();
 
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
+    // Only the players in the same interior cell or worldspace can be in range
+    const auto cGroup = MulticastGroupId::ForCell(cellComponent);
+    if (!cGroup)
     {
-        if (cellComponent.IsInRange(pPlayer->GetCellComponent(), isDragon) && pPlayer != apExcludedPlayer)
-            pPlayer->Send(acServerMessage);
+        // No cell yet, the players that can match don't have one either so they aren't in any cell group
+        for (Player* pPlayer : m_pWorld->GetPlayerManager())
+        {
+            if (cellComponent.IsInRange(pPlayer->GetCellComponent(), isDragon) && pPlayer != apExcludedPlayer)
+                pPlayer->Send(acServerMessage);
+        }
+
+        return true;
     }
 
+    const auto& playerManager = m_pWorld->GetPlayerManager();
+    Multicast(
+        acServerMessage, m_pWorld->GetMulticastGroups().GetMembers(*cGroup),
+        [&](ConnectionId_t aConnectionId)
+        {
+            const auto* pPlayer = playerManager.GetByConnectionId(aConnectionId);
+            return pPlayer && pPlayer != apExcludedPlayer && cellComponent.IsInRange(pPlayer->GetCellComponent(), isDragon);
+        });
+
     return true;
 }
 
@@ -740,17 +1101,7 @@ void GameServer::SendToParty(const ServerMessage& acServerMessage, const PartyCo
         return;
     }
 
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
-    {
-        if (pPlayer == apExcludeSender)
-            continue;
-
-        const auto& partyComponent = pPlayer->GetParty();
-        if (partyComponent.JoinedPartyId == acPartyComponent.JoinedPartyId)
-        {
-            pPlayer->Send(acServerMessage);
-        }
-    }
+    SendToGroup(MulticastGroupId::Party(*acPartyComponent.JoinedPartyId), acServerMessage, apExcludeSender);
 }
 
 void GameServer::SendToPartyInRange(const ServerMessage& acServerMessage, const PartyComponent& acPartyComponent, const entt::entity acOrigin, const Player* apExcludeSender) const
@@ -772,19 +1123,33 @@ void GameServer::SendToPartyInRange(const ServerMessage& acServerMessage, const
 
     const auto& cellComponent = view.get<CellIdComponent>(*it);
 
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
-    {
-        if (pPlayer == apExcludeSender)
-            continue;
+    const auto& playerManager = m_pWorld->GetPlayerManager();
+    Multicast(
+        acServerMessage, m_pWorld->GetMulticastGroups().GetMembers(MulticastGroupId::Party(*acPartyComponent.JoinedPartyId)),
+        [&](ConnectionId_t aConnectionId)
+        {
+            const auto* pPlayer = playerManager.GetByConnectionId(aConnectionId);
+            return pPlayer && pPlayer != apExcludeSender && cellComponent.IsInRange(pPlayer->GetCellComponent(), false);
+        });
+}
 
-        if (!cellComponent.IsInRange(pPlayer->GetCellComponent(), false))
-            continue;
+void GameServer::SendToGroup(const MulticastGroupId& acGroup, const ServerMessage& acServerMessage, const Player* apExcludeSender) const
+{
+    const auto cExcluded = apExcludeSender ? std::optional(apExcludeSender->GetConnectionId()) : std::nullopt;
 
-        if (pPlayer->GetParty().JoinedPartyId != acPartyComponent.JoinedPartyId)
-            continue;
+    Multicast(acServerMessage, m_pWorld->GetMulticastGroups().GetMembers(acGroup), [cExcluded](ConnectionId_t aConnectionId) { return aConnectionId != cExcluded; });
+}
 
-        pPlayer->Send(acServerMessage);
-    }
+void GameServer::AddAdminSession(ConnectionId_t acSession) noexcept
+{
+    m_adminSessions.insert(acSession);
+    m_pWorld->GetMulticastGroups().Join(MulticastGroupId::Admins(), acSession);
+}
+
+void GameServer::RemoveAdminSession(ConnectionId_t acSession) noexcept
+{
+    m_adminSessions.erase(acSession);
+    m_pWorld->GetMulticastGroups().Leave(MulticastGroupId::Admins(), acSession);
 }
 
 static String PrettyPrintModList(const Vector<Mods::Entry>& acMods)
@@ -805,6 +1170,25 @@ bool GameServer::ValidateAuthParams(ConnectionId_t aConnectionId, const UniquePt
     return false;
 }
 
+void GameServer::HandleTimeSyncRequest(const ConnectionId_t aConnectionId, const UniquePtr<TimeSyncRequest>& acRequest)
+{
+    // Only answered once the connection authenticated, anyone could use the server to probe or flood otherwise
+    auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(aConnectionId);
+    if (!pPlayer)
+        return;
+
+    pPlayer->SetLinkStats(acRequest->RoundTripTime, acRequest->Jitter);
+
+    // Stamped when handled rather than when received, the wait for the tick counts as outbound delay. Clients
+    // keep the exchanges with the shortest round trip, those barely waited.
+    TimeSyncResponse response;
+    response.ClientTick = acRequest->ClientTick;
+    response.ServerReceiveTick = GetTick();
+    response.ServerSendTick = response.ServerReceiveTick;
+
+    Send(aConnectionId, response);
+}
+
 void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId, const UniquePtr<AuthenticationRequest>& acRequest)
 {
     const auto info = GetConnectionInfo(aConnectionId);
@@ -833,6 +1217,9 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
     }
 #endif
 
+    if (uCompressionThreshold.value_as<uint32_t>() > 0 && (acRequest->Capabilities & AuthenticationRequest::kCompressedMessages))
+        m_compressedConnections.insert(aConnectionId);
+
     if (m_pWorld->GetPlayerManager().Count() >= uMaxPlayerCount.value_as<uint32_t>())
     {
         sendKick(RT::kServerFull);
@@ -865,7 +1252,7 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
     {
         if (adminPasswordUsed)
         {
-            m_adminSessions.insert(aConnectionId);
+            AddAdminSession(aConnectionId);
             spdlog::warn("New admin session for {:x} '{}'", aConnectionId, remoteAddress);
         }
 
@@ -943,10 +1330,11 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
         Player* pPlayer = m_pWorld->GetPlayerManager().Create(aConnectionId);
         pPlayer->SetEndpoint(remoteAddress);
         pPlayer->SetDiscordId(acRequest->DiscordId);
-        pPlayer->SetUsername(std::move(acRequest->Username));
+        m_pWorld->GetPlayerManager().SetUsername(pPlayer, std::move(acRequest->Username));
         pPlayer->SetMods(playerMods);
         pPlayer->SetModIds(playerModsIds);
         pPlayer->SetLevel(acRequest->Level);
+        pPlayer->SetCapabilities(acRequest->Capabilities);
 
         // this event is shit, needs to be fixed, i know
         auto [canceled, reason] = m_pWorld->GetScriptService().HandlePlayerJoin(aConnectionId);
@@ -1049,9 +1437,10 @@ void GameServer::UpdateTitle() const
 
 Player* GameServer::GetAdminByUsername(const String& acUsername) const noexcept
 {
+    // Names are not unique, the username index only knows the first player to take one
     for (auto session : m_adminSessions)
     {
-        if (auto* pPlayer = PlayerManager::Get()->GetByConnectionId(session))
+        if (auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(session))
         {
             if (pPlayer->GetUsername() == acUsername)
                 return pPlayer;
@@ -1063,16 +1452,7 @@ Player* GameServer::GetAdminByUsername(const String& acUsername) const noexcept
 
 Player const* GameServer::GetAdminByUsername(const String& acUsername) noexcept
 {
-    for (auto session : m_adminSessions)
-    {
-        if (auto const* pPlayer = PlayerManager::Get()->GetByConnectionId(session))
-        {
-            if (pPlayer->GetUsername() == acUsername)
-                return pPlayer;
-        }
-    }
-
-    return nullptr;
+    return std::as_const(*this).GetAdminByUsername(acUsername);
 }
 
 String GameServer::SanitizeUsername(const String& acUsername) const noexcept
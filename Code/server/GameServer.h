@@ -2,8 +2,11 @@
 
 #include <AdminMessages/Message.h>
 #include <Messages/AuthenticationRequest.h>
+#include <Messages/TimeSyncRequest.h>
 #include <Messages/Message.h>
 #include <World.h>
+#include <NetworkThread.h>
+#include <StringCache.h>
 
 using TiltedPhoques::ConnectionId_t;
 using TiltedPhoques::Server;
@@ -35,15 +38,24 @@ struct GameServer final : Server
         uint16_t tick_rate;
     };
 
-    GameServer(Console::ConsoleRegistry& aConsole) noexcept;
+    // aInstanceIndex tells the servers of one process apart, 0 for the first one
+    GameServer(Console::ConsoleRegistry& aConsole, uint32_t aInstanceIndex) noexcept;
     virtual ~GameServer();
 
     TP_NOCOPYMOVE(GameServer);
 
+    // Several servers can run in one process, each on its own thread. Returns the one running on the calling thread.
     static GameServer* Get() noexcept;
 
     void Initialize();
     void Kill();
+    // Runs one server tick, with GameServer:bNetworkThread the packets were already received on the network thread
+    void Tick();
+    // Hides Server::Kick so kicks are ordered with the packets sent before them
+    void Kick(ConnectionId_t aConnectionId);
+    // Hide the Server ones, with GameServer:bNetworkThread they return what the network thread saw after its last poll
+    [[nodiscard]] uint64_t GetTick() const noexcept;
+    [[nodiscard]] uint32_t GetClientCount() const noexcept;
 
     bool CheckMoPo();
     void BindMessageHandlers();
@@ -54,22 +66,30 @@ struct GameServer final : Server
     void UpdateSettings();
 
     // Packet dispatching
-    void Send(ConnectionId_t aConnectionId, const ServerMessage& acServerMessage) const;
+    // Returns the size of the packet handed to the connection
+    uint32_t Send(ConnectionId_t aConnectionId, const ServerMessage& acServerMessage) const;
     void Send(ConnectionId_t aConnectionId, const ServerAdminMessage& acServerMessage) const;
     void SendToLoaded(const ServerMessage& acServerMessage) const;
     void SendToPlayers(const ServerMessage& acServerMessage, const Player* apExcludeSender = nullptr) const;
     bool SendToPlayersInRange(const ServerMessage& acServerMessage, const entt::entity acOrigin, const Player* apExcludeSender = nullptr) const;
     void SendToParty(const ServerMessage& acServerMessage, const PartyComponent& acPartyComponent, const Player* apExcludeSender = nullptr) const;
     void SendToPartyInRange(const ServerMessage& acServerMessage, const PartyComponent& acPartyComponent, const entt::entity acOrigin, const Player* apExcludeSender = nullptr) const;
+    void SendToGroup(const MulticastGroupId& acGroup, const ServerMessage& acServerMessage, const Player* apExcludeSender = nullptr) const;
 
     const Info& GetInfo() const noexcept { return m_info; }
+    // Stable from one run to the next unlike the port, which is whatever was free
+    [[nodiscard]] uint32_t GetInstanceIndex() const noexcept { return m_instanceIndex; }
 
     bool IsRunning() const noexcept { return !m_requestStop; }
     bool IsPasswordProtected() const noexcept { return m_isPasswordProtected; }
 
     template <class T> void ForEachAdmin(const T& aFunctor)
     {
-        for (auto id : m_adminSessions)
+        // Logs can still come in while the world is torn down
+        if (!m_pWorld)
+            return;
+
+        for (auto id : m_pWorld->GetMulticastGroups().GetMembers(MulticastGroupId::Admins()))
             aFunctor(id);
     }
 
@@ -86,9 +106,9 @@ struct GameServer final : Server
 
     [[nodiscard]] const TiltedPhoques::Set<ConnectionId_t>& GetAdminSessions() const noexcept { return m_adminSessions; }
 
-    void AddAdminSession(ConnectionId_t acSession) noexcept { m_adminSessions.insert(acSession); }
+    void AddAdminSession(ConnectionId_t acSession) noexcept;
 
-    void RemoveAdminSession(ConnectionId_t acSession) noexcept { m_adminSessions.erase(acSession); }
+    void RemoveAdminSession(ConnectionId_t acSession) noexcept;
 
     Player* GetAdminByUsername(const String& acUsername) const noexcept;
     Player const* GetAdminByUsername(const String& acUsername) noexcept;
@@ -96,6 +116,7 @@ struct GameServer final : Server
 protected:
     bool ValidateAuthParams(ConnectionId_t aConnectionId, const UniquePtr<AuthenticationRequest>& acRequest);
     void HandleAuthenticationRequest(ConnectionId_t aConnectionId, const UniquePtr<AuthenticationRequest>& acRequest);
+    void HandleTimeSyncRequest(ConnectionId_t aConnectionId, const UniquePtr<TimeSyncRequest>& acRequest);
 
     // Implement TiltedPhoques::Server
     void OnUpdate() override;
@@ -103,11 +124,41 @@ protected:
     void OnConnection(ConnectionId_t aHandle) override;
     void OnDisconnection(ConnectionId_t aConnectionId, EDisconnectReason aReason) override;
 
+    void UpdateWorld();
+    // Decodes and handles a received packet, on the game thread
+    void HandlePacket(const void* apData, uint32_t aSize, ConnectionId_t aConnectionId);
+    void HandleMessage(UniquePtr<ClientMessage>& apMessage, ConnectionId_t aConnectionId);
+    void HandleConnection(ConnectionId_t aConnectionId);
+    void HandleDisconnection(ConnectionId_t aConnectionId, EDisconnectReason aReason);
+
 private:
     void UpdateTitle() const;
+    // Makes this instance the one Get() and StringCache::Get() return on the calling thread
+    void BindToCurrentThread() noexcept;
+    // A serialized message on its way to one or more connections, the copies it needs are made on first use and shared by the recipients
+    struct OutgoingPacket
+    {
+        Buffer& Data;
+        uint32_t Size;
+        // Copy handed to the network thread
+        TiltedPhoques::SharedPtr<Buffer> pCopy{};
+        // Envelope for the connections that negotiated compression, stays null when compressing doesn't pay off
+        TiltedPhoques::SharedPtr<Buffer> pCompressed{};
+        uint32_t CompressedSize{0};
+        bool CompressionTried{false};
+    };
+
+    // Sends right away or through the network thread, compressed when the connection supports it
+    void SendPacket(ConnectionId_t aConnectionId, OutgoingPacket& aPacket) const;
+    void CompressPacket(OutgoingPacket& aPacket) const;
+    // Network thread only
+    void ExecuteOutbound(NetworkThread::Outbound& aCommand);
+    // Serializes the message once and sends it to the members the filter accepts
+    template <class T> void Multicast(const ServerMessage& acServerMessage, const MulticastGroups::TMembers& acMembers, const T& acFilter) const;
     String SanitizeUsername(const String& acUsername) const noexcept;
 
 private:
+    uint32_t m_instanceIndex;
     std::chrono::high_resolution_clock::time_point m_startTime;
     std::chrono::high_resolution_clock::time_point m_lastFrameTime;
     std::function<void(UniquePtr<ClientMessage>&, ConnectionId_t)> m_messageHandlers[kClientOpcodeMax];
@@ -120,11 +171,27 @@ private:
     Console::ConsoleRegistry& m_commands;
 
     TiltedPhoques::Set<ConnectionId_t> m_adminSessions;
+    // Connections that asked for large messages to be compressed at authentication
+    TiltedPhoques::Set<ConnectionId_t> m_compressedConnections;
+    struct CompressionStats
+    {
+        uint64_t Messages{0};
+        uint64_t RawBytes{0};
+        uint64_t CompressedBytes{0};
+    };
+    mutable CompressionStats m_compressionStats{};
     TiltedPhoques::Map<ConnectionId_t, entt::entity> m_connectionToEntity;
 
+    // Declared before the world, its services fill it. Only bound and used on the game thread.
+    StringCache m_stringCache;
     UniquePtr<World> m_pWorld;
+    UniquePtr<NetworkThread> m_pNetworkThread;
+    // Written by the network thread after each poll
+    std::atomic<uint64_t> m_tick{0};
+    std::atomic<uint32_t> m_clientCount{0};
 
-    bool m_requestStop;
+    // Set from whichever thread asks for the shutdown
+    std::atomic<bool> m_requestStop;
 
-    static inline GameServer* s_pInstance = nullptr;
+    static inline thread_local GameServer* s_pInstance = nullptr;
 };
@@ -0,0 +1,121 @@
+#include "NetworkThread.h"
+
+#include <base/threading/ThreadUtils.h>
+
+namespace
+{
+// Longest the sockets go without being polled when nothing has to be sent
+constexpr auto kPollInterval = 1ms;
+} // namespace
+
+NetworkThread::NetworkThread(TPoll aPoll, TExecute aExecute, TStart aStart) noexcept
+    : m_poll(std::move(aPoll))
+    , m_execute(std::move(aExecute))
+    , m_start(std::move(aStart))
+{
+}
+
+NetworkThread::~NetworkThread() noexcept
+{
+    Stop();
+}
+
+void NetworkThread::Start() noexcept
+{
+    m_thread = std::thread(&NetworkThread::Run, this);
+}
+
+void NetworkThread::Stop() noexcept
+{
+    m_running.store(false, std::memory_order_relaxed);
+    m_outbound.interrupt();
+
+    if (m_thread.joinable())
+        m_thread.join();
+
+    // The thread is gone, what it left and what never made it into the queue is sent from here, in order
+    ExecuteOutbound();
+
+    for (auto i = m_outboundOverflowStart; i < m_outboundOverflow.size(); ++i)
+        m_execute(m_outboundOverflow[i]);
+
+    m_outboundOverflow.clear();
+    m_outboundOverflowStart = 0;
+}
+
+void NetworkThread::PushInbound(Inbound& aEvent) noexcept
+{
+    if (m_inbound.try_push(aEvent))
+        return;
+
+    if (aEvent.EventType == Inbound::kMessage)
+    {
+        m_droppedInbound.fetch_add(1, std::memory_order_relaxed);
+        LOG_LIMITED(spdlog::level::warn, "Inbound queue full, dropped a packet and kicked connection {:x}", aEvent.ConnectionId);
+
+        Outbound kick{Outbound::kKick, aEvent.ConnectionId};
+        m_execute(kick);
+        return;
+    }
+
+    // The game thread never waits for us, it frees room by its next tick. Keep sending meanwhile so that the packets
+    // it queued don't pile up, and give up once it is stopping us as it doesn't drain anymore.
+    while (!m_inbound.try_push(aEvent))
+    {
+        if (!m_running.load(std::memory_order_relaxed))
+            return;
+
+        ExecuteOutbound();
+        std::this_thread::yield();
+    }
+}
+
+void NetworkThread::PushOutbound(Outbound& aCommand) noexcept
+{
+    // Nothing may overtake the commands already kept
+    if (m_outboundOverflowStart != m_outboundOverflow.size())
+        FlushOutbound();
+
+    if (m_outboundOverflowStart == m_outboundOverflow.size() && m_outbound.try_push(aCommand))
+        return;
+
+    ++m_outboundOverflows;
+    m_outboundOverflow.push_back(std::move(aCommand));
+}
+
+void NetworkThread::FlushOutbound() noexcept
+{
+    while (m_outboundOverflowStart < m_outboundOverflow.size() && m_outbound.try_push(m_outboundOverflow[m_outboundOverflowStart]))
+        ++m_outboundOverflowStart;
+
+    if (m_outboundOverflowStart == m_outboundOverflow.size())
+    {
+        m_outboundOverflow.clear();
+        m_outboundOverflowStart = 0;
+    }
+}
+
+void NetworkThread::Run() noexcept
+{
+    Base::SetCurrentThreadName("Network");
+
+    if (m_start)
+        m_start();
+
+    while (m_running.load(std::memory_order_relaxed))
+    {
+        m_poll();
+        ExecuteOutbound();
+
+        // Outgoing packets wake us up right away, incoming ones are picked up by the next poll
+        m_outbound.wait_for(kPollInterval);
+    }
+
+    ExecuteOutbound();
+}
+
+void NetworkThread::ExecuteOutbound() noexcept
+{
+    while (auto command = m_outbound.try_pop())
+        m_execute(*command);
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <base/containers/mpsc_queue.hpp>
+#include <Messages/Message.h>
+
+#include <thread>
+
+// Takes receiving and sending off the game thread. The network thread polls the sockets and queues the raw
+// packets, the game thread decodes them once per tick and hands back its serialized packets. Decoding stays on
+// the game thread as it goes through the string cache.
+struct NetworkThread
+{
+    // Network thread to game thread
+    struct Inbound
+    {
+        enum Type : uint8_t
+        {
+            kMessage,
+            kConnection,
+            kDisconnection
+        };
+
+        Type EventType{kMessage};
+        ConnectionId_t ConnectionId{0};
+        Server::EDisconnectReason Reason{};
+        // Copy of the received packet, the receive buffer is reused by the next poll
+        Vector<uint8_t> Packet;
+    };
+
+    // Game thread to network thread
+    struct Outbound
+    {
+        enum Type : uint8_t
+        {
+            kPacket,
+            kKick
+        };
+
+        Type CommandType{kPacket};
+        ConnectionId_t ConnectionId{0};
+        // Shared by all the recipients of a multicast
+        TiltedPhoques::SharedPtr<TiltedPhoques::Buffer> pData;
+        uint32_t Size{0};
+    };
+
+    using TPoll = std::function<void()>;
+    using TExecute = std::function<void(Outbound&)>;
+    using TStart = std::function<void()>;
+
+    // aPoll receives from the sockets, aExecute sends or kicks, aStart runs once before them, all only on the network thread
+    NetworkThread(TPoll aPoll, TExecute aExecute, TStart aStart = {}) noexcept;
+    ~NetworkThread() noexcept;
+
+    TP_NOCOPYMOVE(NetworkThread);
+
+    // Spawns the thread, the owner has to be fully set up as aPoll may run right away
+    void Start() noexcept;
+
+    // Game thread only, sends everything queued and joins the thread, nothing must be pushed afterwards
+    void Stop() noexcept;
+
+    // Network thread only. When the game thread is too far behind, a packet is dropped and its connection kicked as the
+    // stream is broken, connection events wait for room while the outbound commands keep being executed.
+    void PushInbound(Inbound& aEvent) noexcept;
+    // Game thread only, handles at most aMax events so that a flood can't starve the tick, returns how many it handled
+    template <class T> size_t DrainInbound(const T& aFunc, size_t aMax) noexcept
+    {
+        size_t count = 0;
+        while (count < aMax)
+        {
+            auto event = m_inbound.try_pop();
+            if (!event)
+                break;
+
+            aFunc(*event);
+            ++count;
+        }
+
+        return count;
+    }
+
+    // Game thread only, never waits. Commands that don't fit in the queue are kept in order until FlushOutbound.
+    void PushOutbound(Outbound& aCommand) noexcept;
+    // Game thread only, hands the kept commands over as far as the queue has room, once per tick
+    void FlushOutbound() noexcept;
+
+    // Packets dropped because the inbound queue was full
+    [[nodiscard]] uint64_t GetDroppedInbound() const noexcept { return m_droppedInbound.load(std::memory_order_relaxed); }
+    // Commands that had to be kept because the outbound queue was full
+    [[nodiscard]] uint64_t GetOutboundOverflows() const noexcept { return m_outboundOverflows; }
+    [[nodiscard]] size_t GetOutboundBacklog() const noexcept { return m_outboundOverflow.size() - m_outboundOverflowStart; }
+
+private:
+    void Run() noexcept;
+    void ExecuteOutbound() noexcept;
+
+    TPoll m_poll;
+    TExecute m_execute;
+    TStart m_start;
+
+    mpsc_queue<Inbound, 14> m_inbound;
+    mpsc_queue<Outbound, 14> m_outbound;
+    std::atomic<uint64_t> m_droppedInbound{0};
+    std::atomic<bool> m_running{true};
+
+    // Game thread only, the commands not handed over yet start at m_outboundOverflowStart
+    Vector<Outbound> m_outboundOverflow;
+    size_t m_outboundOverflowStart{0};
+    uint64_t m_outboundOverflows{0};
+
+    std::thread m_thread;
+};
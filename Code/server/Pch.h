@@ -25,6 +25,7 @@
 #include <cxxopts.hpp>
 
 #include <spdlog/spdlog.h>
+#include <logging/RateLimiter.h>
 #include <entt/entt.hpp>
 #include <glm/glm.hpp>
 #include <BuildInfo.h>
@@ -24,17 +24,16 @@ void BindPlayer(sol::state_view aState)
     //  &Player::GetQuestLogComponent);
     playerType["SetDiscordId"] = &Player::SetDiscordId;
     playerType["SetEndpoint"] = &Player::SetEndpoint;
-    playerType["SetUsername"] = &Player::SetUsername;
+    playerType["SetUsername"] = [](Player& aSelf, String aUsername) { GameServer::Get()->GetWorld().GetPlayerManager().SetUsername(&aSelf, std::move(aUsername)); };
     playerType["SetMods"] = &Player::SetMods;
     playerType["SetModIds"] = &Player::SetModIds;
     playerType["SetCharacter"] = &Player::SetCharacter;
     playerType["SetStringCacheId"] = &Player::SetStringCacheId;
     playerType["SetLevel"] = &Player::SetLevel;
-    playerType["SetCellComponent"] = &Player::SetCellComponent;
+    playerType["SetCellComponent"] = [](Player& aSelf, const CellIdComponent& acCell) { GameServer::Get()->GetWorld().GetMulticastGroups().SetPlayerCell(&aSelf, acCell); };
     playerType["Send"] = &Player::Send;
     playerType["IsPartyLeader"] = [](Player& aSelf) {
-        return GameServer::Get()->GetWorld().GetPartyService().IsPlayerLeader(
-            PlayerManager::Get()->GetByConnectionId(aSelf.GetConnectionId()));
+        return GameServer::Get()->GetWorld().GetPartyService().IsPlayerLeader(&aSelf);
     };
 }
 
@@ -9,7 +9,7 @@ void CreatePartyServiceBindings(sol::state_view aState)
 
     partyType["get"] = []() -> PartyService& { return GameServer::Get()->GetWorld().GetPartyService(); };
     partyType["IsPlayerInParty"] = [](PartyService& aService, uint32_t aConnID) -> bool {
-        Player* player = PlayerManager::Get()->GetByConnectionId(aConnID);
+        Player* player = GameServer::Get()->GetWorld().GetPlayerManager().GetByConnectionId(aConnID);
         if (player == nullptr)
             return false;
         return aService.IsPlayerInParty(player);
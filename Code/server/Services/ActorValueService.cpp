@@ -10,17 +10,25 @@
 #include <Messages/NotifyActorMaxValueChanges.h>
 #include <Messages/NotifyHealthChangeBroadcast.h>
 #include <Messages/NotifyDeathStateChange.h>
+#include <Messages/AuthenticationRequest.h>
+#include <Events/UpdateEvent.h>
 
 ActorValueService::ActorValueService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
 {
+    m_updateConnection = aDispatcher.sink<UpdateEvent>().connect<&ActorValueService::OnUpdate>(this);
     m_updateHealthConnection = aDispatcher.sink<PacketEvent<RequestActorValueChanges>>().connect<&ActorValueService::OnActorValueChanges>(this);
     m_updateMaxValueConnection = aDispatcher.sink<PacketEvent<RequestActorMaxValueChanges>>().connect<&ActorValueService::OnActorMaxValueChanges>(this);
     m_updateDeltaHealthConnection = aDispatcher.sink<PacketEvent<RequestHealthChangeBroadcast>>().connect<&ActorValueService::OnHealthChangeBroadcast>(this);
     m_deathStateConnection = aDispatcher.sink<PacketEvent<RequestDeathStateChange>>().connect<&ActorValueService::OnDeathStateChange>(this);
 }
 
-void ActorValueService::OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) const noexcept
+void ActorValueService::OnUpdate(const UpdateEvent&) noexcept
+{
+    Flush();
+}
+
+void ActorValueService::OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) noexcept
 {
     auto& message = acMessage.Packet;
 
@@ -37,16 +45,10 @@ void ActorValueService::OnActorValueChanges(const PacketEvent<RequestActorValueC
         }
     }
 
-    NotifyActorValueChanges notify;
-    notify.Id = acMessage.Packet.Id;
-    notify.Values = acMessage.Packet.Values;
-
-    const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    m_pendingChanges.SetValues(message.Id, acMessage.pPlayer->GetId(), message.Values);
 }
 
-void ActorValueService::OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) const noexcept
+void ActorValueService::OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) noexcept
 {
     auto& message = acMessage.Packet;
 
@@ -63,16 +65,10 @@ void ActorValueService::OnActorMaxValueChanges(const PacketEvent<RequestActorMax
         }
     }
 
-    NotifyActorMaxValueChanges notify;
-    notify.Id = message.Id;
-    notify.Values = message.Values;
-
-    const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    m_pendingChanges.SetMaxValues(message.Id, acMessage.pPlayer->GetId(), message.Values);
 }
 
-void ActorValueService::OnHealthChangeBroadcast(const PacketEvent<RequestHealthChangeBroadcast>& acMessage) const noexcept
+void ActorValueService::OnHealthChangeBroadcast(const PacketEvent<RequestHealthChangeBroadcast>& acMessage) noexcept
 {
     auto& message = acMessage.Packet;
 
@@ -88,16 +84,10 @@ void ActorValueService::OnHealthChangeBroadcast(const PacketEvent<RequestHealthC
         actorValuesComponent.CurrentActorValues.ActorValuesList[24] = currentHealth - message.DeltaHealth;
     }
 
-    NotifyHealthChangeBroadcast notify;
-    notify.Id = message.Id;
-    notify.DeltaHealth = message.DeltaHealth;
-
-    const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    m_pendingChanges.AddDeltaHealth(message.Id, acMessage.pPlayer->GetId(), message.DeltaHealth);
 }
 
-void ActorValueService::OnDeathStateChange(const PacketEvent<RequestDeathStateChange>& acMessage) const noexcept
+void ActorValueService::OnDeathStateChange(const PacketEvent<RequestDeathStateChange>& acMessage) noexcept
 {
     auto& message = acMessage.Packet;
 
@@ -112,11 +102,85 @@ void ActorValueService::OnDeathStateChange(const PacketEvent<RequestDeathStateCh
         spdlog::debug("Updating death state {:x}:{}", message.Id, message.IsDead);
     }
 
+    // The killing blow has to arrive before the death state
+    Flush();
+
     NotifyDeathStateChange notify;
     notify.Id = message.Id;
     notify.IsDead = message.IsDead;
 
     const entt::entity cEntity = static_cast<entt::entity>(message.Id);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
+}
+
+void ActorValueService::Flush() noexcept
+{
+    if (m_pendingChanges.IsEmpty())
+        return;
+
+    for (Player* pPlayer : m_world.GetPlayerManager())
+    {
+        const auto& cPlayerCell = pPlayer->GetCellComponent();
+
+        m_batch.Changes.clear();
+        m_pendingChanges.Collect(
+            pPlayer->GetId(),
+            [this, &cPlayerCell](uint32_t aId)
+            {
+                const auto cEntity = static_cast<entt::entity>(aId);
+                if (!m_world.valid(cEntity))
+                    return false;
+
+                const auto* pCellComponent = m_world.try_get<CellIdComponent>(cEntity);
+                if (!pCellComponent)
+                    return false;
+
+                const auto* pCharacterComponent = m_world.try_get<CharacterComponent>(cEntity);
+                const bool cIsDragon = pCharacterComponent && pCharacterComponent->IsDragon();
+
+                return pCellComponent->IsInRange(cPlayerCell, cIsDragon);
+            },
+            m_batch.Changes);
+
+        if (m_batch.Changes.empty())
+            continue;
+
+        if (pPlayer->HasCapability(AuthenticationRequest::kActorValuesBatch))
+            pPlayer->Send(m_batch);
+        else
+            SendUnbatched(*pPlayer);
+    }
+
+    m_pendingChanges.Clear();
+}
+
+void ActorValueService::SendUnbatched(const Player& acPlayer) const noexcept
+{
+    for (const auto& cChanges : m_batch.Changes)
+    {
+        if (!cChanges.Values.empty())
+        {
+            NotifyActorValueChanges notify;
+            notify.Id = cChanges.Id;
+            notify.Values = cChanges.Values;
+            acPlayer.Send(notify);
+        }
+
+        if (!cChanges.MaxValues.empty())
+        {
+            NotifyActorMaxValueChanges notify;
+            notify.Id = cChanges.Id;
+            notify.Values = cChanges.MaxValues;
+            acPlayer.Send(notify);
+        }
+
+        if (cChanges.HasDeltaHealth)
+        {
+            NotifyHealthChangeBroadcast notify;
+            notify.Id = cChanges.Id;
+            notify.DeltaHealth = cChanges.DeltaHealth;
+            acPlayer.Send(notify);
+        }
+    }
 }
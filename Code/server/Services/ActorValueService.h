@@ -1,8 +1,11 @@
 #pragma once
 
 #include <Events/PacketEvent.h>
+#include <Structs/ActorValueCoalescer.h>
+#include <Messages/NotifyActorValuesBatch.h>
 
 struct World;
+struct Player;
 struct UpdateEvent;
 struct TransportService;
 struct RequestActorValueChanges;
@@ -12,6 +15,10 @@ struct RequestDeathStateChange;
 
 /**
  * @brief Broadcasts changes in (max) actor values and updates them server side.
+ *
+ * Changes are applied right away but only broadcasted at the end of the tick, merged per actor
+ * into a single NotifyActorValuesBatch per player. Clients without the batch capability get the
+ * separate value, max value and health messages instead.
  */
 struct ActorValueService
 {
@@ -23,10 +30,20 @@ struct ActorValueService
 private:
     World& m_world;
 
-    void OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) const noexcept;
-    void OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) const noexcept;
-    void OnHealthChangeBroadcast(const PacketEvent<RequestHealthChangeBroadcast>& acMessage) const noexcept;
-    void OnDeathStateChange(const PacketEvent<RequestDeathStateChange>& acMessage) const noexcept;
+    void OnUpdate(const UpdateEvent&) noexcept;
+    void OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) noexcept;
+    void OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) noexcept;
+    void OnHealthChangeBroadcast(const PacketEvent<RequestHealthChangeBroadcast>& acMessage) noexcept;
+    void OnDeathStateChange(const PacketEvent<RequestDeathStateChange>& acMessage) noexcept;
+
+    // Sends the pending changes to every player in range of the changed actors
+    void Flush() noexcept;
+    void SendUnbatched(const Player& acPlayer) const noexcept;
+
+    ActorValueCoalescer m_pendingChanges;
+    NotifyActorValuesBatch m_batch;
+
+    entt::scoped_connection m_updateConnection;
 
     entt::scoped_connection m_updateHealthConnection;
     entt::scoped_connection m_updateMaxValueConnection;
@@ -5,11 +5,73 @@
 
 #include <AdminMessages/AdminShutdownRequest.h>
 #include <AdminMessages/ServerLogs.h>
+#include <Events/UpdateEvent.h>
+
+#include <spdlog/details/os.h>
+
+namespace
+{
+constexpr size_t kMaxPendingMessages = 1000;
+
+// Which instance each thread logs for, the log sink is shared by every instance of the process
+struct ThreadOwners
+{
+    std::mutex Lock;
+    TiltedPhoques::Map<size_t, const AdminService*> Owners;
+};
+
+ThreadOwners& GetThreadOwners()
+{
+    static ThreadOwners s_owners;
+    return s_owners;
+}
+} // namespace
 
 AdminService::AdminService(World& aWorld, entt::dispatcher& aDispatcher)
     : m_world(aWorld)
 {
+    m_updateConnection = aDispatcher.sink<UpdateEvent>().connect<&AdminService::OnUpdate>(this);
     m_shutdownConnection = aDispatcher.sink<AdminPacketEvent<AdminShutdownRequest>>().connect<&AdminService::HandleShutdown>(this);
+
+    ClaimCurrentThread();
+}
+
+AdminService::~AdminService()
+{
+    auto& threadOwners = GetThreadOwners();
+    std::scoped_lock _(threadOwners.Lock);
+
+    for (auto it = std::begin(threadOwners.Owners); it != std::end(threadOwners.Owners);)
+    {
+        if (it->second == this)
+            it = threadOwners.Owners.erase(it);
+        else
+            ++it;
+    }
+}
+
+void AdminService::ClaimCurrentThread() noexcept
+{
+    auto& threadOwners = GetThreadOwners();
+    std::scoped_lock _(threadOwners.Lock);
+
+    threadOwners.Owners[spdlog::details::os::thread_id()] = this;
+}
+
+void AdminService::OnUpdate(const UpdateEvent& acEvent) noexcept
+{
+    std::deque<String> messages;
+    {
+        std::scoped_lock _(mutex_);
+        std::swap(messages, m_messages);
+    }
+
+    ServerLogs logs;
+    for (auto& message : messages)
+    {
+        logs.Logs = std::move(message);
+        GameServer::Get()->ForEachAdmin([&logs](ConnectionId_t aId) { GameServer::Get()->Send(aId, logs); });
+    }
 }
 
 void AdminService::HandleShutdown(const AdminPacketEvent<AdminShutdownRequest>& acMessage) noexcept
@@ -21,13 +83,23 @@ void AdminService::HandleShutdown(const AdminPacketEvent<AdminShutdownRequest>&
 
 void AdminService::sink_it_(const spdlog::details::log_msg& msg)
 {
+    {
+        auto& threadOwners = GetThreadOwners();
+        std::scoped_lock _(threadOwners.Lock);
+
+        const auto it = threadOwners.Owners.find(msg.thread_id);
+        if (it != std::end(threadOwners.Owners) && it->second != this)
+            return;
+    }
+
+    // Nobody to send to for a while, keep the most recent lines only
+    if (m_messages.size() >= kMaxPendingMessages)
+        m_messages.pop_front();
+
     spdlog::memory_buf_t formatted;
     formatter_->format(msg, formatted);
 
-    ServerLogs logs;
-    logs.Logs = fmt::to_string(formatted);
-
-    GameServer::Get()->ForEachAdmin([&logs](ConnectionId_t aId) { GameServer::Get()->Send(aId, logs); });
+    m_messages.emplace_back(formatted.data(), formatted.size());
 }
 
 void AdminService::flush_()
@@ -3,6 +3,8 @@
 #include <Events/AdminPacketEvent.h>
 #include <spdlog/sinks/base_sink.h>
 
+#include <deque>
+
 struct World;
 struct UpdateEvent;
 struct AdminShutdownRequest;
@@ -12,18 +14,28 @@ struct AdminShutdownRequest;
  *
  * This service is currently not in use.
  */
-class AdminService : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+class AdminService : public spdlog::sinks::base_sink<std::mutex>
 {
 public:
     AdminService(World& aWorld, entt::dispatcher& aDispatcher);
+    ~AdminService() override;
+
+    // Lines logged from the calling thread belong to this server instance from now on, the admins of the other instances
+    // of the process don't get them. Claims the constructing thread, the game thread.
+    void ClaimCurrentThread() noexcept;
 
 private:
+    void OnUpdate(const UpdateEvent& acEvent) noexcept;
     void HandleShutdown(const AdminPacketEvent<AdminShutdownRequest>& aChanges) noexcept;
 
+    // Called from the logging thread, lines are only queued and sent on the next update. Lines of threads no instance
+    // claimed, like the runner's, go to every instance.
     void sink_it_(const spdlog::details::log_msg& msg) override;
     void flush_() override;
 
-    Vector<String> m_messages;
+    // Drops from the front once full
+    std::deque<String> m_messages;
+    entt::scoped_connection m_updateConnection;
     entt::scoped_connection m_shutdownConnection;
     World& m_world;
 };
@@ -2,12 +2,12 @@
 #include <Components.h>
 #include <GameServer.h>
 #include <World.h>
+#include <AllocationTags.h>
 
 #include <Events/CharacterSpawnedEvent.h>
 #include <Events/CharacterExteriorCellChangeEvent.h>
 #include <Events/CharacterInteriorCellChangeEvent.h>
 #include <Events/PlayerEnterWorldEvent.h>
-#include <Events/UpdateEvent.h>
 #include <Events/CharacterRemoveEvent.h>
 #include <Events/OwnershipTransferEvent.h>
 
@@ -15,7 +15,6 @@
 
 #include <Messages/AssignCharacterRequest.h>
 #include <Messages/AssignCharacterResponse.h>
-#include <Messages/ServerReferencesMoveRequest.h>
 #include <Messages/ClientReferencesMoveRequest.h>
 #include <Messages/CharacterSpawnRequest.h>
 #include <Messages/RequestFactionsChanges.h>
@@ -43,11 +42,15 @@
 namespace
 {
 Console::Setting bEnableXpSync{"Gameplay:bEnableXpSync", "Syncs combat XP within the party", true};
-}
+Console::Setting bEnableDeadReckoning{"Network:bEnableDeadReckoning", "Skip movement updates that remote clients can extrapolate", true};
+Console::Setting fMaxExtrapolationError{"Network:fMaxExtrapolationError", "Maximum distance between the extrapolated and the real position before a movement update is sent", 8.f};
+Console::Setting uMaxMovementRefreshMs{"Network:uMaxMovementRefreshMs", "Maximum time in ms between two movement updates of a moving character", static_cast<uint32_t>(DeadReckoning::kMaxExtrapolation)};
+} // namespace
 
 CharacterService::CharacterService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
-    , m_updateConnection(aDispatcher.sink<UpdateEvent>().connect<&CharacterService::OnUpdate>(this))
+    , m_movementChanges(aWorld)
+    , m_characterChanges(aWorld)
     , m_interiorCellChangeEventConnection(aDispatcher.sink<CharacterInteriorCellChangeEvent>().connect<&CharacterService::OnCharacterInteriorCellChange>(this))
     , m_exteriorCellChangeEventConnection(aDispatcher.sink<CharacterExteriorCellChangeEvent>().connect<&CharacterService::OnCharacterExteriorCellChange>(this))
     , m_characterAssignRequestConnection(aDispatcher.sink<PacketEvent<AssignCharacterRequest>>().connect<&CharacterService::OnAssignCharacterRequest>(this))
@@ -64,37 +67,36 @@ CharacterService::CharacterService(World& aWorld, entt::dispatcher& aDispatcher)
     , m_syncExperienceConnection(aDispatcher.sink<PacketEvent<SyncExperienceRequest>>().connect<&CharacterService::OnSyncExperienceRequest>(this))
     , m_dialogueConnection(aDispatcher.sink<PacketEvent<DialogueRequest>>().connect<&CharacterService::OnDialogueRequest>(this))
     , m_subtitleConnection(aDispatcher.sink<PacketEvent<SubtitleRequest>>().connect<&CharacterService::OnSubtitleRequest>(this))
+    , m_characterConstructConnection(aWorld.on_construct<CharacterComponent>().connect<&CharacterService::OnSpawnDataChanged>(this))
+    , m_characterUpdateConnection(aWorld.on_update<CharacterComponent>().connect<&CharacterService::OnSpawnDataChanged>(this))
+    , m_characterDestroyConnection(aWorld.on_destroy<CharacterComponent>().connect<&CharacterService::OnSpawnDataChanged>(this))
+    , m_inventoryConstructConnection(aWorld.on_construct<InventoryComponent>().connect<&CharacterService::OnSpawnDataChanged>(this))
+    , m_inventoryUpdateConnection(aWorld.on_update<InventoryComponent>().connect<&CharacterService::OnSpawnDataChanged>(this))
+    , m_inventoryDestroyConnection(aWorld.on_destroy<InventoryComponent>().connect<&CharacterService::OnSpawnDataChanged>(this))
 {
+    auto& timers = aWorld.GetTimers();
+    timers.ScheduleRepeating("Movement snapshots", 1000 / 50, [this] { ProcessMovementChanges(); });
+    timers.ScheduleRepeating("Factions changes", 2000, [this] { ProcessFactionsChanges(); });
 }
 
-void CharacterService::Serialize(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept
+void CharacterService::Serialize(entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) const noexcept
 {
-    const auto& characterComponent = aRegistry.get<CharacterComponent>(aEntity);
+    const auto& characterComponent = m_world.get<CharacterComponent>(aEntity);
 
     apSpawnRequest->ServerId = World::ToInteger(aEntity);
-    apSpawnRequest->AppearanceBuffer = characterComponent.SaveBuffer;
-    apSpawnRequest->ChangeFlags = characterComponent.ChangeFlags;
-    apSpawnRequest->FaceTints = characterComponent.FaceTints;
-    apSpawnRequest->FactionsContent = characterComponent.FactionsContent;
     apSpawnRequest->IsDead = characterComponent.IsDead();
     apSpawnRequest->IsPlayer = characterComponent.IsPlayer();
     apSpawnRequest->IsWeaponDrawn = characterComponent.IsWeaponDrawn();
     apSpawnRequest->IsPlayerSummon = characterComponent.IsPlayerSummon();
     apSpawnRequest->PlayerId = characterComponent.PlayerId;
 
-    const auto* pFormIdComponent = aRegistry.try_get<FormIdComponent>(aEntity);
+    const auto* pFormIdComponent = m_world.try_get<FormIdComponent>(aEntity);
     if (pFormIdComponent)
     {
         apSpawnRequest->FormId = pFormIdComponent->Id;
     }
 
-    const auto* pInventoryComponent = aRegistry.try_get<InventoryComponent>(aEntity);
-    if (pInventoryComponent)
-    {
-        apSpawnRequest->InventoryContent = pInventoryComponent->Content;
-    }
-
-    const auto* pActorValuesComponent = aRegistry.try_get<ActorValuesComponent>(aEntity);
+    const auto* pActorValuesComponent = m_world.try_get<ActorValuesComponent>(aEntity);
     if (pActorValuesComponent)
     {
         apSpawnRequest->InitialActorValues = pActorValuesComponent->CurrentActorValues;
@@ -105,7 +107,7 @@ void CharacterService::Serialize(World& aRegistry, entt::entity aEntity, Charact
         apSpawnRequest->BaseId = characterComponent.BaseId.Id;
     }
 
-    const auto* pMovementComponent = aRegistry.try_get<MovementComponent>(aEntity);
+    const auto* pMovementComponent = m_world.try_get<MovementComponent>(aEntity);
     if (pMovementComponent)
     {
         apSpawnRequest->Position = pMovementComponent->Position;
@@ -113,26 +115,47 @@ void CharacterService::Serialize(World& aRegistry, entt::entity aEntity, Charact
         apSpawnRequest->Rotation.y = pMovementComponent->Rotation.z;
     }
 
-    const auto* pCellIdComponent = aRegistry.try_get<CellIdComponent>(aEntity);
+    const auto* pCellIdComponent = m_world.try_get<CellIdComponent>(aEntity);
     if (pCellIdComponent)
     {
         apSpawnRequest->CellId = pCellIdComponent->Cell;
     }
 
-    const auto& animationComponent = aRegistry.get<AnimationComponent>(aEntity);
+    const auto& animationComponent = m_world.get<AnimationComponent>(aEntity);
     apSpawnRequest->LatestAction = animationComponent.CurrentAction;
-}
 
-void CharacterService::OnUpdate(const UpdateEvent&) const noexcept
-{
-    ProcessFactionsChanges();
-    ProcessMovementChanges();
+    auto& pCachedData = m_spawnCache[aEntity];
+    if (pCachedData)
+    {
+        ++m_spawnCacheStats.Hits;
+    }
+    else
+    {
+        ++m_spawnCacheStats.Misses;
+
+        apSpawnRequest->AppearanceBuffer = characterComponent.SaveBuffer;
+        apSpawnRequest->ChangeFlags = characterComponent.ChangeFlags;
+        apSpawnRequest->FaceTints = characterComponent.FaceTints;
+        apSpawnRequest->FactionsContent = characterComponent.FactionsContent;
+
+        const auto* pInventoryComponent = m_world.try_get<InventoryComponent>(aEntity);
+        if (pInventoryComponent)
+        {
+            apSpawnRequest->InventoryContent = pInventoryComponent->Content;
+        }
+
+        auto pNewCachedData = MakeShared<CharacterSpawnRequest::CachedData>();
+        apSpawnRequest->EncodeCachedData(*pNewCachedData, m_spawnScratch);
+        pCachedData = std::move(pNewCachedData);
+    }
+
+    apSpawnRequest->pCachedData = pCachedData;
 }
 
 void CharacterService::OnCharacterExteriorCellChange(const CharacterExteriorCellChangeEvent& acEvent) const noexcept
 {
     CharacterSpawnRequest spawnMessage;
-    Serialize(m_world, acEvent.Entity, &spawnMessage);
+    Serialize(acEvent.Entity, &spawnMessage);
 
     NotifyRemoveCharacter removeMessage;
     removeMessage.ServerId = World::ToInteger(acEvent.Entity);
@@ -142,6 +165,9 @@ void CharacterService::OnCharacterExteriorCellChange(const CharacterExteriorCell
         if (acEvent.Owner == pPlayer)
             continue;
 
+        // Either spawned or removed right now, a pending streamed spawn would be stale
+        pPlayer->GetSpawnStream().Cancel(acEvent.Entity);
+
         if (pPlayer->GetCellComponent().WorldSpaceId != acEvent.WorldSpaceId || pPlayer->GetCellComponent().WorldSpaceId == acEvent.WorldSpaceId && !GridCellCoords::IsCellInGridCell(acEvent.CurrentCoords, pPlayer->GetCellComponent().CenterCoords, false))
         {
             pPlayer->Send(removeMessage);
@@ -156,7 +182,7 @@ void CharacterService::OnCharacterExteriorCellChange(const CharacterExteriorCell
 void CharacterService::OnCharacterInteriorCellChange(const CharacterInteriorCellChangeEvent& acEvent) const noexcept
 {
     CharacterSpawnRequest spawnMessage;
-    Serialize(m_world, acEvent.Entity, &spawnMessage);
+    Serialize(acEvent.Entity, &spawnMessage);
 
     NotifyRemoveCharacter removeMessage;
     removeMessage.ServerId = World::ToInteger(acEvent.Entity);
@@ -166,6 +192,8 @@ void CharacterService::OnCharacterInteriorCellChange(const CharacterInteriorCell
         if (acEvent.Owner == pPlayer)
             continue;
 
+        pPlayer->GetSpawnStream().Cancel(acEvent.Entity);
+
         if (acEvent.NewCell == pPlayer->GetCellComponent().Cell)
             pPlayer->Send(spawnMessage);
         else
@@ -256,7 +284,7 @@ void CharacterService::OnOwnershipTransferRequest(const PacketEvent<RequestOwner
 
     if (!m_world.valid(cEntity))
     {
-        spdlog::warn("Client {:X} requested ownership transfer of an entity that doesn't exist, server id: {:X}", acMessage.pPlayer->GetConnectionId(), message.ServerId);
+        LOG_LIMITED(spdlog::level::warn, "Client {:X} requested ownership transfer of an entity that doesn't exist, server id: {:X}", acMessage.pPlayer->GetConnectionId(), message.ServerId);
         return;
     }
 
@@ -287,7 +315,13 @@ void CharacterService::OnOwnershipTransferRequest(const PacketEvent<RequestOwner
 
         auto& movementComponent = m_world.get<MovementComponent>(cEntity);
         movementComponent.Position = message.Position;
-        movementComponent.Sent = true;
+        movementComponent.Sent = false;
+
+        // Receivers would extrapolate across the jump, forget what they had so everyone gets a full snapshot next tick
+        for (auto pPlayer : m_world.GetPlayerManager())
+            pPlayer->GetMovementStates().erase(cEntity);
+
+        m_movementChanges.Mark(cEntity);
 
         GameServer::Get()->SendToPlayers(notify, acMessage.pPlayer);
     }
@@ -300,11 +334,11 @@ void CharacterService::OnOwnershipTransferRequest(const PacketEvent<RequestOwner
 
 void CharacterService::OnOwnershipTransferEvent(const OwnershipTransferEvent& acEvent) const noexcept
 {
-    const auto view = m_world.view<OwnerComponent, CharacterComponent, CellIdComponent>();
+    const auto characterView = m_world.GetCharacterView();
 
-    auto& characterComponent = view.get<CharacterComponent>(acEvent.Entity);
-    auto& ownerComponent = view.get<OwnerComponent>(acEvent.Entity);
-    auto& cellIdComponent = view.get<CellIdComponent>(acEvent.Entity);
+    auto& characterComponent = characterView.get<CharacterComponent>(acEvent.Entity);
+    auto& ownerComponent = characterView.get<OwnerComponent>(acEvent.Entity);
+    auto& cellIdComponent = characterView.get<CellIdComponent>(acEvent.Entity);
 
     NotifyOwnershipTransfer response;
     response.ServerId = World::ToInteger(acEvent.Entity);
@@ -329,7 +363,7 @@ void CharacterService::OnOwnershipTransferEvent(const OwnershipTransferEvent& ac
         if (!pPlayer->GetCellComponent().IsInRange(cellIdComponent, characterComponent.IsDragon()))
             continue;
 
-        ownerComponent.SetOwner(pPlayer);
+        m_world.patch<OwnerComponent>(acEvent.Entity, [pPlayer](auto& aOwnerComponent) { aOwnerComponent.SetOwner(pPlayer); });
 
         pPlayer->Send(response);
 
@@ -354,6 +388,8 @@ void CharacterService::OnCharacterRemoveEvent(const CharacterRemoveEvent& acEven
 
     for (auto pPlayer : m_world.GetPlayerManager())
     {
+        pPlayer->GetMovementStates().erase(*it);
+
         if (characterOwnerComponent.GetOwner() == pPlayer)
             continue;
 
@@ -372,11 +408,11 @@ void CharacterService::OnOwnershipClaimRequest(const PacketEvent<RequestOwnershi
 void CharacterService::OnCharacterSpawned(const CharacterSpawnedEvent& acEvent) const noexcept
 {
     CharacterSpawnRequest message;
-    Serialize(m_world, acEvent.Entity, &message);
+    Serialize(acEvent.Entity, &message);
 
     const auto& ownerComp = m_world.get<OwnerComponent>(acEvent.Entity);
     if (!GameServer::Get()->SendToPlayersInRange(message, acEvent.Entity, ownerComp.GetOwner()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 
     GameServer::Get()->GetWorld().GetScriptService().HandleCharacterSpawn(acEvent.Entity);
 }
@@ -394,7 +430,7 @@ void CharacterService::OnReferencesMoveRequest(const PacketEvent<ClientReference
         auto itor = view.find(entity);
         if (itor == std::end(view))
         {
-            spdlog::debug("{:x} requested move of {:x} but does not exist", acMessage.pPlayer->GetConnectionId(), World::ToInteger(*itor));
+            LOG_LIMITED(spdlog::level::debug, "{:x} requested move of {:x} but does not exist", acMessage.pPlayer->GetConnectionId(), entry.first);
             continue;
         }
 
@@ -409,6 +445,9 @@ void CharacterService::OnReferencesMoveRequest(const PacketEvent<ClientReference
         auto& update = entry.second;
         auto& movement = update.UpdatedMovement;
 
+        if (movementComponent.Variables != movement.Variables || movementComponent.Direction != movement.Direction)
+            ++movementComponent.Revision;
+
         movementComponent.Position = movement.Position;
         movementComponent.Rotation = glm::vec3(movement.Rotation.x, 0.f, movement.Rotation.y);
         movementComponent.Variables = movement.Variables;
@@ -430,6 +469,7 @@ void CharacterService::OnReferencesMoveRequest(const PacketEvent<ClientReference
         }
 
         movementComponent.Sent = false;
+        m_world.patch<MovementComponent>(entity);
     }
 }
 
@@ -446,9 +486,13 @@ void CharacterService::OnFactionsChanges(const PacketEvent<RequestFactionsChange
         if (it == std::end(view) || view.get<OwnerComponent>(*it).GetOwner() != acMessage.pPlayer)
             continue;
 
-        auto& characterComponent = view.get<CharacterComponent>(*it);
-        characterComponent.FactionsContent = factions;
-        characterComponent.SetDirtyFactions(true);
+        m_world.patch<CharacterComponent>(
+            *it,
+            [&factions](auto& characterComponent)
+            {
+                characterComponent.FactionsContent = factions;
+                characterComponent.SetDirtyFactions(true);
+            });
     }
 }
 
@@ -462,7 +506,7 @@ void CharacterService::OnMountRequest(const PacketEvent<MountRequest>& acMessage
 
     const entt::entity cEntity = static_cast<entt::entity>(message.MountId);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
 void CharacterService::OnNewPackageRequest(const PacketEvent<NewPackageRequest>& acMessage) const noexcept
@@ -475,7 +519,7 @@ void CharacterService::OnNewPackageRequest(const PacketEvent<NewPackageRequest>&
 
     const entt::entity cEntity = static_cast<entt::entity>(message.ActorId);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
 void CharacterService::OnRequestRespawn(const PacketEvent<RequestRespawn>& acMessage) const noexcept
@@ -484,7 +528,7 @@ void CharacterService::OnRequestRespawn(const PacketEvent<RequestRespawn>& acMes
     auto it = view.find(static_cast<entt::entity>(acMessage.Packet.ActorId));
     if (it == view.end())
     {
-        spdlog::warn("No OwnerComponent found for actor id {:X}", acMessage.Packet.ActorId);
+        LOG_LIMITED(spdlog::level::warn, "No OwnerComponent found for actor id {:X}", acMessage.Packet.ActorId);
         return;
     }
 
@@ -493,22 +537,27 @@ void CharacterService::OnRequestRespawn(const PacketEvent<RequestRespawn>& acMes
     {
         if (!acMessage.Packet.AppearanceBuffer.empty())
         {
-            auto& characterComponent = view.get<CharacterComponent>(*it);
-            characterComponent.SaveBuffer = acMessage.Packet.AppearanceBuffer;
-            characterComponent.ChangeFlags = acMessage.Packet.ChangeFlags;
+            m_world.patch<CharacterComponent>(
+                *it,
+                [&acMessage](auto& characterComponent)
+                {
+                    characterComponent.SaveBuffer = acMessage.Packet.AppearanceBuffer;
+                    characterComponent.ChangeFlags = acMessage.Packet.ChangeFlags;
+                });
         }
 
         NotifyRespawn notify;
         notify.ActorId = acMessage.Packet.ActorId;
 
         if (!GameServer::Get()->SendToPlayersInRange(notify, *it, acMessage.GetSender()))
-            spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+            LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
     }
     else
     {
         CharacterSpawnRequest message;
-        Serialize(m_world, *it, &message);
+        Serialize(*it, &message);
 
+        acMessage.GetSender()->GetSpawnStream().Cancel(*it);
         acMessage.GetSender()->Send(message);
     }
 }
@@ -535,7 +584,7 @@ void CharacterService::OnDialogueRequest(const PacketEvent<DialogueRequest>& acM
 
     const entt::entity cEntity = static_cast<entt::entity>(message.ServerId);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
 void CharacterService::OnSubtitleRequest(const PacketEvent<SubtitleRequest>& acMessage) const noexcept
@@ -548,7 +597,13 @@ void CharacterService::OnSubtitleRequest(const PacketEvent<SubtitleRequest>& acM
 
     const entt::entity cEntity = static_cast<entt::entity>(message.ServerId);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
+}
+
+void CharacterService::OnSpawnDataChanged(entt::registry& aRegistry, entt::entity aEntity) const noexcept
+{
+    if (m_spawnCache.erase(aEntity))
+        ++m_spawnCacheStats.Invalidations;
 }
 
 void CharacterService::CreateCharacter(const PacketEvent<AssignCharacterRequest>& acMessage) const noexcept
@@ -571,7 +626,7 @@ void CharacterService::CreateCharacter(const PacketEvent<AssignCharacterRequest>
     else if (baseId != GameId{} && !isTemporary)
     {
         m_world.destroy(cEntity);
-        spdlog::warn("Unexpected NpcId, player {:x} might be forging packets", acMessage.pPlayer->GetConnectionId());
+        LOG_LIMITED(spdlog::level::warn, "Unexpected NpcId, player {:x} might be forging packets", acMessage.pPlayer->GetConnectionId());
         return;
     }
 
@@ -649,7 +704,7 @@ void CharacterService::TransferOwnership(Player* apPlayer, const uint32_t acServ
     const auto it = view.find(static_cast<entt::entity>(acServerId));
     if (it == view.end())
     {
-        spdlog::warn("Client {:X} requested ownership of an entity that doesn't exist ({:X})!", apPlayer->GetConnectionId(), acServerId);
+        LOG_LIMITED(spdlog::level::warn, "Client {:X} requested ownership of an entity that doesn't exist ({:X})!", apPlayer->GetConnectionId(), acServerId);
         return;
     }
 
@@ -662,8 +717,13 @@ void CharacterService::TransferOwnership(Player* apPlayer, const uint32_t acServ
         characterOwnerComponent.pOwner->Send(notify);
     }
 
-    characterOwnerComponent.SetOwner(apPlayer);
-    characterOwnerComponent.InvalidOwners.clear();
+    m_world.patch<OwnerComponent>(
+        *it,
+        [apPlayer](auto& aOwnerComponent)
+        {
+            aOwnerComponent.SetOwner(apPlayer);
+            aOwnerComponent.InvalidOwners.clear();
+        });
 
     BroadcastActorData(apPlayer, *it, acActorData);
 
@@ -705,10 +765,9 @@ void CharacterService::ApplyActorData(const entt::entity acEntity, const ActorDa
         pActorValuesComponent->CurrentActorValues = acActorData.InitialActorValues;
     }
 
-    auto* pInventoryComponent = m_world.try_get<InventoryComponent>(acEntity);
-    if (pInventoryComponent)
+    if (m_world.all_of<InventoryComponent>(acEntity))
     {
-        pInventoryComponent->Content = acActorData.InitialInventory;
+        m_world.patch<InventoryComponent>(acEntity, [&acActorData](auto& inventoryComponent) { inventoryComponent.Content = acActorData.InitialInventory; });
     }
 
     auto* pCharacterComponent = m_world.try_get<CharacterComponent>(acEntity);
@@ -733,45 +792,41 @@ void CharacterService::BroadcastActorData(Player* apPlayer, const entt::entity a
 
 void CharacterService::ProcessFactionsChanges() const noexcept
 {
-    static std::chrono::steady_clock::time_point lastSendTimePoint;
-    constexpr auto cDelayBetweenSnapshots = 2000ms;
-
-    const auto now = std::chrono::steady_clock::now();
-    if (now - lastSendTimePoint < cDelayBetweenSnapshots)
-        return;
-
-    lastSendTimePoint = now;
-
-    const auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
+    const auto characterView = m_world.GetCharacterView();
 
     TiltedPhoques::Map<Player*, NotifyFactionsChanges> messages;
 
-    for (auto entity : characterView)
-    {
-        auto& characterComponent = characterView.get<CharacterComponent>(entity);
-        auto& cellIdComponent = characterView.get<CellIdComponent>(entity);
-        auto& ownerComponent = characterView.get<OwnerComponent>(entity);
+    // Factions are only changed through patch, characters that weren't patched have nothing new to send
+    m_characterChanges.Consume(
+        [&](entt::entity entity)
+        {
+            if (!characterView.contains(entity))
+                return;
 
-        // If we have nothing new to send skip this
-        if (characterComponent.IsDirtyFactions())
-            continue;
+            auto& characterComponent = characterView.get<CharacterComponent>(entity);
+            auto& cellIdComponent = characterView.get<CellIdComponent>(entity);
+            auto& ownerComponent = characterView.get<OwnerComponent>(entity);
 
-        for (auto pPlayer : m_world.GetPlayerManager())
-        {
-            if (pPlayer == ownerComponent.GetOwner())
-                continue;
+            // Patched for something else
+            if (!characterComponent.IsDirtyFactions())
+                return;
 
-            if (!cellIdComponent.IsInRange(pPlayer->GetCellComponent(), characterComponent.IsDragon()))
-                continue;
+            for (auto pPlayer : m_world.GetPlayerManager())
+            {
+                if (pPlayer == ownerComponent.GetOwner())
+                    continue;
 
-            auto& message = messages[pPlayer];
-            auto& change = message.Changes[World::ToInteger(entity)];
+                if (!cellIdComponent.IsInRange(pPlayer->GetCellComponent(), characterComponent.IsDragon()))
+                    continue;
 
-            change = characterComponent.FactionsContent;
-        }
+                auto& message = messages[pPlayer];
+                auto& change = message.Changes[World::ToInteger(entity)];
 
-        characterComponent.SetDirtyFactions(false);
-    }
+                change = characterComponent.FactionsContent;
+            }
+
+            characterComponent.SetDirtyFactions(false);
+        });
 
     for (auto [pPlayer, message] : messages)
     {
@@ -782,76 +837,114 @@ void CharacterService::ProcessFactionsChanges() const noexcept
 
 void CharacterService::ProcessMovementChanges() const noexcept
 {
-    static std::chrono::steady_clock::time_point lastSendTimePoint;
-    constexpr auto cDelayBetweenSnapshots = 1000ms / 50;
-
-    const auto now = std::chrono::steady_clock::now();
-    if (now - lastSendTimePoint < cDelayBetweenSnapshots)
-        return;
+    Base::AllocationScope _(AllocationTags::Snapshots);
 
-    lastSendTimePoint = now;
+    const auto movementView = m_world.GetMovementView();
 
-    const auto characterView = m_world.view<CharacterComponent, CellIdComponent, MovementComponent, AnimationComponent, OwnerComponent>();
-
-    TiltedPhoques::Map<Player*, ServerReferencesMoveRequest> messages;
+    const auto cTick = GameServer::Get()->GetTick();
 
     for (auto pPlayer : m_world.GetPlayerManager())
-    {
-        auto& message = messages[pPlayer];
+        pPlayer->GetMovementSnapshot().Reset(cTick);
 
-        message.Tick = GameServer::Get()->GetTick();
-    }
+    // Snapshots point into the segments until they are sent, make sure they can't be reallocated
+    if (m_movementSegments.size() < m_movementChanges.GetCount())
+        m_movementSegments.resize(m_movementChanges.GetCount());
 
-    for (auto entity : characterView)
-    {
-        auto& characterComponent = characterView.get<CharacterComponent>(entity);
-        auto& movementComponent = characterView.get<MovementComponent>(entity);
-        auto& cellIdComponent = characterView.get<CellIdComponent>(entity);
-        auto& ownerComponent = characterView.get<OwnerComponent>(entity);
-        auto& animationComponent = characterView.get<AnimationComponent>(entity);
+    size_t usedSegments = 0;
 
-        // If we have nothing new to send skip this
-        if (movementComponent.Sent == true)
-            continue;
+    DeadReckoning::Settings settings{};
+    settings.MaxPositionError = fMaxExtrapolationError.as_float();
+    settings.MaxRefreshInterval = uMaxMovementRefreshMs.value_as<uint64_t>();
 
-        for (auto pPlayer : m_world.GetPlayerManager())
+    const bool cUseDeadReckoning = bEnableDeadReckoning;
+
+    // Only characters that moved, or that someone is still extrapolating, can have something to send
+    m_movementChanges.Consume(
+        [&](entt::entity entity)
         {
-            if (pPlayer == ownerComponent.GetOwner())
-                continue;
+            if (!movementView.contains(entity))
+                return;
 
-            if (!cellIdComponent.IsInRange(pPlayer->GetCellComponent(), characterComponent.IsDragon()))
-                continue;
+            auto& characterComponent = movementView.get<CharacterComponent>(entity);
+            auto& movementComponent = movementView.get<MovementComponent>(entity);
+            auto& cellIdComponent = movementView.get<CellIdComponent>(entity);
+            auto& ownerComponent = movementView.get<OwnerComponent>(entity);
+            auto& animationComponent = movementView.get<AnimationComponent>(entity);
 
-            auto& message = messages[pPlayer];
-            auto& update = message.Updates[World::ToInteger(entity)];
-            auto& movement = update.UpdatedMovement;
+            const ServerReferencesMoveSnapshot::Segment* pSegment = nullptr;
+            bool isExtrapolated = false;
 
-            movement.Position = movementComponent.Position;
+            for (auto pPlayer : m_world.GetPlayerManager())
+            {
+                auto& movementStates = pPlayer->GetMovementStates();
 
-            movement.Rotation.x = movementComponent.Rotation.x;
-            movement.Rotation.y = movementComponent.Rotation.z;
+                if (pPlayer == ownerComponent.GetOwner() || !cellIdComponent.IsInRange(pPlayer->GetCellComponent(), characterComponent.IsDragon()))
+                {
+                    // The player will get a fresh spawn when the character comes back, start over from there
+                    movementStates.erase(entity);
+                    continue;
+                }
 
-            movement.Direction = movementComponent.Direction;
-            movement.Variables = movementComponent.Variables;
+                // The spawn carries the position, a movement update before it would be for a character the client doesn't have
+                if (pPlayer->GetSpawnStream().IsPending(entity))
+                    continue;
 
-            update.ActionEvents = animationComponent.Actions;
-        }
-    }
+                auto& state = movementStates[entity];
+
+                // If we have nothing new to send skip this, unless the player is still extrapolating a movement that stopped
+                if (movementComponent.Sent && !state.IsMoving())
+                    continue;
+
+                if (cUseDeadReckoning && !state.ShouldSend(movementComponent.Position, movementComponent.Rotation, cTick, movementComponent.Revision, !animationComponent.Actions.empty(), settings))
+                {
+                    ++m_movementStats.SuppressedUpdates;
+                    isExtrapolated |= state.IsMoving();
+                    continue;
+                }
+
+                state.Commit(movementComponent.Position, movementComponent.Rotation, cTick, movementComponent.Revision);
+                ++m_movementStats.SentUpdates;
+                isExtrapolated |= state.IsMoving();
+
+                // Only encode the update the first time a player needs it, the others share the bytes
+                if (!pSegment)
+                {
+                    auto& movement = m_movementUpdate.UpdatedMovement;
+
+                    movement.Position = movementComponent.Position;
+
+                    movement.Rotation.x = movementComponent.Rotation.x;
+                    movement.Rotation.y = movementComponent.Rotation.z;
+
+                    movement.Direction = movementComponent.Direction;
+                    movement.Variables = movementComponent.Variables;
+
+                    m_movementUpdate.ActionEvents = animationComponent.Actions;
+
+                    auto& segment = m_movementSegments[usedSegments++];
+                    ServerReferencesMoveSnapshot::Encode(World::ToInteger(entity), m_movementUpdate, segment, m_movementScratch);
+
+                    pSegment = &segment;
+                }
+
+                pPlayer->GetMovementSnapshot().Segments.push_back(pSegment);
+            }
 
-    m_world.view<AnimationComponent>().each(
-        [](AnimationComponent& animationComponent)
-        {
             if (!animationComponent.Actions.empty())
                 animationComponent.LastSerializedAction = animationComponent.Actions[animationComponent.Actions.size() - 1];
 
             animationComponent.Actions.clear();
-        });
+            movementComponent.Sent = true;
 
-    m_world.view<MovementComponent>().each([](MovementComponent& movementComponent) { movementComponent.Sent = true; });
+            // Come back next time until every receiver saw it stop
+            if (isExtrapolated)
+                m_movementChanges.Mark(entity);
+        });
 
-    for (auto& [pPlayer, message] : messages)
+    for (auto pPlayer : m_world.GetPlayerManager())
     {
-        if (!message.Updates.empty())
-            pPlayer->Send(message);
+        const auto& snapshot = pPlayer->GetMovementSnapshot();
+        if (!snapshot.Segments.empty())
+            pPlayer->Send(snapshot);
     }
 }
@@ -2,13 +2,15 @@
 
 #include <Events/PacketEvent.h>
 #include <Structs/ActorData.h>
+#include <Messages/ServerReferencesMoveSnapshot.h>
+#include <Messages/CharacterSpawnRequest.h>
+
+#include <ecs/ChangeTracker.h>
 
-struct UpdateEvent;
 struct CharacterInteriorCellChangeEvent;
 struct CharacterSpawnedEvent;
 struct World;
 struct AssignCharacterRequest;
-struct CharacterSpawnRequest;
 struct ClientReferencesMoveRequest;
 struct RequestFactionsChanges;
 struct GridCellCoords;
@@ -29,15 +31,31 @@ struct SubtitleRequest;
  */
 struct CharacterService
 {
+    struct MovementStats
+    {
+        uint64_t SentUpdates{0};
+        uint64_t SuppressedUpdates{0};
+    };
+
+    struct SpawnCacheStats
+    {
+        uint64_t Hits{0};
+        uint64_t Misses{0};
+        uint64_t Invalidations{0};
+    };
+
     CharacterService(World& aWorld, entt::dispatcher& aDispatcher) noexcept;
     ~CharacterService() noexcept = default;
 
     TP_NOCOPYMOVE(CharacterService);
 
-    static void Serialize(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept;
+    // Appearance, inventory, factions and tints come from a per entity cache of their encoded form
+    void Serialize(entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) const noexcept;
+
+    [[nodiscard]] const MovementStats& GetMovementStats() const noexcept { return m_movementStats; }
+    [[nodiscard]] const SpawnCacheStats& GetSpawnCacheStats() const noexcept { return m_spawnCacheStats; }
 
 protected:
-    void OnUpdate(const UpdateEvent& acEvent) const noexcept;
     void OnCharacterExteriorCellChange(const CharacterExteriorCellChangeEvent& acEvent) const noexcept;
     void OnCharacterInteriorCellChange(const CharacterInteriorCellChangeEvent& acEvent) const noexcept;
     void OnAssignCharacterRequest(const PacketEvent<AssignCharacterRequest>& acMessage) const noexcept;
@@ -54,6 +72,7 @@ protected:
     void OnSyncExperienceRequest(const PacketEvent<SyncExperienceRequest>& acMessage) const noexcept;
     void OnDialogueRequest(const PacketEvent<DialogueRequest>& acMessage) const noexcept;
     void OnSubtitleRequest(const PacketEvent<SubtitleRequest>& acMessage) const noexcept;
+    void OnSpawnDataChanged(entt::registry& aRegistry, entt::entity aEntity) const noexcept;
 
     void CreateCharacter(const PacketEvent<AssignCharacterRequest>& acMessage) const noexcept;
     void TransferOwnership(Player* apPlayer, const uint32_t acServerId, const ActorData& acActorData) const noexcept;
@@ -67,7 +86,22 @@ protected:
 private:
     World& m_world;
 
-    entt::scoped_connection m_updateConnection;
+    // Characters that moved since the last snapshot, plus the ones a player is still extrapolating
+    mutable ECS::ChangeTracker<MovementComponent> m_movementChanges;
+    // Characters patched since the last factions broadcast
+    mutable ECS::ChangeTracker<CharacterComponent> m_characterChanges;
+
+    mutable MovementStats m_movementStats{};
+    // Movement updates encoded once per snapshot and shared by all recipients
+    mutable Vector<ServerReferencesMoveSnapshot::Segment> m_movementSegments;
+    mutable ReferenceUpdate m_movementUpdate;
+    mutable TiltedPhoques::Buffer m_movementScratch{1 << 16};
+
+    mutable SpawnCacheStats m_spawnCacheStats{};
+    // Dropped whenever a component it was built from is patched or removed
+    mutable TiltedPhoques::Map<entt::entity, SharedPtr<const CharacterSpawnRequest::CachedData>> m_spawnCache;
+    mutable TiltedPhoques::Buffer m_spawnScratch{1 << 20};
+
     entt::scoped_connection m_exteriorCellChangeEventConnection;
     entt::scoped_connection m_interiorCellChangeEventConnection;
     entt::scoped_connection m_characterAssignRequestConnection;
@@ -84,4 +118,10 @@ private:
     entt::scoped_connection m_syncExperienceConnection;
     entt::scoped_connection m_dialogueConnection;
     entt::scoped_connection m_subtitleConnection;
+    entt::scoped_connection m_characterConstructConnection;
+    entt::scoped_connection m_characterUpdateConnection;
+    entt::scoped_connection m_characterDestroyConnection;
+    entt::scoped_connection m_inventoryConstructConnection;
+    entt::scoped_connection m_inventoryUpdateConnection;
+    entt::scoped_connection m_inventoryDestroyConnection;
 };
@@ -52,5 +52,5 @@ void CombatService::OnProjectileLaunchRequest(const PacketEvent<ProjectileLaunch
 
     const auto cShooterEntity = static_cast<entt::entity>(packet.ShooterID);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cShooterEntity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 }
@@ -25,7 +25,7 @@ void CommandService::OnSetTimeCommand(const PacketEvent<SetTimeCommandRequest>&
     // Only set time if player is an admin
     for (const auto session : GameServer::Get()->GetAdminSessions())
     {
-        if (PlayerManager::Get()->GetByConnectionId(session)->GetId() == cPlayerId)
+        if (m_world.GetPlayerManager().GetByConnectionId(session)->GetId() == cPlayerId)
         {
             const auto cHours = static_cast<int>(acMessage.Packet.Hours);
             const auto cMinutes = static_cast<int>(acMessage.Packet.Minutes);
@@ -34,8 +34,7 @@ void InventoryService::OnInventoryChanges(const PacketEvent<RequestInventoryChan
 
     if (it != view.end())
     {
-        auto& inventoryComponent = view.get<InventoryComponent>(*it);
-        inventoryComponent.Content.AddOrRemoveEntry(message.Item);
+        m_world.patch<InventoryComponent>(*it, [&message](auto& inventoryComponent) { inventoryComponent.Content.AddOrRemoveEntry(message.Item); });
     }
 
     if (!message.UpdateClients)
@@ -49,7 +48,7 @@ void InventoryService::OnInventoryChanges(const PacketEvent<RequestInventoryChan
 
     const entt::entity cOrigin = static_cast<entt::entity>(message.ServerId);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cOrigin, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
 void InventoryService::OnEquipmentChanges(const PacketEvent<RequestEquipmentChanges>& acMessage) noexcept
@@ -62,8 +61,7 @@ void InventoryService::OnEquipmentChanges(const PacketEvent<RequestEquipmentChan
 
     if (it != view.end())
     {
-        auto& inventoryComponent = view.get<InventoryComponent>(*it);
-        inventoryComponent.Content.UpdateEquipment(message.CurrentInventory);
+        m_world.patch<InventoryComponent>(*it, [&message](auto& inventoryComponent) { inventoryComponent.Content.UpdateEquipment(message.CurrentInventory); });
     }
 
     NotifyEquipmentChanges notify;
@@ -77,7 +75,7 @@ void InventoryService::OnEquipmentChanges(const PacketEvent<RequestEquipmentChan
 
     const entt::entity cOrigin = static_cast<entt::entity>(message.ServerId);
     if (!GameServer::Get()->SendToPlayersInRange(notify, cOrigin, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+        LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
 void InventoryService::OnWeaponDrawnRequest(const PacketEvent<DrawWeaponRequest>& acMessage) noexcept
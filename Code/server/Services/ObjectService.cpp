@@ -95,19 +95,28 @@ void ObjectService::OnAssignObjectsRequest(const PacketEvent<AssignObjectsReques
         {
             const auto cEntity = m_world.create();
 
+            // The saved state wins over what the client reports, it might be from before a restart or from a client that was away
+            const auto* pSavedState = m_world.GetPersistenceService().FindObjectState(object.Id);
+
             m_world.emplace<FormIdComponent>(cEntity, object.Id);
 
             auto& objectComponent = m_world.emplace<ObjectComponent>(cEntity, acMessage.pPlayer);
-            objectComponent.CurrentLockData = object.CurrentLockData;
+            objectComponent.CurrentLockData = pSavedState ? pSavedState->CurrentLockData : object.CurrentLockData;
 
             m_world.emplace<CellIdComponent>(cEntity, object.CellId, object.WorldSpaceId, object.CurrentCoords);
             auto& inventoryComp = m_world.emplace<InventoryComponent>(cEntity);
-            inventoryComp.Content = object.CurrentInventory;
+            inventoryComp.Content = pSavedState ? pSavedState->CurrentInventory : object.CurrentInventory;
 
             ObjectData objectData;
             objectData.Id = object.Id;
             objectData.ServerId = World::ToInteger(cEntity);
-            objectData.IsSenderFirst = true;
+            objectData.IsSenderFirst = !pSavedState;
+
+            if (pSavedState)
+            {
+                objectData.CurrentLockData = objectComponent.CurrentLockData;
+                objectData.CurrentInventory = inventoryComp.Content;
+            }
 
             response.Objects.push_back(objectData);
         }
@@ -152,9 +161,13 @@ void ObjectService::OnLockChange(const PacketEvent<LockChangeRequest>& acMessage
 
     if (iter != std::end(objectView))
     {
-        auto& objectComponent = objectView.get<ObjectComponent>(*iter);
-        objectComponent.CurrentLockData.IsLocked = acMessage.Packet.IsLocked;
-        objectComponent.CurrentLockData.LockLevel = acMessage.Packet.LockLevel;
+        m_world.patch<ObjectComponent>(
+            *iter,
+            [&acMessage](auto& objectComponent)
+            {
+                objectComponent.CurrentLockData.IsLocked = acMessage.Packet.IsLocked;
+                objectComponent.CurrentLockData.LockLevel = acMessage.Packet.LockLevel;
+            });
     }
 
     for (Player* pPlayer : m_world.GetPlayerManager())
@@ -173,8 +186,8 @@ void ObjectService::OnScriptAnimationRequest(const PacketEvent<ScriptAnimationRe
 
     NotifyScriptAnimation message{};
     message.FormID = packet.FormID;
-    message.Animation = packet.Animation;
-    message.EventName = packet.EventName;
+    message.Animation = packet.Animation.ToString();
+    message.EventName = packet.EventName.ToString();
 
     for (Player* pPlayer : m_world.GetPlayerManager())
     {
@@ -15,6 +15,7 @@
 
 #include "Game/Player.h"
 
+#include <iterator>
 #include <regex>
 
 
@@ -27,14 +28,14 @@ OverlayService::OverlayService(World& aWorld, entt::dispatcher& aDispatcher)
     m_playerHealthConnection = aDispatcher.sink<PacketEvent<RequestPlayerHealthUpdate>>().connect<&OverlayService::OnPlayerHealthUpdate>(this);
 }
 
-void sendPlayerMessage(const ChatMessageType acType, const String acContent, Player* aSendingPlayer) noexcept
+void sendPlayerMessage(const ChatMessageType acType, std::string_view aContent, Player* aSendingPlayer) noexcept
 {
     NotifyChatMessageBroadcast notifyMessage{};
 
     std::regex escapeHtml{"<[^>]+>\\s+(?=<)|<[^>]+>"};
     notifyMessage.MessageType = acType;
     notifyMessage.PlayerName = std::regex_replace(aSendingPlayer->GetUsername(), escapeHtml, "");
-    notifyMessage.ChatMessage = std::regex_replace(acContent, escapeHtml, "");
+    std::regex_replace(std::back_inserter(notifyMessage.ChatMessage), aContent.begin(), aContent.end(), escapeHtml, "");
 
     auto character = aSendingPlayer->GetCharacter();
 
@@ -52,7 +53,7 @@ void sendPlayerMessage(const ChatMessageType acType, const String acContent, Pla
         if (character)
         {
             if (!GameServer::Get()->SendToPlayersInRange(notifyMessage, *character))
-                spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+                LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
         }
         break;
     default: spdlog::error("{} is not a known MessageType", static_cast<uint64_t>(notifyMessage.MessageType)); break;
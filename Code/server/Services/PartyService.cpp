@@ -4,7 +4,6 @@
 
 #include <Events/PlayerJoinEvent.h>
 #include <Events/PlayerLeaveEvent.h>
-#include <Events/UpdateEvent.h>
 
 #include <Messages/NotifyPlayerList.h>
 #include <Messages/NotifyPartyInfo.h>
@@ -26,7 +25,6 @@ Console::Setting bAutoPartyJoin{"Gameplay:bAutoPartyJoin", "Join parties automat
 
 PartyService::PartyService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
-    , m_updateEvent(aDispatcher.sink<UpdateEvent>().connect<&PartyService::OnUpdate>(this))
     , m_playerJoinConnection(aDispatcher.sink<PlayerJoinEvent>().connect<&PartyService::OnPlayerJoin>(this))
     , m_playerLeaveConnection(aDispatcher.sink<PlayerLeaveEvent>().connect<&PartyService::OnPlayerLeave>(this))
     , m_partyInviteConnection(aDispatcher.sink<PacketEvent<PartyInviteRequest>>().connect<&PartyService::OnPartyInvite>(this))
@@ -75,51 +73,52 @@ PartyService::Party* PartyService::GetPlayerParty(Player* const apPlayer) noexce
     return nullptr;
 }
 
-void PartyService::OnUpdate(const UpdateEvent& acEvent) noexcept
+std::optional<uint32_t> PartyService::CreateParty(Player* apLeader) noexcept
 {
-    const auto cCurrentTick = GameServer::Get()->GetTick();
-    if (m_nextInvitationExpire > cCurrentTick)
-        return;
+    auto& partyComponent = apLeader->GetParty();
+    if (partyComponent.JoinedPartyId)
+        return std::nullopt;
 
-    // Only expire once every 10 seconds
-    m_nextInvitationExpire = cCurrentTick + 10000;
+    uint32_t partyId = m_nextId++;
+    Party& party = m_parties[partyId];
+    party.LeaderPlayerId = apLeader->GetId();
+    AddPartyMember(party, partyId, apLeader);
 
-    auto view = m_world.view<PartyComponent>();
-    for (auto entity : view)
-    {
-        auto& partyComponent = view.get<PartyComponent>(entity);
-        auto itor = std::begin(partyComponent.Invitations);
-        while (itor != std::end(partyComponent.Invitations))
-        {
-            if (itor->second < cCurrentTick)
-            {
-                itor = partyComponent.Invitations.erase(itor);
-            }
-            else
-            {
-                ++itor;
-            }
-        }
-    }
+    spdlog::debug("[PartyService]: Created party for {}", apLeader->GetId());
+    SendPartyJoinedEvent(party, apLeader);
+
+    return partyId;
+}
+
+bool PartyService::JoinParty(Player* apPlayer, uint32_t aPartyId) noexcept
+{
+    auto& partyComponent = apPlayer->GetParty();
+    if (partyComponent.JoinedPartyId)
+        return false;
+
+    auto itor = m_parties.find(aPartyId);
+    if (itor == std::end(m_parties))
+        return false;
+
+    Party& party = itor.value();
+    AddPartyMember(party, aPartyId, apPlayer);
+
+    SendPartyJoinedEvent(party, apPlayer);
+    BroadcastPartyInfo(aPartyId);
+
+    return true;
 }
 
 void PartyService::OnPartyCreate(const PacketEvent<PartyCreateRequest>& acPacket) noexcept
 {
     Player* const player = acPacket.pPlayer;
-    auto& inviterPartyComponent = player->GetParty();
 
     spdlog::debug("[PartyService]: Received request to create party");
 
-    if (!inviterPartyComponent.JoinedPartyId) // Ensure not in party
+    if (const auto cPartyId = CreateParty(player)) // Ensure not in party
     {
-        uint32_t partyId = m_nextId++;
+        const uint32_t partyId = *cPartyId;
         Party& party = m_parties[partyId];
-        party.Members.push_back(player);
-        party.LeaderPlayerId = player->GetId();
-        inviterPartyComponent.JoinedPartyId = partyId;
-
-        spdlog::debug("[PartyService]: Created party for {}", player->GetId());
-        SendPartyJoinedEvent(party, player);
 
         if (m_parties.size() == 1 && bAutoPartyJoin)
         {
@@ -127,8 +126,7 @@ void PartyService::OnPartyCreate(const PacketEvent<PartyCreateRequest>& acPacket
             {
                 if (otherPlayer->GetId() != player->GetId())
                 {
-                    party.Members.push_back(otherPlayer);
-                    otherPlayer->GetParty().JoinedPartyId = partyId;
+                    AddPartyMember(party, partyId, otherPlayer);
 
                     SendPartyJoinedEvent(party, otherPlayer);
                 }
@@ -226,8 +224,7 @@ void PartyService::OnPlayerJoin(const PlayerJoinEvent& acEvent) noexcept
                 auto& playerPartyComponent = player->GetParty();
                 Party& party = m_parties[*playerPartyComponent.JoinedPartyId];
 
-                party.Members.push_back(acEvent.pPlayer);
-                acEvent.pPlayer->GetParty().JoinedPartyId = *playerPartyComponent.JoinedPartyId;
+                AddPartyMember(party, *playerPartyComponent.JoinedPartyId, acEvent.pPlayer);
 
                 SendPartyJoinedEvent(party, acEvent.pPlayer);
 
@@ -275,9 +272,24 @@ void PartyService::OnPartyInvite(const PacketEvent<PartyInviteRequest>& acPacket
         }
 
         // Expire in 60 seconds
-        const auto cExpiryTick = GameServer::Get()->GetTick() + 60000;
+        constexpr uint64_t cInvitationLifetimeMs = 60000;
+        const auto cExpiryTick = GameServer::Get()->GetTick() + cInvitationLifetimeMs;
         inviteePartyComponent.Invitations[pInviter] = cExpiryTick;
 
+        // A newer invitation from the same inviter replaces the expiry, the stale timer then leaves it alone
+        m_world.GetTimers().ScheduleOnce("Party invitation expiry", cInvitationLifetimeMs,
+                                         [this, cInviteeId = pInvitee->GetId(), pInviter, cExpiryTick]
+                                         {
+                                             Player* pInvitee = m_world.GetPlayerManager().GetById(cInviteeId);
+                                             if (!pInvitee)
+                                                 return;
+
+                                             auto& invitations = pInvitee->GetParty().Invitations;
+                                             const auto itor = invitations.find(pInviter);
+                                             if (itor != std::end(invitations) && itor->second == cExpiryTick)
+                                                 invitations.erase(itor);
+                                         });
+
         NotifyPartyInvite notification;
         notification.InviterId = pInviter->GetId();
         notification.ExpiryTick = cExpiryTick;
@@ -329,8 +341,7 @@ void PartyService::OnPartyAcceptInvite(const PacketEvent<PartyAcceptInviteReques
             return;
         }
 
-        party.Members.push_back(pSelf);
-        selfPartyComponent.JoinedPartyId = partyId;
+        AddPartyMember(party, partyId, pSelf);
 
         spdlog::debug("[PartyService]: Added invitee to party, sending events");
         SendPartyJoinedEvent(party, pSelf);
@@ -362,6 +373,7 @@ void PartyService::RemovePlayerFromParty(Player* apPlayer) noexcept
         auto& members = party.Members;
 
         members.erase(std::find(std::begin(members), std::end(members), apPlayer));
+        m_world.GetMulticastGroups().Leave(MulticastGroupId::Party(id), apPlayer->GetConnectionId());
 
         if (members.empty())
         {
@@ -446,3 +458,11 @@ void PartyService::SendPartyJoinedEvent(Party& aParty, Player* aPlayer) noexcept
     spdlog::debug("[PartyService]: Sending party join event to player");
     aPlayer->Send(joinedMessage);
 }
+
+void PartyService::AddPartyMember(Party& aParty, uint32_t aPartyId, Player* apPlayer) noexcept
+{
+    aParty.Members.push_back(apPlayer);
+    apPlayer->GetParty().JoinedPartyId = aPartyId;
+
+    m_world.GetMulticastGroups().Join(MulticastGroupId::Party(aPartyId), apPlayer->GetConnectionId());
+}
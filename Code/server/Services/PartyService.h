@@ -3,7 +3,6 @@
 #include <Events/PacketEvent.h>
 
 struct World;
-struct UpdateEvent;
 struct PlayerJoinEvent;
 struct PlayerLeaveEvent;
 struct PartyInviteRequest;
@@ -36,8 +35,12 @@ struct PartyService
     bool IsPlayerLeader(Player* const apPlayer) noexcept;
     Party* GetPlayerParty(Player* const apPlayer) noexcept;
 
+    // Creates a party led by the player and returns its id, nothing is created if the player is already in a party
+    std::optional<uint32_t> CreateParty(Player* apLeader) noexcept;
+    // Adds a player that isn't in a party yet and notifies the members
+    bool JoinParty(Player* apPlayer, uint32_t aPartyId) noexcept;
+
 protected:
-    void OnUpdate(const UpdateEvent& acEvent) noexcept;
     void OnPlayerJoin(const PlayerJoinEvent& acEvent) noexcept;
     void OnPlayerLeave(const PlayerLeaveEvent& acEvent) noexcept;
     void OnPartyInvite(const PacketEvent<PartyInviteRequest>& acPacket) noexcept;
@@ -56,9 +59,7 @@ private:
 
     TiltedPhoques::Map<uint32_t, Party> m_parties;
     uint32_t m_nextId{0};
-    uint64_t m_nextInvitationExpire{0};
 
-    entt::scoped_connection m_updateEvent;
     entt::scoped_connection m_playerJoinConnection;
     entt::scoped_connection m_playerLeaveConnection;
     entt::scoped_connection m_partyInviteConnection;
@@ -69,4 +70,6 @@ private:
     entt::scoped_connection m_partyKickConnection;
 
     void SendPartyJoinedEvent(Party& aParty, Player* aPlayer) noexcept;
+    // Adds the player to the party members and its multicast group
+    void AddPartyMember(Party& aParty, uint32_t aPartyId, Player* apPlayer) noexcept;
 };
@@ -0,0 +1,315 @@
+#include <Services/PersistenceService.h>
+
+#include <GameServer.h>
+#include <World.h>
+#include <Components.h>
+
+#include <Events/PlayerJoinEvent.h>
+#include <Events/PlayerEnterWorldEvent.h>
+
+#include <Messages/RequestQuestUpdate.h>
+#include <Messages/NotifyQuestUpdate.h>
+
+#include <filesystem>
+
+namespace
+{
+Console::Setting bEnablePersistence{"Persistence:bEnable", "Save objects, quest logs and parties so they survive a server restart", true};
+Console::StringSetting sDatabasePath{"Persistence:sDatabasePath", "Path of the sqlite database holding the saved state", "world.db"};
+Console::Setting uFlushIntervalMs{"Persistence:uFlushIntervalMs", "Time in ms between two hand overs of changes to the database writer", 1000u};
+
+enum Kind : uint32_t
+{
+    kObject = 1,
+    kQuestLog = 2,
+    kParty = 3
+};
+
+template <class... T> String Encode(TiltedPhoques::Buffer& aScratch, const T&... acValues) noexcept
+{
+    TiltedPhoques::Buffer::Writer writer(&aScratch);
+    (acValues.Serialize(writer), ...);
+
+    return String(reinterpret_cast<const char*>(aScratch.GetData()), writer.Size());
+}
+
+template <class... T> void Decode(const String& acData, T&... aValues) noexcept
+{
+    ViewBuffer buffer(reinterpret_cast<uint8_t*>(const_cast<char*>(acData.data())), acData.size());
+    TiltedPhoques::Buffer::Reader reader(&buffer);
+    (aValues.Deserialize(reader), ...);
+}
+
+TiltedPhoques::Buffer& GetScratch() noexcept
+{
+    // Only used from the game thread, there is one per server instance
+    static thread_local TiltedPhoques::Buffer s_scratch(1 << 20);
+    return s_scratch;
+}
+
+// The first server instance of the process uses the configured file, the others get their instance index appended so they
+// don't share state and find theirs again on the next run
+String GetDatabasePath() noexcept
+{
+    const auto cInstanceIndex = GameServer::Get()->GetInstanceIndex();
+    if (cInstanceIndex == 0)
+        return sDatabasePath.c_str();
+
+    std::filesystem::path path(sDatabasePath.c_str());
+    const auto cExtension = path.extension().string();
+    path.replace_extension(fmt::format("{}{}", cInstanceIndex, cExtension));
+
+    return path.string().c_str();
+}
+} // namespace
+
+PersistenceService::PersistenceService(World& aWorld, entt::dispatcher& aDispatcher)
+    : m_world(aWorld)
+{
+    if (!bEnablePersistence)
+        return;
+
+    const auto cDatabasePath = GetDatabasePath();
+    // The writer logs for this instance
+    if (!m_store.Open(cDatabasePath.c_str(), [&aWorld] { aWorld.GetAdminService().ClaimCurrentThread(); }))
+        return;
+
+    Load(cDatabasePath);
+
+    aWorld.GetTimers().ScheduleRepeating("Persistence flush", uFlushIntervalMs.value_as<uint64_t>(), [this] { Flush(); });
+
+    m_joinConnection = aDispatcher.sink<PlayerJoinEvent>().connect<&PersistenceService::OnPlayerJoin>(this);
+    m_enterWorldConnection = aDispatcher.sink<PlayerEnterWorldEvent>().connect<&PersistenceService::OnPlayerEnterWorld>(this);
+    m_questUpdateConnection = aDispatcher.sink<PacketEvent<RequestQuestUpdate>>().connect<&PersistenceService::OnQuestChanges>(this);
+    m_objectConstructConnection = aWorld.on_construct<ObjectComponent>().connect<&PersistenceService::OnObjectChanged>(this);
+    m_objectUpdateConnection = aWorld.on_update<ObjectComponent>().connect<&PersistenceService::OnObjectChanged>(this);
+    m_objectDestroyConnection = aWorld.on_destroy<ObjectComponent>().connect<&PersistenceService::OnObjectDestroyed>(this);
+    m_inventoryConstructConnection = aWorld.on_construct<InventoryComponent>().connect<&PersistenceService::OnObjectChanged>(this);
+    m_inventoryUpdateConnection = aWorld.on_update<InventoryComponent>().connect<&PersistenceService::OnObjectChanged>(this);
+    m_inventoryDestroyConnection = aWorld.on_destroy<InventoryComponent>().connect<&PersistenceService::OnObjectDestroyed>(this);
+}
+
+PersistenceService::~PersistenceService() noexcept
+{
+    if (!m_store.IsOpen())
+        return;
+
+    for (auto entity : m_dirtyObjects)
+        JournalObject(entity);
+
+    m_dirtyObjects.clear();
+
+    // Close flushes what is left and waits for the writer
+    m_store.Close();
+}
+
+const PersistenceService::ObjectState* PersistenceService::FindObjectState(const GameId& acId) const noexcept
+{
+    const auto itor = m_objects.find(acId);
+    if (itor == std::end(m_objects))
+        return nullptr;
+
+    return &itor->second;
+}
+
+void PersistenceService::Flush() noexcept
+{
+    for (auto entity : m_dirtyObjects)
+        JournalObject(entity);
+
+    m_dirtyObjects.clear();
+
+    JournalParties();
+
+    // A refused flush keeps the changes, they go out with the next one
+    if (!m_store.Flush())
+        spdlog::warn("[Persistence] Writer is falling behind, {} changes waiting", m_store.GetPendingCount());
+}
+
+void PersistenceService::OnPlayerJoin(const PlayerJoinEvent& acEvent) noexcept
+{
+    RestoreParty(acEvent.pPlayer);
+}
+
+void PersistenceService::OnPlayerEnterWorld(const PlayerEnterWorldEvent& acEvent) noexcept
+{
+    auto* pPlayer = m_world.GetPlayerManager().GetById(acEvent.pPlayer->GetId());
+    if (!pPlayer)
+        return;
+
+    const auto itor = m_questLogs.find(pPlayer->GetUsername());
+    if (itor == std::end(m_questLogs))
+        return;
+
+    // The client reported its own log with the character, saved quests it doesn't have or is behind on are added and sent back
+    auto& entries = pPlayer->GetQuestLogComponent().QuestContent.Entries;
+    bool changed = false;
+
+    for (const auto& cSaved : itor->second.Entries)
+    {
+        NotifyQuestUpdate notify{};
+        notify.Id = cSaved.Id;
+        notify.Stage = cSaved.Stage;
+
+        auto entryItor = std::find_if(std::begin(entries), std::end(entries), [&cSaved](const auto& acEntry) { return acEntry.Id == cSaved.Id; });
+        if (entryItor == std::end(entries))
+        {
+            entries.push_back(cSaved);
+            notify.Status = NotifyQuestUpdate::Started;
+        }
+        else if (entryItor->Stage < cSaved.Stage)
+        {
+            entryItor->Stage = cSaved.Stage;
+            notify.Status = NotifyQuestUpdate::StageUpdate;
+        }
+        else
+            continue;
+
+        pPlayer->Send(notify);
+        changed = true;
+    }
+
+    if (!changed)
+        return;
+
+    spdlog::info("[Persistence] Restored quests of {}", pPlayer->GetUsername().c_str());
+
+    const auto& questLog = pPlayer->GetQuestLogComponent().QuestContent;
+    itor.value() = questLog;
+    m_store.Put(kQuestLog, pPlayer->GetUsername(), Encode(GetScratch(), questLog));
+}
+
+void PersistenceService::OnQuestChanges(const PacketEvent<RequestQuestUpdate>& acMessage) noexcept
+{
+    // QuestService already applied the change to the player's log
+    const auto* pPlayer = acMessage.pPlayer;
+    const auto& questLog = pPlayer->GetQuestLogComponent().QuestContent;
+
+    m_questLogs[pPlayer->GetUsername()] = questLog;
+    m_store.Put(kQuestLog, pPlayer->GetUsername(), Encode(GetScratch(), questLog));
+}
+
+void PersistenceService::OnObjectChanged(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    // Characters have an inventory too, only objects are saved
+    if (aRegistry.all_of<ObjectComponent, InventoryComponent>(aEntity))
+        m_dirtyObjects.insert(aEntity);
+}
+
+void PersistenceService::OnObjectDestroyed(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    // Objects are destroyed when their cell empties, the last changes have to be saved while the components are still there
+    if (m_dirtyObjects.erase(aEntity))
+        JournalObject(aEntity);
+}
+
+void PersistenceService::Load(const String& acPath) noexcept
+{
+    const auto cObjectCount = m_store.Load(
+        kObject,
+        [this](const String& acKey, const String& acData)
+        {
+            GameId id;
+            Decode(acKey, id);
+
+            auto& state = m_objects[id];
+            Decode(acData, state.CurrentLockData, state.CurrentInventory);
+        });
+
+    const auto cQuestLogCount = m_store.Load(kQuestLog, [this](const String& acKey, const String& acData) { Decode(acData, m_questLogs[acKey]); });
+    const auto cPartyCount = m_store.Load(kParty, [this](const String& acKey, const String& acData) { m_partyLeaders[acKey] = acData; });
+
+    spdlog::info("[Persistence] Restored {} objects, {} quest logs and {} party memberships from {}", cObjectCount, cQuestLogCount, cPartyCount, acPath.c_str());
+}
+
+void PersistenceService::JournalObject(entt::entity aEntity) noexcept
+{
+    const auto* pFormIdComponent = m_world.try_get<FormIdComponent>(aEntity);
+    const auto* pObjectComponent = m_world.try_get<ObjectComponent>(aEntity);
+    const auto* pInventoryComponent = m_world.try_get<InventoryComponent>(aEntity);
+
+    if (!pFormIdComponent || !pObjectComponent || !pInventoryComponent)
+        return;
+
+    auto& scratch = GetScratch();
+    auto key = Encode(scratch, pFormIdComponent->Id);
+    m_store.Put(kObject, key, Encode(scratch, pObjectComponent->CurrentLockData, pInventoryComponent->Content));
+
+    // The object goes away with its cell, whoever reports it next has to get this state and not their own
+    auto& state = m_objects[pFormIdComponent->Id];
+    state.CurrentLockData = pObjectComponent->CurrentLockData;
+    state.CurrentInventory = pInventoryComponent->Content;
+}
+
+void PersistenceService::JournalParties() noexcept
+{
+    auto& partyService = m_world.GetPartyService();
+    auto& playerManager = m_world.GetPlayerManager();
+
+    for (Player* pPlayer : playerManager)
+    {
+        String leader;
+        if (const auto* pParty = partyService.GetPlayerParty(pPlayer))
+        {
+            if (const auto* pLeader = playerManager.GetById(pParty->LeaderPlayerId))
+                leader = pLeader->GetUsername();
+        }
+
+        const auto itor = m_partyLeaders.find(pPlayer->GetUsername());
+        const bool cJournaled = itor != std::end(m_partyLeaders);
+
+        if (!leader.empty())
+        {
+            if (cJournaled && itor->second == leader)
+                continue;
+
+            m_partyLeaders[pPlayer->GetUsername()] = leader;
+            m_store.Put(kParty, pPlayer->GetUsername(), leader);
+        }
+        else if (cJournaled)
+        {
+            // Without the leader around the party can't be restored yet, keep it for when they come back
+            if (!playerManager.GetByUsername(itor->second))
+                continue;
+
+            m_partyLeaders.erase(itor);
+            m_store.Erase(kParty, pPlayer->GetUsername());
+        }
+    }
+}
+
+void PersistenceService::RestoreParty(Player* apPlayer) noexcept
+{
+    auto& partyService = m_world.GetPartyService();
+    auto& playerManager = m_world.GetPlayerManager();
+
+    const auto& cUsername = apPlayer->GetUsername();
+
+    // Join the party of our leader if they are already back
+    const auto itor = m_partyLeaders.find(cUsername);
+    if (itor != std::end(m_partyLeaders) && itor->second != cUsername && !partyService.IsPlayerInParty(apPlayer))
+    {
+        // The non-const overload only hands out const players
+        if (auto* pLeader = std::as_const(playerManager).GetByUsername(itor->second))
+        {
+            if (pLeader->GetParty().JoinedPartyId)
+                partyService.JoinParty(apPlayer, *pLeader->GetParty().JoinedPartyId);
+        }
+    }
+
+    // Gather the members that came back before their leader
+    for (Player* pPlayer : playerManager)
+    {
+        if (pPlayer == apPlayer || partyService.IsPlayerInParty(pPlayer))
+            continue;
+
+        const auto memberItor = m_partyLeaders.find(pPlayer->GetUsername());
+        if (memberItor == std::end(m_partyLeaders) || memberItor->second != cUsername)
+            continue;
+
+        if (!partyService.IsPlayerInParty(apPlayer))
+            partyService.CreateParty(apPlayer);
+
+        partyService.JoinParty(pPlayer, *apPlayer->GetParty().JoinedPartyId);
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Events/PacketEvent.h>
+#include <Structs/GameId.h>
+#include <Structs/Inventory.h>
+#include <Structs/LockData.h>
+#include <Structs/QuestLog.h>
+
+#include <persistence/WriteBehindStore.h>
+
+struct World;
+struct PlayerJoinEvent;
+struct PlayerEnterWorldEvent;
+struct RequestQuestUpdate;
+
+/**
+ * @brief Keeps object, quest log and party state across server restarts.
+ *
+ * Changes are collected on the game thread and handed to a WriteBehindStore every few ticks,
+ * the sqlite commit happens on the store's own thread so the tick never waits on the disk.
+ *
+ * Quest logs and parties are keyed by username. The server doesn't authenticate usernames, whoever
+ * joins with the name of a saved player gets their quest log and party back, so persistence is only
+ * as trustworthy as the server password keeping strangers out.
+ */
+class PersistenceService
+{
+public:
+    struct ObjectState
+    {
+        LockData CurrentLockData{};
+        Inventory CurrentInventory{};
+    };
+
+    PersistenceService(World& aWorld, entt::dispatcher& aDispatcher);
+    ~PersistenceService() noexcept;
+
+    TP_NOCOPYMOVE(PersistenceService);
+
+    // Saved state of an object, kept in step with what is journaled so the object gets it back whenever a client reports it again
+    [[nodiscard]] const ObjectState* FindObjectState(const GameId& acId) const noexcept;
+
+    [[nodiscard]] bool IsEnabled() const noexcept { return m_store.IsOpen(); }
+    [[nodiscard]] size_t GetSavedObjectCount() const noexcept { return m_objects.size(); }
+    [[nodiscard]] const Persistence::WriteBehindStore& GetStore() const noexcept { return m_store; }
+
+private:
+    void OnPlayerJoin(const PlayerJoinEvent& acEvent) noexcept;
+    // The quest log comes with the player's character, the saved one is merged into it once it is assigned
+    void OnPlayerEnterWorld(const PlayerEnterWorldEvent& acEvent) noexcept;
+    void OnQuestChanges(const PacketEvent<RequestQuestUpdate>& acMessage) noexcept;
+
+    void OnObjectChanged(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+    void OnObjectDestroyed(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+
+    void Load(const String& acPath) noexcept;
+    // Hands the changes gathered since the last call over to the writer
+    void Flush() noexcept;
+    void JournalObject(entt::entity aEntity) noexcept;
+    void JournalParties() noexcept;
+    void RestoreParty(Player* apPlayer) noexcept;
+
+    World& m_world;
+
+    Persistence::WriteBehindStore m_store;
+
+    // Objects are only journaled once per flush no matter how often they change in between
+    TiltedPhoques::Set<entt::entity> m_dirtyObjects;
+    Map<GameId, ObjectState> m_objects;
+    // Quest logs outlive the player so they are still there when they reconnect
+    Map<String, QuestLog> m_questLogs;
+    // Leader username of each player's party, as last journaled
+    Map<String, String> m_partyLeaders;
+
+    entt::scoped_connection m_joinConnection;
+    entt::scoped_connection m_enterWorldConnection;
+    entt::scoped_connection m_questUpdateConnection;
+    entt::scoped_connection m_objectConstructConnection;
+    entt::scoped_connection m_objectUpdateConnection;
+    entt::scoped_connection m_objectDestroyConnection;
+    entt::scoped_connection m_inventoryConstructConnection;
+    entt::scoped_connection m_inventoryUpdateConnection;
+    entt::scoped_connection m_inventoryDestroyConnection;
+};
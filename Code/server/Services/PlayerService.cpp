@@ -1,6 +1,7 @@
 #include "Events/CharacterInteriorCellChangeEvent.h"
 #include "Events/CharacterExteriorCellChangeEvent.h"
 #include "Events/PlayerLeaveCellEvent.h"
+#include "Events/UpdateEvent.h"
 
 #include <Services/PlayerService.h>
 #include <Services/CharacterService.h>
@@ -21,10 +22,13 @@
 namespace
 {
 Console::Setting fGoldLossFactor{"Gameplay:fGoldLossFactor", "Factor of the amount of gold lost on death", 0.0f};
-}
+Console::Setting uSpawnStreamBytesPerTick{"Network:uSpawnStreamBytesPerTick", "Maximum bytes of character spawns sent to a player per tick after entering cells", 32u * 1024u};
+Console::Setting fSpawnStreamBudgetMs{"Network:fSpawnStreamBudgetMs", "Time in ms spent serializing character spawns per tick for all players", 2.f};
+} // namespace
 
 PlayerService::PlayerService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
+    , m_updateConnection(aDispatcher.sink<UpdateEvent>().connect<&PlayerService::OnUpdate>(this))
     , m_interiorCellEnterConnection(aDispatcher.sink<PacketEvent<EnterInteriorCellRequest>>().connect<&PlayerService::HandleInteriorCellEnter>(this))
     , m_gridCellShiftConnection(aDispatcher.sink<PacketEvent<ShiftGridCellRequest>>().connect<&PlayerService::HandleGridCellShift>(this))
     , m_exteriorCellEnterConnection(aDispatcher.sink<PacketEvent<EnterExteriorCellRequest>>().connect<&PlayerService::HandleExteriorCellEnter>(this))
@@ -45,42 +49,109 @@ void SendPlayerCellChanged(const Player* apPlayer) noexcept
     GameServer::Get()->SendToPlayers(notify, apPlayer);
 }
 
-void PlayerService::HandleGridCellShift(const PacketEvent<ShiftGridCellRequest>& acMessage) const noexcept
+void PlayerService::OnUpdate(const UpdateEvent&) const noexcept
 {
-    auto* pPlayer = acMessage.pPlayer;
-
-    auto& message = acMessage.Packet;
-
-    const GameId oldCell = pPlayer->GetCellComponent().Cell;
+    ProcessSpawnStreams();
+}
 
-    CellIdComponent cell = CellIdComponent{message.PlayerCell, message.WorldSpaceId, message.CenterCoords};
-    pPlayer->SetCellComponent(cell);
+template <class T> void PlayerService::StartSpawnStream(Player* apPlayer, const T& acPredicate) const noexcept
+{
+    const MovementComponent* pOriginMovement = nullptr;
+    if (const auto character = apPlayer->GetCharacter())
+        pOriginMovement = m_world.try_get<MovementComponent>(*character);
 
-    m_world.GetDispatcher().trigger(PlayerLeaveCellEvent(oldCell));
+    Vector<SpawnStream::Entry> entries;
 
-    auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
+    const auto characterView = m_world.GetCharacterView();
     for (auto character : characterView)
     {
         const auto& ownedComponent = characterView.get<OwnerComponent>(character);
-        const auto& characterCellComponent = characterView.get<CellIdComponent>(character);
 
-        if (ownedComponent.GetOwner() == pPlayer)
+        if (ownedComponent.GetOwner() == apPlayer)
             continue;
 
-        const auto cellIt = std::find_if(std::begin(message.Cells), std::end(message.Cells), [Cells = message.Cells, CharacterCell = characterCellComponent.Cell](auto playerCell) { return playerCell == CharacterCell; });
+        if (!acPredicate(characterView.get<CellIdComponent>(character)))
+            continue;
 
-        if (cellIt == std::end(message.Cells))
+        // Characters without a known position are sent last
+        float distanceSquared = std::numeric_limits<float>::max();
+        if (const auto* pMovement = m_world.try_get<MovementComponent>(character); pMovement && pOriginMovement)
         {
-            continue;
+            const glm::vec3 cDelta = pMovement->Position - pOriginMovement->Position;
+            distanceSquared = glm::dot(cDelta, cDelta);
         }
 
-        CharacterSpawnRequest spawnMessage;
-        CharacterService::Serialize(m_world, character, &spawnMessage);
+        entries.push_back({character, distanceSquared});
+    }
+
+    apPlayer->GetSpawnStream().Start(std::move(entries));
+}
+
+void PlayerService::ProcessSpawnStreams() const noexcept
+{
+    const auto cStart = std::chrono::steady_clock::now();
+    const auto cTimeBudget = std::chrono::duration<float, std::milli>(fSpawnStreamBudgetMs.as_float());
+    const auto cByteBudget = uSpawnStreamBytesPerTick.value_as<uint32_t>();
+
+    for (auto* pPlayer : m_world.GetPlayerManager())
+    {
+        auto& stream = pPlayer->GetSpawnStream();
+
+        uint32_t sentBytes = 0;
+
+        // Always send at least one spawn per player so every stream progresses
+        while (sentBytes < cByteBudget)
+        {
+            const auto entity = stream.Pop();
+            if (!entity)
+                break;
+
+            // The character might have been destroyed or taken over by this player since the job started
+            if (!m_world.valid(*entity) || !m_world.all_of<CharacterComponent, OwnerComponent>(*entity))
+                continue;
+
+            if (m_world.get<OwnerComponent>(*entity).GetOwner() == pPlayer)
+                continue;
+
+            CharacterSpawnRequest spawnMessage;
+            m_world.GetCharacterService().Serialize(*entity, &spawnMessage);
+
+            // Checked before encoding so a large spawn waits for the next tick instead of overshooting the budget
+            if (sentBytes > 0 && sentBytes + 1 + spawnMessage.SerializedSizeBound() > cByteBudget)
+            {
+                stream.Unpop();
+                break;
+            }
 
-        pPlayer->Send(spawnMessage);
+            sentBytes += pPlayer->Send(spawnMessage);
+
+            if (std::chrono::steady_clock::now() - cStart >= cTimeBudget)
+                break;
+        }
     }
 }
 
+void PlayerService::HandleGridCellShift(const PacketEvent<ShiftGridCellRequest>& acMessage) const noexcept
+{
+    auto* pPlayer = acMessage.pPlayer;
+
+    auto& message = acMessage.Packet;
+
+    const GameId oldCell = pPlayer->GetCellComponent().Cell;
+
+    CellIdComponent cell = CellIdComponent{message.PlayerCell, message.WorldSpaceId, message.CenterCoords};
+    m_world.GetMulticastGroups().SetPlayerCell(pPlayer, cell);
+
+    m_world.GetDispatcher().trigger(PlayerLeaveCellEvent(oldCell));
+
+    StartSpawnStream(
+        pPlayer,
+        [&message](const CellIdComponent& acCharacterCell)
+        {
+            return std::find(std::begin(message.Cells), std::end(message.Cells), acCharacterCell.Cell) != std::end(message.Cells);
+        });
+}
+
 void PlayerService::HandleExteriorCellEnter(const PacketEvent<EnterExteriorCellRequest>& acMessage) const noexcept
 {
     auto& message = acMessage.Packet;
@@ -97,7 +168,7 @@ void PlayerService::HandleExteriorCellEnter(const PacketEvent<EnterExteriorCellR
             m_world.GetDispatcher().trigger(CharacterExteriorCellChangeEvent{pPlayer, entity, message.WorldSpaceId, message.CurrentCoords});
         }
 
-        pPlayer->SetCellComponent(cell);
+        m_world.GetMulticastGroups().SetPlayerCell(pPlayer, cell);
 
         SendPlayerCellChanged(pPlayer);
     }
@@ -112,7 +183,7 @@ void PlayerService::HandleInteriorCellEnter(const PacketEvent<EnterInteriorCellR
     const auto oldCell = pPlayer->GetCellComponent().Cell;
 
     auto cell = CellIdComponent{message.CellId, {}, {}};
-    pPlayer->SetCellComponent(cell);
+    m_world.GetMulticastGroups().SetPlayerCell(pPlayer, cell);
 
     m_world.GetDispatcher().trigger(PlayerLeaveCellEvent(oldCell));
 
@@ -126,22 +197,7 @@ void PlayerService::HandleInteriorCellEnter(const PacketEvent<EnterInteriorCellR
         }
     }
 
-    auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
-    for (auto character : characterView)
-    {
-        const auto& ownedComponent = characterView.get<OwnerComponent>(character);
-
-        if (ownedComponent.GetOwner() == pPlayer)
-            continue;
-
-        if (message.CellId != characterView.get<CellIdComponent>(character).Cell)
-            continue;
-
-        CharacterSpawnRequest spawnMessage;
-        CharacterService::Serialize(m_world, character, &spawnMessage);
-
-        pPlayer->Send(spawnMessage);
-    }
+    StartSpawnStream(pPlayer, [&message](const CellIdComponent& acCharacterCell) { return message.CellId == acCharacterCell.Cell; });
 
     SendPlayerCellChanged(pPlayer);
 }
@@ -172,7 +228,7 @@ void PlayerService::OnPlayerRespawnRequest(const PacketEvent<PlayerRespawnReques
             entry.BaseId = goldId;
             entry.Count = -goldToRemove;
 
-            inventoryComponent.Content.AddOrRemoveEntry(entry);
+            m_world.patch<InventoryComponent>(*it, [&entry](auto& inventory) { inventory.Content.AddOrRemoveEntry(entry); });
 
             NotifyInventoryChanges notifyInventoryChanges{};
             notifyInventoryChanges.ServerId = World::ToInteger(*character);
@@ -181,7 +237,7 @@ void PlayerService::OnPlayerRespawnRequest(const PacketEvent<PlayerRespawnReques
 
             // Exclude respawned player from inventory changes notification...
             if (!GameServer::Get()->SendToPlayersInRange(notifyInventoryChanges, *character, acMessage.GetSender()))
-                spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+                LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
 
             // ...and instead, send NotifyPlayerRespawn so that the client can print a message.
             NotifyPlayerRespawn notifyPlayerRespawn{};
@@ -195,7 +251,7 @@ void PlayerService::OnPlayerRespawnRequest(const PacketEvent<PlayerRespawnReques
         notifyRespawn.ActorId = World::ToInteger(*character);
 
         if (!GameServer::Get()->SendToPlayersInRange(notifyRespawn, *character, acMessage.GetSender()))
-            spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+            LOG_LIMITED(spdlog::level::err, "{}: SendToPlayersInRange failed", __FUNCTION__);
     }
 }
 
@@ -3,6 +3,8 @@
 #include <Events/PacketEvent.h>
 
 struct World;
+struct Player;
+struct UpdateEvent;
 struct ShiftGridCellRequest;
 struct EnterInteriorCellRequest;
 struct EnterExteriorCellRequest;
@@ -20,15 +22,21 @@ struct PlayerService
     TP_NOCOPYMOVE(PlayerService);
 
 protected:
+    void OnUpdate(const UpdateEvent& acEvent) const noexcept;
     void HandleGridCellShift(const PacketEvent<ShiftGridCellRequest>& acMessage) const noexcept;
     void HandleExteriorCellEnter(const PacketEvent<EnterExteriorCellRequest>& acMessage) const noexcept;
     void HandleInteriorCellEnter(const PacketEvent<EnterInteriorCellRequest>& acMessage) const noexcept;
     void OnPlayerRespawnRequest(const PacketEvent<PlayerRespawnRequest>& acMessage) const noexcept;
     void OnPlayerLevelRequest(const PacketEvent<PlayerLevelRequest>& acMessage) const noexcept;
 
+    // Queues the spawns of every character matching the predicate on the player's spawn stream, nearest first
+    template <class T> void StartSpawnStream(Player* apPlayer, const T& acPredicate) const noexcept;
+    void ProcessSpawnStreams() const noexcept;
+
 private:
     World& m_world;
 
+    entt::scoped_connection m_updateConnection;
     entt::scoped_connection m_gridCellShiftConnection;
     entt::scoped_connection m_exteriorCellEnterConnection;
     entt::scoped_connection m_interiorCellEnterConnection;
@@ -161,7 +161,7 @@ std::tuple<bool, String> ScriptService::HandlePlayerJoin(const ConnectionId_t aP
     return CallCancelableEvent("onPlayerJoin", aPlayer);
 }
 
-std::tuple<bool, String> ScriptService::HandleChatMessage(const entt::entity aSender, const String& aMessage) noexcept
+std::tuple<bool, String> ScriptService::HandleChatMessage(const entt::entity aSender, std::string_view aMessage) noexcept
 {
     return CallCancelableEvent("onChatMessage", aSender, aMessage);
 }
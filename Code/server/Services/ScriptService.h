@@ -29,7 +29,7 @@ struct ScriptService
     std::tuple<bool, String> HandleCharacterSpawn(const entt::entity aPlayer) noexcept;
     std::tuple<bool, String> HandleCharacterDestoy(const entt::entity aPlayer) noexcept;
 
-    std::tuple<bool, String> HandleChatMessage(const entt::entity aSender, const String& aMessage) noexcept;
+    std::tuple<bool, String> HandleChatMessage(const entt::entity aSender, std::string_view aMessage) noexcept;
 
     void HandlePlayerQuit(ConnectionId_t aConnectionId, Server::EDisconnectReason aReason) noexcept;
 
@@ -1,3 +1,4 @@
+#include <AllocationTags.h>
 #include <sol/sol.hpp>
 
 template <typename... Args>
@@ -5,6 +6,8 @@ std::tuple<bool, String> ScriptService::CallCancelableEvent(const String& acName
 {
     m_eventCanceled = false;
 
+    Base::AllocationScope _(AllocationTags::Scripting);
+
     auto& callbacks = m_callbacks[acName];
 
     for (auto& callback : callbacks)
@@ -27,6 +30,8 @@ std::tuple<bool, String> ScriptService::CallCancelableEvent(const String& acName
 
 template <typename... Args> void ScriptService::CallEvent(const String& acName, Args&&... args) noexcept
 {
+    Base::AllocationScope _(AllocationTags::Scripting);
+
     auto& callbacks = m_callbacks[acName];
 
     for (auto& callback : callbacks)
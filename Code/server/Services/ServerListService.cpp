@@ -1,6 +1,5 @@
 #include <Events/PlayerJoinEvent.h>
 #include <Events/PlayerLeaveEvent.h>
-#include <Events/UpdateEvent.h>
 #include <GameServer.h>
 #include <Services/ServerListService.h>
 
@@ -20,36 +19,31 @@ static Console::Setting bAnnounceServer{"LiveServices:bAnnounceServer", "Whether
 
 ServerListService::ServerListService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
-    , m_updateConnection(aDispatcher.sink<UpdateEvent>().connect<&ServerListService::OnUpdate>(this))
-    , m_nextAnnounce(std::chrono::seconds(0))
 {
     if (!bAnnounceServer)
         spdlog::warn("bAnnounceServer is set to false. The server will not show up as a public server. "
                      "If you are just playing with friends, this is probably what you want.");
-}
-
-void ServerListService::OnUpdate(const UpdateEvent& acEvent) noexcept
-{
-    if (m_nextAnnounce < std::chrono::steady_clock::now())
-    {
-        Announce();
 
-        m_nextAnnounce = (std::chrono::steady_clock::now() + std::chrono::minutes(1));
-    }
+    ScheduleAnnounce(0);
 }
 
 void ServerListService::OnPlayerJoin(const PlayerJoinEvent& acEvent) noexcept
 {
     Announce();
-
-    m_nextAnnounce = (std::chrono::steady_clock::now() + std::chrono::minutes(1));
+    ScheduleAnnounce(kAnnounceIntervalMs);
 }
 
 void ServerListService::OnPlayerLeave(const PlayerLeaveEvent& acEvent) noexcept
 {
     Announce();
+    ScheduleAnnounce(kAnnounceIntervalMs);
+}
 
-    m_nextAnnounce = (std::chrono::steady_clock::now() + std::chrono::minutes(1));
+void ServerListService::ScheduleAnnounce(uint64_t aFirstDelayMs) noexcept
+{
+    auto& timers = m_world.GetTimers();
+    timers.Cancel(m_announceTimer);
+    m_announceTimer = timers.ScheduleRepeating("Server list announce", kAnnounceIntervalMs, [this] { Announce(); }, aFirstDelayMs);
 }
 
 void ServerListService::Announce() noexcept
@@ -1,7 +1,8 @@
 #pragma once
 
+#include <timing/TimerWheel.h>
+
 struct World;
-struct UpdateEvent;
 struct PlayerJoinEvent;
 struct PlayerLeaveEvent;
 
@@ -16,12 +17,13 @@ struct ServerListService
     TP_NOCOPYMOVE(ServerListService);
 
 protected:
-    void OnUpdate(const UpdateEvent& acEvent) noexcept;
     void OnPlayerJoin(const PlayerJoinEvent& acEvent) noexcept;
     void OnPlayerLeave(const PlayerLeaveEvent& acEvent) noexcept;
 
 private:
     void Announce() noexcept;
+    // Restarts the periodic announce, the first one after aFirstDelayMs
+    void ScheduleAnnounce(uint64_t aFirstDelayMs) noexcept;
 
     static void PostAnnouncement(String acName, String acDesc, String acIconUrl, uint16_t aPort, uint16_t aTick,
                                  uint16_t aPlayerCount, uint16_t aPlayerMaxCount, String acTagList, bool aPublic,
@@ -29,13 +31,14 @@ private:
 
     World& m_world;
 
-    entt::scoped_connection m_updateConnection;
     entt::scoped_connection m_playerJoinConnection;
     entt::scoped_connection m_playerLeaveConnection;
-    mutable std::chrono::steady_clock::time_point m_nextAnnounce;
+    Timing::TimerWheel::TimerId m_announceTimer{Timing::TimerWheel::kInvalidTimer};
 
     int32 m_flags = 0;
 
+    static constexpr uint64_t kAnnounceIntervalMs = 60 * 1000;
+
     enum
     {
         kHasPassword = 1 << 0,
@@ -2,26 +2,16 @@
 
 #include <GameServer.h>
 #include <Services/StringCacheService.h>
-#include <Events/UpdateEvent.h>
 #include <Game/Player.h>
 
 StringCacheService::StringCacheService(World& aWorld, entt::dispatcher& aDispatcher)
     : m_world(aWorld)
-    , m_updateConnection(aDispatcher.sink<UpdateEvent>().connect<&StringCacheService::HandleUpdate>(this))
 {
+    aWorld.GetTimers().ScheduleRepeating("String cache", 2000, [this] { SendDirtyStrings(); });
 }
 
-void StringCacheService::HandleUpdate(const UpdateEvent&) const noexcept
+void StringCacheService::SendDirtyStrings() const noexcept
 {
-    static std::chrono::steady_clock::time_point lastSendTimePoint;
-    constexpr auto cDelayBetweenSnapshots = 2000ms;
-
-    const auto now = std::chrono::steady_clock::now();
-    if (now - lastSendTimePoint < cDelayBetweenSnapshots)
-        return;
-
-    lastSendTimePoint = now;
-
     auto& stringCache = StringCache::Get();
 
     if (!stringCache.ProcessDirty())
@@ -1,6 +1,5 @@
 #pragma once
 
-struct UpdateEvent;
 struct World;
 
 /**
@@ -11,10 +10,8 @@ struct StringCacheService
     StringCacheService(World& aWorld, entt::dispatcher& aDispatcher);
 
 protected:
-    void HandleUpdate(const UpdateEvent&) const noexcept;
+    void SendDirtyStrings() const noexcept;
 
 private:
     World& m_world;
-
-    entt::scoped_connection m_updateConnection;
 };
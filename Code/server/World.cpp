@@ -16,13 +16,75 @@
 #include <Services/WeatherService.h>
 #include <Services/ScriptService.h>
 #include <Services/MapService.h>
+#include <Services/PersistenceService.h>
 
+#include <AllocationTags.h>
 #include <es_loader/ESLoader.h>
+#include <logging/AsyncSink.h>
 
-World::World()
+namespace
 {
+// The runner writes logs from a background thread, admin logs go through it rather than the game thread
+void AttachLogSink(const spdlog::sink_ptr& acSink)
+{
+    auto& sinks = spdlog::default_logger()->sinks();
+    for (auto& sink : sinks)
+    {
+        if (const auto pAsync = std::dynamic_pointer_cast<Logging::AsyncSink>(sink))
+        {
+            pAsync->AddSink(acSink);
+            return;
+        }
+    }
+
+    sinks.push_back(acSink);
+}
+
+void DetachLogSink(const spdlog::sink_ptr& acSink)
+{
+    auto& sinks = spdlog::default_logger()->sinks();
+    for (auto& sink : sinks)
+    {
+        if (const auto pAsync = std::dynamic_pointer_cast<Logging::AsyncSink>(sink))
+            pAsync->RemoveSink(acSink);
+    }
+
+    sinks.erase(std::remove(std::begin(sinks), std::end(sinks), acSink), std::end(sinks));
+}
+
+struct LoadedData
+{
+    TiltedPhoques::SharedPtr<const ESLoader::RecordCollection> pRecordCollection;
+    ESLoader::PluginCollection LoadOrder;
+};
+
+// The data files don't change while the process runs, every server instance reads the same copy
+const LoadedData& GetLoadedData()
+{
+    static const LoadedData s_data = []
+    {
+        Base::AllocationScope _(AllocationTags::ESLoader);
+
+        ESLoader::ESLoader loader;
+        LoadedData data;
+        data.pRecordCollection = loader.BuildRecordCollection();
+        data.LoadOrder = loader.GetLoadOrder();
+        return data;
+    }();
+
+    return s_data;
+}
+} // namespace
+
+World::World(uint64_t aNowMs)
+    : m_timers(aNowMs)
+{
+    ctx().emplace<OwnershipIndex>(*this);
+
     m_spAdminService = std::make_shared<AdminService>(*this, m_dispatcher);
-    spdlog::default_logger()->sinks().push_back(std::static_pointer_cast<spdlog::sinks::sink>(m_spAdminService));
+    AttachLogSink(m_spAdminService);
+
+    m_timers.ScheduleRepeating("Suppressed logs", 1000, [] { Logging::RateLimiter::ReportSuppressed(); });
 
     ctx().emplace<CharacterService>(*this, m_dispatcher);
     ctx().emplace<PlayerService>(*this, m_dispatcher);
@@ -41,11 +103,13 @@ World::World()
     ctx().emplace<CombatService>(*this, m_dispatcher);
     ctx().emplace<WeatherService>(*this, m_dispatcher);
     ctx().emplace<MapService>(*this, m_dispatcher);
+    // Registered last so quest and party changes are seen after their services applied them
+    ctx().emplace<PersistenceService>(*this, m_dispatcher);
 
-    ESLoader::ESLoader loader;
+    const auto& cLoadedData = GetLoadedData();
+    m_pRecordCollection = cLoadedData.pRecordCollection;
     // emplace loaded mods into modscomponent.
-    m_recordCollection = loader.BuildRecordCollection();
-    for (const auto& it : loader.GetLoadOrder())
+    for (const auto& it : cLoadedData.LoadOrder)
     {
         ctx().emplace<ModsComponent>().AddServerMod(it);
     }
@@ -56,5 +120,6 @@ World::World()
 
 World::~World()
 {
+    DetachLogSink(m_spAdminService);
     m_pScriptService.reset();
 }
@@ -8,8 +8,14 @@
 #include <Services/CalendarService.h>
 #include <Services/QuestService.h>
 #include <Services/ScriptService.h>
+#include <Services/PersistenceService.h>
 
 #include "Game/PlayerManager.h"
+#include "Game/OwnershipIndex.h"
+#include "Game/MulticastGroups.h"
+#include "ComponentViews.h"
+
+#include <timing/TimerWheel.h>
 
 namespace ESLoader
 {
@@ -18,7 +24,8 @@ struct RecordCollection;
 
 struct World : entt::registry
 {
-    World();
+    // aNowMs is the server tick the timers start counting from
+    explicit World(uint64_t aNowMs);
     ~World() noexcept;
 
     TP_NOCOPYMOVE(World);
@@ -35,22 +42,34 @@ struct World : entt::registry
     const CalendarService& GetCalendarService() const noexcept { return ctx().at<const CalendarService>(); }
     QuestService& GetQuestService() noexcept { return ctx().at<QuestService>(); }
     const QuestService& GetQuestService() const noexcept { return ctx().at<const QuestService>(); }
+    PersistenceService& GetPersistenceService() noexcept { return ctx().at<PersistenceService>(); }
+    const PersistenceService& GetPersistenceService() const noexcept { return ctx().at<const PersistenceService>(); }
+    AdminService& GetAdminService() noexcept { return *m_spAdminService; }
+    auto GetMovementView() noexcept { return ComponentViews::Movement(*this); }
+    auto GetCharacterView() noexcept { return ComponentViews::Characters(*this); }
+    const OwnershipIndex& GetOwnershipIndex() const noexcept { return ctx().at<const OwnershipIndex>(); }
     PlayerManager& GetPlayerManager() noexcept { return m_playerManager; }
     const PlayerManager& GetPlayerManager() const noexcept { return m_playerManager; }
+    MulticastGroups& GetMulticastGroups() noexcept { return m_multicastGroups; }
+    const MulticastGroups& GetMulticastGroups() const noexcept { return m_multicastGroups; }
+    // Driven by the server tick, in milliseconds
+    Timing::TimerWheel& GetTimers() noexcept { return m_timers; }
+    const Timing::TimerWheel& GetTimers() const noexcept { return m_timers; }
     ScriptService& GetScriptService() const noexcept { return *m_pScriptService; }
 
-    // Null checked at start when MoPo is on!
-    ESLoader::RecordCollection* GetRecordCollection() noexcept { return m_recordCollection.get(); }
-
-    const ESLoader::RecordCollection* GetRecordCollection() const noexcept { return m_recordCollection.get(); }
+    // Null checked at start when MoPo is on! Loaded once and shared by every server instance of the process
+    const ESLoader::RecordCollection* GetRecordCollection() const noexcept { return m_pRecordCollection.get(); }
 
     [[nodiscard]] static uint32_t ToInteger(entt::entity aEntity) { return to_integral(aEntity); }
 
 private:
     entt::dispatcher m_dispatcher;
+    // Declared first so services can schedule on it while being constructed
+    Timing::TimerWheel m_timers;
 
     TiltedPhoques::SharedPtr<AdminService> m_spAdminService;
     TiltedPhoques::UniquePtr<ScriptService> m_pScriptService;
     PlayerManager m_playerManager;
-    UniquePtr<ESLoader::RecordCollection> m_recordCollection;
+    MulticastGroups m_multicastGroups;
+    TiltedPhoques::SharedPtr<const ESLoader::RecordCollection> m_pRecordCollection;
 };
@@ -0,0 +1,248 @@
+#include <NetworkThread.h>
+#include <base/containers/fast_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kSamples = 2000;
+constexpr uint32_t kLoadThreads = 3;
+// Time between two measured packets, about a 60Hz server sending to a handful of players
+constexpr auto kSendInterval = 250us;
+
+struct Latencies
+{
+    void Add(Clock::duration aLatency) { Samples.push_back(std::chrono::duration<double, std::micro>(aLatency).count()); }
+
+    void Print(const char* apName)
+    {
+        std::sort(std::begin(Samples), std::end(Samples));
+        const auto cPercentile = [this](double aValue) { return Samples[static_cast<size_t>(aValue * static_cast<double>(Samples.size() - 1))]; };
+
+        printf("%-32s p50 %8.1f us, p99 %8.1f us, max %8.1f us\n", apName, cPercentile(0.5), cPercentile(0.99), Samples.back());
+    }
+
+    Vector<double> Samples;
+};
+
+// Keeps the other cores busy, a loaded host is when wake ups matter
+struct Load
+{
+    Load()
+    {
+        for (uint32_t i = 0; i < kLoadThreads; ++i)
+        {
+            Threads.emplace_back(
+                [this]
+                {
+                    volatile uint64_t sink = 0;
+                    while (Running.load(std::memory_order_relaxed))
+                        sink = sink + 1;
+                });
+        }
+    }
+
+    ~Load()
+    {
+        Running = false;
+        for (auto& thread : Threads)
+            thread.join();
+    }
+
+    std::atomic<bool> Running{true};
+    Vector<std::thread> Threads;
+};
+
+TEST(NetworkThread, PacketsKeepTheirOrder)
+{
+    std::atomic<uint32_t> next{0};
+    std::atomic<bool> ordered{true};
+
+    {
+        NetworkThread thread([] {},
+                             [&](NetworkThread::Outbound& aCommand)
+                             {
+                                 if (aCommand.ConnectionId != next.fetch_add(1))
+                                     ordered = false;
+                             });
+        thread.Start();
+
+        for (uint32_t i = 0; i < 50000; ++i)
+        {
+            NetworkThread::Outbound command{NetworkThread::Outbound::kPacket, i};
+            thread.PushOutbound(command);
+        }
+    }
+
+    // Stopping sends everything that was queued
+    EXPECT_EQ(next.load(), 50000);
+    EXPECT_TRUE(ordered.load());
+}
+
+TEST(NetworkThread, SaturatedQueues)
+{
+    // More than either queue holds
+    constexpr uint32_t kFlood = 20000;
+    constexpr size_t kMaxPerTick = 1000;
+
+    std::atomic<bool> flooded{false};
+    std::atomic<bool> released{false};
+    std::atomic<uint32_t> kicks{0};
+    std::atomic<uint32_t> next{0};
+    std::atomic<bool> ordered{true};
+    uint32_t messages = 0;
+    bool connected = false;
+    uint64_t dropped = 0;
+
+    {
+        NetworkThread* pThread = nullptr;
+        NetworkThread thread(
+            [&]
+            {
+                if (flooded.load())
+                    return;
+
+                // A single poll receiving more than the game thread takes, then a connection that can't be dropped
+                for (uint32_t i = 0; i < kFlood; ++i)
+                {
+                    NetworkThread::Inbound event{NetworkThread::Inbound::kMessage, i};
+                    pThread->PushInbound(event);
+                }
+                flooded = true;
+
+                NetworkThread::Inbound connection{NetworkThread::Inbound::kConnection, kFlood};
+                pThread->PushInbound(connection);
+            },
+            [&](NetworkThread::Outbound& aCommand)
+            {
+                if (aCommand.CommandType == NetworkThread::Outbound::kKick)
+                {
+                    ++kicks;
+                    return;
+                }
+
+                // Sending is stuck until the game thread is done pushing
+                while (!released.load())
+                    std::this_thread::yield();
+
+                if (aCommand.ConnectionId != next.fetch_add(1))
+                    ordered = false;
+            });
+        pThread = &thread;
+        thread.Start();
+
+        while (!flooded.load())
+            std::this_thread::yield();
+
+        // The network thread waits for room in the inbound queue, pushing outbound must not wait for it in turn
+        for (uint32_t i = 0; i < kFlood * 2; ++i)
+        {
+            NetworkThread::Outbound command{NetworkThread::Outbound::kPacket, i};
+            thread.PushOutbound(command);
+        }
+
+        EXPECT_GT(thread.GetOutboundOverflows(), 0u);
+        released = true;
+
+        while (!connected)
+        {
+            thread.FlushOutbound();
+
+            const auto cHandled = thread.DrainInbound(
+                [&](NetworkThread::Inbound& aEvent)
+                {
+                    if (aEvent.EventType == NetworkThread::Inbound::kConnection)
+                        connected = true;
+                    else
+                        ++messages;
+                },
+                kMaxPerTick);
+
+            EXPECT_LE(cHandled, kMaxPerTick);
+        }
+
+        dropped = thread.GetDroppedInbound();
+        thread.Stop();
+        EXPECT_EQ(thread.GetOutboundBacklog(), 0u);
+    }
+
+    // Every packet was either handled or dropped with its connection kicked
+    EXPECT_GT(dropped, 0u);
+    EXPECT_EQ(messages + dropped, kFlood);
+    EXPECT_EQ(kicks.load(), dropped);
+
+    EXPECT_EQ(next.load(), kFlood * 2);
+    EXPECT_TRUE(ordered.load());
+}
+
+TEST(NetworkThread, Benchmark)
+{
+    Load load;
+
+    // The previous hand off pattern, a fast_queue reader sleeping 1ms whenever it finds the queue empty
+    {
+        fast_queue<Clock::time_point, 8> queue;
+        std::atomic<bool> running{true};
+        Latencies latencies;
+
+        std::thread reader(
+            [&]
+            {
+                while (running.load(std::memory_order_relaxed) || !queue.empty())
+                {
+                    if (queue.empty())
+                    {
+                        std::this_thread::sleep_for(1ms);
+                        continue;
+                    }
+
+                    Clock::time_point* pSent;
+                    auto lock = queue.read_acquire(pSent);
+                    latencies.Add(Clock::now() - *pSent);
+                }
+            });
+
+        for (uint32_t i = 0; i < kSamples; ++i)
+        {
+            Clock::time_point* pSent;
+            {
+                auto lock = queue.write_acquire(pSent);
+                *pSent = Clock::now();
+            }
+            std::this_thread::sleep_for(kSendInterval);
+        }
+
+        running = false;
+        reader.join();
+        latencies.Print("fast_queue, 1ms reader sleep");
+    }
+
+    // Outbound packets wake the network thread up
+    {
+        Latencies latencies;
+        Vector<Clock::time_point> sent(kSamples);
+
+        {
+            NetworkThread thread([] {}, [&](NetworkThread::Outbound& aCommand) { latencies.Add(Clock::now() - sent[aCommand.ConnectionId]); });
+            thread.Start();
+
+            for (uint32_t i = 0; i < kSamples; ++i)
+            {
+                sent[i] = Clock::now();
+                NetworkThread::Outbound command{NetworkThread::Outbound::kPacket, i};
+                thread.PushOutbound(command);
+                std::this_thread::sleep_for(kSendInterval);
+            }
+        }
+
+        latencies.Print("NetworkThread, outbound wake up");
+    }
+}
+} // namespace
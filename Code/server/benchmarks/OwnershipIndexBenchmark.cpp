@@ -0,0 +1,139 @@
+#include "SyntheticWorld.h"
+
+#include <Game/OwnerView.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+constexpr uint32_t kEntityCount = 2000;
+constexpr uint32_t kRounds = 200;
+
+// What disconnect handling did before: walk every owned entity on the server
+size_t CollectByScan(entt::registry& aRegistry, const Player* apPlayer, Vector<entt::entity>& aEntities)
+{
+    aEntities.clear();
+
+    auto ownerView = aRegistry.view<OwnerComponent>();
+    for (auto entity : ownerView)
+    {
+        if (ownerView.get<OwnerComponent>(entity).GetOwner() == apPlayer)
+            aEntities.push_back(entity);
+    }
+
+    return aEntities.size();
+}
+
+size_t CollectByIndex(const OwnershipIndex& acIndex, const Player* apPlayer, Vector<entt::entity>& aEntities)
+{
+    aEntities.clear();
+
+    for (auto entity : acIndex.GetEntities(apPlayer))
+        aEntities.push_back(entity);
+
+    return aEntities.size();
+}
+} // namespace
+
+TEST(OwnershipIndex, FollowsOwnerChanges)
+{
+    PlayerStubs players(2);
+    entt::registry registry;
+    OwnershipIndex index(registry);
+
+    const auto cFirst = registry.create();
+    const auto cSecond = registry.create();
+    registry.emplace<OwnerComponent>(cFirst, players.Get(0));
+    registry.emplace<OwnerComponent>(cSecond, players.Get(0));
+
+    EXPECT_EQ(index.Count(players.Get(0)), 2);
+    EXPECT_EQ(index.Count(players.Get(1)), 0);
+
+    registry.patch<OwnerComponent>(cFirst, [&players](auto& aOwnerComponent) { aOwnerComponent.SetOwner(players.Get(1)); });
+    EXPECT_EQ(index.Count(players.Get(0)), 1);
+    EXPECT_EQ(index.IndexOf(cFirst, players.Get(0)), OwnershipIndex::kNotOwned);
+    EXPECT_EQ(index.GetEntities(players.Get(1))[index.IndexOf(cFirst, players.Get(1))], cFirst);
+
+    // Patching without changing the owner keeps the entity where it is
+    registry.patch<OwnerComponent>(cSecond);
+    EXPECT_EQ(index.IndexOf(cSecond, players.Get(0)), 0);
+
+    registry.destroy(cSecond);
+    registry.remove<OwnerComponent>(cFirst);
+    EXPECT_EQ(index.Count(players.Get(0)), 0);
+    EXPECT_EQ(index.Count(players.Get(1)), 0);
+}
+
+TEST(OwnershipIndex, OwnerViewOnlyVisitsOwnedEntities)
+{
+    PlayerStubs players(2);
+    entt::registry registry;
+    registry.ctx().emplace<OwnershipIndex>(registry);
+
+    Vector<entt::entity> owned;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        const auto cEntity = registry.create();
+        registry.emplace<OwnerComponent>(cEntity, players.Get(i % 2));
+
+        // Half of the entities the player owns are characters
+        if (i % 4 == 0)
+        {
+            registry.emplace<CharacterComponent>(cEntity);
+            owned.push_back(cEntity);
+        }
+    }
+
+    OwnerView<CharacterComponent> view(registry, players.Get(0));
+
+    Vector<entt::entity> visited;
+    for (auto entity : view)
+        visited.push_back(entity);
+
+    EXPECT_EQ(visited.size(), owned.size());
+    EXPECT_TRUE(std::is_permutation(std::begin(visited), std::end(visited), std::begin(owned)));
+
+    EXPECT_TRUE(view.find(owned[1]) != std::end(view));
+    EXPECT_EQ(*view.find(owned[1]), owned[1]);
+    // Owned by the other player, and owned but not a character
+    EXPECT_TRUE(view.find(static_cast<entt::entity>(1)) == std::end(view));
+    EXPECT_TRUE(view.find(static_cast<entt::entity>(2)) == std::end(view));
+}
+
+TEST(OwnershipIndex, Benchmark)
+{
+    SyntheticWorld world(kEntityCount);
+
+    Vector<entt::entity> entities;
+    entities.reserve(kEntityCount);
+
+    // Each round disconnects every player once, without actually removing anything
+    size_t scanned = 0;
+    const auto cScanStart = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < kRounds; ++round)
+    {
+        for (uint32_t i = 0; i < SyntheticWorld::kPlayerCount; ++i)
+            scanned += CollectByScan(world.Registry, world.Players.Get(i), entities);
+    }
+    const auto cScanTime = std::chrono::steady_clock::now() - cScanStart;
+
+    size_t indexed = 0;
+    const auto cIndexStart = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < kRounds; ++round)
+    {
+        for (uint32_t i = 0; i < SyntheticWorld::kPlayerCount; ++i)
+            indexed += CollectByIndex(world.GetOwnershipIndex(), world.Players.Get(i), entities);
+    }
+    const auto cIndexTime = std::chrono::steady_clock::now() - cIndexStart;
+
+    EXPECT_EQ(scanned, indexed);
+
+    const auto cDisconnects = static_cast<double>(kRounds * SyntheticWorld::kPlayerCount);
+    printf("%u owned entities, %u players\n", kEntityCount, SyntheticWorld::kPlayerCount);
+    printf("disconnect: view scan %.2f us, ownership index %.2f us\n", std::chrono::duration<double, std::micro>(cScanTime).count() / cDisconnects,
+           std::chrono::duration<double, std::micro>(cIndexTime).count() / cDisconnects);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Components.h>
+#include <Game/OwnershipIndex.h>
+
+/**
+ * @brief Stand-ins for the players owning entities in the benchmarks.
+ *
+ * Ownership only ever compares player pointers, the benchmarks never dereference them. Real players can't be built
+ * here, Player::Send pulls in the whole GameServer. Each stub is storage shaped like a player so the addresses are
+ * distinct and aligned like the real ones.
+ */
+class PlayerStubs
+{
+public:
+    explicit PlayerStubs(uint32_t aCount)
+        : m_slots(aCount)
+    {
+    }
+
+    [[nodiscard]] Player* Get(uint32_t aIndex) noexcept { return reinterpret_cast<Player*>(&m_slots[aIndex]); }
+    [[nodiscard]] uint32_t Count() const noexcept { return static_cast<uint32_t>(m_slots.size()); }
+
+private:
+    struct alignas(Player) Slot
+    {
+        std::byte Bytes[sizeof(Player)];
+    };
+
+    Vector<Slot> m_slots;
+};
+
+/**
+ * @brief A world the way the server builds it, characters spread over the players with objects mixed in between.
+ */
+struct SyntheticWorld
+{
+    static constexpr uint32_t kPlayerCount = 32;
+    static constexpr uint32_t kCellCount = 64;
+
+    explicit SyntheticWorld(uint32_t aEntityCount)
+        : Players(kPlayerCount)
+    {
+        // Same as the server world, the index has to see every owner from the start
+        Registry.ctx().emplace<OwnershipIndex>(Registry);
+
+        for (uint32_t i = 0; i < aEntityCount; ++i)
+        {
+            const auto cEntity = Registry.create();
+
+            Registry.emplace<FormIdComponent>(cEntity, i, 0u);
+            Registry.emplace<OwnerComponent>(cEntity, Players.Get(i % kPlayerCount));
+            Registry.emplace<CellIdComponent>(cEntity, GameId(0, i % kCellCount));
+
+            // One out of four entities is an object
+            if (i % 4 == 0)
+            {
+                Registry.emplace<ObjectComponent>(cEntity, nullptr);
+                Registry.emplace<InventoryComponent>(cEntity);
+                continue;
+            }
+
+            auto& characterComponent = Registry.emplace<CharacterComponent>(cEntity);
+            characterComponent.SetDragon(i % 97 == 0);
+
+            Registry.emplace<InventoryComponent>(cEntity);
+            Registry.emplace<ActorValuesComponent>(cEntity);
+
+            auto& movementComponent = Registry.emplace<MovementComponent>(cEntity);
+            movementComponent.Position = glm::vec3(static_cast<float>(i), static_cast<float>(i % 100), 0.f);
+            movementComponent.Sent = i % 3 == 0;
+
+            Registry.emplace<AnimationComponent>(cEntity);
+        }
+    }
+
+    [[nodiscard]] const OwnershipIndex& GetOwnershipIndex() const noexcept { return Registry.ctx().at<const OwnershipIndex>(); }
+
+    [[nodiscard]] static constexpr uint32_t CharacterCount(uint32_t aEntityCount) noexcept { return aEntityCount - (aEntityCount + 3) / 4; }
+
+    PlayerStubs Players;
+    entt::registry Registry;
+};
@@ -16,8 +16,8 @@ constexpr char kBuildTag[]{BUILD_BRANCH "@" BUILD_COMMIT};
 
 struct GameServerInstance final : IGameServerInstance
 {
-    GameServerInstance(Console::ConsoleRegistry& aConsole)
-        : m_gameServer(aConsole)
+    GameServerInstance(Console::ConsoleRegistry& aConsole, uint32_t aInstanceIndex)
+        : m_gameServer(aConsole, aInstanceIndex)
     {
     }
 
@@ -30,6 +30,8 @@ struct GameServerInstance final : IGameServerInstance
     bool IsListening() override;
     bool IsRunning() override;
     void Update() override;
+    uint32_t GetTickRate() override;
+    bool HasClients() override;
 
 private:
     GameServer m_gameServer;
@@ -58,7 +60,17 @@ bool GameServerInstance::IsRunning()
 
 void GameServerInstance::Update()
 {
-    m_gameServer.Update();
+    m_gameServer.Tick();
+}
+
+uint32_t GameServerInstance::GetTickRate()
+{
+    return m_gameServer.GetTickRate();
+}
+
+bool GameServerInstance::HasClients()
+{
+    return m_gameServer.GetClientCount() > 0;
 }
 
 // NOTE(Vince): For now we use this to compare the dll to the server.
@@ -72,7 +84,7 @@ GS_EXPORT bool CheckBuildTag(const char* apBuildTag)
     return std::strcmp(apBuildTag, kBuildTag) == 0;
 }
 
-GS_EXPORT UniquePtr<IGameServerInstance> CreateGameServer(Console::ConsoleRegistry& aConReg, const std::function<void()>& aCallback)
+GS_EXPORT UniquePtr<IGameServerInstance> CreateGameServer(Console::ConsoleRegistry& aConReg, const std::function<void()>& aCallback, uint32_t aInstanceIndex)
 {
     BASE_ASSERT(aCallback, "CreateGameServer(): Callback was not provided");
 
@@ -82,7 +94,7 @@ GS_EXPORT UniquePtr<IGameServerInstance> CreateGameServer(Console::ConsoleRegist
     // this is a special callback to notify the runner once all settings become available
     aCallback();
 
-    return TiltedPhoques::CastUnique<IGameServerInstance>(TiltedPhoques::MakeUnique<GameServerInstance>(aConReg));
+    return TiltedPhoques::CastUnique<IGameServerInstance>(TiltedPhoques::MakeUnique<GameServerInstance>(aConReg, aInstanceIndex));
 }
 
 // cxx symbol
@@ -2,6 +2,22 @@ local function istable(t) return type(t) == 'table' end
 
 add_requires("sol2 v3.3.0", {configs = {lua = "lua"}})
 
+local function add_server_packages()
+    add_packages(
+        "gamenetworkingsockets",
+        "spdlog",
+        "hopscotch-map",
+        "sqlite3",
+        "zlib",
+        "lua",
+        "sol2",
+        "glm",
+        "entt",
+        "cpp-httplib",
+        "tiltedcore",
+        "sentry-native")
+end
+
 local function build_server()
     set_kind("shared")
     set_group("Server")
@@ -10,7 +26,7 @@ local function build_server()
         "../../Libraries/")
     set_pcxxheader("Pch.h")
     add_headerfiles("**.h")
-    add_files("**.cpp")
+    add_files("**.cpp|benchmarks/**.cpp")
     if is_plat("windows") then
         add_files("server.rc")
     end
@@ -23,22 +39,15 @@ local function build_server()
         "Resources",
         "ESLoader",
         "CrashHandler",
+        "Persistence",
+        "ECS",
+        "Timing",
+        "Logging",
         "BaseLib",
         "AdminProtocol",
         "TiltedConnect"
     )
-    add_packages(
-        "gamenetworkingsockets",
-        "spdlog",
-        "hopscotch-map",
-        "sqlite3",
-        "lua",
-        "sol2",
-        "glm",
-        "entt",
-        "cpp-httplib",
-        "tiltedcore",
-        "sentry-native")
+    add_server_packages()
 end
 
 target("SkyrimTogetherServer")
@@ -46,3 +55,29 @@ target("SkyrimTogetherServer")
     add_defines("TARGET_PREFIX=\"st\"")
     add_deps("SkyrimEncoding")
     build_server()
+
+-- Builds a synthetic world out of the server components, no game server involved
+if is_plat("linux") then
+    target("Server_Benchmarks")
+        set_kind("binary")
+        set_group("Tests")
+        add_includedirs(
+            ".",
+            "../",
+            "../../Libraries/")
+        set_pcxxheader("Pch.h")
+        add_files(
+            "benchmarks/*.cpp",
+            "Game/OwnershipIndex.cpp",
+            "NetworkThread.cpp",
+            "../TestMain.cpp")
+        add_deps(
+            "SkyrimEncoding",
+            "CommonLib",
+            "Console",
+            "Logging",
+            "BaseLib",
+            "TiltedConnect")
+        add_server_packages()
+        add_packages("gtest")
+end
@@ -3,6 +3,7 @@
 
 #include <console/CommandSettingsProvider.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <base/threading/ThreadUtils.h>
@@ -15,9 +16,11 @@ DediRunner* s_pRunner{nullptr};
 } // namespace
 
 // imports
-GS_IMPORT TiltedPhoques::UniquePtr<IGameServerInstance> CreateGameServer(Console::ConsoleRegistry& conReg, const std::function<void()>& aCallback);
+GS_IMPORT TiltedPhoques::UniquePtr<IGameServerInstance> CreateGameServer(Console::ConsoleRegistry& conReg, const std::function<void()>& aCallback, uint32_t aInstanceIndex);
 // needs to be global
 Console::Setting bConsole{"bConsole", "Enable the console", true};
+Console::Setting uIdleTickRate{"GameServer:uIdleTickRate", "Tick rate while no player is connected, keeps empty servers from using CPU", 5u};
+Console::Setting uAdditionalInstances{"GameServer:uAdditionalInstances", "Extra servers to run in this process, each on its own thread and the next free port", 0u};
 
 DediRunner* GetDediRunner() noexcept
 {
@@ -30,18 +33,54 @@ DediRunner::DediRunner(int argc, char** argv)
     s_pRunner = this;
 
     uv_loop_init(&m_loop);
+    uv_timer_init(&m_loop, &m_tickTimer);
+    uv_async_init(&m_loop, &m_wakeUp, OnWakeUp);
+    m_tickTimer.data = this;
 
-    m_pServerInstance = std::move(CreateGameServer(m_console, [this, argc, argv]() { LoadSettings(argc, argv); }));
+    m_pServerInstance = std::move(CreateGameServer(m_console, [this, argc, argv]() { LoadSettings(argc, argv); }, 0));
 
     // it is here for now..
     m_pServerInstance->Initialize();
     SaveSettingsToIni(m_console, m_SettingsPath);
+
+    // Started one after the other so each instance gets the same port from one run to the next
+    for (uint32_t i = 0; i < uAdditionalInstances.value_as<uint32_t>(); ++i)
+    {
+        std::promise<void> started;
+        auto ready = started.get_future();
+        m_additionalInstances.emplace_back([this, &started, i]() { RunAdditionalInstance(started, i + 1); });
+
+        try
+        {
+            ready.get();
+        }
+        catch (const std::exception& acException)
+        {
+            spdlog::error("Additional server instance {} failed to start: {}", i + 1, acException.what());
+        }
+    }
+
+    m_console.RegisterCommand<>(
+        "tickstats", "Show tick pacing statistics",
+        [this](Console::ArgStack&)
+        {
+            const auto& cStats = m_pacer.GetStats();
+            spdlog::get("ConOut")->info("{} ticks at {} Hz: {:.0f}us average jitter, {}us max, {} overruns, {} skipped ticks", cStats.Ticks, m_pacer.GetTickRate(), cStats.GetAverageJitterUs(),
+                                        cStats.MaxJitterUs, cStats.Overruns, cStats.SkippedTicks);
+            m_pacer.ResetStats();
+        });
 }
 
 DediRunner::~DediRunner()
 {
+    StopAdditionalInstances();
+
     if (m_useIni)
         SaveSettingsToIni(m_console, m_SettingsPath);
+
+    uv_close(reinterpret_cast<uv_handle_t*>(&m_tickTimer), nullptr);
+    uv_close(reinterpret_cast<uv_handle_t*>(&m_wakeUp), nullptr);
+    uv_run(&m_loop, UV_RUN_NOWAIT);
     uv_loop_close(&m_loop);
 }
 
@@ -116,20 +155,127 @@ void DediRunner::PrintExecutorArrowHack()
     // fmt::print(">>>");
 }
 
+void DediRunner::OnTickTimer(uv_timer_t* apTimer)
+{
+    static_cast<DediRunner*>(apTimer->data)->Tick();
+}
+
+void DediRunner::OnWakeUp(uv_async_t*)
+{
+    // Only there to get uv_run to return
+}
+
 void DediRunner::RunGSThread()
 {
+    m_pacer.SetTickRate(GetTargetTickRate(*m_pServerInstance));
+    m_pacer.Start(Timing::TickPacer::Clock::now());
+    ScheduleTick();
+
+    // Sleeps until the next tick or console input
     while (m_pServerInstance->IsListening())
+        uv_run(&m_loop, UV_RUN_ONCE);
+
+    uv_timer_stop(&m_tickTimer);
+
+    StopAdditionalInstances();
+}
+
+void DediRunner::RunAdditionalInstance(std::promise<void>& aStarted, uint32_t aInstanceIndex)
+{
+    // Commands bind to the instance that registers them, the extra instances don't share the terminal's registry
+    Console::ConsoleRegistry console(KCompilerStopThisBullshit);
+    TiltedPhoques::UniquePtr<IGameServerInstance> pInstance;
+    try
     {
-        m_pServerInstance->Update();
-        if (bConsole)
+        pInstance = CreateGameServer(console, []() {}, aInstanceIndex);
+        pInstance->Initialize();
+    }
+    catch (...)
+    {
+        // The runner waits on aStarted before it carries on
+        aStarted.set_exception(std::current_exception());
+        return;
+    }
+    aStarted.set_value();
+
+    // No terminal input to wake up for, sleeping until the deadline is enough
+    Timing::TickPacer pacer{GetTargetTickRate(*pInstance)};
+    pacer.Start(Timing::TickPacer::Clock::now());
+
+    bool shutdownRequested = false;
+    while (pInstance->IsListening())
+    {
+        if (!shutdownRequested && m_stopAdditionalInstances)
         {
-            uv_run(&m_loop, UV_RUN_NOWAIT);
-            if (m_console.Update())
-                PrintExecutorArrowHack();
+            pInstance->Shutdown();
+            shutdownRequested = true;
         }
+
+        std::this_thread::sleep_for(pacer.GetTimeUntilNextTick(Timing::TickPacer::Clock::now()));
+
+        const auto cNow = Timing::TickPacer::Clock::now();
+        if (!pacer.IsTickDue(cNow))
+            continue;
+
+        pacer.OnTick(cNow);
+        pInstance->Update();
+        pacer.SetTickRate(GetTargetTickRate(*pInstance));
     }
 }
 
+void DediRunner::StopAdditionalInstances()
+{
+    m_stopAdditionalInstances = true;
+
+    for (auto& thread : m_additionalInstances)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    m_additionalInstances.clear();
+}
+
+void DediRunner::Tick()
+{
+    // libuv timers are in whole milliseconds, don't run before the deadline
+    const auto cNow = Timing::TickPacer::Clock::now();
+    if (m_pacer.IsTickDue(cNow))
+    {
+        m_pacer.OnTick(cNow);
+
+        m_pServerInstance->Update();
+        if (bConsole && m_console.Update())
+            PrintExecutorArrowHack();
+
+        m_pacer.SetTickRate(GetTargetTickRate(*m_pServerInstance));
+    }
+
+    if (m_pServerInstance->IsListening())
+        ScheduleTick();
+}
+
+void DediRunner::ScheduleTick()
+{
+    using namespace std::chrono;
+
+    // The loop time is only refreshed once per iteration, it doesn't account for the tick that just ran
+    uv_update_time(&m_loop);
+
+    const auto cWait = m_pacer.GetTimeUntilNextTick(Timing::TickPacer::Clock::now());
+    const auto cWaitMs = duration_cast<milliseconds>(cWait + milliseconds(1) - nanoseconds(1)).count();
+
+    uv_timer_start(&m_tickTimer, OnTickTimer, static_cast<uint64_t>(cWaitMs), 0);
+}
+
+uint32_t DediRunner::GetTargetTickRate(IGameServerInstance& aInstance)
+{
+    const auto cTickRate = aInstance.GetTickRate();
+    if (aInstance.HasClients())
+        return cTickRate;
+
+    return std::min(cTickRate, uIdleTickRate.value_as<uint32_t>());
+}
+
 void DediRunner::StartTerminalIO()
 {
     spdlog::get("ConOut")->info("Server started, type /help for a list of commands.");
@@ -149,6 +295,8 @@ void DediRunner::StartTerminalIO()
 void DediRunner::RequestKill()
 {
     m_pServerInstance->Shutdown();
+    m_stopAdditionalInstances = true;
+    uv_async_send(&m_wakeUp);
 
 #if defined(_WIN32)
     // work around Control Handler exception (Control-C) being set
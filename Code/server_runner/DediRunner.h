@@ -3,6 +3,8 @@
 // spdlog
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <future>
 #include <thread>
 
 #include <BuildInfo.h>
@@ -10,6 +12,7 @@
 #include <console/ConsoleRegistry.h>
 #include <console/IniSettingsProvider.h>
 #include <common/GameServerInstance.h>
+#include <timing/TickPacer.h>
 
 #ifdef _WIN32
 #define GS_IMPORT extern __declspec(dllimport)
@@ -41,16 +44,34 @@ private:
 
     static void ReadStdin(uv_stream_t* apStream, ssize_t aRead, const uv_buf_t* acpBuffer);
     static void AllocateBuffer(uv_handle_t* apHandle, size_t aSuggestedSize, uv_buf_t* apBuffer);
+    static void OnTickTimer(uv_timer_t* apTimer);
+    static void OnWakeUp(uv_async_t* apAsync);
+
+    void Tick();
+    // Arms the tick timer for the next deadline of the pacer
+    void ScheduleTick();
+    [[nodiscard]] static uint32_t GetTargetTickRate(IGameServerInstance& aInstance);
+
+    // Extra instances are created, ticked and destroyed on their own thread, aStarted is set once it is listening.
+    // They are numbered from 1 in start order, the main instance is 0.
+    void RunAdditionalInstance(std::promise<void>& aStarted, uint32_t aInstanceIndex);
+    void StopAdditionalInstances();
 
 private:
     // fs::path m_configPath;
     //  Order here matters for constructor calling order.
     uv_loop_t m_loop;
     uv_tty_t m_tty;
+    uv_timer_t m_tickTimer;
+    // Lets RequestKill interrupt the wait for the next tick
+    uv_async_t m_wakeUp;
+    Timing::TickPacer m_pacer{60};
     fs::path m_SettingsPath;
     bool m_useIni{false};
     Console::ConsoleRegistry m_console;
     TiltedPhoques::UniquePtr<IGameServerInstance> m_pServerInstance;
+    TiltedPhoques::Vector<std::thread> m_additionalInstances;
+    std::atomic<bool> m_stopAdditionalInstances{false};
 };
 
 DediRunner* GetDediRunner() noexcept;
@@ -11,6 +11,7 @@
 
 #include <Setting.h>
 #include <base/simpleini/SimpleIni.h>
+#include <logging/AsyncSink.h>
 #include <base/threading/ThreadUtils.h>
 
 #include "DediRunner.h"
@@ -66,7 +67,10 @@ struct LogInstance
         auto fileOut = std::make_shared<sinks::rotating_file_sink_mt>(std::string("logs/") + kLogFileName, kLogFileSizeCap, 3);
         auto serverOut = std::make_shared<sinks::stdout_color_sink_mt>();
         serverOut->set_pattern("%^[%H:%M:%S.%e] [%l] [tid %t] %$ %v");
-        auto globalOut = std::make_shared<logger>("", sinks_init_list{serverOut, fileOut});
+
+        // the console and the disk are written from a background thread so logging never stalls a tick
+        m_pAsyncOut = std::make_shared<Logging::AsyncSink>(std::vector<sink_ptr>{serverOut, fileOut});
+        auto globalOut = std::make_shared<logger>("", m_pAsyncOut);
         globalOut->set_level(level::from_str(sLogLevel.value()));
 
         // as the library is compiled into the client + server we have to do this twice
@@ -76,7 +80,14 @@ struct LogInstance
         SetDefaultLogger(globalOut);
     }
 
-    ~LogInstance() { spdlog::shutdown(); }
+    ~LogInstance()
+    {
+        // the server keeps a reference, stop the writer before exit tears it down from a static destructor
+        m_pAsyncOut->Stop();
+        spdlog::shutdown();
+    }
+
+    std::shared_ptr<Logging::AsyncSink> m_pAsyncOut;
 };
 
 static bool RegisterQuitHandler()
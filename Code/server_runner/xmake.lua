@@ -25,6 +25,8 @@ local function build_runner()
     add_deps(
         "CommonLib",
         "Console",
+        "Timing",
+        "Logging",
         "BaseLib")
     add_packages(
         "tiltedcore",
@@ -0,0 +1,152 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <Messages/NotifyActorValueChanges.h>
+#include <Messages/NotifyHealthChangeBroadcast.h>
+#include <Messages/NotifyActorValuesBatch.h>
+#include <Structs/ActorValueCoalescer.h>
+
+#include <catch2/catch.hpp>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+constexpr uint32_t kHealth = 24;
+constexpr uint32_t kStamina = 26;
+
+constexpr auto AcceptAll = [](uint32_t) { return true; };
+
+Map<uint32_t, float> BuildValues(std::initializer_list<std::pair<const uint32_t, float>> aValues)
+{
+    Map<uint32_t, float> values;
+    for (const auto& [key, value] : aValues)
+        values[key] = value;
+
+    return values;
+}
+} // namespace
+
+TEST_CASE("Actor value coalescing", "[actor_values]")
+{
+    ActorValueCoalescer coalescer;
+
+    constexpr uint32_t cOwner = 1;
+    constexpr uint32_t cAttacker = 2;
+    constexpr uint32_t cObserver = 3;
+
+    SECTION("Last write wins")
+    {
+        coalescer.SetValues(10, cOwner, BuildValues({{kStamina, 50.f}, {kHealth, 80.f}}));
+        coalescer.SetValues(10, cOwner, BuildValues({{kStamina, 40.f}}));
+        coalescer.SetMaxValues(10, cOwner, BuildValues({{kHealth, 120.f}}));
+
+        Vector<ActorValueChanges> changes;
+        coalescer.Collect(cObserver, AcceptAll, changes);
+
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0].Id == 10);
+        REQUIRE(changes[0].Values == BuildValues({{kStamina, 40.f}, {kHealth, 80.f}}));
+        REQUIRE(changes[0].MaxValues == BuildValues({{kHealth, 120.f}}));
+        REQUIRE_FALSE(changes[0].HasDeltaHealth);
+        REQUIRE(coalescer.GetMergedCount() == 1);
+    }
+
+    SECTION("Health deltas are summed")
+    {
+        coalescer.AddDeltaHealth(10, cAttacker, 5.f);
+        coalescer.AddDeltaHealth(10, cAttacker, 7.5f);
+        coalescer.AddDeltaHealth(10, cObserver, 2.f);
+
+        Vector<ActorValueChanges> changes;
+        coalescer.Collect(cOwner, AcceptAll, changes);
+
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0].HasDeltaHealth);
+        REQUIRE(changes[0].DeltaHealth == 14.5f);
+
+        // Each reporter only gets what the others reported
+        changes.clear();
+        coalescer.Collect(cAttacker, AcceptAll, changes);
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0].DeltaHealth == 2.f);
+    }
+
+    SECTION("Changes are not sent back to their source")
+    {
+        coalescer.SetValues(10, cOwner, BuildValues({{kStamina, 50.f}}));
+        coalescer.SetValues(11, cAttacker, BuildValues({{kStamina, 60.f}}));
+        // The attacker overwrote a value the owner reported first
+        coalescer.SetValues(10, cAttacker, BuildValues({{kStamina, 30.f}}));
+
+        Vector<ActorValueChanges> changes;
+        coalescer.Collect(cAttacker, AcceptAll, changes);
+        REQUIRE(changes.empty());
+
+        coalescer.Collect(cOwner, AcceptAll, changes);
+        REQUIRE(changes.size() == 2);
+        REQUIRE(changes[0].Values == BuildValues({{kStamina, 30.f}}));
+        REQUIRE(changes[1].Id == 11);
+    }
+
+    SECTION("Filtered actors are skipped")
+    {
+        coalescer.AddDeltaHealth(10, cAttacker, 5.f);
+        coalescer.AddDeltaHealth(11, cAttacker, 5.f);
+
+        Vector<ActorValueChanges> changes;
+        coalescer.Collect(cObserver, [](uint32_t aId) { return aId == 11; }, changes);
+
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0].Id == 11);
+    }
+
+    SECTION("Clear starts a new tick")
+    {
+        coalescer.SetValues(10, cOwner, BuildValues({{kStamina, 50.f}}));
+        coalescer.Clear();
+        REQUIRE(coalescer.IsEmpty());
+
+        coalescer.AddDeltaHealth(11, cAttacker, 3.f);
+
+        Vector<ActorValueChanges> changes;
+        coalescer.Collect(cObserver, AcceptAll, changes);
+
+        REQUIRE(coalescer.GetActorCount() == 1);
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0].Id == 11);
+        REQUIRE(changes[0].Values.empty());
+    }
+}
+
+TEST_CASE("NotifyActorValuesBatch round trip", "[actor_values]")
+{
+    NotifyActorValuesBatch sendMessage, recvMessage;
+
+    auto& first = sendMessage.Changes.emplace_back();
+    first.Id = 1234;
+    first.Values = BuildValues({{kHealth, 80.f}, {kStamina, 12.5f}});
+    first.MaxValues = BuildValues({{kHealth, 120.f}});
+
+    auto& second = sendMessage.Changes.emplace_back();
+    second.Id = 42;
+    second.HasDeltaHealth = true;
+    second.DeltaHealth = -17.25f;
+
+    Buffer buff(1000);
+    Buffer::Writer writer(&buff);
+    sendMessage.Serialize(writer);
+
+    Buffer::Reader reader(&buff);
+
+    uint64_t trash;
+    reader.ReadBits(trash, 8); // pop opcode
+
+    recvMessage.DeserializeRaw(reader);
+
+    REQUIRE(sendMessage == recvMessage);
+}
@@ -0,0 +1,96 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <BehaviorVarTable.h>
+#include <Structs/AnimationGraphDescriptorManager.h>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+namespace
+{
+std::string ToUpper(std::string_view aName)
+{
+    std::string upper(aName);
+    for (auto& c : upper)
+    {
+        if (c >= 'a' && c <= 'z')
+            c = static_cast<char>(c - 'a' + 'A');
+    }
+
+    return upper;
+}
+} // namespace
+
+TEST_CASE("Behavior variable tables", "[encoding.behavior]")
+{
+    const auto cTables = BehaviorVarTables::GetAll();
+    REQUIRE_FALSE(cTables.empty());
+
+    SECTION("Every name resolves to its value")
+    {
+        for (const auto& cTable : cTables)
+        {
+            INFO("behavior " << cTable.Key);
+            REQUIRE(BehaviorVarTables::Get(cTable.Key) == &cTable);
+
+            for (uint32_t i = 0; i < cTable.Size(); ++i)
+            {
+                const auto cName = cTable.GetName(i);
+                INFO("variable " << std::string(cName));
+
+                REQUIRE(cTable.Find(cName) == i);
+                REQUIRE(cTable.FindFolded(cName) == i);
+                REQUIRE(cTable.FindFolded(ToUpper(cName)) == i);
+                REQUIRE(cTable.FindFolded(cTable.FoldedNames[i]) == i);
+            }
+        }
+    }
+
+    SECTION("Unknown names and values")
+    {
+        for (const auto& cTable : cTables)
+        {
+            REQUIRE(cTable.Find("") == BehaviorVarTable::kNotFound);
+            REQUIRE(cTable.Find("bNotABehaviorVariable") == BehaviorVarTable::kNotFound);
+            REQUIRE(cTable.FindFolded("bNotABehaviorVariable") == BehaviorVarTable::kNotFound);
+            REQUIRE(cTable.GetName(static_cast<uint32_t>(cTable.Size())).empty());
+
+            // Exact lookups keep the case the game uses
+            for (uint32_t i = 0; i < cTable.Size(); ++i)
+            {
+                const auto cUpper = ToUpper(cTable.GetName(i));
+                if (cUpper != cTable.GetName(i))
+                    REQUIRE(cTable.Find(cUpper) == BehaviorVarTable::kNotFound);
+            }
+        }
+
+        REQUIRE(BehaviorVarTables::Get(0) == nullptr);
+    }
+
+    SECTION("Every descriptor has its names")
+    {
+        for (const auto& [cKey, cDescriptor] : AnimationGraphDescriptorManager::Get().GetDescriptors())
+        {
+            INFO("behavior " << cKey);
+
+            const auto* cpTable = BehaviorVarTables::Get(cKey);
+            REQUIRE(cpTable);
+
+            for (const auto cValue : cDescriptor.BooleanLookUpTable)
+                REQUIRE_FALSE(cpTable->GetName(cValue).empty());
+            for (const auto cValue : cDescriptor.FloatLookupTable)
+                REQUIRE_FALSE(cpTable->GetName(cValue).empty());
+            for (const auto cValue : cDescriptor.IntegerLookupTable)
+                REQUIRE_FALSE(cpTable->GetName(cValue).empty());
+        }
+    }
+}
@@ -0,0 +1,203 @@
+#include "Bench.h"
+
+#include <base/allocator/TrackingAllocator.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace Bench
+{
+namespace
+{
+Base::TrackingAllocator s_allocator{"Benchmark"};
+
+// Keeps the optimizer from dropping operations whose result is unused
+volatile size_t s_sink = 0;
+
+double MeasureTime(const Operation& acOperation, uint32_t aMinTime)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Grow the batch until it is long enough for the clock's resolution not to matter
+    size_t batch = 1;
+    for (;;)
+    {
+        const auto cStart = Clock::now();
+        for (size_t i = 0; i < batch; ++i)
+            s_sink = s_sink + acOperation();
+        const auto cElapsed = Clock::now() - cStart;
+
+        if (cElapsed >= std::chrono::microseconds(500) || batch >= (1u << 24))
+            break;
+
+        batch *= 2;
+    }
+
+    // The fastest batch is the one least disturbed by the rest of the machine
+    auto best = std::numeric_limits<double>::max();
+    const auto cEnd = Clock::now() + std::chrono::milliseconds(aMinTime);
+    do
+    {
+        const auto cStart = Clock::now();
+        for (size_t i = 0; i < batch; ++i)
+            s_sink = s_sink + acOperation();
+        const auto cElapsed = std::chrono::duration<double, std::nano>(Clock::now() - cStart).count();
+
+        best = std::min(best, cElapsed / static_cast<double>(batch));
+    } while (Clock::now() < cEnd);
+
+    return best;
+}
+
+const Result* Find(const Vector<Result>& acResults, const String& acName)
+{
+    for (const auto& result : acResults)
+    {
+        if (result.Name == acName)
+            return &result;
+    }
+
+    return nullptr;
+}
+
+bool IsRegression(double aBaseline, double aValue, double aTolerance)
+{
+    // Baselines are saved with two decimals at most
+    constexpr double cEpsilon = 0.01;
+
+    return aValue > aBaseline * (1.0 + aTolerance) + cEpsilon;
+}
+} // namespace
+
+void Registry::Add(String aName, Operation aOperation)
+{
+    m_operations.emplace_back(std::move(aName), std::move(aOperation));
+}
+
+Vector<Result> Registry::Run(const Settings& acSettings, const String& acFilter) const
+{
+    Vector<Result> results;
+
+    for (const auto& [name, operation] : m_operations)
+    {
+        if (!acFilter.empty() && name.find(acFilter) == String::npos)
+            continue;
+
+        Result result;
+        result.Name = name;
+
+        // Warms caches and lets lazily built state (string cache, thread local buffers) settle before counting
+        size_t bytes = 0;
+        for (auto i = 0u; i < 4; ++i)
+            bytes = operation();
+
+        s_allocator.ResetStats();
+        {
+            Base::AllocationScope _(s_allocator);
+            for (auto i = 0u; i < acSettings.AllocationIterations; ++i)
+                s_sink = s_sink + operation();
+        }
+
+        result.BytesPerOp = static_cast<double>(bytes);
+        result.AllocationsPerOp = static_cast<double>(s_allocator.GetStats().Allocations) / acSettings.AllocationIterations;
+        result.NanosecondsPerOp = MeasureTime(operation, acSettings.MinTime);
+
+        results.push_back(std::move(result));
+    }
+
+    return results;
+}
+
+bool SaveBaseline(const String& acPath, const Vector<Result>& acResults)
+{
+    std::ofstream file(acPath.c_str());
+    if (!file)
+        return false;
+
+    file << "# TPBench baseline, written by TPBench --write-baseline\n";
+    file << "# name ns/op bytes/op allocs/op\n";
+    for (const auto& result : acResults)
+    {
+        char line[512];
+        std::snprintf(line, sizeof(line), "%s %.1f %.0f %.2f\n", result.Name.c_str(), result.NanosecondsPerOp, result.BytesPerOp, result.AllocationsPerOp);
+        file << line;
+    }
+
+    return static_cast<bool>(file);
+}
+
+bool LoadBaseline(const String& acPath, Vector<Result>& aResults)
+{
+    std::ifstream file(acPath.c_str());
+    if (!file)
+        return false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream stream(line);
+        std::string name;
+        Result result;
+        if (!(stream >> name >> result.NanosecondsPerOp >> result.BytesPerOp >> result.AllocationsPerOp))
+            return false;
+
+        result.Name = name.c_str();
+        aResults.push_back(std::move(result));
+    }
+
+    return true;
+}
+
+size_t Compare(const Vector<Result>& acBaseline, const Vector<Result>& acResults, uint32_t aMetrics, const Tolerances& acTolerances)
+{
+    size_t regressions = 0;
+
+    for (const auto& result : acResults)
+    {
+        const auto* cpBaseline = Find(acBaseline, result.Name);
+        if (!cpBaseline)
+        {
+            std::printf("NEW        %s\n", result.Name.c_str());
+            continue;
+        }
+
+        if ((aMetrics & kTime) && IsRegression(cpBaseline->NanosecondsPerOp, result.NanosecondsPerOp, acTolerances.Time))
+        {
+            std::printf("REGRESSION %s: %.1f ns/op, baseline %.1f\n", result.Name.c_str(), result.NanosecondsPerOp, cpBaseline->NanosecondsPerOp);
+            ++regressions;
+        }
+
+        if ((aMetrics & kBytes) && IsRegression(cpBaseline->BytesPerOp, result.BytesPerOp, acTolerances.Bytes))
+        {
+            std::printf("REGRESSION %s: %.0f bytes/op, baseline %.0f\n", result.Name.c_str(), result.BytesPerOp, cpBaseline->BytesPerOp);
+            ++regressions;
+        }
+
+        if ((aMetrics & kAllocations) && IsRegression(cpBaseline->AllocationsPerOp, result.AllocationsPerOp, acTolerances.Allocations))
+        {
+            std::printf("REGRESSION %s: %.2f allocs/op, baseline %.2f\n", result.Name.c_str(), result.AllocationsPerOp, cpBaseline->AllocationsPerOp);
+            ++regressions;
+        }
+    }
+
+    for (const auto& baseline : acBaseline)
+    {
+        if (!Find(acResults, baseline.Name))
+            std::printf("MISSING    %s\n", baseline.Name.c_str());
+    }
+
+    return regressions;
+}
+
+void Print(const Vector<Result>& acResults)
+{
+    std::printf("%-56s %12s %10s %10s\n", "benchmark", "ns/op", "bytes/op", "allocs/op");
+    for (const auto& result : acResults)
+        std::printf("%-56s %12.1f %10.0f %10.2f\n", result.Name.c_str(), result.NanosecondsPerOp, result.BytesPerOp, result.AllocationsPerOp);
+}
+} // namespace Bench
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <TiltedCore/Stl.hpp>
+
+#include <functional>
+
+using TiltedPhoques::String;
+using TiltedPhoques::Vector;
+
+/**
+ * @brief Small benchmark runner for the encoding library.
+ *
+ * An operation encodes or decodes one thing and returns how many bytes it produced or consumed. The runner
+ * reports the fastest time per operation over several batches, the bytes and the allocations per operation.
+ * Allocations are counted through Base::AllocationScope, so both TiltedPhoques containers and plain operator
+ * new are seen.
+ */
+namespace Bench
+{
+using Operation = std::function<size_t()>;
+
+struct Result
+{
+    String Name;
+    double NanosecondsPerOp{0.0};
+    double BytesPerOp{0.0};
+    double AllocationsPerOp{0.0};
+};
+
+struct Settings
+{
+    // Time spent measuring each operation, in ms
+    uint32_t MinTime{50};
+    // Iterations the allocations are averaged over, operations are deterministic so few are needed
+    uint32_t AllocationIterations{16};
+};
+
+class Registry
+{
+public:
+    void Add(String aName, Operation aOperation);
+
+    // Runs the benchmarks whose name contains acFilter, all of them when it is empty
+    [[nodiscard]] Vector<Result> Run(const Settings& acSettings, const String& acFilter) const;
+
+private:
+    Vector<std::pair<String, Operation>> m_operations;
+};
+
+// Which metrics a baseline comparison fails on
+enum Metric : uint32_t
+{
+    kTime = 1 << 0,
+    kBytes = 1 << 1,
+    kAllocations = 1 << 2,
+    kAllMetrics = kTime | kBytes | kAllocations
+};
+
+struct Tolerances
+{
+    // Timings vary between runs, 0.25 allows a result 25% slower than the baseline
+    double Time{0.25};
+    // Encodings and allocations are deterministic, any growth is a regression
+    double Bytes{0.0};
+    double Allocations{0.0};
+};
+
+// Text file, one "name ns/op bytes/op allocs/op" line per benchmark, # starts a comment
+bool SaveBaseline(const String& acPath, const Vector<Result>& acResults);
+bool LoadBaseline(const String& acPath, Vector<Result>& aResults);
+
+/**
+ * Compares results against a baseline and prints every regression.
+ * @return The number of regressions, benchmarks missing from either side are reported but don't count.
+ */
+size_t Compare(const Vector<Result>& acBaseline, const Vector<Result>& acResults, uint32_t aMetrics, const Tolerances& acTolerances);
+
+void Print(const Vector<Result>& acResults);
+} // namespace Bench
+
+// Defined by each suite
+void RegisterMessageBenchmarks(Bench::Registry& aRegistry);
+void RegisterStructBenchmarks(Bench::Registry& aRegistry);
+void RegisterSystemBenchmarks(Bench::Registry& aRegistry);
@@ -0,0 +1,113 @@
+#include "Bench.h"
+
+#include <cxxopts.hpp>
+
+#include <cstdio>
+#include <sstream>
+
+namespace
+{
+bool ParseMetrics(const std::string& acList, uint32_t& aMetrics)
+{
+    aMetrics = 0;
+
+    std::istringstream stream(acList);
+    std::string metric;
+    while (std::getline(stream, metric, ','))
+    {
+        if (metric == "time")
+            aMetrics |= Bench::kTime;
+        else if (metric == "bytes")
+            aMetrics |= Bench::kBytes;
+        else if (metric == "allocs")
+            aMetrics |= Bench::kAllocations;
+        else
+            return false;
+    }
+
+    return aMetrics != 0;
+}
+
+int Run(cxxopts::Options& aOptions, const cxxopts::ParseResult& acResult);
+} // namespace
+
+int main(int argc, char** argv)
+{
+    cxxopts::Options options("TPBench", "Encoding and decoding benchmarks of every network message and the hot structs");
+
+    // clang-format off
+    options.add_options()
+        ("f,filter", "Only run the benchmarks whose name contains this", cxxopts::value<std::string>()->default_value(""))
+        ("min-time", "Time spent measuring each benchmark, in ms", cxxopts::value<uint32_t>()->default_value("50"))
+        ("b,baseline", "Compare the results against this baseline, exits with 1 on regressions", cxxopts::value<std::string>()->default_value(""))
+        ("w,write-baseline", "Write the results to this baseline", cxxopts::value<std::string>()->default_value(""))
+        ("check", "Metrics compared against the baseline, time, bytes and allocs separated by commas", cxxopts::value<std::string>()->default_value("time,bytes,allocs"))
+        ("time-tolerance", "How much slower than the baseline a benchmark may get, 0.25 is 25%", cxxopts::value<double>()->default_value("0.25"))
+        ("h,help", "Print usage");
+    // clang-format on
+
+    try
+    {
+        return Run(options, options.parse(argc, argv));
+    }
+    catch (const cxxopts::OptionException& acException)
+    {
+        std::fprintf(stderr, "%s\n", acException.what());
+        return 2;
+    }
+}
+
+namespace
+{
+int Run(cxxopts::Options& aOptions, const cxxopts::ParseResult& acResult)
+{
+    uint32_t metrics = 0;
+    if (!ParseMetrics(acResult["check"].as<std::string>(), metrics))
+    {
+        std::fprintf(stderr, "Unknown metric in --check %s\n", acResult["check"].as<std::string>().c_str());
+        return 2;
+    }
+
+    Bench::Registry registry;
+    RegisterMessageBenchmarks(registry);
+    RegisterStructBenchmarks(registry);
+    RegisterSystemBenchmarks(registry);
+
+    Bench::Settings settings;
+    settings.MinTime = acResult["min-time"].as<uint32_t>();
+
+    const auto cResults = registry.Run(settings, acResult["filter"].as<std::string>().c_str());
+    Bench::Print(cResults);
+
+    const auto& cWritePath = acResult["write-baseline"].as<std::string>();
+    if (!cWritePath.empty() && !Bench::SaveBaseline(cWritePath.c_str(), cResults))
+    {
+        std::fprintf(stderr, "Could not write baseline %s\n", cWritePath.c_str());
+        return 2;
+    }
+
+    const auto& cBaselinePath = acResult["baseline"].as<std::string>();
+    if (cBaselinePath.empty())
+        return 0;
+
+    Vector<Bench::Result> baseline;
+    if (!Bench::LoadBaseline(cBaselinePath.c_str(), baseline))
+    {
+        std::fprintf(stderr, "Could not read baseline %s\n", cBaselinePath.c_str());
+        return 2;
+    }
+
+    Bench::Tolerances tolerances;
+    tolerances.Time = acResult["time-tolerance"].as<double>();
+
+    const auto cRegressions = Bench::Compare(baseline, cResults, metrics, tolerances);
+    if (cRegressions > 0)
+    {
+        std::printf("%zu regressions against %s\n", cRegressions, cBaselinePath.c_str());
+        return 1;
+    }
+
+    std::printf("No regressions against %s\n", cBaselinePath.c_str());
+    return 0;
+}
+} // namespace
@@ -0,0 +1,116 @@
+#include "Bench.h"
+#include "Payloads.h"
+
+#include <ViewScope.h>
+
+#include <magic_enum.hpp>
+
+#include <memory>
+#include <set>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+// The encode benchmarks write into a buffer that is reused, as GameServer::Send does
+constexpr size_t kBufferSize = 1 << 20;
+
+template <class T> std::shared_ptr<T> BuildMessage()
+{
+    // Some members have no initializer, decoding zeroes gives every one a defined value before the payload is filled
+    static const uint8_t s_zeroes[256]{};
+
+    auto pMessage = std::make_shared<T>();
+    ViewBuffer zeroes(const_cast<uint8_t*>(s_zeroes), sizeof(s_zeroes));
+    Buffer::Reader reader(&zeroes);
+    pMessage->DeserializeRaw(reader);
+
+    Payloads::Random random(0xC0FFEE ^ static_cast<uint32_t>(T::Opcode));
+    Payloads::Fill(*pMessage, random);
+
+    return pMessage;
+}
+
+// Messages with MessageString fields, which can borrow them from the decoded buffer
+template <class T> constexpr bool kBorrowsStrings = std::is_same_v<T, SendChatMessageRequest> || std::is_same_v<T, PlayerDialogueRequest> || std::is_same_v<T, SubtitleRequest> ||
+                                                    std::is_same_v<T, DialogueRequest> || std::is_same_v<T, TeleportCommandRequest> || std::is_same_v<T, ScriptAnimationRequest>;
+
+template <class T> String GetName()
+{
+    auto name = magic_enum::enum_name(T::Opcode);
+    if (name.starts_with('k'))
+        name.remove_prefix(1);
+
+    return String(name.data(), name.size());
+}
+
+template <class TFactory> void RegisterFactory(Bench::Registry& aRegistry, const char* acpSide)
+{
+    auto pBuffer = std::make_shared<Buffer>(kBufferSize);
+    std::set<uint32_t> registered;
+
+    TFactory::Visit(
+        [&](auto& x)
+        {
+            using T = typename std::remove_reference_t<decltype(x)>::Type;
+
+            // The factory lists some messages twice
+            if (!registered.insert(T::Opcode).second)
+                return false;
+
+            const auto cpMessage = BuildMessage<T>();
+            const auto cName = GetName<T>();
+
+            aRegistry.Add(String(acpSide) + "/encode/" + cName,
+                          [cpMessage, pBuffer]()
+                          {
+                              Buffer::Writer writer(pBuffer.get());
+                              cpMessage->Serialize(writer);
+                              return writer.Size();
+                          });
+
+            Buffer::Writer writer(pBuffer.get());
+            cpMessage->Serialize(writer);
+            auto pEncoded = std::make_shared<Vector<uint8_t>>(pBuffer->GetData(), pBuffer->GetData() + writer.Size());
+
+            aRegistry.Add(String(acpSide) + "/decode/" + cName,
+                          [pEncoded]()
+                          {
+                              static const TFactory s_factory;
+
+                              ViewBuffer view(pEncoded->data(), pEncoded->size());
+                              Buffer::Reader reader(&view);
+                              const auto pMessage = s_factory.Extract(reader);
+
+                              return pMessage ? pEncoded->size() : 0;
+                          });
+
+            if constexpr (kBorrowsStrings<T>)
+            {
+                // Same as GameServer::OnConsume when the message is handled on the receiving thread
+                aRegistry.Add(String(acpSide) + "/decode-view/" + cName,
+                              [pEncoded]()
+                              {
+                                  static const TFactory s_factory;
+
+                                  ViewBuffer view(pEncoded->data(), pEncoded->size());
+                                  Buffer::Reader reader(&view);
+                                  ViewScope views(pEncoded->data(), pEncoded->size());
+                                  const auto pMessage = s_factory.Extract(reader);
+
+                                  return pMessage ? pEncoded->size() : 0;
+                              });
+            }
+
+            return false;
+        });
+}
+} // namespace
+
+void RegisterMessageBenchmarks(Bench::Registry& aRegistry)
+{
+    Payloads::RegisterCachedStrings();
+
+    RegisterFactory<ClientMessageFactory>(aRegistry, "client");
+    RegisterFactory<ServerMessageFactory>(aRegistry, "server");
+}
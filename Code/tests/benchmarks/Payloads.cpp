@@ -0,0 +1,529 @@
+#include "Payloads.h"
+
+#include <StringCache.h>
+
+#include <string>
+
+namespace Payloads
+{
+namespace
+{
+// Sizes of the human behavior graph the client synchronizes
+constexpr uint32_t kBooleanCount = 64;
+constexpr uint32_t kIntegerCount = 10;
+constexpr uint32_t kFloatCount = 30;
+
+const char* const kEventNames[] = {"moveStart", "moveStop", "turnStart", "turnStop", "SprintStart", "SprintStop", "weaponSwing", "attackStart", "blockStart", "blockStop", "JumpStandingStart", "JumpLand", "IdleForceDefaultState", "BeginCastRight", "MRh_SpellFire_Event", "SneakStart"};
+
+const char* const kPlugins[] = {"Skyrim.esm", "Update.esm", "Dawnguard.esm", "HearthFires.esm", "Dragonborn.esm", "ccBGSSSE001-Fish.esm", "ccQDRSSE001-SurvivalMode.esl", "_ResourcePack.esl", "SkyUI_SE.esp", "RaceMenu.esp"};
+
+const char* const kTintMasks[] = {
+    "SkinTone", "MaleHeadCheeks", "MaleHead_Cheeks2", "MaleHeadLaughLines", "MaleHead_FrownLines", "MaleHeadNord_Lips", "MaleHead_Nose", "MaleHeadForehead",
+    "MaleHead_Chin", "MaleUpperEyeSocket", "MaleLowerEyeSocket", "MaleNeck", "MaleHeadWarPaint_01", "MaleHeadDirt_01"};
+
+// Load orders of a few dozen mods are the norm
+constexpr uint32_t kExtraPlugins = 40;
+// Actors moving around a player in a town
+constexpr uint32_t kMovingActors = 8;
+constexpr uint32_t kObjectCount = 12;
+
+GameId BuildGameId(Random& aRandom)
+{
+    return GameId(aRandom.Chance(70) ? 0 : aRandom.Range(1u, 40u), aRandom.Range(0x800u, 0xFFFFFu));
+}
+
+Mods BuildMods()
+{
+    Mods mods;
+
+    uint16_t id = 0;
+    for (const auto* cpPlugin : kPlugins)
+    {
+        const bool cIsLite = std::string_view(cpPlugin).ends_with(".esl");
+        mods.ModList.push_back({cpPlugin, id++, cIsLite});
+    }
+
+    for (auto i = 0u; i < kExtraPlugins; ++i)
+        mods.ModList.push_back({String("Immersive Patch ") + std::to_string(i).c_str() + ".esp", id++, false});
+
+    return mods;
+}
+
+// Face morphs and sliders, mostly small floats and empty slots like a real save buffer
+String BuildAppearance(Random& aRandom)
+{
+    String appearance;
+    for (auto i = 0u; i < 600; ++i)
+    {
+        const float cValue = aRandom.Chance(20) ? 0.f : static_cast<float>(aRandom.Range(0u, 16u)) / 16.f;
+        appearance.append(reinterpret_cast<const char*>(&cValue), sizeof(cValue));
+    }
+
+    return appearance;
+}
+
+Tints BuildTints(Random& aRandom)
+{
+    Tints tints;
+    for (const auto* cpMask : kTintMasks)
+    {
+        Tints::Entry entry;
+        entry.Name = String(cpMask);
+        entry.Alpha = aRandom.Range(0.f, 1.f);
+        entry.Color = 0xFF000000 | (aRandom.Next() & 0xFFFFFF);
+        entry.Type = aRandom.Range(0u, 2u);
+        tints.Entries.push_back(entry);
+    }
+
+    return tints;
+}
+
+Factions BuildFactions(Random& aRandom)
+{
+    Factions factions;
+    for (auto i = 0u; i < 6; ++i)
+    {
+        Faction faction;
+        faction.Id = BuildGameId(aRandom);
+        faction.Rank = static_cast<int8_t>(aRandom.Range(0u, 4u));
+        (i < 4 ? factions.NpcFactions : factions.ExtraFactions).push_back(faction);
+    }
+
+    return factions;
+}
+} // namespace
+
+uint32_t Random::Next() noexcept
+{
+    m_state ^= m_state << 13;
+    m_state ^= m_state >> 17;
+    m_state ^= m_state << 5;
+    return m_state;
+}
+
+uint32_t Random::Range(uint32_t aMin, uint32_t aMax) noexcept
+{
+    return aMin + Next() % (aMax - aMin + 1);
+}
+
+float Random::Range(float aMin, float aMax) noexcept
+{
+    return aMin + (aMax - aMin) * static_cast<float>(Next() >> 8) / static_cast<float>(1 << 24);
+}
+
+bool Random::Chance(uint32_t aPercent) noexcept
+{
+    return Next() % 100 < aPercent;
+}
+
+void RegisterCachedStrings()
+{
+    auto& cache = StringCache::Get();
+    for (const auto* cpName : kEventNames)
+        cache.Add(cpName);
+    for (const auto* cpMask : kTintMasks)
+        cache.Add(cpMask);
+}
+
+AnimationVariables BuildAnimationVariables(Random& aRandom)
+{
+    AnimationVariables variables;
+
+    variables.Booleans.resize(kBooleanCount);
+    for (auto i = 0u; i < kBooleanCount; ++i)
+        variables.Booleans[i] = aRandom.Chance(15);
+
+    // States and indices, small values
+    for (auto i = 0u; i < kIntegerCount; ++i)
+        variables.Integers.push_back(aRandom.Chance(50) ? 0 : aRandom.Range(1u, 8u));
+
+    // Speeds, directions and blend weights
+    for (auto i = 0u; i < kFloatCount; ++i)
+        variables.Floats.push_back(aRandom.Chance(40) ? 0.f : aRandom.Range(-1.f, 1.f));
+
+    return variables;
+}
+
+AnimationVariables NextFrame(const AnimationVariables& acVariables, Random& aRandom)
+{
+    auto variables = acVariables;
+
+    for (auto i = 0u; i < 6; ++i)
+        variables.Floats[aRandom.Range(0u, kFloatCount - 1)] += aRandom.Range(-0.1f, 0.1f);
+
+    if (aRandom.Chance(20))
+        variables.Integers[aRandom.Range(0u, kIntegerCount - 1)] = aRandom.Range(0u, 8u);
+
+    if (aRandom.Chance(10))
+    {
+        const auto cIndex = aRandom.Range(0u, kBooleanCount - 1);
+        variables.Booleans[cIndex] = !variables.Booleans[cIndex];
+    }
+
+    return variables;
+}
+
+ActionEvent BuildActionEvent(Random& aRandom, uint64_t aTick)
+{
+    ActionEvent event;
+    event.Tick = aTick;
+    event.ActorId = aRandom.Range(0x14u, 0xFFFFFu);
+    event.ActionId = 0x13000 + aRandom.Range(0u, 0x200u);
+    event.TargetId = aRandom.Chance(30) ? aRandom.Range(0x14u, 0xFFFFFu) : 0;
+    event.IdleId = aRandom.Chance(50) ? 0x10000 + aRandom.Range(0u, 0xFFFFu) : 0;
+    event.State1 = aRandom.Range(0u, 4u);
+    event.State2 = aRandom.Range(0u, 4u);
+    event.Type = aRandom.Range(0u, 3u);
+    event.EventName = String(kEventNames[aRandom.Range(0u, std::size(kEventNames) - 1)]);
+    event.TargetEventName = String(aRandom.Chance(50) ? kEventNames[aRandom.Range(0u, std::size(kEventNames) - 1)] : "");
+    event.Variables = BuildAnimationVariables(aRandom);
+
+    return event;
+}
+
+Inventory::Entry BuildInventoryEntry(Random& aRandom)
+{
+    Inventory::Entry entry;
+    entry.BaseId = BuildGameId(aRandom);
+    entry.Count = static_cast<int32_t>(aRandom.Chance(70) ? 1 : aRandom.Range(2u, 50u));
+
+    // Weapons and armor that were enchanted or improved
+    if (aRandom.Chance(15))
+    {
+        entry.ExtraEnchantId = BuildGameId(aRandom);
+        entry.ExtraEnchantCharge = static_cast<uint16_t>(aRandom.Range(500u, 3000u));
+        entry.ExtraCharge = aRandom.Range(0.f, 3000.f);
+        entry.EnchantData.IsWeapon = aRandom.Chance(50);
+
+        Inventory::EffectItem effect;
+        effect.Magnitude = aRandom.Range(5.f, 40.f);
+        effect.Duration = static_cast<int32_t>(aRandom.Range(0u, 5u));
+        effect.RawCost = aRandom.Range(1.f, 100.f);
+        effect.EffectId = BuildGameId(aRandom);
+        entry.EnchantData.Effects.push_back(effect);
+    }
+
+    if (aRandom.Chance(10))
+        entry.ExtraHealth = 1.f + static_cast<float>(aRandom.Range(1u, 6u)) / 10.f;
+
+    if (aRandom.Chance(3))
+    {
+        entry.ExtraPoisonId = BuildGameId(aRandom);
+        entry.ExtraPoisonCount = aRandom.Range(1u, 3u);
+    }
+
+    if (aRandom.Chance(3))
+        entry.ExtraSoulLevel = static_cast<int32_t>(aRandom.Range(1u, 5u));
+
+    entry.ExtraWorn = aRandom.Chance(10);
+    entry.ExtraWornLeft = !entry.ExtraWorn && aRandom.Chance(3);
+    entry.IsQuestItem = aRandom.Chance(2);
+
+    return entry;
+}
+
+Inventory BuildInventory(Random& aRandom, uint32_t aEntryCount)
+{
+    Inventory inventory;
+    for (auto i = 0u; i < aEntryCount; ++i)
+        inventory.AddOrRemoveEntry(BuildInventoryEntry(aRandom));
+
+    return inventory;
+}
+
+Vector3_NetQuantize BuildPosition(Random& aRandom)
+{
+    // Exterior coordinates span a few hundred thousand units
+    Vector3_NetQuantize position;
+    position.x = aRandom.Range(-200000.f, 200000.f);
+    position.y = aRandom.Range(-200000.f, 200000.f);
+    position.z = aRandom.Range(-5000.f, 20000.f);
+
+    return position;
+}
+
+Movement BuildMovement(Random& aRandom)
+{
+    Movement movement;
+    movement.CellId = BuildGameId(aRandom);
+    movement.WorldSpaceId = GameId(0, 0x3C);
+    movement.Position = BuildPosition(aRandom);
+    movement.Rotation.x = aRandom.Range(-0.5f, 0.5f);
+    movement.Rotation.y = aRandom.Range(0.f, 6.28f);
+    movement.Variables = BuildAnimationVariables(aRandom);
+    movement.Direction = aRandom.Range(-3.14f, 3.14f);
+
+    return movement;
+}
+
+ReferenceUpdate BuildReferenceUpdate(Random& aRandom, uint64_t aTick)
+{
+    ReferenceUpdate update;
+    update.UpdatedMovement = BuildMovement(aRandom);
+
+    // Most updates carry no action, some carry the one that started the current animation
+    if (aRandom.Chance(30))
+        update.ActionEvents.push_back(BuildActionEvent(aRandom, aTick));
+
+    return update;
+}
+
+ActorValues BuildActorValues(Random& aRandom)
+{
+    // Skills, attributes and their modifiers, close to 70 of them per actor
+    ActorValues values;
+    for (auto i = 0u; i < 70; ++i)
+        values.ActorValuesList[i] = aRandom.Chance(30) ? 0.f : static_cast<float>(aRandom.Range(1u, 100u));
+    for (auto id : {24u, 25u, 26u})
+        values.ActorMaxValuesList[id] = static_cast<float>(aRandom.Range(100u, 500u));
+
+    return values;
+}
+
+ObjectData BuildObjectData(Random& aRandom)
+{
+    ObjectData object;
+    object.ServerId = aRandom.Range(1u, 5000u);
+    object.Id = BuildGameId(aRandom);
+    object.CellId = BuildGameId(aRandom);
+    object.WorldSpaceId = GameId(0, 0x3C);
+    object.CurrentCoords = GridCellCoords(static_cast<int32_t>(aRandom.Range(0u, 60u)) - 30, static_cast<int32_t>(aRandom.Range(0u, 60u)) - 30);
+    object.CurrentLockData.IsLocked = aRandom.Chance(20);
+    object.CurrentLockData.LockLevel = static_cast<uint8_t>(aRandom.Range(0u, 100u));
+
+    // Containers carry their content, doors and levers don't
+    if (aRandom.Chance(40))
+        object.CurrentInventory = BuildInventory(aRandom, aRandom.Range(1u, 10u));
+
+    object.IsSenderFirst = aRandom.Chance(50);
+
+    return object;
+}
+
+void Fill(AuthenticationRequest& aMessage, Random& aRandom)
+{
+    aMessage.DiscordId = (static_cast<uint64_t>(aRandom.Next()) << 32) | aRandom.Next();
+    aMessage.SKSEActive = true;
+    aMessage.Token = "server password";
+    aMessage.Version = "master@0123456789abcdef";
+    aMessage.UserMods = BuildMods();
+    aMessage.Username = "Dovahkiin";
+    aMessage.WorldSpaceId = GameId(0, 0x3C);
+    aMessage.CellId = BuildGameId(aRandom);
+    aMessage.Level = static_cast<uint16_t>(aRandom.Range(1u, 81u));
+    aMessage.Capabilities = AuthenticationRequest::kCompressedMessages;
+}
+
+void Fill(AssignCharacterRequest& aMessage, Random& aRandom)
+{
+    aMessage.Cookie = aRandom.Next();
+    aMessage.ReferenceId = GameId(0, 0x14);
+    aMessage.FormId = GameId(0, 0x7);
+    aMessage.CellId = BuildGameId(aRandom);
+    aMessage.WorldSpaceId = GameId(0, 0x3C);
+    aMessage.Position = BuildPosition(aRandom);
+    aMessage.Rotation.y = aRandom.Range(0.f, 6.28f);
+    aMessage.ChangeFlags = aRandom.Next();
+    aMessage.AppearanceBuffer = BuildAppearance(aRandom);
+    aMessage.FactionsContent = BuildFactions(aRandom);
+    aMessage.LatestAction = BuildActionEvent(aRandom, 10000);
+
+    for (auto i = 0u; i < 20; ++i)
+        aMessage.QuestContent.Entries.push_back({BuildGameId(aRandom), static_cast<uint16_t>(aRandom.Range(0u, 200u))});
+
+    aMessage.FaceTints = BuildTints(aRandom);
+    aMessage.CurrentActorData.InitialActorValues = BuildActorValues(aRandom);
+    aMessage.CurrentActorData.InitialInventory = BuildInventory(aRandom, 80);
+}
+
+void Fill(ClientReferencesMoveRequest& aMessage, Random& aRandom)
+{
+    aMessage.Tick = 10000;
+    for (auto i = 0u; i < kMovingActors; ++i)
+        aMessage.Updates[aRandom.Range(1u, 5000u)] = BuildReferenceUpdate(aRandom, aMessage.Tick);
+}
+
+void Fill(ShiftGridCellRequest& aMessage, Random& aRandom)
+{
+    aMessage.WorldSpaceId = GameId(0, 0x3C);
+    aMessage.PlayerCell = BuildGameId(aRandom);
+    aMessage.CenterCoords = GridCellCoords(5, -3);
+
+    // The 5x5 grid around the player
+    for (auto i = 0u; i < 25; ++i)
+        aMessage.Cells.push_back(BuildGameId(aRandom));
+}
+
+void Fill(RequestInventoryChanges& aMessage, Random& aRandom)
+{
+    aMessage.ServerId = aRandom.Range(1u, 5000u);
+    aMessage.Item = BuildInventoryEntry(aRandom);
+    aMessage.UpdateClients = true;
+}
+
+void Fill(RequestEquipmentChanges& aMessage, Random& aRandom)
+{
+    aMessage.ServerId = aRandom.Range(1u, 5000u);
+    aMessage.ItemId = BuildGameId(aRandom);
+    aMessage.EquipSlotId = GameId(0, 0x13F42);
+    aMessage.CurrentInventory = BuildInventory(aRandom, 80);
+}
+
+void Fill(AssignObjectsRequest& aMessage, Random& aRandom)
+{
+    for (auto i = 0u; i < kObjectCount; ++i)
+        aMessage.Objects.push_back(BuildObjectData(aRandom));
+}
+
+void Fill(SendChatMessageRequest& aMessage, Random&)
+{
+    aMessage.MessageType = kGlobalChat;
+    aMessage.ChatMessage = "Anyone up for Bleak Falls Barrow? Meet me at the Sleeping Giant Inn in Riverwood.";
+}
+
+void Fill(PlayerDialogueRequest& aMessage, Random&)
+{
+    aMessage.Text = "I used to be an adventurer like you. Then I took an arrow in the knee...";
+}
+
+void Fill(SubtitleRequest& aMessage, Random& aRandom)
+{
+    aMessage.ServerId = aRandom.Range(1u, 4096u);
+    aMessage.Text = "Let me guess... someone stole your sweetroll.";
+    aMessage.TopicFormId = aRandom.Range(0x10000u, 0xFFFFFFu);
+}
+
+void Fill(DialogueRequest& aMessage, Random& aRandom)
+{
+    aMessage.ServerId = aRandom.Range(1u, 4096u);
+    aMessage.SoundFilename = "Data\\Sound\\Voice\\Skyrim.esm\\MaleGuard\\DialogueGenericVampire_00012345_1.fuz";
+}
+
+void Fill(TeleportCommandRequest& aMessage, Random&)
+{
+    aMessage.TargetPlayer = "Dovahkiin";
+}
+
+void Fill(ScriptAnimationRequest& aMessage, Random& aRandom)
+{
+    aMessage.FormID = aRandom.Range(0x10000u, 0xFFFFFFu);
+    // An idle the cache doesn't know, and an event it does
+    aMessage.Animation = "IdleChairSitting";
+    aMessage.EventName = kEventNames[aRandom.Range(0u, std::size(kEventNames) - 1)];
+}
+
+void Fill(ProjectileLaunchRequest& aMessage, Random& aRandom)
+{
+    aMessage.OriginX = aRandom.Range(-200000.f, 200000.f);
+    aMessage.OriginY = aRandom.Range(-200000.f, 200000.f);
+    aMessage.OriginZ = aRandom.Range(-5000.f, 20000.f);
+    aMessage.ProjectileBaseID = BuildGameId(aRandom);
+    aMessage.WeaponID = BuildGameId(aRandom);
+    aMessage.AmmoID = BuildGameId(aRandom);
+    aMessage.ZAngle = aRandom.Range(0.f, 6.28f);
+    aMessage.XAngle = aRandom.Range(-0.5f, 0.5f);
+    aMessage.ParentCellID = BuildGameId(aRandom);
+    aMessage.Power = 1.f;
+    aMessage.Scale = 1.f;
+}
+
+void Fill(AuthenticationResponse& aMessage, Random&)
+{
+    aMessage.Type = AuthenticationResponse::ResponseType::kAccepted;
+    aMessage.Version = "master@0123456789abcdef";
+    aMessage.UserMods = BuildMods();
+    aMessage.PlayerId = 3;
+}
+
+void Fill(AssignCharacterResponse& aMessage, Random& aRandom)
+{
+    aMessage.Cookie = aRandom.Next();
+    aMessage.ServerId = aRandom.Range(1u, 5000u);
+    aMessage.PlayerId = 3;
+    aMessage.Position = BuildPosition(aRandom);
+    aMessage.CellId = BuildGameId(aRandom);
+    aMessage.WorldSpaceId = GameId(0, 0x3C);
+    aMessage.AllActorValues = BuildActorValues(aRandom);
+    aMessage.CurrentInventory = BuildInventory(aRandom, 80);
+    aMessage.Owner = true;
+}
+
+void Fill(ServerReferencesMoveRequest& aMessage, Random& aRandom)
+{
+    aMessage.Tick = 10000;
+    for (auto i = 0u; i < kMovingActors; ++i)
+        aMessage.Updates[aRandom.Range(1u, 5000u)] = BuildReferenceUpdate(aRandom, aMessage.Tick);
+}
+
+void Fill(CharacterSpawnRequest& aMessage, Random& aRandom)
+{
+    aMessage.ServerId = aRandom.Range(1u, 5000u);
+    aMessage.FormId = GameId(0, 0x14);
+    aMessage.BaseId = GameId(0, 0x7);
+    aMessage.CellId = BuildGameId(aRandom);
+    aMessage.Position = BuildPosition(aRandom);
+    aMessage.Rotation.y = aRandom.Range(0.f, 6.28f);
+    aMessage.ChangeFlags = aRandom.Next();
+    aMessage.AppearanceBuffer = BuildAppearance(aRandom);
+    aMessage.InventoryContent = BuildInventory(aRandom, 80);
+    aMessage.FactionsContent = BuildFactions(aRandom);
+    aMessage.LatestAction = BuildActionEvent(aRandom, 10000);
+    aMessage.FaceTints = BuildTints(aRandom);
+    aMessage.InitialActorValues = BuildActorValues(aRandom);
+    aMessage.PlayerId = 7;
+    aMessage.IsPlayer = true;
+}
+
+void Fill(StringCacheUpdate& aMessage, Random&)
+{
+    aMessage.StartId = 12;
+    for (const auto* cpMask : kTintMasks)
+        aMessage.Values.push_back(String("Actors\\Character\\Character Assets\\TintMasks\\") + cpMask + ".dds");
+}
+
+void Fill(NotifyInventoryChanges& aMessage, Random& aRandom)
+{
+    aMessage.ServerId = aRandom.Range(1u, 5000u);
+    aMessage.Item = BuildInventoryEntry(aRandom);
+}
+
+void Fill(NotifyPlayerList& aMessage, Random& aRandom)
+{
+    for (auto i = 0u; i < 16; ++i)
+        aMessage.Players[aRandom.Range(1u, 5000u)] = String("Player ") + std::to_string(i).c_str();
+}
+
+void Fill(NotifySpawnData& aMessage, Random& aRandom)
+{
+    aMessage.Id = aRandom.Range(1u, 5000u);
+    aMessage.NewActorData.InitialActorValues = BuildActorValues(aRandom);
+    aMessage.NewActorData.InitialInventory = BuildInventory(aRandom, 30);
+}
+
+void Fill(AssignObjectsResponse& aMessage, Random& aRandom)
+{
+    for (auto i = 0u; i < kObjectCount; ++i)
+        aMessage.Objects.push_back(BuildObjectData(aRandom));
+}
+
+void Fill(NotifyActorValuesBatch& aMessage, Random& aRandom)
+{
+    // Health, magicka and stamina of the actors fighting around a player
+    for (auto i = 0u; i < kMovingActors; ++i)
+    {
+        ActorValueChanges changes;
+        changes.Id = aRandom.Range(1u, 5000u);
+        for (auto id : {24u, 25u, 26u})
+        {
+            if (aRandom.Chance(60))
+                changes.Values[id] = static_cast<float>(aRandom.Range(0u, 500u));
+        }
+
+        changes.HasDeltaHealth = aRandom.Chance(50);
+        if (changes.HasDeltaHealth)
+            changes.DeltaHealth = -aRandom.Range(1.f, 60.f);
+
+        aMessage.Changes.push_back(std::move(changes));
+    }
+}
+} // namespace Payloads
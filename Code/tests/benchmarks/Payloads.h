@@ -0,0 +1,81 @@
+#pragma once
+
+#include <TiltedCore/Stl.hpp>
+
+#include <Messages/ClientMessageFactory.h>
+#include <Messages/ServerMessageFactory.h>
+
+/**
+ * @brief Seeded generators of realistic payloads for the benchmarks.
+ *
+ * Sizes and value ranges follow what a session with a handful of players sends: full behavior graphs,
+ * inventories of a few dozen items, a few actors moving per update. The same seed always gives the same
+ * payload so encoded sizes can be compared against a baseline.
+ */
+namespace Payloads
+{
+// xorshift32, small and identical on every standard library unlike the <random> distributions
+struct Random
+{
+    explicit Random(uint32_t aSeed) noexcept
+        : m_state(aSeed ? aSeed : 1)
+    {
+    }
+
+    uint32_t Next() noexcept;
+    // In [aMin, aMax]
+    uint32_t Range(uint32_t aMin, uint32_t aMax) noexcept;
+    float Range(float aMin, float aMax) noexcept;
+    // True aPercent% of the time
+    bool Chance(uint32_t aPercent) noexcept;
+
+private:
+    uint32_t m_state;
+};
+
+// Event names the benchmarks add to the string cache, as the game would have
+void RegisterCachedStrings();
+
+AnimationVariables BuildAnimationVariables(Random& aRandom);
+// The next frame of an animation graph, a few floats move and the odd state flips
+AnimationVariables NextFrame(const AnimationVariables& acVariables, Random& aRandom);
+ActionEvent BuildActionEvent(Random& aRandom, uint64_t aTick);
+Inventory BuildInventory(Random& aRandom, uint32_t aEntryCount);
+Inventory::Entry BuildInventoryEntry(Random& aRandom);
+Movement BuildMovement(Random& aRandom);
+ReferenceUpdate BuildReferenceUpdate(Random& aRandom, uint64_t aTick);
+ActorValues BuildActorValues(Random& aRandom);
+ObjectData BuildObjectData(Random& aRandom);
+Vector3_NetQuantize BuildPosition(Random& aRandom);
+
+// Fills a message with a realistic payload, messages without an overload keep their decoded defaults
+template <class T> void Fill(T&, Random&)
+{
+}
+
+void Fill(AuthenticationRequest& aMessage, Random& aRandom);
+void Fill(AssignCharacterRequest& aMessage, Random& aRandom);
+void Fill(ClientReferencesMoveRequest& aMessage, Random& aRandom);
+void Fill(ShiftGridCellRequest& aMessage, Random& aRandom);
+void Fill(RequestInventoryChanges& aMessage, Random& aRandom);
+void Fill(RequestEquipmentChanges& aMessage, Random& aRandom);
+void Fill(AssignObjectsRequest& aMessage, Random& aRandom);
+void Fill(SendChatMessageRequest& aMessage, Random& aRandom);
+void Fill(PlayerDialogueRequest& aMessage, Random& aRandom);
+void Fill(SubtitleRequest& aMessage, Random& aRandom);
+void Fill(DialogueRequest& aMessage, Random& aRandom);
+void Fill(TeleportCommandRequest& aMessage, Random& aRandom);
+void Fill(ScriptAnimationRequest& aMessage, Random& aRandom);
+void Fill(ProjectileLaunchRequest& aMessage, Random& aRandom);
+
+void Fill(AuthenticationResponse& aMessage, Random& aRandom);
+void Fill(AssignCharacterResponse& aMessage, Random& aRandom);
+void Fill(ServerReferencesMoveRequest& aMessage, Random& aRandom);
+void Fill(CharacterSpawnRequest& aMessage, Random& aRandom);
+void Fill(StringCacheUpdate& aMessage, Random& aRandom);
+void Fill(NotifyInventoryChanges& aMessage, Random& aRandom);
+void Fill(NotifyPlayerList& aMessage, Random& aRandom);
+void Fill(NotifySpawnData& aMessage, Random& aRandom);
+void Fill(AssignObjectsResponse& aMessage, Random& aRandom);
+void Fill(NotifyActorValuesBatch& aMessage, Random& aRandom);
+} // namespace Payloads
@@ -0,0 +1,243 @@
+#include "Bench.h"
+#include "Payloads.h"
+
+#include <StringCache.h>
+#include <BehaviorVarTable.h>
+
+#include <algorithm>
+#include <memory>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+constexpr size_t kBufferSize = 1 << 16;
+
+// A player's inventory, armor, weapons, potions and loot
+constexpr uint32_t kInventorySize = 80;
+
+using Encoder = std::function<void(Buffer::Writer&)>;
+using Decoder = std::function<void(Buffer::Reader&)>;
+
+void AddEncoder(Bench::Registry& aRegistry, const char* acpName, Encoder aEncoder)
+{
+    auto pBuffer = std::make_shared<Buffer>(kBufferSize);
+
+    aRegistry.Add(acpName,
+                  [pBuffer, encoder = std::move(aEncoder)]()
+                  {
+                      Buffer::Writer writer(pBuffer.get());
+                      encoder(writer);
+                      return writer.Size();
+                  });
+}
+
+// Decodes what acEncoder wrote, over and over
+void AddDecoder(Bench::Registry& aRegistry, const char* acpName, const Encoder& acEncoder, Decoder aDecoder)
+{
+    Buffer buffer(kBufferSize);
+    Buffer::Writer writer(&buffer);
+    acEncoder(writer);
+    auto pEncoded = std::make_shared<Vector<uint8_t>>(buffer.GetData(), buffer.GetData() + writer.Size());
+
+    aRegistry.Add(acpName,
+                  [pEncoded, decoder = std::move(aDecoder)]()
+                  {
+                      ViewBuffer view(pEncoded->data(), pEncoded->size());
+                      Buffer::Reader reader(&view);
+                      decoder(reader);
+                      return pEncoded->size();
+                  });
+}
+
+void RegisterAnimationVariables(Bench::Registry& aRegistry)
+{
+    Payloads::Random random(1);
+    auto pPrevious = std::make_shared<AnimationVariables>(Payloads::BuildAnimationVariables(random));
+    auto pCurrent = std::make_shared<AnimationVariables>(Payloads::NextFrame(*pPrevious, random));
+
+    const Encoder cDiff = [pPrevious, pCurrent](Buffer::Writer& aWriter) { pCurrent->GenerateDiff(*pPrevious, aWriter); };
+    // What Movement sends, no previous state to diff against
+    const Encoder cFull = [pCurrent](Buffer::Writer& aWriter) { pCurrent->GenerateDiff(AnimationVariables{}, aWriter); };
+
+    AddEncoder(aRegistry, "struct/AnimationVariables/GenerateDiff", cDiff);
+    AddEncoder(aRegistry, "struct/AnimationVariables/GenerateDiffFull", cFull);
+
+    auto pTarget = std::make_shared<AnimationVariables>(*pPrevious);
+    AddDecoder(aRegistry, "struct/AnimationVariables/ApplyDiff", cDiff, [pTarget](Buffer::Reader& aReader) { pTarget->ApplyDiff(aReader); });
+}
+
+void RegisterActionEvent(Bench::Registry& aRegistry)
+{
+    Payloads::Random random(2);
+    auto pPrevious = std::make_shared<ActionEvent>(Payloads::BuildActionEvent(random, 10000));
+
+    // The next action of the same actor, a different animation with the graph moved on
+    auto pCurrent = std::make_shared<ActionEvent>(*pPrevious);
+    pCurrent->Tick += 250;
+    pCurrent->ActionId += 1;
+    pCurrent->EventName = String("moveStop");
+    pCurrent->Variables = Payloads::NextFrame(pPrevious->Variables, random);
+
+    const Encoder cDiff = [pPrevious, pCurrent](Buffer::Writer& aWriter) { pCurrent->GenerateDifferential(*pPrevious, aWriter); };
+    AddEncoder(aRegistry, "struct/ActionEvent/GenerateDifferential", cDiff);
+
+    AddDecoder(aRegistry, "struct/ActionEvent/ApplyDifferential", cDiff,
+               [pPrevious, pTarget = std::make_shared<ActionEvent>()](Buffer::Reader& aReader)
+               {
+                   *pTarget = *pPrevious;
+                   pTarget->ApplyDifferential(aReader);
+               });
+}
+
+void RegisterInventory(Bench::Registry& aRegistry)
+{
+    Payloads::Random random(3);
+    auto pInventory = std::make_shared<Inventory>(Payloads::BuildInventory(random, kInventorySize));
+
+    const Encoder cFull = [pInventory](Buffer::Writer& aWriter) { pInventory->Serialize(aWriter); };
+    AddEncoder(aRegistry, "struct/Inventory/Serialize", cFull);
+    AddDecoder(aRegistry, "struct/Inventory/Deserialize", cFull, [pTarget = std::make_shared<Inventory>()](Buffer::Reader& aReader) { pTarget->Deserialize(aReader); });
+}
+
+void RegisterVector3(Bench::Registry& aRegistry)
+{
+    Payloads::Random random(4);
+    const auto cPosition = Payloads::BuildPosition(random);
+    const auto cPacked = cPosition.Pack();
+
+    aRegistry.Add("struct/Vector3_NetQuantize/Pack",
+                  [cPosition]()
+                  {
+                      const auto cValue = cPosition.Pack();
+                      return static_cast<size_t>(cValue != 0) * sizeof(cValue);
+                  });
+
+    aRegistry.Add("struct/Vector3_NetQuantize/Unpack",
+                  [cPacked]()
+                  {
+                      Vector3_NetQuantize position;
+                      position.Unpack(cPacked);
+                      return static_cast<size_t>(position.x != 0.f) * sizeof(cPacked);
+                  });
+
+    const Encoder cSerialize = [cPosition](Buffer::Writer& aWriter) { cPosition.Serialize(aWriter); };
+    AddEncoder(aRegistry, "struct/Vector3_NetQuantize/Serialize", cSerialize);
+    AddDecoder(aRegistry, "struct/Vector3_NetQuantize/Deserialize", cSerialize, [](Buffer::Reader& aReader) { Vector3_NetQuantize position; position.Deserialize(aReader); });
+}
+
+void RegisterStringCache(Bench::Registry& aRegistry)
+{
+    // Event names and paths a server has seen after a while, sent to every joining player
+    auto pCache = std::make_shared<StringCache>();
+    for (auto i = 0u; i < 300; ++i)
+        pCache->Add(String("Actors\\Character\\Behaviors\\Event") + std::to_string(i).c_str());
+
+    uint32_t startId = 0;
+    const auto cUpdate = pCache->Serialize(startId);
+
+    Buffer buffer(kBufferSize);
+    Buffer::Writer writer(&buffer);
+    cUpdate.Serialize(writer);
+    const auto cEncodedSize = writer.Size();
+
+    aRegistry.Add("struct/StringCache/Serialize",
+                  [pCache, cEncodedSize]()
+                  {
+                      uint32_t startId = 0;
+                      const auto cUpdate = pCache->Serialize(startId);
+                      return cUpdate.Values.empty() ? 0 : cEncodedSize;
+                  });
+}
+
+// Variables looked up by name the way BehaviorVar resolves mod signatures, each operation goes through a whole graph
+void RegisterBehaviorVarTable(Bench::Registry& aRegistry)
+{
+    // The human graph, the largest one
+    const auto* cpTable = BehaviorVarTables::Get(17585368238253125375ull);
+
+    auto pNames = std::make_shared<Vector<String>>();
+    for (uint32_t i = 0; i < cpTable->Size(); ++i)
+        pNames->push_back(String(cpTable->GetName(i)));
+
+    Payloads::Random random(5);
+    for (size_t i = pNames->size() - 1; i > 0; --i)
+        std::swap((*pNames)[i], (*pNames)[random.Range(0u, static_cast<uint32_t>(i))]);
+
+    auto pUpperNames = std::make_shared<Vector<String>>(*pNames);
+    for (auto& name : *pUpperNames)
+        std::transform(std::begin(name), std::end(name), std::begin(name), [](char aChar) { return static_cast<char>(std::toupper(static_cast<unsigned char>(aChar))); });
+
+    aRegistry.Add("struct/BehaviorVarTable/Find",
+                  [cpTable, pNames]()
+                  {
+                      size_t found = 0;
+                      for (const auto& cName : *pNames)
+                          found += cpTable->Find(cName) != BehaviorVarTable::kNotFound;
+                      return found;
+                  });
+
+    aRegistry.Add("struct/BehaviorVarTable/FindFolded",
+                  [cpTable, pUpperNames]()
+                  {
+                      size_t found = 0;
+                      for (const auto& cName : *pUpperNames)
+                          found += cpTable->FindFolded(cName) != BehaviorVarTable::kNotFound;
+                      return found;
+                  });
+
+    aRegistry.Add("struct/BehaviorVarTable/GetName",
+                  [cpTable]()
+                  {
+                      size_t found = 0;
+                      for (uint32_t i = 0; i < cpTable->Size(); ++i)
+                          found += !cpTable->GetName(i).empty();
+                      return found;
+                  });
+
+    // The maps the client used to build from the enums at startup, for comparison
+    auto pMap = std::make_shared<Map<String, uint32_t>>();
+    for (uint32_t i = 0; i < cpTable->Size(); ++i)
+        (*pMap)[String(cpTable->GetName(i))] = i;
+
+    aRegistry.Add("struct/BehaviorVarTable/MapFind",
+                  [pMap, pNames]()
+                  {
+                      size_t found = 0;
+                      for (const auto& cName : *pNames)
+                          found += pMap->find(cName) != std::end(*pMap);
+                      return found;
+                  });
+
+    aRegistry.Add("struct/BehaviorVarTable/BuildMaps",
+                  []()
+                  {
+                      size_t count = 0;
+                      for (const auto& cTable : BehaviorVarTables::GetAll())
+                      {
+                          Map<String, uint32_t> nameMap;
+                          Map<uint32_t, String> valueMap;
+                          for (uint32_t i = 0; i < cTable.Size(); ++i)
+                          {
+                              nameMap[String(cTable.GetName(i))] = i;
+                              valueMap[i] = String(cTable.GetName(i));
+                          }
+
+                          count += nameMap.size();
+                      }
+                      return count;
+                  });
+}
+} // namespace
+
+void RegisterStructBenchmarks(Bench::Registry& aRegistry)
+{
+    Payloads::RegisterCachedStrings();
+
+    RegisterAnimationVariables(aRegistry);
+    RegisterActionEvent(aRegistry);
+    RegisterInventory(aRegistry);
+    RegisterVector3(aRegistry);
+    RegisterStringCache(aRegistry);
+    RegisterBehaviorVarTable(aRegistry);
+}
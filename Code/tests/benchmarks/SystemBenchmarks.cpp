@@ -0,0 +1,476 @@
+#include "Bench.h"
+#include "Payloads.h"
+
+#include <Interpolation.h>
+#include <MessageCompression.h>
+#include <Messages/NotifyActorValueChanges.h>
+#include <Messages/NotifyActorValuesBatch.h>
+#include <Messages/NotifyHealthChangeBroadcast.h>
+#include <Messages/ServerReferencesMoveSnapshot.h>
+#include <Structs/ActorValueCoalescer.h>
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <memory>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+constexpr size_t kBufferSize = 1 << 20;
+
+size_t EncodedSize(const ServerMessage& acMessage, Buffer& aBuffer)
+{
+    Buffer::Writer writer(&aBuffer);
+    acMessage.Serialize(writer);
+
+    return writer.Size();
+}
+
+// A fight in a few cells: players hit actors around them and owners report stamina and health every few ticks
+void RegisterActorValues(Bench::Registry& aRegistry)
+{
+    constexpr uint32_t cPlayerCount = 32;
+    constexpr uint32_t cActorCount = 256;
+    constexpr uint32_t cCellCount = 4;
+    constexpr uint32_t cTickCount = 20;
+    constexpr uint32_t cHitsPerTick = 96;
+    constexpr uint32_t cValueReportsPerTick = 48;
+    constexpr uint32_t cHealth = 24;
+    constexpr uint32_t cStamina = 26;
+
+    struct Report
+    {
+        uint32_t ActorId;
+        uint32_t PlayerId;
+        bool IsHit;
+        float DeltaHealth;
+        Map<uint32_t, float> Values;
+    };
+
+    static constexpr auto s_cellOf = [](uint32_t aId) { return aId % cCellCount; };
+
+    // Hits come from players in the same cell
+    Payloads::Random random(3);
+    auto pTicks = std::make_shared<Vector<Vector<Report>>>(cTickCount);
+    for (auto& tick : *pTicks)
+    {
+        for (auto i = 0u; i < cHitsPerTick; ++i)
+        {
+            const auto cActorId = random.Range(0u, cActorCount - 1);
+            const auto cPlayerId = s_cellOf(cActorId) + cCellCount * random.Range(0u, cPlayerCount / cCellCount - 1);
+            tick.push_back({cActorId, cPlayerId, true, random.Range(0.5f, 20.f), {}});
+        }
+
+        for (auto i = 0u; i < cValueReportsPerTick; ++i)
+        {
+            const auto cActorId = random.Range(0u, cActorCount - 1);
+            Map<uint32_t, float> values;
+            values[cStamina] = random.Range(0.f, 100.f);
+            values[cHealth] = random.Range(0.f, 100.f);
+            tick.push_back({cActorId, cActorId % cPlayerCount, false, 0.f, std::move(values)});
+        }
+    }
+
+    auto pBuffer = std::make_shared<Buffer>(kBufferSize);
+
+    // One notification per request to every player in range but the sender, as the server did before the batch
+    aRegistry.Add("actorvalues/Direct",
+                  [pTicks, pBuffer]()
+                  {
+                      size_t bytes = 0;
+                      for (const auto& tick : *pTicks)
+                      {
+                          for (const auto& report : tick)
+                          {
+                              NotifyHealthChangeBroadcast health;
+                              NotifyActorValueChanges values;
+                              const ServerMessage* pMessage = &health;
+
+                              if (report.IsHit)
+                              {
+                                  health.Id = report.ActorId;
+                                  health.DeltaHealth = report.DeltaHealth;
+                              }
+                              else
+                              {
+                                  values.Id = report.ActorId;
+                                  values.Values = report.Values;
+                                  pMessage = &values;
+                              }
+
+                              for (auto playerId = 0u; playerId < cPlayerCount; ++playerId)
+                              {
+                                  if (playerId != report.PlayerId && s_cellOf(playerId) == s_cellOf(report.ActorId))
+                                      bytes += EncodedSize(*pMessage, *pBuffer);
+                              }
+                          }
+                      }
+                      return bytes;
+                  });
+
+    auto pCoalescer = std::make_shared<ActorValueCoalescer>();
+    auto pBatch = std::make_shared<NotifyActorValuesBatch>();
+
+    aRegistry.Add("actorvalues/Batched",
+                  [pTicks, pBuffer, pCoalescer, pBatch]()
+                  {
+                      size_t bytes = 0;
+                      for (const auto& tick : *pTicks)
+                      {
+                          for (const auto& report : tick)
+                          {
+                              if (report.IsHit)
+                                  pCoalescer->AddDeltaHealth(report.ActorId, report.PlayerId, report.DeltaHealth);
+                              else
+                                  pCoalescer->SetValues(report.ActorId, report.PlayerId, report.Values);
+                          }
+
+                          for (auto playerId = 0u; playerId < cPlayerCount; ++playerId)
+                          {
+                              pBatch->Changes.clear();
+                              pCoalescer->Collect(
+                                  playerId, [cCell = s_cellOf(playerId)](uint32_t aActorId) { return s_cellOf(aActorId) == cCell; }, pBatch->Changes);
+
+                              if (!pBatch->Changes.empty())
+                                  bytes += EncodedSize(*pBatch, *pBuffer);
+                          }
+
+                          pCoalescer->Clear();
+                      }
+                      return bytes;
+                  });
+}
+
+template <class T> void AddCompression(Bench::Registry& aRegistry, const char* acpName, uint32_t aSeed)
+{
+    T message;
+    Payloads::Random random(aSeed);
+    Payloads::Fill(message, random);
+
+    Buffer buffer(kBufferSize);
+    Buffer::Writer writer(&buffer);
+    message.Serialize(writer);
+    auto pEncoded = std::make_shared<Vector<uint8_t>>(buffer.GetData(), buffer.GetData() + writer.Size());
+
+    auto pEnvelope = std::make_shared<Vector<uint8_t>>(MessageCompression::GetMaxEnvelopeSize(pEncoded->size()));
+
+    aRegistry.Add(String("compression/") + acpName + "/Compress",
+                  [pEncoded, pEnvelope]() { return MessageCompression::Compress(pEncoded->data(), pEncoded->size(), pEnvelope->data(), pEnvelope->size()); });
+
+    auto pCompressed = std::make_shared<Vector<uint8_t>>(*pEnvelope);
+    pCompressed->resize(MessageCompression::Compress(pEncoded->data(), pEncoded->size(), pCompressed->data(), pCompressed->size()));
+    auto pInflated = std::make_shared<Vector<uint8_t>>();
+
+    aRegistry.Add(String("compression/") + acpName + "/Decompress",
+                  [pCompressed, pInflated]()
+                  {
+                      if (!MessageCompression::Decompress(pCompressed->data(), pCompressed->size(), *pInflated))
+                          return size_t(0);
+                      return pCompressed->size();
+                  });
+}
+
+// The messages sent through the compression envelope, the bytes are the envelope size
+void RegisterCompression(Bench::Registry& aRegistry)
+{
+    AddCompression<StringCacheUpdate>(aRegistry, "StringCacheUpdate", 4);
+    AddCompression<CharacterSpawnRequest>(aRegistry, "CharacterSpawnRequest", 5);
+    AddCompression<AuthenticationResponse>(aRegistry, "AuthenticationResponse", 6);
+}
+
+// What InterpolationSystem did with its list of points, kept to compare against
+float SampleList(std::list<InterpolationBuffer::Point>& aPoints, uint64_t aTick)
+{
+    constexpr float cTwoPi = 6.28318530718f;
+
+    while (aPoints.size() > 2 && aTick > std::next(aPoints.begin())->Tick)
+        aPoints.pop_front();
+
+    if (aPoints.size() < 2)
+        return 0.f;
+
+    const auto& first = aPoints.front();
+    const auto& second = *std::next(aPoints.begin());
+
+    const auto cTickDelta = static_cast<float>(second.Tick - first.Tick);
+    const auto cDelta = std::clamp(cTickDelta > 0.f && aTick > first.Tick ? static_cast<float>(aTick - first.Tick) / cTickDelta : 0.f, 0.f, 1.f);
+
+    const auto cPosition = first.Position + (second.Position - first.Position) * cDelta;
+    const auto Rotate = [cDelta](float aFrom, float aTo) { return std::fmod(std::fmod(aFrom + std::remainder(aTo - aFrom, cTwoPi) * cDelta, cTwoPi) + cTwoPi, cTwoPi); };
+    const glm::vec3 cRotation{Rotate(first.Rotation.x, second.Rotation.x), Rotate(first.Rotation.y, second.Rotation.y), Rotate(first.Rotation.z, second.Rotation.z)};
+
+    return cPosition.x + cRotation.z;
+}
+
+// 64 snapshots 50 ticks apart with one late snapshot in four, sampled 150 ticks behind the latest
+void RegisterInterpolation(Bench::Registry& aRegistry)
+{
+    constexpr uint64_t cInterval = 50;
+    constexpr uint64_t cDelay = 150;
+
+    struct State
+    {
+        Vector<InterpolationBuffer::Point> Points;
+        uint64_t Offset{0};
+        float Sink{0.f};
+    };
+
+    Payloads::Random random(7);
+    Vector<InterpolationBuffer::Point> points;
+    for (auto i = 0u; i < 64; ++i)
+    {
+        const auto cMovement = Payloads::BuildMovement(random);
+
+        InterpolationBuffer::Point point;
+        point.Tick = 1000 + i * cInterval;
+        point.Position = {cMovement.Position.x, cMovement.Position.y, cMovement.Position.z};
+        point.Rotation = {cMovement.Rotation.x, 0.f, cMovement.Rotation.y};
+        point.Variables = cMovement.Variables;
+        point.Direction = cMovement.Direction;
+        points.push_back(std::move(point));
+    }
+    for (auto i = 0u; i + 4 <= points.size(); i += 4)
+        std::swap(points[i + 2], points[i + 3]);
+
+    // Each run continues where the previous one stopped
+    auto pBufferState = std::make_shared<State>(State{points});
+    auto pBuffer = std::make_shared<InterpolationBuffer>();
+
+    aRegistry.Add("interpolation/Buffer",
+                  [pBufferState, pBuffer]()
+                  {
+                      InterpolationBuffer::Sample sample;
+                      for (auto point : pBufferState->Points)
+                      {
+                          point.Tick += pBufferState->Offset;
+                          pBuffer->Add(point);
+                          if (pBuffer->Update(point.Tick - cDelay, sample))
+                              pBufferState->Sink += sample.Position.x + sample.Rotation.z;
+                      }
+
+                      pBufferState->Offset += pBufferState->Points.size() * cInterval;
+                      return pBufferState->Points.size();
+                  });
+
+    auto pListState = std::make_shared<State>(State{points});
+    auto pList = std::make_shared<std::list<InterpolationBuffer::Point>>();
+
+    aRegistry.Add("interpolation/List",
+                  [pListState, pList]()
+                  {
+                      for (auto point : pListState->Points)
+                      {
+                          point.Tick += pListState->Offset;
+
+                          auto itor = std::find_if(pList->begin(), pList->end(), [&point](const auto& acPoint) { return acPoint.Tick > point.Tick; });
+                          pList->insert(itor, point);
+
+                          pListState->Sink += SampleList(*pList, point.Tick - cDelay);
+                      }
+
+                      pListState->Offset += pListState->Points.size() * cInterval;
+                      return pListState->Points.size();
+                  });
+}
+
+Inventory::Entry BuildEntry(uint32_t aBaseId, int32_t aCount)
+{
+    Inventory::Entry entry;
+    entry.BaseId = GameId(0, aBaseId);
+    entry.Count = aCount;
+
+    return entry;
+}
+
+// The linear scans the inventory used before it was indexed
+void LinearAddOrRemoveEntry(Vector<Inventory::Entry>& aEntries, const Inventory::Entry& acEntry)
+{
+    auto duplicate = std::find_if(aEntries.begin(), aEntries.end(), [&acEntry](Inventory::Entry& entry) { return entry.CanBeMerged(acEntry); });
+
+    if (duplicate != aEntries.end())
+    {
+        duplicate->Count += acEntry.Count;
+        if (duplicate->Count <= 0)
+            aEntries.erase(duplicate);
+    }
+    else
+    {
+        aEntries.push_back(acEntry);
+    }
+}
+
+void LinearUpdateEquipment(Vector<Inventory::Entry>& aEntries, const Inventory& acNewInventory)
+{
+    while (true)
+    {
+        auto wornEntry = std::find_if(aEntries.begin(), aEntries.end(), [](auto& aEntry) { return aEntry.IsWorn(); });
+        if (wornEntry == aEntries.end())
+            break;
+
+        wornEntry->ExtraWorn = wornEntry->ExtraWornLeft = false;
+    }
+
+    for (const auto& newEntry : acNewInventory.Entries)
+    {
+        if (!newEntry.IsWorn())
+            continue;
+
+        auto entry = std::find_if(aEntries.begin(), aEntries.end(), [&newEntry](auto& aEntry) { return aEntry.BaseId == newEntry.BaseId; });
+        if (entry == aEntries.end())
+            continue;
+
+        entry->ExtraWorn = newEntry.ExtraWorn;
+        entry->ExtraWornLeft = newEntry.ExtraWornLeft;
+    }
+}
+
+// A container of 1000 entries, every run changes 200 of them and then reverts the changes
+void RegisterInventory(Bench::Registry& aRegistry)
+{
+    constexpr uint32_t cEntryCount = 1000;
+    constexpr uint32_t cChangeCount = 200;
+    constexpr uint32_t cWornCount = 100;
+
+    Inventory source;
+    for (auto i = 0u; i < cEntryCount; ++i)
+    {
+        auto entry = BuildEntry(0x1000 + i, 1 + i % 5);
+        entry.ExtraHealth = i % 7 == 0 ? 1.5f : 0.f;
+        source.AddOrRemoveEntry(entry);
+    }
+
+    auto pChanges = std::make_shared<Vector<Inventory::Entry>>();
+    for (auto i = 0u; i < cChangeCount; ++i)
+        pChanges->push_back(BuildEntry(0x1000 + (i * 37) % cEntryCount, i % 2 ? 1 : -1));
+    for (auto i = 0u; i < cChangeCount; ++i)
+        pChanges->push_back(BuildEntry(0x1000 + (i * 37) % cEntryCount, i % 2 ? -1 : 1));
+
+    // Switching between two sets of worn items, one at the start of the entries and one at the end
+    auto pEquipments = std::make_shared<Vector<Inventory>>();
+    for (const auto cFirst : {1u, cEntryCount - 3 * cWornCount})
+    {
+        Inventory equipment;
+        for (auto i = 0u; i < cWornCount; ++i)
+        {
+            auto entry = BuildEntry(0x1000 + cFirst + i * 3, 1);
+            entry.ExtraWorn = true;
+            equipment.Entries.push_back(entry);
+        }
+        pEquipments->push_back(std::move(equipment));
+    }
+
+    auto pLinear = std::make_shared<Vector<Inventory::Entry>>(source.Entries);
+    auto pIndexed = std::make_shared<Inventory>(source);
+
+    aRegistry.Add("inventory/AddOrRemoveEntry/Linear",
+                  [pLinear, pChanges]()
+                  {
+                      for (const auto& change : *pChanges)
+                          LinearAddOrRemoveEntry(*pLinear, change);
+                      return pChanges->size();
+                  });
+
+    aRegistry.Add("inventory/AddOrRemoveEntry/Indexed",
+                  [pIndexed, pChanges]()
+                  {
+                      for (const auto& change : *pChanges)
+                          pIndexed->AddOrRemoveEntry(change);
+                      return pChanges->size();
+                  });
+
+    aRegistry.Add("inventory/UpdateEquipment/Linear",
+                  [pLinear, pEquipments]()
+                  {
+                      for (const auto& equipment : *pEquipments)
+                          LinearUpdateEquipment(*pLinear, equipment);
+                      return pEquipments->size();
+                  });
+
+    aRegistry.Add("inventory/UpdateEquipment/Indexed",
+                  [pIndexed, pEquipments]()
+                  {
+                      for (const auto& equipment : *pEquipments)
+                          pIndexed->UpdateEquipment(equipment);
+                      return pEquipments->size();
+                  });
+}
+
+// One movement tick of 100 moving entities sent to 16 players, the bytes are what all of them receive
+void RegisterSnapshot(Bench::Registry& aRegistry)
+{
+    constexpr uint32_t cPlayerCount = 16;
+    constexpr uint32_t cEntityCount = 100;
+    constexpr uint64_t cTick = 10000;
+
+    Payloads::Random random(8);
+    auto pUpdates = std::make_shared<Vector<ReferenceUpdate>>();
+    for (auto i = 0u; i < cEntityCount; ++i)
+        pUpdates->push_back(Payloads::BuildReferenceUpdate(random, cTick));
+
+    auto pPacket = std::make_shared<Buffer>(kBufferSize);
+
+    // What the server used to do: one message per recipient, every update copied and encoded for each of them
+    aRegistry.Add("snapshot/PerRecipient",
+                  [pUpdates, pPacket]()
+                  {
+                      Map<uint32_t, ServerReferencesMoveRequest> messages;
+                      for (auto player = 0u; player < cPlayerCount; ++player)
+                      {
+                          auto& message = messages[player];
+                          message.Tick = cTick;
+
+                          for (auto entity = 0u; entity < cEntityCount; ++entity)
+                              message.Updates[entity] = (*pUpdates)[entity];
+                      }
+
+                      size_t bytes = 0;
+                      for (auto& [player, message] : messages)
+                          bytes += EncodedSize(message, *pPacket);
+                      return bytes;
+                  });
+
+    struct Segments
+    {
+        Buffer Scratch{1 << 16};
+        Vector<ServerReferencesMoveSnapshot::Segment> Encoded = Vector<ServerReferencesMoveSnapshot::Segment>(cEntityCount);
+        Vector<ServerReferencesMoveSnapshot> Snapshots = Vector<ServerReferencesMoveSnapshot>(cPlayerCount);
+    };
+
+    auto pSegments = std::make_shared<Segments>();
+
+    aRegistry.Add("snapshot/EncodeOnce",
+                  [pUpdates, pPacket, pSegments]()
+                  {
+                      for (auto& snapshot : pSegments->Snapshots)
+                          snapshot.Reset(cTick);
+
+                      for (auto entity = 0u; entity < cEntityCount; ++entity)
+                      {
+                          ServerReferencesMoveSnapshot::Encode(entity, (*pUpdates)[entity], pSegments->Encoded[entity], pSegments->Scratch);
+
+                          for (auto& snapshot : pSegments->Snapshots)
+                              snapshot.Segments.push_back(&pSegments->Encoded[entity]);
+                      }
+
+                      size_t bytes = 0;
+                      for (const auto& snapshot : pSegments->Snapshots)
+                          bytes += EncodedSize(snapshot, *pPacket);
+                      return bytes;
+                  });
+}
+} // namespace
+
+void RegisterSystemBenchmarks(Bench::Registry& aRegistry)
+{
+    Payloads::RegisterCachedStrings();
+
+    RegisterActorValues(aRegistry);
+    RegisterCompression(aRegistry);
+    RegisterInterpolation(aRegistry);
+    RegisterInventory(aRegistry);
+    RegisterSnapshot(aRegistry);
+}
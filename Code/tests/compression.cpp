@@ -0,0 +1,269 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <MessageCompression.h>
+#include <Messages/AuthenticationRequest.h>
+#include <Messages/ClientMessageFactory.h>
+#include <Messages/ServerMessageFactory.h>
+
+#include <catch2/catch.hpp>
+#include <zlib.h>
+
+#include <cstring>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+const char* const kTintMasks[] = {
+    "SkinTone", "MaleHeadCheeks", "MaleHead_Cheeks2", "MaleHeadLaughLines", "MaleHead_FrownLines", "MaleHeadNord_Lips", "MaleHead_Nose", "MaleHeadForehead",
+    "MaleHead_Chin", "MaleUpperEyeSocket", "MaleLowerEyeSocket", "MaleNeck", "MaleHeadWarPaint_01", "MaleHeadDirt_01"};
+
+template <class T> Vector<uint8_t> Encode(const T& acMessage)
+{
+    Buffer buffer(1 << 20);
+    Buffer::Writer writer(&buffer);
+    acMessage.Serialize(writer);
+
+    return Vector<uint8_t>(buffer.GetData(), buffer.GetData() + writer.Size());
+}
+
+// What a client receives when a new player with a tinted face shows up
+StringCacheUpdate BuildStringCacheUpdate()
+{
+    StringCacheUpdate update;
+    update.StartId = 12;
+    for (const auto* cpName : kTintMasks)
+        update.Values.push_back(String("Actors\\Character\\Character Assets\\TintMasks\\") + cpName + ".dds");
+
+    return update;
+}
+
+CharacterSpawnRequest BuildSpawnRequest()
+{
+    CharacterSpawnRequest request;
+    request.ServerId = 1234;
+    request.FormId.BaseId = 0x14;
+    request.BaseId.BaseId = 0x7;
+    request.Position.x = 100.f;
+    request.ChangeFlags = 0xF00D;
+    request.PlayerId = 7;
+    request.IsPlayer = true;
+
+    // Face morphs and sliders, mostly small floats and empty slots like a real save buffer
+    String appearance;
+    for (auto i = 0u; i < 600; ++i)
+    {
+        const float cValue = (i % 5) == 0 ? 0.f : static_cast<float>(i % 17) / 16.f;
+        appearance.append(reinterpret_cast<const char*>(&cValue), sizeof(cValue));
+    }
+    request.AppearanceBuffer = appearance;
+
+    for (auto i = 0u; i < 80; ++i)
+    {
+        Inventory::Entry entry;
+        entry.BaseId.BaseId = 0x12E40 + i * 3;
+        entry.Count = static_cast<int32_t>(i % 4 + 1);
+        entry.ExtraWorn = (i % 10) == 0;
+        request.InventoryContent.Entries.push_back(entry);
+    }
+
+    for (auto i = 0u; i < 14; ++i)
+    {
+        Tints::Entry tint;
+        tint.Name = kTintMasks[i];
+        tint.Alpha = 0.25f * static_cast<float>(i % 4);
+        tint.Color = 0xFF000000 | (i * 0x10203);
+        tint.Type = i % 3;
+        request.FaceTints.Entries.push_back(tint);
+    }
+
+    return request;
+}
+
+AuthenticationResponse BuildAuthenticationResponse()
+{
+    const char* const cPlugins[] = {"Skyrim.esm", "Update.esm", "Dawnguard.esm", "HearthFires.esm", "Dragonborn.esm", "ccBGSSSE001-Fish.esm", "ccQDRSSE001-SurvivalMode.esl", "_ResourcePack.esl", "SkyUI_SE.esp", "RaceMenu.esp"};
+    // Load orders of a few dozen mods are the norm
+    constexpr uint32_t cExtraPlugins = 40;
+
+    AuthenticationResponse response;
+    response.Type = AuthenticationResponse::ResponseType::kAccepted;
+    response.Version = "master@0123456789abcdef";
+    response.PlayerId = 3;
+
+    uint16_t id = 0;
+    for (const auto* cpPlugin : cPlugins)
+    {
+        const bool cIsLite = std::strstr(cpPlugin, ".esl") != nullptr;
+        response.UserMods.ModList.push_back({cpPlugin, id++, cIsLite});
+    }
+
+    for (auto i = 0u; i < cExtraPlugins; ++i)
+        response.UserMods.ModList.push_back({String("Immersive Patch ") + std::to_string(i).c_str() + ".esp", id++, false});
+
+    return response;
+}
+
+Vector<uint8_t> CompressToVector(const Vector<uint8_t>& acMessage)
+{
+    Vector<uint8_t> envelope(MessageCompression::GetMaxEnvelopeSize(acMessage.size()));
+    envelope.resize(MessageCompression::Compress(acMessage.data(), acMessage.size(), envelope.data(), envelope.size()));
+    return envelope;
+}
+
+// Plain deflate with the same settings, to see what the dictionary brings
+size_t CompressWithoutDictionary(const Vector<uint8_t>& acMessage)
+{
+    Vector<uint8_t> out(compressBound(static_cast<uLong>(acMessage.size())));
+    z_stream stream{};
+    deflateInit2(&stream, 6, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    stream.next_in = const_cast<Bytef*>(acMessage.data());
+    stream.avail_in = static_cast<uInt>(acMessage.size());
+    stream.next_out = out.data();
+    stream.avail_out = static_cast<uInt>(out.size());
+    deflate(&stream, Z_FINISH);
+    const auto cSize = stream.total_out;
+    deflateEnd(&stream);
+
+    return cSize + MessageCompression::kHeaderSize;
+}
+
+template <class T> void CheckRoundTrip(const T& acMessage)
+{
+    const auto cEncoded = Encode(acMessage);
+    const auto cEnvelope = CompressToVector(cEncoded);
+
+    REQUIRE(!cEnvelope.empty());
+    REQUIRE(cEnvelope.size() < cEncoded.size());
+    REQUIRE(MessageCompression::IsEnvelope(cEnvelope.data(), cEnvelope.size()));
+
+    Vector<uint8_t> inflated;
+    REQUIRE(MessageCompression::Decompress(cEnvelope.data(), cEnvelope.size(), inflated));
+    REQUIRE(inflated == cEncoded);
+
+    ViewBuffer buffer(inflated.data(), inflated.size());
+    Buffer::Reader reader(&buffer);
+
+    const ServerMessageFactory factory;
+    auto pMessage = factory.Extract(reader);
+
+    REQUIRE(pMessage);
+    REQUIRE(pMessage->GetOpcode() == acMessage.GetOpcode());
+    REQUIRE(*CastUnique<T>(std::move(pMessage)) == acMessage);
+}
+} // namespace
+
+TEST_CASE("Compressed envelope round trip", "[encoding.compression]")
+{
+    SECTION("StringCacheUpdate") { CheckRoundTrip(BuildStringCacheUpdate()); }
+    SECTION("CharacterSpawnRequest") { CheckRoundTrip(BuildSpawnRequest()); }
+    SECTION("AuthenticationResponse") { CheckRoundTrip(BuildAuthenticationResponse()); }
+}
+
+TEST_CASE("Dictionary shrinks small messages", "[encoding.compression]")
+{
+    const auto cEncoded = Encode(BuildStringCacheUpdate());
+    const auto cEnvelope = CompressToVector(cEncoded);
+    const auto cWithoutDictionary = CompressWithoutDictionary(cEncoded);
+
+    // Every path is in the dictionary, only the references are left
+    REQUIRE(cEnvelope.size() * 4 < cEncoded.size());
+    REQUIRE(cEnvelope.size() < cWithoutDictionary);
+}
+
+TEST_CASE("Envelopes that can't be read are rejected", "[encoding.compression]")
+{
+    const auto cEncoded = Encode(BuildSpawnRequest());
+    auto envelope = CompressToVector(cEncoded);
+    REQUIRE(!envelope.empty());
+
+    Vector<uint8_t> inflated;
+
+    SECTION("Other dictionary")
+    {
+        envelope[1] = MessageCompression::GetDictionaryId() + 1;
+        REQUIRE_FALSE(MessageCompression::Decompress(envelope.data(), envelope.size(), inflated));
+    }
+
+    SECTION("Truncated")
+    {
+        REQUIRE_FALSE(MessageCompression::Decompress(envelope.data(), envelope.size() - 4, inflated));
+        REQUIRE_FALSE(MessageCompression::Decompress(envelope.data(), MessageCompression::kHeaderSize, inflated));
+    }
+
+    SECTION("Wrong size")
+    {
+        envelope[2] += 1;
+        REQUIRE_FALSE(MessageCompression::Decompress(envelope.data(), envelope.size(), inflated));
+    }
+
+    SECTION("Plain message")
+    {
+        REQUIRE_FALSE(MessageCompression::IsEnvelope(cEncoded.data(), cEncoded.size()));
+        REQUIRE_FALSE(MessageCompression::Decompress(cEncoded.data(), cEncoded.size(), inflated));
+    }
+}
+
+TEST_CASE("Incompressible messages are left alone", "[encoding.compression]")
+{
+    Vector<uint8_t> noise(512);
+    uint32_t state = 0x12345678;
+    for (auto& value : noise)
+    {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+
+    Vector<uint8_t> envelope(MessageCompression::GetMaxEnvelopeSize(noise.size()));
+    REQUIRE(MessageCompression::Compress(noise.data(), noise.size(), envelope.data(), envelope.size()) == 0);
+}
+
+TEST_CASE("Compression capability negotiation", "[encoding.compression]")
+{
+    AuthenticationRequest request;
+    request.Token = "TesSt";
+    request.Capabilities = AuthenticationRequest::kCompressedMessages | AuthenticationRequest::kActorValuesBatch;
+
+    Buffer buffer(1 << 16);
+    Buffer::Writer writer(&buffer);
+    request.Serialize(writer);
+
+    const ClientMessageFactory factory;
+
+    SECTION("Current client")
+    {
+        ViewBuffer view(buffer.GetWriteData(), writer.Size());
+        Buffer::Reader reader(&view);
+
+        auto pRequest = CastUnique<AuthenticationRequest>(factory.Extract(reader));
+        REQUIRE(pRequest);
+        REQUIRE(*pRequest == request);
+    }
+
+    SECTION("Client without capabilities")
+    {
+        // Older clients stop right before the capabilities, a single byte here
+        const auto cOldBits = writer.GetBitPosition() - 8;
+        const auto cOldSize = (cOldBits + 7) / 8;
+
+        // Their last byte is only partly used, whatever its padding holds isn't part of the message
+        REQUIRE((cOldBits & 7) != 0);
+        buffer.GetWriteData()[cOldSize - 1] |= static_cast<uint8_t>(0xFF << (cOldBits & 7));
+
+        ViewBuffer view(buffer.GetWriteData(), cOldSize);
+        Buffer::Reader reader(&view);
+
+        auto pRequest = CastUnique<AuthenticationRequest>(factory.Extract(reader));
+        REQUIRE(pRequest);
+        REQUIRE(pRequest->Token == request.Token);
+        REQUIRE(pRequest->Capabilities == 0);
+    }
+}
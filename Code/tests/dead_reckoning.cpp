@@ -0,0 +1,155 @@
+#include <TiltedCore/Stl.hpp>
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+#include <DeadReckoning.h>
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+struct Sample
+{
+    uint64_t Tick;
+    glm::vec3 Position;
+    glm::vec3 Rotation;
+    uint32_t Revision;
+};
+
+struct ReplayResult
+{
+    size_t Sent{0};
+    size_t Suppressed{0};
+    float MaxError{0.f};
+
+    [[nodiscard]] double SuppressionRate() const noexcept { return Sent + Suppressed ? static_cast<double>(Suppressed) / static_cast<double>(Sent + Suppressed) : 0.0; }
+};
+
+// Snapshots as the server would build them every 20ms from the owner's movement
+Vector<Sample> BuildTrajectory(float aSpeed, float aTurnRate, uint64_t aDuration, uint64_t aStopAt)
+{
+    Vector<Sample> samples;
+
+    glm::vec3 position{1000.f, -2000.f, 300.f};
+    float heading = 0.f;
+
+    for (uint64_t tick = 20; tick <= aDuration; tick += 20)
+    {
+        const bool cStopped = tick >= aStopAt;
+        if (!cStopped)
+        {
+            heading = std::remainder(heading + aTurnRate * 20.f, 6.28318530718f);
+            position += glm::vec3{std::sin(heading), std::cos(heading), 0.f} * aSpeed * 20.f;
+        }
+
+        // Stopping changes the animation state like a real owner would
+        samples.push_back({tick, position, {0.f, 0.f, heading}, cStopped ? 1u : 0u});
+    }
+
+    return samples;
+}
+
+ReplayResult Replay(const Vector<Sample>& acSamples, const DeadReckoning::Settings& acSettings)
+{
+    ReplayResult result;
+    DeadReckoning::State state;
+
+    // What the receiving client holds
+    Vector<Sample> received;
+
+    for (const auto& sample : acSamples)
+    {
+        if (state.ShouldSend(sample.Position, sample.Rotation, sample.Tick, sample.Revision, false, acSettings))
+        {
+            state.Commit(sample.Position, sample.Rotation, sample.Tick, sample.Revision);
+            received.push_back(sample);
+            ++result.Sent;
+        }
+        else
+        {
+            ++result.Suppressed;
+        }
+
+        glm::vec3 displayed = received.back().Position;
+        if (received.size() >= 2)
+        {
+            const auto& previous = received[received.size() - 2];
+            const auto& last = received.back();
+            displayed = DeadReckoning::Extrapolate(previous.Position, previous.Tick, last.Position, last.Tick, sample.Tick, DeadReckoning::kMaxExtrapolation);
+        }
+
+        result.MaxError = std::max(result.MaxError, glm::distance(displayed, sample.Position));
+    }
+
+    return result;
+}
+} // namespace
+
+TEST_CASE("Dead reckoning", "[encoding.dead_reckoning]")
+{
+    DeadReckoning::Settings settings{};
+
+    GIVEN("A state that was never sent")
+    {
+        DeadReckoning::State state;
+
+        REQUIRE(state.ShouldSend({}, {}, 20, 0, false, settings));
+    }
+
+    GIVEN("Pending actions or an animation change")
+    {
+        DeadReckoning::State state;
+        state.Commit({}, {}, 20, 0);
+
+        REQUIRE(state.ShouldSend({}, {}, 40, 0, true, settings));
+        REQUIRE(state.ShouldSend({}, {}, 40, 1, false, settings));
+        REQUIRE_FALSE(state.ShouldSend({}, {}, 40, 0, false, settings));
+    }
+
+    GIVEN("A reference that doesn't move")
+    {
+        DeadReckoning::State state;
+        state.Commit({}, {}, 20, 0);
+
+        REQUIRE(state.ShouldSend({}, {}, 20 + settings.MaxRefreshInterval, 0, false, settings));
+    }
+
+    GIVEN("Extrapolation past the cap")
+    {
+        const auto cPosition = DeadReckoning::Extrapolate({0.f, 0.f, 0.f}, 0, {1.f, 0.f, 0.f}, 10, 10000, 100);
+
+        REQUIRE(cPosition.x == Approx(11.f));
+    }
+
+    GIVEN("Recorded movement replays")
+    {
+        struct Scenario
+        {
+            const char* Name;
+            Vector<Sample> Samples;
+            double MinSuppression;
+        };
+
+        const Scenario cScenarios[]{
+            {"town walk", BuildTrajectory(0.09f, 0.f, 30000, 30000), 0.9},
+            {"road travel", BuildTrajectory(0.35f, 0.f, 30000, 30000), 0.9},
+            {"walk then idle", BuildTrajectory(0.09f, 0.f, 30000, 15000), 0.9},
+            {"slow turn", BuildTrajectory(0.09f, 0.0004f, 30000, 30000), 0.4},
+        };
+
+        for (const auto& scenario : cScenarios)
+        {
+            const auto cResult = Replay(scenario.Samples, settings);
+
+            INFO(scenario.Name << ": " << cResult.Sent << " of " << scenario.Samples.size() << " snapshots sent, max error " << cResult.MaxError);
+
+            REQUIRE(cResult.MaxError <= settings.MaxPositionError);
+            REQUIRE(cResult.SuppressionRate() >= scenario.MinSuppression);
+        }
+    }
+}
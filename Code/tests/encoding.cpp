@@ -403,6 +403,48 @@ TEST_CASE("Packets", "[encoding.packets]")
         REQUIRE(sendMessage == recvMessage);
     }
 
+    SECTION("TimeSyncRequest")
+    {
+        Buffer buff(1000);
+
+        TimeSyncRequest sendMessage, recvMessage;
+        sendMessage.ClientTick = 1234567890123;
+        sendMessage.RoundTripTime = 48;
+        sendMessage.Jitter = 6;
+        Buffer::Writer writer(&buff);
+        sendMessage.Serialize(writer);
+
+        Buffer::Reader reader(&buff);
+
+        uint64_t trash;
+        reader.ReadBits(trash, 8); // pop opcode
+
+        recvMessage.DeserializeRaw(reader);
+
+        REQUIRE(sendMessage == recvMessage);
+    }
+
+    SECTION("TimeSyncResponse")
+    {
+        Buffer buff(1000);
+
+        TimeSyncResponse sendMessage, recvMessage;
+        sendMessage.ClientTick = 1234567890123;
+        sendMessage.ServerReceiveTick = 987654321;
+        sendMessage.ServerSendTick = 987654337;
+        Buffer::Writer writer(&buff);
+        sendMessage.Serialize(writer);
+
+        Buffer::Reader reader(&buff);
+
+        uint64_t trash;
+        reader.ReadBits(trash, 8); // pop opcode
+
+        recvMessage.DeserializeRaw(reader);
+
+        REQUIRE(sendMessage == recvMessage);
+    }
+
     SECTION("AssignCharacterRequest")
     {
         Buffer buff(1000);
@@ -0,0 +1,298 @@
+#include <TiltedCore/Stl.hpp>
+
+#include <glm/vec3.hpp>
+
+#include <Interpolation.h>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+InterpolationBuffer::Point MakePoint(uint64_t aTick, float aX = 0.f)
+{
+    InterpolationBuffer::Point point;
+    point.Tick = aTick;
+    point.Position = {aX, 0.f, 0.f};
+    point.Variables.Floats.assign(8, static_cast<float>(aTick));
+    point.Variables.Integers.assign(4, static_cast<uint32_t>(aTick));
+    point.Variables.Booleans.assign(64, (aTick & 1) != 0);
+
+    return point;
+}
+
+bool IsSorted(const InterpolationBuffer& acBuffer)
+{
+    for (auto i = 1u; i < acBuffer.Size(); ++i)
+    {
+        if (acBuffer[i - 1].Tick >= acBuffer[i].Tick)
+            return false;
+    }
+
+    return true;
+}
+
+// Snapshots every 50ms, delivered after a base latency plus random jitter so some arrive out of order
+struct Link
+{
+    uint64_t Latency;
+    uint64_t Jitter;
+    std::mt19937 Random{42};
+
+    uint64_t Deliver(uint64_t aTick) { return aTick + Latency + std::uniform_int_distribution<uint64_t>(0, Jitter)(Random); }
+};
+} // namespace
+
+TEST_CASE("Interpolation buffer ordering", "[encoding.interpolation]")
+{
+    InterpolationBuffer buffer;
+
+    SECTION("Late points are inserted in place")
+    {
+        for (auto tick : {100u, 300u, 200u, 500u, 400u, 50u})
+            REQUIRE(buffer.Add(MakePoint(tick)));
+
+        REQUIRE(buffer.Size() == 6);
+        REQUIRE(IsSorted(buffer));
+        REQUIRE(buffer[0].Tick == 50);
+        REQUIRE(buffer[5].Tick == 500);
+    }
+
+    SECTION("A point with a known tick replaces the old one")
+    {
+        buffer.Add(MakePoint(100, 1.f));
+        buffer.Add(MakePoint(200, 2.f));
+        buffer.Add(MakePoint(100, 5.f));
+
+        REQUIRE(buffer.Size() == 2);
+        REQUIRE(buffer[0].Position.x == 5.f);
+    }
+
+    SECTION("A full buffer drops its oldest point")
+    {
+        for (auto i = 0u; i < InterpolationBuffer::kCapacity + 4; ++i)
+            REQUIRE(buffer.Add(MakePoint(1000 + i * 50)));
+
+        REQUIRE(buffer.Size() == InterpolationBuffer::kCapacity);
+        REQUIRE(buffer[0].Tick == 1000 + 4 * 50);
+        REQUIRE(IsSorted(buffer));
+
+        // Older than everything kept, playback is past it
+        REQUIRE_FALSE(buffer.Add(MakePoint(10)));
+        REQUIRE(buffer[0].Tick == 1000 + 4 * 50);
+
+        // Late but still in range, the oldest point makes room for it
+        REQUIRE(buffer.Add(MakePoint(1000 + 4 * 50 + 25)));
+        REQUIRE(buffer[0].Tick == 1000 + 4 * 50 + 25);
+        REQUIRE(IsSorted(buffer));
+    }
+
+    SECTION("Random arrival order across wraps")
+    {
+        std::mt19937 random{7};
+        Vector<uint64_t> ticks;
+        for (auto i = 0u; i < 200; ++i)
+            ticks.push_back(100 + i * 10);
+
+        // Shuffle within small windows, like reordering on a real link
+        for (auto i = 0u; i + 4 <= ticks.size(); i += 4)
+            std::shuffle(ticks.begin() + i, ticks.begin() + i + 4, random);
+
+        for (auto tick : ticks)
+        {
+            buffer.Add(MakePoint(tick));
+            REQUIRE(IsSorted(buffer));
+        }
+
+        REQUIRE(buffer.Size() == InterpolationBuffer::kCapacity);
+        REQUIRE(buffer[InterpolationBuffer::kCapacity - 1].Tick == ticks.size() * 10 + 90);
+    }
+}
+
+TEST_CASE("Interpolation buffer sampling", "[encoding.interpolation]")
+{
+    InterpolationBuffer buffer;
+    InterpolationBuffer::Sample sample;
+
+    REQUIRE_FALSE(buffer.Update(100, sample));
+
+    auto first = MakePoint(100, 0.f);
+    auto second = MakePoint(200, 10.f);
+    second.Rotation = {0.f, 0.f, 1.f};
+    second.Direction = 0.5f;
+    buffer.Add(first);
+    REQUIRE_FALSE(buffer.Update(100, sample));
+    buffer.Add(second);
+
+    SECTION("Between two points")
+    {
+        REQUIRE(buffer.Update(150, sample));
+        REQUIRE_FALSE(sample.Extrapolated);
+        REQUIRE(sample.Position.x == Approx(5.f));
+        REQUIRE(sample.Rotation.z == Approx(0.5f));
+        REQUIRE(sample.pTarget->Tick == 200);
+        REQUIRE(sample.pTarget->Direction == 0.5f);
+    }
+
+    SECTION("Before the first point")
+    {
+        REQUIRE(buffer.Update(50, sample));
+        REQUIRE(sample.Position.x == Approx(0.f));
+        REQUIRE(sample.Rotation.z == Approx(0.f));
+    }
+
+    SECTION("Past the last point")
+    {
+        REQUIRE(buffer.Update(250, sample));
+        REQUIRE(sample.Extrapolated);
+        REQUIRE(sample.Position.x == Approx(15.f));
+        REQUIRE(sample.Rotation.z == Approx(1.f));
+    }
+
+    SECTION("Points playback moved past are dropped")
+    {
+        buffer.Add(MakePoint(300, 20.f));
+        buffer.Add(MakePoint(400, 30.f));
+
+        REQUIRE(buffer.Update(350, sample));
+        REQUIRE(buffer.Size() == 2);
+        REQUIRE(buffer[0].Tick == 300);
+        REQUIRE(sample.Position.x == Approx(25.f));
+    }
+
+    SECTION("Rotation takes the short way around")
+    {
+        buffer.Clear();
+
+        auto from = MakePoint(100);
+        auto to = MakePoint(200);
+        from.Rotation.z = 6.f;
+        to.Rotation.z = 0.4f;
+        buffer.Add(from);
+        buffer.Add(to);
+
+        REQUIRE(buffer.Update(150, sample));
+
+        const auto cExpected = std::fmod(6.f + (0.4f + 6.28318530718f - 6.f) / 2.f, 6.28318530718f);
+        REQUIRE(sample.Rotation.z == Approx(cExpected));
+    }
+}
+
+TEST_CASE("Interpolation buffer reuses its storage", "[encoding.interpolation]")
+{
+    InterpolationBuffer buffer;
+    InterpolationBuffer::Sample sample;
+
+    uint64_t tick = 1000;
+    for (auto i = 0u; i < InterpolationBuffer::kCapacity; ++i, tick += 50)
+        buffer.Add(MakePoint(tick));
+
+    Vector<const float*> storage;
+    for (auto i = 0u; i < buffer.Size(); ++i)
+        storage.push_back(buffer[i].Variables.Floats.data());
+
+    // Once every slot has held a point, new points are copied into existing vectors
+    for (auto i = 0u; i < 10 * InterpolationBuffer::kCapacity; ++i, tick += 50)
+    {
+        buffer.Add(MakePoint(tick));
+        REQUIRE(buffer.Update(tick - 200, sample));
+
+        for (auto j = 0u; j < buffer.Size(); ++j)
+            REQUIRE(std::find(storage.begin(), storage.end(), buffer[j].Variables.Floats.data()) != storage.end());
+    }
+}
+
+TEST_CASE("Playout delay adapts to the link", "[encoding.interpolation]")
+{
+    constexpr uint64_t cSnapshotInterval = 50;
+
+    const auto Run = [](Link& aLink, PlayoutDelay& aDelay, uint64_t aDuration, size_t& aLate)
+    {
+        InterpolationBuffer buffer;
+        InterpolationBuffer::Sample sample;
+        std::multimap<uint64_t, uint64_t> inFlight;
+
+        uint64_t nextSnapshot = 1000;
+        for (uint64_t now = 1000; now < 1000 + aDuration; now += 16)
+        {
+            for (; nextSnapshot <= now; nextSnapshot += cSnapshotInterval)
+                inFlight.emplace(aLink.Deliver(nextSnapshot), nextSnapshot);
+
+            while (!inFlight.empty() && inFlight.begin()->first <= now)
+            {
+                const auto cTick = inFlight.begin()->second;
+                inFlight.erase(inFlight.begin());
+
+                aDelay.OnSnapshot(cTick, now);
+                buffer.Add(MakePoint(cTick, static_cast<float>(cTick)));
+            }
+
+            const auto cPlayback = aDelay.Update(now);
+            if (buffer.Update(cPlayback, sample) && sample.Extrapolated)
+                ++aLate;
+        }
+    };
+
+    SECTION("Stable link converges below the fixed delay")
+    {
+        Link link{20, 5};
+        PlayoutDelay delay;
+        size_t late = 0;
+
+        REQUIRE(delay.GetDelay() == 300.f);
+        Run(link, delay, 20000, late);
+
+        // One way delay + one snapshot interval + a few ms of margin
+        REQUIRE(delay.GetDelay() < 110.f);
+        REQUIRE(delay.GetDelay() >= 70.f);
+        REQUIRE(delay.GetInterval() == Approx(50.f).margin(2.f));
+        REQUIRE(late == 0);
+    }
+
+    SECTION("Jitter increases the delay")
+    {
+        Link stable{20, 5};
+        Link jittery{20, 80};
+        PlayoutDelay stableDelay;
+        PlayoutDelay jitteryDelay;
+        size_t stableLate = 0;
+        size_t jitteryLate = 0;
+
+        Run(stable, stableDelay, 20000, stableLate);
+        Run(jittery, jitteryDelay, 20000, jitteryLate);
+
+        REQUIRE(jitteryDelay.GetJitter() > stableDelay.GetJitter());
+        REQUIRE(jitteryDelay.GetDelay() > stableDelay.GetDelay() + 50.f);
+        REQUIRE(jitteryDelay.GetDelay() <= 300.f);
+    }
+
+    SECTION("Changes are slewed")
+    {
+        PlayoutDelay delay;
+        delay.Update(1000);
+        delay.OnSnapshot(1000, 1010);
+
+        // Target is the minimum, 100ms of frames can only remove 10ms of delay
+        delay.Update(1100);
+        REQUIRE(delay.GetDelay() == Approx(290.f));
+    }
+
+    SECTION("Reset goes back to the conservative delay")
+    {
+        Link link{20, 5};
+        PlayoutDelay delay;
+        size_t late = 0;
+
+        Run(link, delay, 20000, late);
+        delay.Reset();
+
+        REQUIRE(delay.GetDelay() == 300.f);
+        REQUIRE(delay.GetTargetDelay() == 300.f);
+    }
+}
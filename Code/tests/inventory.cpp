@@ -0,0 +1,189 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <Structs/Inventory.h>
+
+#include <catch2/catch.hpp>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+Inventory::Entry BuildEntry(uint32_t aBaseId, int32_t aCount)
+{
+    Inventory::Entry entry;
+    entry.BaseId = GameId(0, aBaseId);
+    entry.Count = aCount;
+
+    return entry;
+}
+
+Inventory BuildInventory(uint32_t aCount)
+{
+    Inventory inventory;
+    for (auto i = 0u; i < aCount; ++i)
+    {
+        auto entry = BuildEntry(0x1000 + i, 1 + i % 5);
+        entry.ExtraHealth = i % 7 == 0 ? 1.5f : 0.f;
+        inventory.AddOrRemoveEntry(entry);
+    }
+
+    return inventory;
+}
+
+// The linear scan the inventory used before it was indexed, the equipment test checks both agree
+void LinearUpdateEquipment(Vector<Inventory::Entry>& aEntries, const Inventory& acNewInventory)
+{
+    while (true)
+    {
+        auto wornEntry = std::find_if(aEntries.begin(), aEntries.end(), [](auto& aEntry) { return aEntry.IsWorn(); });
+        if (wornEntry == aEntries.end())
+            break;
+
+        wornEntry->ExtraWorn = wornEntry->ExtraWornLeft = false;
+    }
+
+    for (const auto& newEntry : acNewInventory.Entries)
+    {
+        if (!newEntry.IsWorn())
+            continue;
+
+        auto entry = std::find_if(aEntries.begin(), aEntries.end(), [&newEntry](auto& aEntry) { return aEntry.BaseId == newEntry.BaseId; });
+        if (entry == aEntries.end())
+            continue;
+
+        entry->ExtraWorn = newEntry.ExtraWorn;
+        entry->ExtraWornLeft = newEntry.ExtraWornLeft;
+    }
+}
+
+Inventory BuildEquipment(uint32_t aFirst, uint32_t aCount)
+{
+    Inventory equipment;
+    for (auto i = 0u; i < aCount; ++i)
+    {
+        auto entry = BuildEntry(0x1000 + aFirst + i * 3, 1);
+        entry.ExtraWorn = true;
+        equipment.Entries.push_back(entry);
+    }
+
+    return equipment;
+}
+} // namespace
+
+TEST_CASE("Inventory merges entries", "[inventory]")
+{
+    Inventory inventory;
+
+    inventory.AddOrRemoveEntry(BuildEntry(0x10, 2));
+    inventory.AddOrRemoveEntry(BuildEntry(0x10, 3));
+    REQUIRE(inventory.Entries.size() == 1);
+    REQUIRE(inventory.Entries[0].Count == 5);
+
+    // Same base, different extra data
+    auto enchanted = BuildEntry(0x10, 1);
+    enchanted.ExtraEnchantId = GameId(0, 0x20);
+    inventory.AddOrRemoveEntry(enchanted);
+    REQUIRE(inventory.Entries.size() == 2);
+
+    GameId id(0, 0x10);
+    REQUIRE(inventory.GetEntryCountById(id) == 5);
+
+    inventory.AddOrRemoveEntry(BuildEntry(0x10, -5));
+    REQUIRE(inventory.Entries.size() == 1);
+    REQUIRE(inventory.Entries[0].ExtraEnchantId == GameId(0, 0x20));
+    REQUIRE(inventory.GetEntryCountById(id) == 1);
+
+    GameId missing(0, 0x30);
+    REQUIRE_FALSE(inventory.GetEntryById(missing));
+}
+
+TEST_CASE("Inventory sees entries added directly", "[inventory]")
+{
+    Inventory inventory;
+    inventory.AddOrRemoveEntry(BuildEntry(0x10, 1));
+
+    inventory.Entries.push_back(BuildEntry(0x11, 4));
+    inventory.MarkEntriesDirty();
+
+    GameId id(0, 0x11);
+    REQUIRE(inventory.GetEntryCountById(id) == 4);
+
+    inventory.AddOrRemoveEntry(BuildEntry(0x11, 1));
+    REQUIRE(inventory.Entries.size() == 2);
+    REQUIRE(inventory.GetEntryCountById(id) == 5);
+
+    inventory.RemoveByFilter([](const Inventory::Entry& acEntry) { return acEntry.BaseId == GameId(0, 0x10); });
+    REQUIRE(inventory.Entries.size() == 1);
+    REQUIRE(inventory.GetEntryCountById(id) == 5);
+}
+
+TEST_CASE("Inventory notices direct edits it wasn't told about", "[inventory]")
+{
+    auto inventory = BuildInventory(8);
+    GameId pushed(0, 0x2000);
+    GameId first(0, 0x1000);
+    GameId renamed(0, 0x3000);
+
+    // The index was built by the lookups, then entries come and go behind its back
+    REQUIRE(inventory.GetEntryCountById(first) == 1);
+    inventory.Entries.push_back(BuildEntry(0x2000, 2));
+    REQUIRE(inventory.GetEntryCountById(pushed) == 2);
+
+    inventory.Entries.erase(std::begin(inventory.Entries));
+    REQUIRE_FALSE(inventory.GetEntryById(first));
+    inventory.AddOrRemoveEntry(BuildEntry(0x2000, 1));
+    REQUIRE(inventory.GetEntryCountById(pushed) == 3);
+
+    // Same size, the indexed entry got another base id
+    GameId second(0, 0x1001);
+    REQUIRE(inventory.GetEntryById(second));
+    for (auto& entry : inventory.Entries)
+    {
+        if (entry.BaseId == second)
+            entry.BaseId = renamed;
+    }
+    REQUIRE_FALSE(inventory.GetEntryById(second));
+    REQUIRE(inventory.GetEntryCountById(renamed) == 2);
+}
+
+TEST_CASE("Inventory equipment update", "[inventory]")
+{
+    auto inventory = BuildInventory(32);
+    auto reference = inventory.Entries;
+
+    const auto cFirstEquipment = BuildEquipment(0, 4);
+    const auto cSecondEquipment = BuildEquipment(1, 4);
+
+    inventory.UpdateEquipment(cFirstEquipment);
+    LinearUpdateEquipment(reference, cFirstEquipment);
+    REQUIRE(inventory.Entries == reference);
+
+    inventory.UpdateEquipment(cSecondEquipment);
+    LinearUpdateEquipment(reference, cSecondEquipment);
+    REQUIRE(inventory.Entries == reference);
+}
+
+TEST_CASE("Inventory full encoding", "[inventory]")
+{
+    auto server = BuildInventory(20);
+
+    Buffer buffer(1 << 20);
+    Buffer::Writer writer(&buffer);
+    server.Serialize(writer);
+
+    Buffer::Reader reader(&buffer);
+    Inventory client;
+    client.Deserialize(reader);
+
+    REQUIRE(client == server);
+    REQUIRE(writer.Size() == (server.SerializedBitsBound() + 7) / 8);
+
+    // The index of the receiver is built from what was read
+    GameId id(0, 0x1005);
+    REQUIRE(client.GetEntryCountById(id) == server.GetEntryCountById(id));
+}
@@ -0,0 +1,236 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <StringCache.h>
+#include <ChatMessageTypes.h>
+#include <ViewScope.h>
+#include <Structs/CachedString.h>
+#include <Structs/MessageString.h>
+#include <Messages/ClientMessageFactory.h>
+#include <Messages/SendChatMessageRequest.h>
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+bool PointsInto(std::string_view aView, const Buffer& acBuffer)
+{
+    const auto* cpData = reinterpret_cast<const uint8_t*>(aView.data());
+    return cpData >= acBuffer.GetData() && cpData + aView.size() <= acBuffer.GetData() + acBuffer.GetSize();
+}
+
+// Writes the string after aPadding bits, so it can be made to start in the middle of a byte
+Buffer Encode(const MessageString& acValue, size_t aPadding, bool aCached = false)
+{
+    Buffer buffer(acValue.size() + 64);
+    Buffer::Writer writer(&buffer);
+
+    writer.WriteBits(0, aPadding);
+    if (aCached)
+        acValue.SerializeCached(writer);
+    else
+        acValue.Serialize(writer);
+
+    return buffer;
+}
+
+MessageString Decode(Buffer& aBuffer, size_t aPadding, bool aCached = false)
+{
+    Buffer::Reader reader(&aBuffer);
+
+    uint64_t dummy;
+    reader.ReadBits(dummy, aPadding);
+
+    MessageString value;
+    if (aCached)
+        value.DeserializeCached(reader);
+    else
+        value.Deserialize(reader);
+
+    return value;
+}
+} // namespace
+
+TEST_CASE("Message strings", "[encoding.views]")
+{
+    const MessageString cText = String("The dragon is coming from the west, gather at Whiterun's gate");
+
+    SECTION("Copied without a scope")
+    {
+        auto buffer = Encode(cText, 0);
+        const auto cValue = Decode(buffer, 0);
+
+        REQUIRE_FALSE(cValue.IsBorrowed());
+        REQUIRE(cValue == cText);
+    }
+
+    SECTION("Aligned strings point into the buffer")
+    {
+        auto buffer = Encode(cText, 8);
+        ViewScope views(buffer.GetData(), buffer.GetSize());
+
+        const auto cValue = Decode(buffer, 8);
+
+        REQUIRE(cValue.IsBorrowed());
+        REQUIRE(cValue == cText);
+        REQUIRE(PointsInto(cValue, buffer));
+    }
+
+    SECTION("Unaligned strings are copied to the scope")
+    {
+        auto buffer = Encode(cText, 3);
+        ViewScope views(buffer.GetData(), buffer.GetSize());
+
+        const auto cValue = Decode(buffer, 3);
+
+        REQUIRE(cValue.IsBorrowed());
+        REQUIRE(cValue == cText);
+        REQUIRE_FALSE(PointsInto(cValue, buffer));
+    }
+
+    SECTION("Strings from another buffer are copied")
+    {
+        auto buffer = Encode(cText, 0);
+        Buffer other(16);
+        ViewScope views(other.GetData(), other.GetSize());
+
+        const auto cValue = Decode(buffer, 0);
+
+        REQUIRE_FALSE(cValue.IsBorrowed());
+        REQUIRE(cValue == cText);
+    }
+
+    SECTION("Strings larger than the inline space")
+    {
+        const MessageString cLong = String(5000, 'x');
+        auto buffer = Encode(cLong, 1);
+        ViewScope views(buffer.GetData(), buffer.GetSize());
+        const auto cValue = Decode(buffer, 1);
+
+        REQUIRE(cValue.IsBorrowed());
+        REQUIRE(cValue == cLong);
+    }
+
+    SECTION("Own outlives the scope")
+    {
+        auto buffer = Encode(cText, 0);
+
+        MessageString value;
+        {
+            ViewScope views(buffer.GetData(), buffer.GetSize());
+            value = Decode(buffer, 0);
+            REQUIRE(value.IsBorrowed());
+
+            value.Own();
+        }
+
+        std::memset(buffer.GetWriteData(), 0, buffer.GetSize());
+
+        REQUIRE_FALSE(value.IsBorrowed());
+        REQUIRE(value == cText);
+    }
+
+#if TP_CHECK_MESSAGE_VIEWS
+    SECTION("Borrowed strings are invalid once their scope closes")
+    {
+        auto buffer = Encode(cText, 0);
+
+        MessageString value;
+        {
+            ViewScope outer(buffer.GetData(), buffer.GetSize());
+            {
+                ViewScope inner(buffer.GetData(), buffer.GetSize());
+                value = Decode(buffer, 0);
+            }
+
+            REQUIRE_FALSE(value.IsValid());
+        }
+
+        REQUIRE_FALSE(value.IsValid());
+    }
+#endif
+}
+
+TEST_CASE("Cached message strings", "[encoding.views]")
+{
+    StringCache cache;
+    StringCache::SetCurrent(&cache);
+
+    const MessageString cKnown = String("IdleForceDefaultState");
+    const MessageString cUnknown = String("IdleChairSitting");
+    TP_UNUSED(cache.Add(cKnown.ToString()));
+
+    SECTION("Known strings are read from the cache")
+    {
+        auto buffer = Encode(cKnown, 0, true);
+        ViewScope views(buffer.GetData(), buffer.GetSize());
+
+        const auto cValue = Decode(buffer, 0, true);
+
+        REQUIRE(cValue.IsBorrowed());
+        REQUIRE(cValue == cKnown);
+        REQUIRE_FALSE(PointsInto(cValue, buffer));
+    }
+
+    SECTION("Unknown strings are borrowed and wanted")
+    {
+        auto buffer = Encode(cUnknown, 0, true);
+        ViewScope views(buffer.GetData(), buffer.GetSize());
+
+        const auto cValue = Decode(buffer, 0, true);
+
+        REQUIRE(cValue.IsBorrowed());
+        REQUIRE(cValue == cUnknown);
+        REQUIRE(cache.ProcessDirty());
+    }
+
+    SECTION("Same wire format as CachedString")
+    {
+        CachedString legacy;
+        legacy = cUnknown.ToString();
+
+        Buffer buffer(1024);
+        Buffer::Writer writer(&buffer);
+        legacy.Serialize(writer);
+
+        const auto cValue = Decode(buffer, 0, true);
+
+        REQUIRE(cValue == cUnknown);
+    }
+
+    StringCache::SetCurrent(nullptr);
+}
+
+TEST_CASE("Messages decoded in a scope", "[encoding.views]")
+{
+    SendChatMessageRequest sendMessage;
+    sendMessage.MessageType = kLocalChat;
+    sendMessage.ChatMessage = String("Anyone selling lockpicks near Riften?");
+
+    Buffer buffer(1024);
+    Buffer::Writer writer(&buffer);
+    sendMessage.Serialize(writer);
+
+    ViewScope views(buffer.GetData(), buffer.GetSize());
+
+    Buffer::Reader reader(&buffer);
+    const ClientMessageFactory factory;
+    auto pMessage = factory.Extract(reader);
+    REQUIRE(pMessage);
+    REQUIRE(pMessage->GetOpcode() == SendChatMessageRequest::Opcode);
+
+    auto pRecvMessage = CastUnique<SendChatMessageRequest>(std::move(pMessage));
+    REQUIRE(pRecvMessage->ChatMessage.IsBorrowed());
+    REQUIRE(*pRecvMessage == sendMessage);
+}
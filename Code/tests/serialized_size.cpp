@@ -0,0 +1,180 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <StringCache.h>
+#include <ViewScope.h>
+#include <Messages/ClientMessageFactory.h>
+#include <Messages/ServerMessageFactory.h>
+
+#include "benchmarks/Payloads.h"
+
+#include <catch2/catch.hpp>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+constexpr uint32_t kSeeds[] = {1, 0xC0FFEE, 0xBADF00D, 0x5EED5EED};
+
+// Larger than anything the payloads produce, the bounds are checked against what was actually written
+constexpr size_t kBufferSize = 1 << 22;
+
+template <class T> T BuildMessage(uint32_t aSeed)
+{
+    // Same as the benchmarks, decoding zeroes gives the members without an initializer a value
+    static const uint8_t s_zeroes[256]{};
+
+    T message;
+    ViewBuffer zeroes(const_cast<uint8_t*>(s_zeroes), sizeof(s_zeroes));
+    Buffer::Reader reader(&zeroes);
+    message.DeserializeRaw(reader);
+
+    Payloads::Random random(aSeed ^ static_cast<uint32_t>(T::Opcode));
+    Payloads::Fill(message, random);
+
+    return message;
+}
+
+template <class TFactory> void CheckFactory()
+{
+    Buffer buffer(kBufferSize);
+    Buffer copy(kBufferSize);
+
+    TFactory::Visit(
+        [&](auto& x)
+        {
+            using T = typename std::remove_reference_t<decltype(x)>::Type;
+
+            for (const auto cSeed : kSeeds)
+            {
+                INFO("opcode " << static_cast<uint32_t>(T::Opcode) << ", seed " << cSeed);
+
+                const auto cMessage = BuildMessage<T>(cSeed);
+
+                Buffer::Writer writer(&buffer);
+                cMessage.Serialize(writer);
+                REQUIRE(writer.Size() == cMessage.SerializedSizeBound());
+
+                // Decoded messages borrow their strings, inventories also get a version of their own so only the bound is compared
+                ViewScope views(buffer.GetData(), writer.Size());
+                Buffer::Reader reader(&buffer);
+                uint64_t opcode;
+                reader.ReadBits(opcode, sizeof(T::Opcode) * 8);
+
+                T decoded;
+                decoded.DeserializeRaw(reader);
+
+                Buffer::Writer copyWriter(&copy);
+                decoded.Serialize(copyWriter);
+                REQUIRE(copyWriter.Size() == decoded.SerializedSizeBound());
+            }
+
+            return false;
+        });
+}
+
+template <class T> size_t EncodedBits(const T& acValue)
+{
+    Buffer buffer(kBufferSize);
+    Buffer::Writer writer(&buffer);
+    acValue.Serialize(writer);
+
+    return writer.GetBitPosition();
+}
+} // namespace
+
+TEST_CASE("Message size bounds", "[encoding.size]")
+{
+    StringCache cache;
+    StringCache::SetCurrent(&cache);
+
+    SECTION("Strings written inline")
+    {
+        CheckFactory<ClientMessageFactory>();
+        CheckFactory<ServerMessageFactory>();
+    }
+
+    SECTION("Strings written as cache ids")
+    {
+        Payloads::RegisterCachedStrings();
+
+        CheckFactory<ClientMessageFactory>();
+        CheckFactory<ServerMessageFactory>();
+    }
+
+    StringCache::SetCurrent(nullptr);
+}
+
+TEST_CASE("Struct size bounds", "[encoding.size]")
+{
+    StringCache cache;
+    StringCache::SetCurrent(&cache);
+    Payloads::RegisterCachedStrings();
+
+    Buffer buffer(kBufferSize);
+
+    SECTION("Action event differentials")
+    {
+        for (const auto cSeed : kSeeds)
+        {
+            INFO("seed " << cSeed);
+            Payloads::Random random(cSeed);
+
+            const auto cPrevious = Payloads::BuildActionEvent(random, 1000);
+            auto current = Payloads::BuildActionEvent(random, 1000 + random.Range(1u, 100000u));
+            current.Variables = Payloads::NextFrame(cPrevious.Variables, random);
+
+            for (const auto& cBase : {cPrevious, current, ActionEvent{}})
+            {
+                Buffer::Writer writer(&buffer);
+                current.GenerateDifferential(cBase, writer);
+                REQUIRE(writer.GetBitPosition() == current.DifferentialBitsBound(cBase));
+            }
+        }
+    }
+
+    SECTION("Inventory after changes")
+    {
+        for (const auto cSeed : kSeeds)
+        {
+            INFO("seed " << cSeed);
+            Payloads::Random random(cSeed);
+
+            auto inventory = Payloads::BuildInventory(random, random.Range(0u, 60u));
+
+            inventory.AddOrRemoveEntry(Payloads::BuildInventoryEntry(random));
+            if (!inventory.Entries.empty())
+            {
+                auto removed = inventory.Entries.front();
+                removed.Count = -removed.Count;
+                inventory.AddOrRemoveEntry(removed);
+            }
+
+            REQUIRE(EncodedBits(inventory) == inventory.SerializedBitsBound());
+        }
+    }
+
+    SECTION("Movement and object data")
+    {
+        for (const auto cSeed : kSeeds)
+        {
+            INFO("seed " << cSeed);
+            Payloads::Random random(cSeed);
+
+            const auto cMovement = Payloads::BuildMovement(random);
+            REQUIRE(EncodedBits(cMovement) == cMovement.SerializedBitsBound());
+
+            const auto cObject = Payloads::BuildObjectData(random);
+            REQUIRE(EncodedBits(cObject) == cObject.SerializedBitsBound());
+        }
+    }
+
+    StringCache::SetCurrent(nullptr);
+}
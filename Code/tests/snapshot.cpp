@@ -0,0 +1,174 @@
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <optional>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <Messages/ServerReferencesMoveRequest.h>
+#include <Messages/ServerReferencesMoveSnapshot.h>
+#include <Messages/CharacterSpawnRequest.h>
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+ReferenceUpdate BuildUpdate(uint32_t aSeed)
+{
+    ReferenceUpdate update;
+    auto& movement = update.UpdatedMovement;
+
+    movement.Position.x = 1000.f + static_cast<float>(aSeed) * 1.5f;
+    movement.Position.y = -2000.f + static_cast<float>(aSeed % 97);
+    movement.Position.z = 300.f;
+    movement.Rotation.x = 0.1f;
+    movement.Rotation.y = static_cast<float>(aSeed % 628) / 100.f;
+    movement.Direction = 0.5f;
+
+    movement.Variables.Booleans.resize(76);
+    for (auto i = 0u; i < movement.Variables.Booleans.size(); ++i)
+        movement.Variables.Booleans[i] = ((aSeed + i) % 3) == 0;
+
+    for (auto i = 0u; i < 12; ++i)
+        movement.Variables.Floats.push_back(static_cast<float>(aSeed + i) * 0.25f);
+
+    for (auto i = 0u; i < 4; ++i)
+        movement.Variables.Integers.push_back(aSeed * 7 + i);
+
+    // Some characters have pending actions
+    if (aSeed % 5 == 0)
+    {
+        ActionEvent action;
+        action.ActionId = 42;
+        action.ActorId = aSeed;
+        action.Tick = 48;
+        action.EventName = "moveStart";
+        update.ActionEvents.push_back(action);
+    }
+
+    return update;
+}
+
+ServerReferencesMoveRequest Decode(Buffer& aBuffer)
+{
+    Buffer::Reader reader(&aBuffer);
+
+    uint64_t trash;
+    reader.ReadBits(trash, 8); // pop opcode
+
+    ServerReferencesMoveRequest message;
+    message.DeserializeRaw(reader);
+
+    return message;
+}
+} // namespace
+
+TEST_CASE("Movement snapshot segments", "[encoding.snapshot]")
+{
+    ServerReferencesMoveRequest expected;
+    expected.Tick = 123456789;
+
+    ServerReferencesMoveSnapshot snapshot;
+    snapshot.Reset(expected.Tick);
+
+    Buffer scratch(1 << 16);
+    Vector<ServerReferencesMoveSnapshot::Segment> segments(16);
+
+    for (auto i = 0u; i < segments.size(); ++i)
+    {
+        const auto cUpdate = BuildUpdate(i);
+        expected.Updates[i] = cUpdate;
+
+        ServerReferencesMoveSnapshot::Encode(i, cUpdate, segments[i], scratch);
+        snapshot.Segments.push_back(&segments[i]);
+    }
+
+    Buffer expectedBuff(1 << 16);
+    Buffer::Writer expectedWriter(&expectedBuff);
+    expected.Serialize(expectedWriter);
+
+    Buffer buff(1 << 16);
+    Buffer::Writer writer(&buff);
+    snapshot.Serialize(writer);
+
+    // Positions are quantized on the wire so compare what clients decode
+    const auto cExpected = Decode(expectedBuff);
+
+    REQUIRE(writer.Size() == expectedWriter.Size());
+    REQUIRE(Decode(buff) == cExpected);
+
+    GIVEN("A reused snapshot")
+    {
+        snapshot.Reset(expected.Tick + 20);
+        snapshot.Segments.push_back(&segments[3]);
+
+        Buffer reusedBuff(1 << 16);
+        Buffer::Writer reusedWriter(&reusedBuff);
+        snapshot.Serialize(reusedWriter);
+
+        const auto cDecoded = Decode(reusedBuff);
+
+        REQUIRE(cDecoded.Tick == expected.Tick + 20);
+        REQUIRE(cDecoded.Updates.size() == 1);
+        REQUIRE(cDecoded.Updates.at(3) == cExpected.Updates.at(3));
+    }
+}
+
+TEST_CASE("Cached character spawn", "[encoding.snapshot]")
+{
+    CharacterSpawnRequest request;
+    request.ServerId = 1234;
+    request.FormId.BaseId = 0x14;
+    request.Position.x = 100.f;
+    request.ChangeFlags = 0xF00D;
+    request.AppearanceBuffer = String(4096, 'x');
+    request.PlayerId = 7;
+    request.IsPlayer = true;
+
+    for (auto i = 0u; i < 64; ++i)
+    {
+        Inventory::Entry entry;
+        entry.BaseId.BaseId = 0x1000 + i;
+        entry.Count = static_cast<int32_t>(i + 1);
+        entry.ExtraWorn = (i % 8) == 0;
+        request.InventoryContent.Entries.push_back(entry);
+    }
+
+    Tints::Entry tint;
+    tint.Name = "SkinTone";
+    tint.Alpha = 0.5f;
+    tint.Color = 0xFFAABB;
+    tint.Type = 2;
+    request.FaceTints.Entries.push_back(tint);
+
+    Buffer expectedBuff(1 << 16);
+    Buffer::Writer expectedWriter(&expectedBuff);
+    request.Serialize(expectedWriter);
+
+    Buffer scratch(1 << 16);
+    auto pCachedData = MakeShared<CharacterSpawnRequest::CachedData>();
+    request.EncodeCachedData(*pCachedData, scratch);
+
+    // Only the fields that are not cached are filled in by the server when the cache is used
+    CharacterSpawnRequest cachedRequest;
+    cachedRequest.ServerId = request.ServerId;
+    cachedRequest.FormId = request.FormId;
+    cachedRequest.Position = request.Position;
+    cachedRequest.PlayerId = request.PlayerId;
+    cachedRequest.IsPlayer = request.IsPlayer;
+    cachedRequest.pCachedData = pCachedData;
+
+    Buffer buff(1 << 16);
+    Buffer::Writer writer(&buff);
+    cachedRequest.Serialize(writer);
+
+    REQUIRE(writer.Size() == expectedWriter.Size());
+    REQUIRE(std::memcmp(buff.GetData(), expectedBuff.GetData(), writer.Size()) == 0);
+}
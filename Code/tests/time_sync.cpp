@@ -0,0 +1,218 @@
+#include <TiltedCore/Stl.hpp>
+
+#include <TimeSync.h>
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace TiltedPhoques;
+
+namespace
+{
+// A server clock running at its own rate from its own origin, reached over a link with random queuing delay
+struct SimulatedLink
+{
+    int64_t Offset{0};
+    double Drift{0.0};
+    uint64_t Latency{20};
+    uint64_t Jitter{0};
+    // Extra one way delay server to client, which no exchange can measure
+    uint64_t Asymmetry{0};
+    std::mt19937 Random{1234};
+
+    uint64_t ServerTick(uint64_t aLocalTick) const { return static_cast<uint64_t>(static_cast<int64_t>(std::llround(static_cast<double>(aLocalTick) * (1.0 + Drift))) + Offset); }
+
+    uint64_t Delay()
+    {
+        if (Jitter == 0)
+            return Latency;
+
+        // Queuing delay is mostly small with a long tail
+        std::exponential_distribution<double> distribution(1.0 / static_cast<double>(Jitter));
+        return Latency + static_cast<uint64_t>(distribution(Random));
+    }
+
+    void Exchange(TimeSync& aSync, uint64_t aLocalTick)
+    {
+        const auto cClientSend = aLocalTick;
+        const auto cArrival = cClientSend + Delay();
+        const auto cServerReceive = ServerTick(cArrival);
+        // Requests wait for the next server tick to be handled
+        const auto cServerSend = cServerReceive + 16;
+        const auto cClientReceive = cArrival + 16 + Delay() + Asymmetry;
+
+        REQUIRE(aSync.AddExchange(cClientSend, cServerReceive, cServerSend, cClientReceive));
+    }
+};
+
+int64_t TrueOffset(const SimulatedLink& acLink, uint64_t aLocalTick)
+{
+    return static_cast<int64_t>(acLink.ServerTick(aLocalTick)) - static_cast<int64_t>(aLocalTick);
+}
+} // namespace
+
+TEST_CASE("Single time sync exchange", "[encoding.time_sync]")
+{
+    TimeSync::Exchange exchange;
+
+    SECTION("Symmetric link")
+    {
+        // Server clock is 5000 ahead, 20 ms each way, held 4 ms
+        REQUIRE(TimeSync::Measure(1000, 6020, 6024, 1044, exchange));
+        REQUIRE(exchange.Offset == 5000);
+        REQUIRE(exchange.RoundTripTime == 40);
+        REQUIRE(exchange.LocalTick == 1044);
+    }
+
+    SECTION("Server behind the client")
+    {
+        REQUIRE(TimeSync::Measure(100000, 40030, 40030, 100060, exchange));
+        REQUIRE(exchange.Offset == -60000);
+        REQUIRE(exchange.RoundTripTime == 60);
+    }
+
+    SECTION("Inconsistent timestamps")
+    {
+        REQUIRE_FALSE(TimeSync::Measure(1000, 6020, 6100, 1044, exchange));
+        REQUIRE_FALSE(TimeSync::Measure(1000, 6020, 6010, 1044, exchange));
+        REQUIRE_FALSE(TimeSync::Measure(1000, 6020, 6024, 900, exchange));
+    }
+}
+
+TEST_CASE("Time sync estimation", "[encoding.time_sync]")
+{
+    TimeSync sync;
+
+    REQUIRE_FALSE(sync.IsSynchronized());
+    REQUIRE(sync.GetServerTick(1234) == 1234);
+
+    SECTION("Stable link")
+    {
+        SimulatedLink link;
+        link.Offset = 7'000'000;
+
+        for (uint64_t tick = 1000; tick < 20000; tick += 1000)
+            link.Exchange(sync, tick);
+
+        REQUIRE(sync.EstimateOffset(20000) == TrueOffset(link, 20000));
+        REQUIRE(sync.GetRoundTripTime() == Approx(40.f));
+        REQUIRE(sync.GetJitter() < 1.f);
+        REQUIRE(sync.GetDrift() == Approx(0.0).margin(1e-6));
+    }
+
+    SECTION("Queuing delay is filtered out")
+    {
+        SimulatedLink link;
+        link.Offset = -300'000;
+        link.Jitter = 40;
+
+        uint64_t tick = 1000;
+        for (; tick < 60000; tick += 1000)
+            link.Exchange(sync, tick);
+
+        // A single exchange can be off by tens of ms, the fastest of the window by a few
+        REQUIRE(std::abs(sync.EstimateOffset(tick) - TrueOffset(link, tick)) <= 10);
+        REQUIRE(sync.GetJitter() > 10.f);
+        REQUIRE(sync.GetMinRoundTripTime() < sync.GetRoundTripTime());
+    }
+
+    SECTION("Drift is corrected")
+    {
+        SimulatedLink link;
+        link.Offset = 50'000;
+        // 1 ms every second, a badly calibrated clock
+        link.Drift = 1e-3;
+        link.Jitter = 5;
+
+        uint64_t tick = 1000;
+        for (; tick < 60000; tick += 2000)
+            link.Exchange(sync, tick);
+
+        REQUIRE(sync.GetDrift() == Approx(1e-3).margin(2e-4));
+
+        // Ten seconds without an exchange, the drift keeps the estimate on track
+        tick += 10000;
+        REQUIRE(std::abs(sync.EstimateOffset(tick) - TrueOffset(link, tick)) <= 4);
+    }
+
+    SECTION("Asymmetric links are biased by half the difference")
+    {
+        SimulatedLink link;
+        link.Asymmetry = 30;
+
+        for (uint64_t tick = 1000; tick < 20000; tick += 1000)
+            link.Exchange(sync, tick);
+
+        REQUIRE(sync.EstimateOffset(20000) - TrueOffset(link, 20000) == -15);
+    }
+}
+
+TEST_CASE("Time sync server tick", "[encoding.time_sync]")
+{
+    TimeSync sync;
+    SimulatedLink link;
+    link.Offset = 100'000;
+
+    link.Exchange(sync, 1000);
+    REQUIRE(sync.GetServerTick(1100) == link.ServerTick(1100));
+
+    SECTION("Small corrections are slewed")
+    {
+        // The server turns out to be 40 ms further ahead
+        link.Offset += 40;
+        for (uint64_t tick = 2000; tick < 20000; tick += 1000)
+            link.Exchange(sync, tick);
+
+        uint64_t previous = sync.GetServerTick(20000);
+        uint64_t tick = 20000;
+        for (; tick < 21000; tick += 16)
+        {
+            const auto cServerTick = sync.GetServerTick(tick);
+
+            // Never backwards, never faster than 5% over real time
+            REQUIRE(cServerTick >= previous);
+            REQUIRE(cServerTick - previous <= 17);
+            previous = cServerTick;
+        }
+
+        REQUIRE(std::abs(static_cast<int64_t>(sync.GetServerTick(tick)) - static_cast<int64_t>(link.ServerTick(tick))) <= 1);
+    }
+
+    SECTION("Large errors step")
+    {
+        TimeSync stepped;
+        link.Exchange(stepped, 1000);
+        REQUIRE(stepped.GetServerTick(2000) == link.ServerTick(2000));
+
+        link.Offset += 5000;
+        link.Exchange(stepped, 3000);
+        REQUIRE(stepped.GetServerTick(3100) == link.ServerTick(3100));
+    }
+
+    SECTION("Never goes backwards")
+    {
+        uint64_t previous = sync.GetServerTick(2000);
+
+        // The server clock turns out to be 5 s behind, it is waited for instead of rewound
+        link.Offset -= 5000;
+        uint64_t frame = 3000;
+        for (; frame < 30000; frame += 16)
+        {
+            if (frame % 1000 < 16)
+                link.Exchange(sync, frame);
+
+            const auto cServerTick = sync.GetServerTick(frame);
+            REQUIRE(cServerTick >= previous);
+            previous = cServerTick;
+        }
+
+        // Caught up after holding, then slewed the rest of the way
+        REQUIRE(std::abs(static_cast<int64_t>(previous) - static_cast<int64_t>(link.ServerTick(frame))) <= 16);
+
+        sync.Reset();
+        REQUIRE_FALSE(sync.IsSynchronized());
+        REQUIRE(sync.GetExchangeCount() == 0);
+    }
+}
@@ -1,3 +1,16 @@
+-- Seeded payloads shared by the size property tests and the benchmarks
+target("TPPayloads")
+    set_kind("static")
+    set_group("Tests")
+    add_includedirs(
+        ".", "../encoding")
+    add_headerfiles("benchmarks/Payloads.h")
+    add_files("benchmarks/Payloads.cpp")
+    add_deps("SkyrimEncoding")
+    add_packages(
+        "tiltedcore",
+        "hopscotch-map",
+        "glm")
 
 target("TPTests")
     set_kind("binary")
@@ -6,10 +19,27 @@ target("TPTests")
         ".", "../encoding")
     add_headerfiles("**.h")
     add_files("*.cpp")
-    add_deps("SkyrimEncoding")
+    add_deps("SkyrimEncoding", "TPPayloads")
     add_packages(
         "tiltedcore",
         "hopscotch-map",
         "catch2",
         "mimalloc",
-        "glm")
+        "glm",
+        "zlib")
+
+target("TPBench")
+    set_kind("binary")
+    set_group("Tests")
+    add_includedirs(
+        ".", "../encoding", "../../Libraries")
+    add_headerfiles("benchmarks/*.h")
+    add_files("benchmarks/*.cpp|Payloads.cpp")
+    add_deps("SkyrimEncoding", "BaseLib", "TPPayloads")
+    add_packages(
+        "tiltedcore",
+        "hopscotch-map",
+        "mimalloc",
+        "glm",
+        "zlib",
+        "spdlog")
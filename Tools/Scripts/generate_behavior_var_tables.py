@@ -0,0 +1,165 @@
+# Generates Code/encoding/Structs/Skyrim/BehaviorVarTables.h from the animation graph descriptors next to it.
+#
+# Each descriptor lists the variables of a behavior graph in its Variables enum, the table keeps their names so
+# they can be resolved both ways, and a perfect hash over the lower case names (see BehaviorVarTable.h).
+# Run it again whenever a descriptor changes: python Tools/Scripts/generate_behavior_var_tables.py
+import os
+import re
+import sys
+
+MASK = (1 << 64) - 1
+EMPTY = None
+
+root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+descriptors_path = os.path.join(root, "Code", "encoding", "Structs", "Skyrim")
+output_path = os.path.join(descriptors_path, "BehaviorVarTables.h")
+
+def name_hash(name):
+  # Must match BehaviorVarTable::Hash, 8 little endian bytes of the folded name per round
+  data = name.lower().encode("ascii")
+  value = 0x9E3779B97F4A7C15 ^ len(data)
+  for offset in range(0, len(data), 8):
+    value = ((value ^ int.from_bytes(data[offset:offset + 8], "little")) * 0xFF51AFD7ED558CCD) & MASK
+    value ^= value >> 29
+  return mix(value)
+
+def power_of_two(value):
+  return 1 << max(0, value - 1).bit_length()
+
+def mix(value):
+  # Must match BehaviorVarTable::Mix
+  value ^= value >> 30
+  value = (value * 0xBF58476D1CE4E5B9) & MASK
+  value ^= value >> 27
+  value = (value * 0x94D049BB133111EB) & MASK
+  value ^= value >> 31
+  return value
+
+def read(path):
+  with open(path, encoding="utf-8-sig") as f:
+    return f.read()
+
+def load_descriptor(cpp_path):
+  source = read(cpp_path)
+
+  enum = re.search(r"enum Variables\s*\{(.*?)\};", source, re.S)
+  if not enum:
+    sys.exit("No Variables enum in " + cpp_path)
+
+  variables = [(int(value), name) for name, value in re.findall(r"\bk(\w+)\s*=\s*(\d+)", enum.group(1))]
+  variables.sort()
+  if [value for value, _ in variables] != list(range(len(variables))):
+    sys.exit("Variables of " + cpp_path + " don't go from 0 without gaps, values can't be indices")
+
+  # A few descriptors declare their key in the header
+  key = re.search(r"key = (\d+)", source) or re.search(r"key = (\d+)", read(cpp_path[:-4] + ".h"))
+  if not key:
+    sys.exit("No key in " + cpp_path)
+
+  names = [name for _, name in variables]
+  if len(set(name.lower() for name in names)) != len(names):
+    sys.exit("Two variables of " + cpp_path + " only differ by case, they can't share a case-insensitive table")
+
+  return int(key.group(1)), names
+
+def build_perfect_hash(names):
+  hashes = [name_hash(name) for name in names]
+  if len(set(hashes)) != len(hashes):
+    sys.exit("Hash collision between " + ", ".join(names))
+
+  # Powers of two so lookups mask instead of dividing
+  bucket_count = power_of_two((len(names) + 3) // 4)
+  slot_count = power_of_two(len(names) + len(names) // 4 + 1)
+
+  buckets = [[] for _ in range(bucket_count)]
+  for index, value in enumerate(hashes):
+    buckets[value & (bucket_count - 1)].append(index)
+
+  displacements = [0] * bucket_count
+  slots = [EMPTY] * slot_count
+
+  # Largest buckets first, they are the hardest to place
+  for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+    if not buckets[bucket]:
+      continue
+
+    for displacement in range(1 << 16):
+      candidates = [mix((hashes[index] + displacement) & MASK) & (slot_count - 1) for index in buckets[bucket]]
+      if len(set(candidates)) == len(candidates) and all(slots[slot] is EMPTY for slot in candidates):
+        break
+    else:
+      sys.exit("No displacement fits a bucket, use more slots")
+
+    displacements[bucket] = displacement
+    for index, slot in zip(buckets[bucket], candidates):
+      slots[slot] = index
+
+  # Empty slots point at the first name, which only matches a lookup that lands in its own slot
+  return displacements, [0 if slot is EMPTY else slot for slot in slots]
+
+def wrap(items, indent="    ", width=160):
+  lines = []
+  line = indent
+  for item in items:
+    if len(line) + len(item) + 2 > width and line.strip():
+      lines.append(line.rstrip())
+      line = indent
+    line += item + ", "
+  if line.strip():
+    lines.append(line.rstrip())
+  return "\n".join(lines)
+
+def main():
+  tables = []
+  for filename in sorted(os.listdir(descriptors_path)):
+    match = re.match(r"AnimationGraphDescriptor_(\w+)\.cpp$", filename)
+    if not match:
+      continue
+
+    key, names = load_descriptor(os.path.join(descriptors_path, filename))
+    displacements, slots = build_perfect_hash(names)
+    tables.append((key, match.group(1), names, displacements, slots))
+
+  tables.sort()
+
+  out = []
+  out.append("#pragma once")
+  out.append("")
+  out.append("// DO NOT EDIT, generated by Tools/Scripts/generate_behavior_var_tables.py from the descriptors of this folder")
+  out.append("")
+  out.append("#include <BehaviorVarTable.h>")
+  out.append("")
+  out.append("namespace BehaviorVarTables")
+  out.append("{")
+  for key, behavior, names, displacements, slots in tables:
+    out.append("namespace " + behavior)
+    out.append("{")
+    out.append("inline constexpr std::string_view kNames[] = {")
+    out.append(wrap('"' + name + '"' for name in names))
+    out.append("};")
+    out.append("inline constexpr std::string_view kFoldedNames[] = {")
+    out.append(wrap('"' + name.lower() + '"' for name in names))
+    out.append("};")
+    out.append("inline constexpr uint16_t kDisplacements[] = {")
+    out.append(wrap(str(value) for value in displacements))
+    out.append("};")
+    out.append("inline constexpr uint16_t kSlots[] = {")
+    out.append(wrap(str(value) for value in slots))
+    out.append("};")
+    out.append("} // namespace " + behavior)
+    out.append("")
+
+  out.append("// Sorted by key")
+  out.append("inline constexpr BehaviorVarTable kTables[] = {")
+  for key, behavior, _, _, _ in tables:
+    out.append("    {{{0}ull, {1}::kNames, {1}::kFoldedNames, {1}::kDisplacements, {1}::kSlots}},".format(key, behavior))
+  out.append("};")
+  out.append("} // namespace BehaviorVarTables")
+  out.append("")
+
+  with open(output_path, "w", newline="\n") as f:
+    f.write("\n".join(out))
+
+  print("Wrote {} tables, {} variables to {}".format(len(tables), sum(len(t[2]) for t in tables), output_path))
+
+main()
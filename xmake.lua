@@ -25,6 +25,13 @@ add_vectorexts("neon")
 -- build configurations
 add_rules("mode.debug", "mode.releasedbg", "mode.release")
 
+option("allocator")
+    set_default("default")
+    set_showmenu(true)
+    set_values("default", "mimalloc", "slab")
+    set_description("Backend behind operator new")
+option_end()
+
 if has_config("unitybuild") then
     add_rules("c.unity_build")
     add_rules("c++.unity_build", {batchsize = 12})
@@ -42,7 +49,8 @@ add_requires(
     "mem 1.0.0", 
     "glm 0.9.9+8", 
     "sentry-native 0.7.1", 
-    "zlib v1.3.1"
+    "zlib v1.3.1",
+    "sqlite3 3.43.0+200"
 )
 if is_plat("windows") then
     add_requires(
@@ -51,6 +59,10 @@ if is_plat("windows") then
     )
 end
 
+if is_config("allocator", "mimalloc") then
+    add_requires("mimalloc 2.1.7")
+end
+
 -- dependencies' dependencies version pinning
 add_requireconfs("*.mimalloc", { version = "2.1.7", override = true })
 add_requireconfs("*.cmake", { version = "3.30.2", override = true })